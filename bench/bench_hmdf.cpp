@@ -0,0 +1,76 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "synthetic.h"
+
+namespace {
+
+//...Samples per station, 10 days of 6 minute data
+constexpr size_t c_numSamples = 2400;
+
+//...Line by line reader with one CDate per sample that was used before the
+//   columnar stations
+void BM_ReadImedsLineByLine(benchmark::State &state) {
+  const size_t numStations = state.range(0);
+  const std::string filename =
+      Bench::syntheticImedsFile(numStations, c_numSamples);
+  for (auto _ : state) {
+    std::ifstream fid(filename);
+    std::string line;
+    for (size_t i = 0; i < 3; ++i) std::getline(fid, line);
+    std::vector<Adcirc::Output::HmdfStation> stations;
+    while (std::getline(fid, line)) {
+      int year, month, day, hour, minute, second;
+      double value;
+      if (Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
+              line, year, month, day, hour, minute, second, value)) {
+        stations.back().setNext(
+            Adcirc::CDate(year, month, day, hour, minute, second), value);
+      } else {
+        stations.emplace_back(1);
+      }
+    }
+    benchmark::DoNotOptimize(stations.data());
+  }
+  state.SetItemsProcessed(state.iterations() * numStations * c_numSamples);
+}
+
+void BM_ReadImeds(benchmark::State &state) {
+  const size_t numStations = state.range(0);
+  const std::string filename =
+      Bench::syntheticImedsFile(numStations, c_numSamples);
+  for (auto _ : state) {
+    Adcirc::Output::Hmdf hmdf;
+    hmdf.readImeds(filename);
+    benchmark::DoNotOptimize(hmdf.nstations());
+  }
+  state.SetItemsProcessed(state.iterations() * numStations * c_numSamples);
+}
+
+void stationCounts(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(16, 256)->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReadImedsLineByLine)->Apply(stationCounts);
+BENCHMARK(BM_ReadImeds)->Apply(stationCounts);
@@ -0,0 +1,118 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+
+#include "synthetic.h"
+
+using Adcirc::Geometry::Mesh;
+using Adcirc::Geometry::MeshFormat;
+
+namespace {
+
+void readMesh(benchmark::State &state, MeshFormat format) {
+  const size_t n = state.range(0);
+  const std::string filename = Bench::syntheticMeshFile(n, format);
+  for (auto _ : state) {
+    Mesh mesh(filename);
+    mesh.read(format);
+    benchmark::DoNotOptimize(mesh.numNodes());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void writeMesh(benchmark::State &state, MeshFormat format,
+               const std::string &extension) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  const std::string filename = Bench::scratchFile("write" + extension);
+  for (auto _ : state) {
+    mesh->write(filename, format);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+  std::remove(filename.c_str());
+}
+
+void BM_ReadMeshAscii(benchmark::State &state) {
+  readMesh(state, Adcirc::Geometry::MeshAdcirc);
+}
+
+void BM_ReadMesh2dm(benchmark::State &state) {
+  readMesh(state, Adcirc::Geometry::Mesh2DM);
+}
+
+void BM_ReadMeshNetcdf(benchmark::State &state) {
+  readMesh(state, Adcirc::Geometry::MeshDFlow);
+}
+
+void BM_WriteMeshAscii(benchmark::State &state) {
+  writeMesh(state, Adcirc::Geometry::MeshAdcirc, ".grd");
+}
+
+void BM_WriteMesh2dm(benchmark::State &state) {
+  writeMesh(state, Adcirc::Geometry::Mesh2DM, ".2dm");
+}
+
+void BM_WriteMeshNetcdf(benchmark::State &state) {
+  writeMesh(state, Adcirc::Geometry::MeshDFlow, "_net.nc");
+}
+
+void BM_WriteElementShapefile(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  const std::string filename = Bench::scratchFile("elements.shp");
+  for (auto _ : state) {
+    mesh->toElementShapefile(filename);
+  }
+  state.SetItemsProcessed(state.iterations() * mesh->numElements());
+  for (const std::string ext : {".shp", ".shx", ".dbf", ".cpg", ".prj"}) {
+    std::remove(Bench::scratchFile("elements" + ext).c_str());
+  }
+}
+
+void BM_ComputeMeshSize(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  for (auto _ : state) {
+    std::vector<double> size = mesh->computeMeshSize();
+    benchmark::DoNotOptimize(size.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_Orthogonality(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  for (auto _ : state) {
+    std::vector<std::vector<double>> o = mesh->orthogonality();
+    benchmark::DoNotOptimize(o.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReadMeshAscii)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ReadMesh2dm)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ReadMeshNetcdf)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteMeshAscii)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteMesh2dm)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteMeshNetcdf)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteElementShapefile)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ComputeMeshSize)->Apply(Bench::meshSizes);
+BENCHMARK(BM_Orthogonality)->Apply(Bench::meshSizes);
@@ -0,0 +1,56 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+
+#include "synthetic.h"
+
+using Adcirc::ModelParameters::NodalAttributes;
+
+namespace {
+
+void BM_ReadNodalAttributes(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string filename = Bench::syntheticNodalAttributesFile(n);
+  Adcirc::Geometry::Mesh *mesh = Bench::syntheticMesh(n);
+  for (auto _ : state) {
+    NodalAttributes fort13(filename, mesh);
+    fort13.read();
+    benchmark::DoNotOptimize(fort13.numNodes());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_WriteNodalAttributes(benchmark::State &state) {
+  const size_t n = state.range(0);
+  NodalAttributes fort13(Bench::syntheticNodalAttributesFile(n),
+                         Bench::syntheticMesh(n));
+  fort13.read();
+
+  const std::string filename = Bench::scratchFile("write.13");
+  for (auto _ : state) {
+    fort13.write(filename);
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+  std::remove(filename.c_str());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReadNodalAttributes)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteNodalAttributes)->Apply(Bench::meshSizes);
@@ -0,0 +1,220 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "OceanweatherDecoder.h"
+#include "boost/spirit/include/phoenix.hpp"
+#include "boost/spirit/include/qi.hpp"
+#include "synthetic.h"
+
+using Adcirc::Private::OceanweatherDecoder;
+
+namespace {
+
+//...Number of records in the synthetic Oceanweather files
+constexpr size_t c_numSnaps = 4;
+
+//...Reads the pressure block of the first record into memory
+std::string pressureBlock(size_t n) {
+  std::ifstream fid(Bench::syntheticOceanweatherFile(n, c_numSnaps, false));
+  std::string line, block;
+  std::getline(fid, line);
+  std::getline(fid, line);
+  for (size_t i = 0; i < n * n; i += OceanweatherDecoder::valuesPerLine()) {
+    std::getline(fid, line);
+    block += line + "\n";
+  }
+  return block;
+}
+
+//...Line by line Spirit parser that was used before the fixed width decoder
+void BM_DecodeOceanweatherSpirit(benchmark::State &state) {
+  namespace qi = boost::spirit::qi;
+  namespace ascii = boost::spirit::ascii;
+  namespace phoenix = boost::phoenix;
+
+  const size_t n = state.range(0);
+  const std::string block = pressureBlock(n);
+  std::vector<double> values;
+  for (auto _ : state) {
+    std::istringstream fid(block);
+    values.clear();
+    values.reserve(n * n);
+    for (size_t i = 0; i < n * n; i += OceanweatherDecoder::valuesPerLine()) {
+      std::string line;
+      std::getline(fid, line);
+      qi::phrase_parse(
+          line.begin(), line.end(),
+          (*(qi::double_[phoenix::push_back(phoenix::ref(values), qi::_1)])),
+          ascii::space);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_DecodeOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string block = pressureBlock(n);
+  std::vector<double> values;
+  for (auto _ : state) {
+    std::istringstream fid(block);
+    OceanweatherDecoder::read(fid, n * n, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+//...Reads all records of two domains
+void BM_ReadOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string pressure =
+      Bench::syntheticOceanweatherFile(n, c_numSnaps, false);
+  const std::string wind =
+      Bench::syntheticOceanweatherFile(n, c_numSnaps, true);
+  for (auto _ : state) {
+    Adcirc::Oceanweather owi;
+    owi.addDomain(pressure, wind);
+    owi.addDomain(pressure, wind);
+    for (size_t s = 0; s < c_numSnaps; ++s) {
+      owi.read();
+    }
+    owi.close();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * 3 * c_numSnaps * n * n);
+}
+
+//...Reads the first record of a single domain and returns points spread over
+//   the grid, including some outside of it
+Adcirc::OceanweatherRecord interpolationRecord(size_t n, std::vector<double> &x,
+                                               std::vector<double> &y) {
+  Adcirc::Oceanweather owi;
+  owi.addDomain(Bench::syntheticOceanweatherFile(n, c_numSnaps, false),
+                Bench::syntheticOceanweatherFile(n, c_numSnaps, true));
+  owi.read();
+  Adcirc::OceanweatherRecord record = owi.record();
+  owi.close();
+
+  const double extent = 0.01 * (n - 1);
+  x.resize(n * n);
+  y.resize(n * n);
+  for (size_t i = 0; i < n * n; ++i) {
+    x[i] = -90.05 + (extent + 0.1) * ((i * 7919) % (n * n)) / (n * n);
+    y[i] = 24.95 + (extent + 0.1) * ((i * 104729) % (n * n)) / (n * n);
+  }
+  return record;
+}
+
+//...Bilinear interpolation of each point with OceanweatherRecord::get
+void BM_InterpolateOceanweatherPointwise(benchmark::State &state) {
+  const size_t n = state.range(0);
+  std::vector<double> x, y;
+  const Adcirc::OceanweatherRecord record = interpolationRecord(n, x, y);
+  std::vector<double> p(x.size()), u(x.size()), v(x.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < x.size(); ++i) {
+      std::tie(p[i], u[i], v[i], std::ignore) = record.get(x[i], y[i]);
+    }
+    benchmark::DoNotOptimize(p.data());
+  }
+  state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+//...Interpolation with an operator built before the timed loop
+void BM_InterpolateOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  std::vector<double> x, y;
+  const Adcirc::OceanweatherRecord record = interpolationRecord(n, x, y);
+  Adcirc::OceanweatherInterpolator interp(x, y);
+  interp.build(record);
+  std::vector<double> p, u, v;
+  for (auto _ : state) {
+    interp.interpolate(record, p, u, v);
+    benchmark::DoNotOptimize(p.data());
+  }
+  state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_StormInfoOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  std::vector<double> x, y;
+  const Adcirc::OceanweatherRecord record = interpolationRecord(n, x, y);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(record.get_current_storm_info());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+//...Reads all records of two domains and extracts the storm track
+void BM_TrackOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string pressure =
+      Bench::syntheticOceanweatherFile(n, c_numSnaps, false);
+  const std::string wind =
+      Bench::syntheticOceanweatherFile(n, c_numSnaps, true);
+  for (auto _ : state) {
+    Adcirc::Oceanweather owi;
+    owi.addDomain(pressure, wind);
+    owi.addDomain(pressure, wind);
+    benchmark::DoNotOptimize(owi.track().size());
+    owi.close();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * 3 * c_numSnaps * n * n);
+}
+
+//...Scans a wind file for its snaps, or reads the index from the cache
+void BM_IndexOceanweather(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const bool cached = state.range(1) != 0;
+  const std::string wind =
+      Bench::syntheticOceanweatherFile(n, c_numSnaps, true);
+  Adcirc::OceanweatherIndex(wind, true, true);
+  for (auto _ : state) {
+    Adcirc::OceanweatherIndex index;
+    if (!cached || !index.readCache(wind)) index.build(wind, true);
+    benchmark::DoNotOptimize(index.nSnaps());
+  }
+  std::remove(Adcirc::OceanweatherIndex::cacheFilename(wind).c_str());
+}
+
+//...Grid sizes without (0) and with (1) the cached index
+void indexConfigs(benchmark::internal::Benchmark *b) {
+  for (int64_t n : {64, 256, 1024}) {
+    for (int64_t cached : {0, 1}) {
+      b->Args({n, cached});
+    }
+  }
+  b->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_DecodeOceanweatherSpirit)->Apply(Bench::meshSizes);
+BENCHMARK(BM_DecodeOceanweather)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ReadOceanweather)->Apply(Bench::meshSizes);
+BENCHMARK(BM_InterpolateOceanweatherPointwise)->Apply(Bench::meshSizes);
+BENCHMARK(BM_InterpolateOceanweather)->Apply(Bench::meshSizes);
+BENCHMARK(BM_StormInfoOceanweather)->Apply(Bench::meshSizes);
+BENCHMARK(BM_TrackOceanweather)->Apply(Bench::meshSizes);
+BENCHMARK(BM_IndexOceanweather)->Apply(indexConfigs);
@@ -0,0 +1,183 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "synthetic.h"
+
+using Adcirc::Output::ReadOutput;
+
+namespace {
+
+//...Number of records in the synthetic output files
+constexpr size_t c_numSnaps = 8;
+
+void BM_ReadOutputAscii(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string filename = Bench::syntheticOutputFile(n, c_numSnaps);
+
+  std::unique_ptr<ReadOutput> output;
+  size_t snap = c_numSnaps;
+  for (auto _ : state) {
+    if (snap == c_numSnaps) {
+      state.PauseTiming();
+      output.reset(new ReadOutput(filename));
+      output->open();
+      snap = 0;
+      state.ResumeTiming();
+    }
+    output->read();
+    snap++;
+
+    state.PauseTiming();
+    output->clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_ReadOutputAsciiRange(benchmark::State &state) {
+  const size_t n = state.range(0);
+  ReadOutput output(Bench::syntheticOutputFile(n, c_numSnaps));
+  output.open();
+
+  for (auto _ : state) {
+    Adcirc::Output::OutputSnapRange range(&output, 0, c_numSnaps);
+    for (auto &record : range) {
+      benchmark::DoNotOptimize(record.z(0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * c_numSnaps * n * n);
+}
+
+void BM_WriteOutputAscii(benchmark::State &state) {
+  const size_t n = state.range(0);
+  ReadOutput output(Bench::syntheticOutputFile(n, c_numSnaps));
+  output.open();
+  output.read();
+  output.close();
+
+  const std::string filename = Bench::scratchFile("write.63");
+  for (auto _ : state) {
+    Adcirc::Output::WriteOutput writer(filename, &output,
+                                       Bench::syntheticMesh(n));
+    writer.open();
+    writer.write(output.dataAt(0));
+    writer.close();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+  std::remove(filename.c_str());
+}
+
+//...netCDF write options compared by the netCDF benchmarks, selected by the
+//   second argument: library defaults, snap major chunks, node blocked chunks,
+//   node blocked with asynchronous writes, and the same with quantized values
+Adcirc::Output::NetcdfWriteOptions netcdfOptions(int64_t config) {
+  Adcirc::Output::NetcdfWriteOptions options;
+  if (config == 1) {
+    options.setChunkLayout(Adcirc::Output::ChunkSnapMajor);
+  } else if (config >= 2) {
+    options.setChunkLayout(Adcirc::Output::ChunkNodeBlocked);
+    options.setChunkSnaps(c_numSnaps);
+  }
+  if (config >= 3) options.setAsyncWrite(true);
+  if (config >= 4) options.setSignificantDigits(4);
+  return options;
+}
+
+void netcdfArguments(benchmark::internal::Benchmark *b) {
+  for (int64_t n : {256, 1024}) {
+    for (int64_t config = 0; config < 5; ++config) {
+      b->Args({n, config});
+    }
+  }
+  b->Unit(benchmark::kMillisecond);
+}
+
+//...Reads every record of a synthetic output file
+void readAllSnaps(ReadOutput &output) {
+  output.open();
+  for (size_t i = 0; i < output.numSnaps(); ++i) {
+    output.read(i);
+  }
+  output.close();
+}
+
+void writeNetcdf(const std::string &filename, ReadOutput &output, size_t n,
+                 const Adcirc::Output::NetcdfWriteOptions &options) {
+  Adcirc::Output::WriteOutput writer(filename, &output,
+                                     Bench::syntheticMesh(n));
+  writer.setNetcdfOptions(options);
+  writer.open();
+  for (size_t i = 0; i < output.numSnaps(); ++i) {
+    writer.write(output.data(i));
+  }
+  writer.close();
+}
+
+void BM_WriteOutputNetcdf(benchmark::State &state) {
+  const size_t n = state.range(0);
+  ReadOutput output(Bench::syntheticOutputFile(n, c_numSnaps));
+  readAllSnaps(output);
+
+  const std::string filename = Bench::scratchFile("write.63.nc");
+  const Adcirc::Output::NetcdfWriteOptions options =
+      netcdfOptions(state.range(1));
+  for (auto _ : state) {
+    writeNetcdf(filename, output, n, options);
+  }
+  state.SetItemsProcessed(state.iterations() * c_numSnaps * n * n);
+  std::remove(filename.c_str());
+}
+
+void BM_ReadTimeseriesNetcdf(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const std::string filename = Bench::scratchFile("timeseries.63.nc");
+  {
+    ReadOutput output(Bench::syntheticOutputFile(n, c_numSnaps));
+    readAllSnaps(output);
+    writeNetcdf(filename, output, n, netcdfOptions(state.range(1)));
+  }
+
+  //...A handful of stations spread over the mesh
+  std::vector<size_t> nodes;
+  for (size_t i = 0; i < 16; ++i) {
+    nodes.push_back((i * n * n) / 16);
+  }
+
+  ReadOutput output(filename);
+  output.open();
+  for (auto _ : state) {
+    Adcirc::Output::OutputTimeseries ts =
+        output.readTimeseries(nodes, 0, c_numSnaps);
+    benchmark::DoNotOptimize(ts.z(0, 0));
+  }
+  output.close();
+  state.SetItemsProcessed(state.iterations() * c_numSnaps * nodes.size());
+  std::remove(filename.c_str());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReadOutputAscii)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ReadOutputAsciiRange)->Apply(Bench::meshSizes)->UseRealTime();
+BENCHMARK(BM_WriteOutputAscii)->Apply(Bench::meshSizes);
+BENCHMARK(BM_WriteOutputNetcdf)->Apply(netcdfArguments)->UseRealTime();
+BENCHMARK(BM_ReadTimeseriesNetcdf)->Apply(netcdfArguments);
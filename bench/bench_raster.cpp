@@ -0,0 +1,76 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+
+#include "synthetic.h"
+
+using Adcirc::Geometry::Mesh;
+using Adcirc::Interpolation::Griddata;
+
+namespace {
+
+void BM_ToRaster(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  const std::vector<double> z = mesh->z();
+  const std::vector<double> extent = mesh->extent();
+  const std::string filename = Bench::scratchFile("toraster.tif");
+  for (auto _ : state) {
+    mesh->toRaster(filename, z, extent, 0.25 * Bench::syntheticResolution());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+  std::remove(filename.c_str());
+}
+
+void BM_ComputeValuesFromRaster(benchmark::State &state) {
+  const size_t n = state.range(0);
+  const auto method =
+      static_cast<Adcirc::Interpolation::Method>(state.range(1));
+  Mesh *mesh = Bench::syntheticMesh(n);
+  const std::string raster = Bench::syntheticRasterFile(n);
+
+  Griddata g(mesh, raster, Bench::syntheticEpsg());
+  g.setInterpolationFlags(method);
+  if (method == Adcirc::Interpolation::InverseDistanceWeightedNPoints ||
+      method == Adcirc::Interpolation::AverageNearestNPoints) {
+    g.setFilterSizes(16.0);
+  }
+  for (auto _ : state) {
+    std::vector<double> r = g.computeValuesFromRaster();
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void griddataArguments(benchmark::internal::Benchmark *b) {
+  using namespace Adcirc::Interpolation;
+  b->ArgNames({"n", "method"})->Unit(benchmark::kMillisecond);
+  for (long n : {64, 256, 1024}) {
+    for (long m : {Average, Nearest, Highest, PlusTwoSigma, BilskieEtAll,
+                   InverseDistanceWeighted, InverseDistanceWeightedNPoints,
+                   AverageNearestNPoints}) {
+      b->Args({n, m});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ToRaster)->Apply(Bench::meshSizes);
+BENCHMARK(BM_ComputeValuesFromRaster)->Apply(griddataArguments);
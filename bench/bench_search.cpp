@@ -0,0 +1,85 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "synthetic.h"
+
+using Adcirc::Geometry::Mesh;
+
+namespace {
+
+//...Number of locations searched in each iteration of the query benchmarks
+constexpr size_t c_numQueries = 100000;
+
+void BM_BuildNodalSearchTree(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  for (auto _ : state) {
+    mesh->buildNodalSearchTree();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_FindNearestNode(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  std::vector<double> x, y;
+  Bench::syntheticQueryPoints(n, c_numQueries, x, y);
+  mesh->buildNodalSearchTree();
+  for (auto _ : state) {
+    for (size_t i = 0; i < x.size(); ++i) {
+      benchmark::DoNotOptimize(mesh->findNearestNode(x[i], y[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_FindElement(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  std::vector<double> x, y;
+  Bench::syntheticQueryPoints(n, c_numQueries, x, y);
+  mesh->buildElementalSearchTree();
+  std::vector<double> weights;
+  for (auto _ : state) {
+    for (size_t i = 0; i < x.size(); ++i) {
+      benchmark::DoNotOptimize(mesh->findElement(x[i], y[i], weights));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+void BM_FindElements(benchmark::State &state) {
+  const size_t n = state.range(0);
+  Mesh *mesh = Bench::syntheticMesh(n);
+  std::vector<double> x, y;
+  Bench::syntheticQueryPoints(n, c_numQueries, x, y);
+  mesh->buildElementalSearchTree();
+  std::vector<double> weights;
+  for (auto _ : state) {
+    std::vector<size_t> e = mesh->findElements(x, y, weights);
+    benchmark::DoNotOptimize(e.data());
+  }
+  state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_BuildNodalSearchTree)->Apply(Bench::meshSizes);
+BENCHMARK(BM_FindNearestNode)->Apply(Bench::meshSizes);
+BENCHMARK(BM_FindElement)->Apply(Bench::meshSizes);
+BENCHMARK(BM_FindElements)->Apply(Bench::meshSizes);
@@ -0,0 +1,69 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+//
+// Measures the raster tile cache hit rate when interpolating a land cover
+// raster to a mesh with the query points processed in their original order
+// and along space filling curves. Run from the testing directory.
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int main(int argc, char *argv[]) {
+  using namespace Adcirc::Interpolation;
+
+  const size_t cacheSize =
+      (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2) * 1024 * 1024;
+
+  Adcirc::Geometry::Mesh mesh("test_files/ms-riv.grd");
+  mesh.read();
+  mesh.defineProjection(4326, true);
+  mesh.reproject(26915);
+
+  const QueryOrder orders[] = {OriginalOrder, MortonOrder, HilbertOrder};
+  const char *names[] = {"original", "morton", "hilbert"};
+
+  std::vector<double> reference;
+  for (size_t k = 0; k < 3; ++k) {
+    Adcirc::Interpolation::Griddata g(
+        &mesh, "test_files/lulc_samplelulcraster.tif", 26915);
+    g.readLookupTable("test_files/sample_lookup.table");
+    g.setInterpolationFlags(Average);
+    g.setRasterCacheSize(cacheSize);
+    g.setQueryOrder(orders[k]);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    std::vector<double> r = g.computeValuesFromRaster(true);
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    if (k == 0) reference = r;
+    const size_t hits = g.rasterCacheHits();
+    const size_t misses = g.rasterCacheMisses();
+    std::printf("%-9s hits %8zu misses %8zu hit rate %6.3f time %8.4f s %s\n",
+                names[k], hits, misses,
+                static_cast<double>(hits) / static_cast<double>(hits + misses),
+                std::chrono::duration<double>(t1 - t0).count(),
+                r == reference ? "" : "(results differ)");
+  }
+  return 0;
+}
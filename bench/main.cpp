@@ -1,4 +1,4 @@
-//------------------------------GPL---------------------------------------//
+/*------------------------------GPL---------------------------------------//
 // This file is part of ADCIRCModules.
 //
 // (c) 2015-2019 Zachary Cobell
@@ -15,21 +15,13 @@
 //
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
-//------------------------------------------------------------------------//
-#include <QCoreApplication>
-#include <QPointer>
-#include "adcircmesh.h"
+//------------------------------------------------------------------------*/
+//
+// Throughput benchmarks for the library. The cases are spread across the
+// bench_*.cpp files and operate on synthetic data generated at run time (see
+// synthetic.h), so the suite does not require any input files. Use
+// --benchmark_filter to select a subset of the cases.
+//
 #include "benchmark/benchmark.h"
 
-static void bench_readmesh(benchmark::State &state) {
-  AdcircMesh *mesh = new AdcircMesh(std::string(
-      "/home/zcobell/Development/QADCModules/testing/test_files/ms-riv.grd"));
-  while (state.KeepRunning()) {
-    mesh->read();
-  }
-  delete mesh;
-}
-
-BENCHMARK(bench_readmesh);
-
-BENCHMARK_MAIN()
+BENCHMARK_MAIN();
@@ -0,0 +1,199 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+//
+// Compares the structure of arrays mesh storage against a replica of the
+// previous array of structures layout, where each node owned its own hash
+// buffers and each element owned a heap allocated vector of node pointers.
+// The legacy accessors are kept out of line, as they were in the library, so
+// that both sides pay the same call overhead.
+//
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+namespace {
+
+struct LegacyNode {
+  BENCH_NOINLINE double x() const { return position[0]; }
+  BENCH_NOINLINE double y() const { return position[1]; }
+  BENCH_NOINLINE double z() const { return position[2]; }
+  size_t id;
+  std::array<double, 3> position;
+  std::unique_ptr<char[]> hash;
+  std::unique_ptr<char[]> positionHash;
+  bool isBoundaryNode;
+};
+
+struct LegacyElement {
+  BENCH_NOINLINE LegacyNode *node(size_t i) const {
+    return i < nodes.size() ? nodes[i] : nullptr;
+  }
+  size_t id;
+  std::vector<LegacyNode *> nodes;
+  std::unique_ptr<char[]> hash;
+};
+
+size_t residentBytes() {
+#ifdef __linux__
+  std::ifstream f("/proc/self/statm");
+  size_t pages = 0, resident = 0;
+  f >> pages >> resident;
+  return resident * 4096;
+#else
+  return 0;
+#endif
+}
+
+template <typename F>
+double timeit(F f, size_t repeat) {
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < repeat; ++i) f();
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count() / repeat;
+}
+
+double legacyArea(const std::vector<LegacyElement> &elements) {
+  double a = 0.0;
+  for (const auto &e : elements) {
+    const LegacyNode *n0 = e.node(0);
+    const LegacyNode *n1 = e.node(1);
+    const LegacyNode *n2 = e.node(2);
+    a += 0.5 * ((n1->x() - n0->x()) * (n2->y() - n0->y()) -
+                (n2->x() - n0->x()) * (n1->y() - n0->y()));
+  }
+  return a;
+}
+
+double meshArea(Adcirc::Geometry::Mesh &mesh) {
+  double a = 0.0;
+  for (size_t i = 0; i < mesh.numElements(); ++i) {
+    const Adcirc::Geometry::Element *e = mesh.element(i);
+    const Adcirc::Geometry::Node *n0 = e->node(0);
+    const Adcirc::Geometry::Node *n1 = e->node(1);
+    const Adcirc::Geometry::Node *n2 = e->node(2);
+    a += 0.5 * ((n1->x() - n0->x()) * (n2->y() - n0->y()) -
+                (n2->x() - n0->x()) * (n1->y() - n0->y()));
+  }
+  return a;
+}
+
+double legacyZ(const std::vector<LegacyNode> &nodes) {
+  double s = 0.0;
+  for (const auto &n : nodes) s += n.z();
+  return s;
+}
+
+double meshZ(Adcirc::Geometry::Mesh &mesh) {
+  double s = 0.0;
+  for (size_t i = 0; i < mesh.numNodes(); ++i) s += mesh.node(i)->z();
+  return s;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const size_t nx = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+  const size_t ny = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+  const size_t repeat = 5;
+  const size_t nn = nx * ny;
+  const size_t ne = 2 * (nx - 1) * (ny - 1);
+
+  std::cout << "Synthetic mesh: " << nn << " nodes, " << ne << " elements"
+            << std::endl;
+
+  size_t r0 = residentBytes();
+  std::vector<LegacyNode> lnodes(nn);
+  std::vector<LegacyElement> lelements(ne);
+  for (size_t j = 0; j < ny; ++j) {
+    for (size_t i = 0; i < nx; ++i) {
+      size_t k = j * nx + i;
+      lnodes[k].id = k + 1;
+      lnodes[k].position = {static_cast<double>(i), static_cast<double>(j),
+                            static_cast<double>(k % 17)};
+      lnodes[k].isBoundaryNode = false;
+    }
+  }
+  size_t k = 0;
+  for (size_t j = 0; j + 1 < ny; ++j) {
+    for (size_t i = 0; i + 1 < nx; ++i) {
+      size_t n = j * nx + i;
+      lelements[k].id = k + 1;
+      lelements[k++].nodes = {&lnodes[n], &lnodes[n + 1], &lnodes[n + nx]};
+      lelements[k].id = k + 1;
+      lelements[k++].nodes = {&lnodes[n + 1], &lnodes[n + nx + 1],
+                              &lnodes[n + nx]};
+    }
+  }
+  size_t r1 = residentBytes();
+
+  Adcirc::Geometry::Mesh mesh;
+  mesh.resizeMesh(nn, ne, 0, 0);
+  for (size_t j = 0; j < ny; ++j) {
+    for (size_t i = 0; i < nx; ++i) {
+      size_t n = j * nx + i;
+      mesh.addNode(n, Adcirc::Geometry::Node(n + 1, static_cast<double>(i),
+                                             static_cast<double>(j),
+                                             static_cast<double>(n % 17)));
+    }
+  }
+  k = 0;
+  for (size_t j = 0; j + 1 < ny; ++j) {
+    for (size_t i = 0; i + 1 < nx; ++i) {
+      size_t n = j * nx + i;
+      mesh.addElement(k, Adcirc::Geometry::Element(
+                             k + 1, mesh.node(n), mesh.node(n + 1),
+                             mesh.node(n + nx)));
+      ++k;
+      mesh.addElement(k, Adcirc::Geometry::Element(
+                             k + 1, mesh.node(n + 1), mesh.node(n + nx + 1),
+                             mesh.node(n + nx)));
+      ++k;
+    }
+  }
+  size_t r2 = residentBytes();
+
+  double al = 0.0, am = 0.0, zl = 0.0, zm = 0.0;
+  double tal = timeit([&]() { al = legacyArea(lelements); }, repeat);
+  double tam = timeit([&]() { am = meshArea(mesh); }, repeat);
+  double tzl = timeit([&]() { zl = legacyZ(lnodes); }, repeat);
+  double tzm = timeit([&]() { zm = meshZ(mesh); }, repeat);
+
+  std::printf("%-28s %14s %14s\n", "", "legacy", "soa");
+  std::printf("%-28s %14.1f %14.1f\n", "resident memory (MB)",
+              (r1 - r0) / 1048576.0, (r2 - r1) / 1048576.0);
+  std::printf("%-28s %14.4f %14.4f\n", "element area loop (s)", tal, tam);
+  std::printf("%-28s %14.4f %14.4f\n", "node elevation loop (s)", tzl, tzm);
+  std::printf("%-28s %14.6e %14.6e\n", "area checksum", al, am);
+  std::printf("%-28s %14.6e %14.6e\n", "elevation checksum", zl, zm);
+
+  return al == am && zl == zm ? 0 : 1;
+}
@@ -0,0 +1,358 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "synthetic.h"
+
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+
+#include "OceanweatherTestFile.h"
+
+namespace {
+
+//...Lower left corner of the synthetic meshes
+constexpr double c_x0 = 400000.0;
+constexpr double c_y0 = 3300000.0;
+
+/**
+ * @brief Keeps track of the files generated by the suite and removes them
+ * when the program exits
+ */
+class ScratchFiles {
+ public:
+  ~ScratchFiles() {
+    for (const auto &f : m_files) {
+      std::remove(f.second.c_str());
+    }
+  }
+
+  bool contains(const std::string &key) const {
+    return m_files.find(key) != m_files.end();
+  }
+  const std::string &file(const std::string &key) const {
+    return m_files.at(key);
+  }
+  void add(const std::string &key, const std::string &file) {
+    m_files[key] = file;
+  }
+
+ private:
+  std::map<std::string, std::string> m_files;
+};
+
+ScratchFiles &scratchFiles() {
+  static ScratchFiles files;
+  return files;
+}
+
+/**
+ * @brief Deterministic offset in [-0.5, 0.5) used to jitter the mesh nodes
+ */
+double jitter(size_t i, size_t j, size_t component) {
+  size_t h = (i * 73856093) ^ (j * 19349663) ^ (component * 83492791);
+  h ^= h >> 13;
+  h *= 0x5bd1e995;
+  h ^= h >> 15;
+  return static_cast<double>(h % 10007) / 10007.0 - 0.5;
+}
+
+double bathymetry(double x, double y) {
+  return 10.0 + 5.0 * std::sin((x - c_x0) / 1000.0) *
+                    std::cos((y - c_y0) / 1500.0);
+}
+
+std::string meshExtension(Adcirc::Geometry::MeshFormat format) {
+  switch (format) {
+    case Adcirc::Geometry::MeshAdcirc:
+      return ".grd";
+    case Adcirc::Geometry::Mesh2DM:
+      return ".2dm";
+    case Adcirc::Geometry::MeshDFlow:
+      return "_net.nc";
+    case Adcirc::Geometry::MeshAdcircBinary:
+      return ".adcmesh";
+    default:
+      adcircmodules_throw_exception("Bench: Unsupported mesh format");
+      return std::string();
+  }
+}
+
+}  // namespace
+
+namespace Bench {
+
+/**
+ * @brief Returns the name used for a file generated by the suite. Files are
+ * written to the working directory and removed when the program exits
+ */
+std::string scratchFile(const std::string &name) {
+  return "adcmod_bench_" + name;
+}
+
+/**
+ * @brief Returns a synthetic mesh with n x n nodes. The mesh is generated
+ * once for each size and then reused
+ */
+Adcirc::Geometry::Mesh *syntheticMesh(size_t n) {
+  static std::map<size_t, std::unique_ptr<Adcirc::Geometry::Mesh>> meshes;
+  auto it = meshes.find(n);
+  if (it != meshes.end()) return it->second.get();
+
+  const size_t nn = n * n;
+  const size_t ne = 2 * (n - 1) * (n - 1);
+  const double dx = syntheticResolution();
+
+  std::unique_ptr<Adcirc::Geometry::Mesh> mesh(new Adcirc::Geometry::Mesh());
+  mesh->setMeshHeaderString("Synthetic benchmark mesh");
+  mesh->resizeMesh(nn, ne, 0, 0);
+
+  for (size_t j = 0; j < n; ++j) {
+    for (size_t i = 0; i < n; ++i) {
+      double x = c_x0 + i * dx;
+      double y = c_y0 + j * dx;
+      if (i > 0 && j > 0 && i + 1 < n && j + 1 < n) {
+        x += 0.4 * dx * jitter(i, j, 0);
+        y += 0.4 * dx * jitter(i, j, 1);
+      }
+      const size_t k = j * n + i;
+      mesh->addNode(k, Adcirc::Geometry::Node(k + 1, x, y, bathymetry(x, y)));
+    }
+  }
+
+  size_t k = 0;
+  for (size_t j = 0; j + 1 < n; ++j) {
+    for (size_t i = 0; i + 1 < n; ++i) {
+      const size_t c = j * n + i;
+      mesh->addElement(k, Adcirc::Geometry::Element(
+                              k + 1, mesh->node(c), mesh->node(c + 1),
+                              mesh->node(c + n + 1)));
+      ++k;
+      mesh->addElement(k, Adcirc::Geometry::Element(
+                              k + 1, mesh->node(c), mesh->node(c + n + 1),
+                              mesh->node(c + n)));
+      ++k;
+    }
+  }
+  mesh->defineProjection(syntheticEpsg(), false);
+
+  Adcirc::Geometry::Mesh *m = mesh.get();
+  meshes[n] = std::move(mesh);
+  return m;
+}
+
+/**
+ * @brief Returns the name of a file containing the synthetic mesh of size n
+ * in the specified format
+ */
+std::string syntheticMeshFile(size_t n, Adcirc::Geometry::MeshFormat format) {
+  const std::string key =
+      "mesh_" + std::to_string(n) + "_" + std::to_string(format);
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename =
+      scratchFile("mesh_" + std::to_string(n) + meshExtension(format));
+  syntheticMesh(n)->write(filename, format);
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Returns the name of an ASCII formatted scalar output file (fort.63)
+ * for the synthetic mesh of size n
+ */
+std::string syntheticOutputFile(size_t n, size_t numSnaps) {
+  const std::string key =
+      "fort63_" + std::to_string(n) + "_" + std::to_string(numSnaps);
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename =
+      scratchFile("fort_" + std::to_string(n) + ".63");
+  FILE *f = std::fopen(filename.c_str(), "w");
+  if (!f) adcircmodules_throw_exception("Bench: Could not open output file");
+
+  const size_t nn = n * n;
+  std::fprintf(f, "Synthetic benchmark output\n");
+  std::fprintf(f, "%11zu%11zu    3600.000000       360           1\n",
+               numSnaps, nn);
+  for (size_t s = 0; s < numSnaps; ++s) {
+    std::fprintf(f, "%20.10f%11zu\n", 3600.0 * (s + 1), 360 * (s + 1));
+    for (size_t i = 0; i < nn; ++i) {
+      const double v = std::sin(0.001 * i + 0.5 * s);
+      std::fprintf(f, "%10zu    %20.10e\n", i + 1, v);
+    }
+  }
+  std::fclose(f);
+
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Returns the name of a nodal attributes file (fort.13) for the
+ * synthetic mesh of size n containing a scalar and a 12 value attribute, each
+ * with non-default values at half of the nodes
+ */
+std::string syntheticNodalAttributesFile(size_t n) {
+  const std::string key = "fort13_" + std::to_string(n);
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename =
+      scratchFile("fort_" + std::to_string(n) + ".13");
+  FILE *f = std::fopen(filename.c_str(), "w");
+  if (!f) {
+    adcircmodules_throw_exception("Bench: Could not open nodal attribute file");
+  }
+
+  const size_t nn = n * n;
+  std::fprintf(f, "Synthetic benchmark nodal attributes\n%zu\n2\n", nn);
+  std::fprintf(f, "mannings_n_at_sea_floor\nunitless\n1\n0.020000\n");
+  std::fprintf(f, "surface_directional_effective_roughness_length\nm\n12\n");
+  for (size_t k = 0; k < 12; ++k) std::fprintf(f, "0.000000 ");
+  std::fprintf(f, "\n");
+
+  std::fprintf(f, "mannings_n_at_sea_floor\n%zu\n", (nn + 1) / 2);
+  for (size_t i = 0; i < nn; i += 2) {
+    std::fprintf(f, "%zu %f\n", i + 1, 0.02 + 0.001 * (i % 50));
+  }
+  std::fprintf(f, "surface_directional_effective_roughness_length\n%zu\n",
+               (nn + 1) / 2);
+  for (size_t i = 0; i < nn; i += 2) {
+    std::fprintf(f, "%zu", i + 1);
+    for (size_t k = 0; k < 12; ++k) {
+      std::fprintf(f, " %f", 0.001 * ((i + k) % 30));
+    }
+    std::fprintf(f, "\n");
+  }
+  std::fclose(f);
+
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Returns the name of an Oceanweather (OWI) pressure or wind file with
+ * numSnaps records on an n x n grid, written 8 values per line in the 8F10.4
+ * layout
+ */
+std::string syntheticOceanweatherFile(size_t n, size_t numSnaps, bool wind) {
+  const std::string ext = wind ? ".win" : ".pre";
+  const std::string key =
+      "owi_" + std::to_string(n) + "_" + std::to_string(numSnaps) + ext;
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename = scratchFile("owi_" + std::to_string(n) + ext);
+  OceanweatherTestFile::Spec spec;
+  spec.wind = wind;
+  spec.numRecords = numSnaps;
+  spec.intervalHours = 1;
+  spec.grid = [=](size_t) {
+    return OceanweatherTestFile::Grid{n, n, 0.01, 25.0, -90.0};
+  };
+  spec.value = [=](size_t s, size_t field, size_t i) {
+    const double r = 0.002 * static_cast<double>(i % n + i / n + s);
+    return wind ? 30.0 * std::sin(r + field - 1) : 1013.0 - 40.0 * std::cos(r);
+  };
+  if (!OceanweatherTestFile::write(filename, spec)) {
+    adcircmodules_throw_exception("Bench: Could not open Oceanweather file");
+  }
+
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Returns the name of an IMEDS file with numStations stations, each
+ * with numSamples samples 6 minutes apart
+ */
+std::string syntheticImedsFile(size_t numStations, size_t numSamples) {
+  const std::string key = "imeds_" + std::to_string(numStations) + "_" +
+                          std::to_string(numSamples);
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename = scratchFile(key + ".imeds");
+  FILE *f = std::fopen(filename.c_str(), "w");
+  if (!f) {
+    adcircmodules_throw_exception("Bench: Could not open IMEDS file");
+  }
+
+  std::fprintf(f, "%% IMEDS generic format\n");
+  std::fprintf(f, "%% year month day hour min sec value\n");
+  std::fprintf(f, "%% Bench UTC MSL m\n");
+  for (size_t s = 0; s < numStations; ++s) {
+    std::fprintf(f, "station_%zu   %16.10f   %16.10f\n", s,
+                 29.0 + 0.001 * s, -90.0 - 0.001 * s);
+    Adcirc::CDate d(2005, 8, 1);
+    for (size_t i = 0; i < numSamples; ++i) {
+      std::fprintf(f, "%04d %02d %02d %02d %02d %02d %10.6e\n", d.year(),
+                   d.month(), d.day(), d.hour(), d.minute(), d.second(),
+                   std::sin(0.01 * static_cast<double>(i + s)));
+      d += Adcirc::CDate::minutes(6);
+    }
+  }
+  std::fclose(f);
+
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Returns the name of a GeoTIFF raster of the synthetic mesh
+ * bathymetry with four pixels per node spacing
+ */
+std::string syntheticRasterFile(size_t n) {
+  const std::string key = "raster_" + std::to_string(n);
+  if (scratchFiles().contains(key)) return scratchFiles().file(key);
+
+  const std::string filename =
+      scratchFile("raster_" + std::to_string(n) + ".tif");
+  Adcirc::Geometry::Mesh *mesh = syntheticMesh(n);
+  mesh->toRaster(filename, mesh->z(), mesh->extent(),
+                 0.25 * syntheticResolution());
+
+  scratchFiles().add(key, filename);
+  return filename;
+}
+
+/**
+ * @brief Generates uniformly distributed query locations over the extent of
+ * the synthetic mesh of size n
+ */
+void syntheticQueryPoints(size_t n, size_t numPoints, std::vector<double> &x,
+                          std::vector<double> &y) {
+  const double span = (n - 1) * syntheticResolution();
+  std::mt19937 gen(n);
+  std::uniform_real_distribution<double> dist(0.0, span);
+  x.resize(numPoints);
+  y.resize(numPoints);
+  for (size_t i = 0; i < numPoints; ++i) {
+    x[i] = c_x0 + dist(gen);
+    y[i] = c_y0 + dist(gen);
+  }
+}
+
+/**
+ * @brief Registers the mesh sizes (nodes per side) used by the suite
+ */
+void meshSizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace Bench
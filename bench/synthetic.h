@@ -0,0 +1,57 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_BENCH_SYNTHETIC_H
+#define ADCMOD_BENCH_SYNTHETIC_H
+
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "benchmark/benchmark.h"
+
+//...Synthetic data used by the benchmark suite so that it can be run without
+//   any external files. Meshes are structured grids of n x n nodes, split into
+//   triangles, with the interior nodes jittered so that the elements are not
+//   all identical. Coordinates are in meters (EPSG:26915).
+namespace Bench {
+
+constexpr int syntheticEpsg() { return 26915; }
+
+//...Spacing between the nodes of a synthetic mesh before they are jittered
+constexpr double syntheticResolution() { return 50.0; }
+
+Adcirc::Geometry::Mesh *syntheticMesh(size_t n);
+
+std::string syntheticMeshFile(size_t n, Adcirc::Geometry::MeshFormat format);
+std::string syntheticOutputFile(size_t n, size_t numSnaps);
+std::string syntheticNodalAttributesFile(size_t n);
+std::string syntheticRasterFile(size_t n);
+std::string syntheticOceanweatherFile(size_t n, size_t numSnaps, bool wind);
+std::string syntheticImedsFile(size_t numStations, size_t numSamples);
+
+void syntheticQueryPoints(size_t n, size_t numPoints, std::vector<double> &x,
+                          std::vector<double> &y);
+
+std::string scratchFile(const std::string &name);
+
+void meshSizes(benchmark::internal::Benchmark *b);
+
+}  // namespace Bench
+
+#endif  // ADCMOD_BENCH_SYNTHETIC_H
@@ -0,0 +1,59 @@
+if(BUILD_BENCHMARKS)
+  file(MAKE_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/benchmarks)
+
+  set(BENCH_LIST meshstorage.cpp)
+  if(GDAL_FOUND)
+    set(BENCH_LIST ${BENCH_LIST} griddataordering.cpp)
+  endif()
+
+  foreach(BENCHFILE ${BENCH_LIST})
+    get_filename_component(BENCHNAME ${BENCHFILE} NAME_WE)
+    set(BENCHTARGET bench_${BENCHNAME})
+    add_executable(${BENCHTARGET} ${CMAKE_SOURCE_DIR}/bench/${BENCHFILE})
+    add_dependencies(${BENCHTARGET} adcircmodules_static)
+    target_link_libraries(${BENCHTARGET} adcircmodules_static
+                          adcircmodules_interface)
+    target_include_directories(${BENCHTARGET}
+                               PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/src)
+    set_target_properties(
+      ${BENCHTARGET} PROPERTIES RUNTIME_OUTPUT_DIRECTORY
+                                ${CMAKE_BINARY_DIR}/benchmarks)
+  endforeach()
+
+  # ############################################################################
+  # Google Benchmark throughput suite
+  # ############################################################################
+  find_package(benchmark)
+  if(benchmark_FOUND)
+    set(BENCH_SUITE_LIST
+        main.cpp
+        synthetic.cpp
+        bench_hmdf.cpp
+        bench_mesh.cpp
+        bench_nodalattributes.cpp
+        bench_oceanweather.cpp
+        bench_output.cpp
+        bench_search.cpp)
+    if(GDAL_FOUND)
+      set(BENCH_SUITE_LIST ${BENCH_SUITE_LIST} bench_raster.cpp)
+    endif()
+    set(BENCH_SUITE_SOURCES)
+    foreach(BENCHFILE ${BENCH_SUITE_LIST})
+      list(APPEND BENCH_SUITE_SOURCES ${CMAKE_SOURCE_DIR}/bench/${BENCHFILE})
+    endforeach()
+
+    add_executable(bench ${BENCH_SUITE_SOURCES})
+    add_dependencies(bench adcircmodules_static)
+    target_link_libraries(bench adcircmodules_static adcircmodules_interface
+                          benchmark::benchmark)
+    target_include_directories(
+      bench PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/src
+                    ${CMAKE_CURRENT_SOURCE_DIR}/testing/support)
+    set_target_properties(bench PROPERTIES RUNTIME_OUTPUT_DIRECTORY
+                                           ${CMAKE_BINARY_DIR}/benchmarks)
+  else()
+    message(
+      WARNING
+        "Google Benchmark not found. The bench target will not be available.")
+  endif()
+endif()
@@ -8,6 +8,15 @@ if(ENABLE_GDAL)
   if(NOT GDAL_FOUND)
     message(WARNING "GDAL Library not found. These functions will be disabled.")
   endif(NOT GDAL_FOUND)
+  if(ADCIRCMODULES_ENABLE_OGR_WRITER
+     AND GDAL_FOUND
+     AND GDAL_VERSION
+     AND GDAL_VERSION VERSION_LESS 3.1)
+    message(
+      FATAL_ERROR
+        "GeoPackage and FlatGeobuf output requires GDAL 3.1 or later. Found ${GDAL_VERSION}"
+    )
+  endif()
 else(ENABLE_GDAL)
   message(
     WARNING
@@ -6,6 +6,8 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Logging.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FileTypes.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Formatting.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/AsciiWriter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/AsciiOutputReader.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Mesh.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Node.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Element.cpp
@@ -20,14 +22,20 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/CDate.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Boundary.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FileIO.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MappedFile.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/StringConversion.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodalAttributes.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Attribute.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/AttributeMetadata.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputMetadata.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputRecord.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputRecordPool.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputTimeseries.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputSnapRange.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ReadOutput.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/WriteOutput.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/NetcdfWriteOptions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/NetcdfBlockWriter.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsRecord.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsOutput.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ElementTable.cpp
@@ -36,9 +44,16 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Multithreading.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Constants.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshPrivate.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/FeatureWriter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ShapefileWriter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshStorage.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ElementLocator.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshRasterizer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterProjection.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Projection.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/KDTree.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/KDTreePrivate.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/SpaceFillingCurve.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Topology.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FaceTable.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ProgressBar.cpp
@@ -46,7 +61,10 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsRecordPrivate.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodalAttributesPrivate.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherHeader.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherIndex.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherDecoder.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherRecord.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherInterpolator.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Oceanweather.cpp)
 if(GDAL_FOUND)
   set(ADCIRCMODULES_SOURCES
@@ -55,6 +73,8 @@ if(GDAL_FOUND)
       ${CMAKE_CURRENT_SOURCE_DIR}/src/GriddataPrivate.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/Pixel.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterData.cpp
+      ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterTileCache.cpp
+      ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterFileWriter.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataAverage.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataNearest.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataHighest.cpp
@@ -64,8 +84,14 @@ if(GDAL_FOUND)
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataInverseDistanceWeightedNPoints.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataAverageNearestNPoints.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataWindRoughness.cpp
+      ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/WindRoughnessKernel.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataMethod.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherTrackInfo.h)
+  if(ADCIRCMODULES_ENABLE_OGR_WRITER)
+    set(ADCIRCMODULES_SOURCES
+        ${ADCIRCMODULES_SOURCES}
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/OgrFeatureWriter.cpp)
+  endif(ADCIRCMODULES_ENABLE_OGR_WRITER)
 endif(GDAL_FOUND)
 
 set(HEADER_LIST
@@ -91,11 +117,16 @@ set(HEADER_LIST
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FileIO.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Projection.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Mesh.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterProjection.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodalAttributes.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Node.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ReadOutput.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/WriteOutput.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/NetcdfWriteOptions.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputRecord.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputSpan.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputTimeseries.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputSnapRange.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputMetadata.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Meshchecker.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ElementTable.h
@@ -112,7 +143,9 @@ set(HEADER_LIST
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Point.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Oceanweather.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherHeader.h
-    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherRecord.h)
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherIndex.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherRecord.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OceanweatherInterpolator.h)
 # ##############################################################################
 
 add_library(adcircmodules_interface INTERFACE)
@@ -158,6 +191,12 @@ if(ADCIRCMODULES_ENABLE_STACK_TRACE)
                              PRIVATE ADCIRCMODULES_FORCE_SANITIZER_STACK_TRACE)
 endif()
 
+if(GDAL_FOUND AND ADCIRCMODULES_ENABLE_OGR_WRITER)
+  message(STATUS "ADCIRCModules will write GeoPackage and FlatGeobuf files")
+  target_compile_definitions(adcircmodules_objectlib
+                             PRIVATE ADCMOD_ENABLE_OGR_WRITER)
+endif()
+
 if(GDAL_FOUND)
   target_compile_definitions(adcircmodules_objectlib PRIVATE "USE_GDAL")
   target_include_directories(adcircmodules_objectlib
@@ -165,6 +204,8 @@ if(GDAL_FOUND)
   link_directories(${GDAL_LIBPATH})
   target_link_libraries(adcircmodules_interface INTERFACE ${GDAL_LIBRARY})
   set(HEADER_LIST ${HEADER_LIST} ${CMAKE_SOURCE_DIR}/src/RasterData.h
+                  ${CMAKE_SOURCE_DIR}/src/RasterTileCache.h
+                  ${CMAKE_SOURCE_DIR}/src/RasterWindow.h
                   ${CMAKE_SOURCE_DIR}/src/Griddata.h)
 endif(GDAL_FOUND)
 
@@ -235,6 +276,9 @@ if(OPENMP_FOUND)
                         INTERFACE ${OpenMP_CXX_LIB_NAMES} ${OpenMP_CXX_FLAGS})
 endif(OPENMP_FOUND)
 
+find_package(Threads REQUIRED)
+target_link_libraries(adcircmodules_interface INTERFACE ${CMAKE_THREAD_LIBS_INIT})
+
 if(HDF5_FOUND)
   target_compile_definitions(adcircmodules_objectlib
                              PRIVATE HAVE_HDF5 ${HDF5_DEFINITIONS})
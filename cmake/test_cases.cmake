@@ -5,20 +5,36 @@ if(UNIX OR CYGWIN)
 
     set(TEST_LIST
         cxx_readmesh.cpp
+        cxx_readmeshmapped.cpp
         cxx_readnetcdfmesh.cpp
         cxx_writemesh.cpp
         cxx_writeshapefile.cpp
+        cxx_shapefileexport.cpp
         cxx_projectmesh.cpp
         cxx_nodalSearchTree.cpp
         cxx_elementalSearchTree.cpp
+        cxx_elementlocator.cpp
+        cxx_meshrasterizer.cpp
+        cxx_rasterprojection.cpp
+        cxx_findelements.cpp
         cxx_readfort13_wmesh.cpp
         cxx_readfort13_womesh.cpp
         cxx_fort13findatt.cpp
+        cxx_fort13values.cpp
+        cxx_readoceanweather.cpp
+        cxx_oceanweatherinterpolator.cpp
+        cxx_oceanweatherindex.cpp
+        cxx_oceanweathertrack.cpp
+        cxx_readimeds.cpp
         cxx_readasciifull.cpp
         cxx_readasciisparse.cpp
         cxx_readmaxele.cpp
         cxx_readnetcdfmaxele.cpp
         cxx_readasciivector.cpp
+        cxx_readasciirandom.cpp
+        cxx_readtimeseries.cpp
+        cxx_readsnaprange.cpp
+        cxx_recordstorage.cpp
         cxx_readnetcdf.cpp
         cxx_readnetcdfvector.cpp
         cxx_readHarmonicsElevation.cpp
@@ -29,25 +45,30 @@ if(UNIX OR CYGWIN)
         cxx_read2dm.cpp
         cxx_kdtree.cpp
         cxx_writeasciifull.cpp
+        cxx_asciiwriter.cpp
         cxx_writeasciisparse.cpp
         cxx_writeasciifullvector.cpp
         cxx_writeasciisparsevector.cpp
         cxx_writenetcdf.cpp
+        cxx_writenetcdfoptions.cpp
         cxx_writenetcdfvector.cpp
         cxx_writehdf5.cpp
         cxx_makemesh.cpp
         cxx_date.cpp
         cxx_topolgy.cpp
+        cxx_spacefillingcurve.cpp
         )
 
     if(ENABLE_GDAL)
       set(TEST_LIST
           ${TEST_LIST} cxx_interpolateRaster.cpp cxx_interpolateManning.cpp
-          cxx_interpolateDwind.cpp cxx_writeraster.cpp)
+          cxx_interpolateDwind.cpp cxx_writeraster.cpp
+          cxx_rastertilecache.cpp cxx_windkernel.cpp)
     endif(ENABLE_GDAL)
 
     if(OpenSSL_FOUND)
-      set(TEST_LIST ${TEST_LIST} cxx_hash.cpp cxx_hashmesh.cpp)
+      set(TEST_LIST ${TEST_LIST} cxx_hash.cpp cxx_hashmesh.cpp
+          cxx_meshcache.cpp)
     endif(OpenSSL_FOUND)
 
     foreach(TESTFILE ${TEST_LIST})
@@ -56,7 +77,9 @@ if(UNIX OR CYGWIN)
                      ${CMAKE_SOURCE_DIR}/testing/cxx_tests/${TESTFILE})
       add_dependencies(${TESTNAME} adcircmodules_static)
       target_link_libraries(${TESTNAME} adcircmodules_static adcircmodules_interface)
-      target_include_directories(${TESTNAME} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/src) 
+      target_include_directories(${TESTNAME} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/src
+                                 ${CMAKE_CURRENT_SOURCE_DIR}/thirdparty/shapelib
+                                 ${CMAKE_CURRENT_SOURCE_DIR}/testing/support)
       set_target_properties(
         ${TESTNAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY
                                ${CMAKE_BINARY_DIR}/cxx_testcases)
@@ -42,6 +42,15 @@ Hash::~Hash() { this->m_impl.reset(nullptr); }
  */
 void Hash::addData(const std::string &s) { this->m_impl->addData(s); }
 
+/**
+ * @brief Adds a block of raw data to the hash
+ * @param[in] data pointer to the data to add to the hash
+ * @param[in] length number of bytes to add
+ */
+void Hash::addData(const char *data, size_t length) {
+  this->m_impl->addData(data, length);
+}
+
 /**
  * @brief Returns a char pointer to the hash
  * @return char pointer with hash data
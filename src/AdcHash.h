@@ -52,6 +52,7 @@ class Hash {
                     Adcirc::Cryptography::AdcircDefaultHash);
   ~Hash();
   void addData(const std::string &s);
+  void addData(const char *data, size_t length);
   char *getHash();
 
   Adcirc::Cryptography::HashType hashType() const;
@@ -48,6 +48,10 @@ void HashPrivate::addData(const std::string &s) {
   adcircmodules_throw_exception("OpenSSL library not enabled.");
 }
 
+void HashPrivate::addData(const char *data, size_t length) {
+  adcircmodules_throw_exception("OpenSSL library not enabled.");
+}
+
 char *HashPrivate::getHash() {
   adcircmodules_throw_exception("OpenSSL library not enabled.");
   return nullptr;
@@ -79,25 +83,29 @@ void HashPrivate::initialize() {
 }
 
 void HashPrivate::addData(const std::string &s) {
+  this->addData(s.data(), s.length());
+}
+
+void HashPrivate::addData(const char *data, size_t length) {
   if (!this->m_started) this->initialize();
-  (this->*addDataPtr)(s);
+  (this->*addDataPtr)(data, length);
   return;
 }
 
 char *HashPrivate::getHash() { return (this->*getHashPtr)(); }
 
-void HashPrivate::addDataMd5(const std::string &data) {
-  MD5_Update(&this->m_md5ctx, &data[0], data.length());
+void HashPrivate::addDataMd5(const char *data, size_t length) {
+  MD5_Update(&this->m_md5ctx, data, length);
   return;
 }
 
-void HashPrivate::addDataSha1(const std::string &data) {
-  SHA1_Update(&this->m_sha1ctx, &data[0], data.length());
+void HashPrivate::addDataSha1(const char *data, size_t length) {
+  SHA1_Update(&this->m_sha1ctx, data, length);
   return;
 }
 
-void HashPrivate::addDataSha256(const std::string &data) {
-  SHA256_Update(&this->m_sha256ctx, &data[0], data.length());
+void HashPrivate::addDataSha256(const char *data, size_t length) {
+  SHA256_Update(&this->m_sha256ctx, data, length);
   return;
 }
 
@@ -36,6 +36,7 @@ class HashPrivate {
   explicit HashPrivate(Adcirc::Cryptography::HashType h =
                            Adcirc::Cryptography::AdcircDefaultHash);
   void addData(const std::string &s);
+  void addData(const char *data, size_t length);
   char *getHash();
 
   Adcirc::Cryptography::HashType hashType() const;
@@ -48,9 +49,9 @@ class HashPrivate {
 #ifdef ADCMOD_HAVE_OPENSSL
   void initialize();
 
-  void addDataMd5(const std::string &data);
-  void addDataSha1(const std::string &data);
-  void addDataSha256(const std::string &data);
+  void addDataMd5(const char *data, size_t length);
+  void addDataSha1(const char *data, size_t length);
+  void addDataSha256(const char *data, size_t length);
 
   char *getSha256();
   char *getSha1();
@@ -58,7 +59,7 @@ class HashPrivate {
 
   char *getDigest(size_t length, unsigned char data[]);
 
-  void (HashPrivate::*addDataPtr)(const std::string &data);
+  void (HashPrivate::*addDataPtr)(const char *data, size_t length);
   char *(HashPrivate::*getHashPtr)();
 
   MD5_CTX m_md5ctx;
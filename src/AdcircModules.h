@@ -40,12 +40,16 @@
 #include "Multithreading.h"
 #include "NodalAttributes.h"
 #include "NodeTable.h"
+#include "OutputSnapRange.h"
 #include "Projection.h"
+#include "RasterProjection.h"
 #include "ReadOutput.h"
 #include "Topology.h"
 #include "WriteOutput.h"
 #include "Oceanweather.h"
 #include "OceanweatherHeader.h"
+#include "OceanweatherIndex.h"
 #include "OceanweatherRecord.h"
+#include "OceanweatherInterpolator.h"
 
 #endif  // ADCMOD_ADCIRCMODULES_H
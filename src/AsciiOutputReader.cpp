@@ -0,0 +1,512 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "AsciiOutputReader.h"
+
+#include <algorithm>
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "StringConversion.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Private;
+using Adcirc::Output::OutputRecord;
+
+/**
+ * @brief Constructor which maps the file into memory
+ * @param[in] filename ASCII output file to read
+ */
+AsciiOutputReader::AsciiOutputReader(const std::string &filename)
+    : m_file(filename),
+      m_numSnaps(0),
+      m_numNodes(0),
+      m_prefetchDepth(2),
+      m_nextSequential(0) {
+  //...Records begin after the title line and the file information line
+  this->m_offsets.push_back(this->m_file.nextLine(this->m_file.nextLine(0)));
+}
+
+/**
+ * @brief Destructor. Waits for any records being decoded in the background
+ */
+AsciiOutputReader::~AsciiOutputReader() { this->cancelPrefetch(); }
+
+/**
+ * @brief Returns one of the two lines which precede the first record
+ * @param[in] index 0 for the file title or 1 for the file information line
+ * @return text of the line without the line terminator
+ */
+std::string AsciiOutputReader::headerLine(size_t index) const {
+  size_t position = 0;
+  for (size_t i = 0; i < index; ++i) {
+    position = this->m_file.nextLine(position);
+  }
+  size_t end = this->m_file.lineEnd(position);
+  if (end > position && this->m_file.data()[end - 1] == '\r') end--;
+  return std::string(this->m_file.data() + position,
+                     this->m_file.data() + end);
+}
+
+/**
+ * @brief Sets the dimensions read from the file header. Must be called before
+ * any records are read. Records decoded in the background are discarded if
+ * the layout changes.
+ * @param[in] numSnaps number of records in the file
+ * @param[in] numNodes number of nodes in each record
+ * @param[in] metadata metadata assigned to the records
+ */
+void AsciiOutputReader::setLayout(
+    size_t numSnaps, size_t numNodes,
+    const Adcirc::Output::OutputMetadata &metadata) {
+  if (numSnaps == this->m_numSnaps && numNodes == this->m_numNodes &&
+      this->m_metadata == metadata) {
+    return;
+  }
+  this->cancelPrefetch();
+  this->m_spare.clear();
+  this->m_numSnaps = numSnaps;
+  this->m_numNodes = numNodes;
+  this->m_metadata = metadata;
+}
+
+/**
+ * @brief Number of records decoded ahead of the caller when records are read
+ * sequentially
+ */
+size_t AsciiOutputReader::prefetchDepth() const {
+  return this->m_prefetchDepth;
+}
+
+/**
+ * @brief Sets the number of records decoded ahead of the caller when records
+ * are read sequentially. A depth of zero disables prefetching.
+ * @param[in] depth number of records
+ */
+void AsciiOutputReader::setPrefetchDepth(size_t depth) {
+  this->m_prefetchDepth = depth;
+  while (this->m_pending.size() > depth) {
+    this->m_pending.back()->task.wait();
+    this->m_pending.pop_back();
+  }
+}
+
+/**
+ * @brief Number of records whose position in the file is known
+ */
+size_t AsciiOutputReader::numIndexedRecords() const {
+  return this->m_offsets.size() - 1;
+}
+
+/**
+ * @brief Reads a record from the file
+ * @param[in] snap zero based record index
+ * @return decoded record
+ */
+OutputRecord AsciiOutputReader::read(size_t snap) {
+  if (snap >= this->m_numSnaps) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Attempt to read past last record in file");
+  }
+
+  int numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+
+  OutputRecord record;
+  if (!this->m_pending.empty() && this->m_pending.front()->snap == snap) {
+    std::unique_ptr<Prefetch> p = std::move(this->m_pending.front());
+    this->m_pending.pop_front();
+    this->finishPrefetch(*p, numThreads);
+    record = std::move(p->record);
+  } else {
+    this->cancelPrefetch();
+    if (!this->indexRecords(snap)) {
+      adcircmodules_throw_exception(
+          "ReadOutput: Attempt to read past last record in file");
+    }
+    record = this->newRecord(snap);
+    this->decode(this->m_offsets[snap], this->m_offsets[snap + 1], numThreads,
+                 record);
+  }
+
+  if (snap == this->m_nextSequential) {
+    this->schedulePrefetch(snap + 1);
+  }
+  this->m_nextSequential = snap + 1;
+
+  return record;
+}
+
+/**
+ * @brief Reads a record from the file into an existing record, reusing its
+ * storage
+ * @param[in] snap zero based record index
+ * @param[in,out] record record holding numNodes values with the dimension of
+ * the file
+ * @param[in] numThreads number of threads used to parse the values, or zero
+ * to use the OpenMP default
+ *
+ * Records are not decoded ahead of the caller when this function is used.
+ */
+void AsciiOutputReader::read(size_t snap, OutputRecord &record,
+                             int numThreads) {
+  if (snap >= this->m_numSnaps) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Attempt to read past last record in file");
+  }
+
+  if (numThreads <= 0) {
+    numThreads = 1;
+#ifdef _OPENMP
+    numThreads = omp_get_max_threads();
+#endif
+  }
+
+  this->cancelPrefetch();
+  if (!this->indexRecords(snap)) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Attempt to read past last record in file");
+  }
+  record.setRecord(snap);
+  this->decode(this->m_offsets[snap], this->m_offsets[snap + 1], numThreads,
+               record);
+}
+
+/**
+ * @brief Returns a record which is no longer needed by the caller so that its
+ * storage can be reused for a later snap
+ * @param[in] record record to reuse. Records which do not match the layout of
+ * the file are discarded.
+ */
+void AsciiOutputReader::recycle(OutputRecord &&record) {
+  if (this->m_spare.size() <= this->m_prefetchDepth &&
+      record.numNodes() == this->m_numNodes &&
+      *record.metadata() == this->m_metadata) {
+    this->m_spare.push_back(std::move(record));
+  }
+}
+
+/**
+ * @brief Returns a record with storage for the values of a snap, reusing a
+ * recycled record when one is available
+ * @param[in] snap zero based record index
+ */
+OutputRecord AsciiOutputReader::newRecord(size_t snap) {
+  if (!this->m_spare.empty()) {
+    OutputRecord record = std::move(this->m_spare.back());
+    this->m_spare.pop_back();
+    record.setRecord(snap);
+    return record;
+  }
+  Adcirc::Output::OutputMetadata metadata = this->m_metadata;
+  return OutputRecord(snap, this->m_numNodes, metadata);
+}
+
+/**
+ * @brief Parses the line which begins a record
+ * @param[in] position byte offset of the line
+ * @return time, iteration, number of value lines and default value
+ *
+ * Sparse files list the number of non-default values and the default value on
+ * this line. Full files contain one line for every node.
+ */
+AsciiOutputReader::RecordHeader AsciiOutputReader::parseRecordHeader(
+    size_t position) const {
+  std::string line(this->m_file.data() + position,
+                   this->m_file.data() + this->m_file.lineEnd(position));
+  std::vector<std::string> list;
+  FileIO::Generic::splitString(line, list);
+  if (list.size() < 2) {
+    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+  }
+
+  RecordHeader h;
+  bool ok;
+  h.time = StringConversion::stringToDouble(list[0], ok);
+  if (!ok) {
+    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+  }
+
+  h.iteration = StringConversion::stringToInt(list[1], ok);
+  if (!ok) {
+    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+  }
+
+  h.numValues = this->m_numNodes;
+  h.defaultValue = Adcirc::Output::defaultOutputValue();
+
+  if (list.size() > 3) {
+    h.numValues = StringConversion::stringToSizet(list[2], ok);
+    if (!ok || h.numValues > this->m_numNodes) {
+      adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+    }
+
+    h.defaultValue = StringConversion::stringToDouble(list[3], ok);
+    if (!ok) {
+      adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+    }
+  }
+  return h;
+}
+
+/**
+ * @brief Extends the index of record positions until it includes a record
+ * @param[in] snap zero based record index
+ * @return true if the record is present in the file
+ *
+ * Records are located by counting lines, so the index is extended only as far
+ * as the records which have been requested.
+ */
+bool AsciiOutputReader::indexRecords(size_t snap) {
+  while (this->numIndexedRecords() <= snap &&
+         this->numIndexedRecords() < this->m_numSnaps) {
+    size_t position = this->m_offsets.back();
+    if (position >= this->m_file.size()) return false;
+
+    RecordHeader h = this->parseRecordHeader(position);
+    position = this->m_file.nextLine(position);
+    for (size_t i = 0; i < h.numValues; ++i) {
+      if (position >= this->m_file.size()) {
+        adcircmodules_throw_exception(
+            "ReadOutput: Unexpected end of file in ascii record");
+      }
+      position = this->m_file.nextLine(position);
+    }
+    this->m_offsets.push_back(position);
+  }
+  return this->numIndexedRecords() > snap;
+}
+
+/**
+ * @brief Parses the line which begins a record and sets the record up to
+ * receive its values
+ * @param[in] first byte offset of the record
+ * @param[in,out] record record with storage for numNodes values. The time,
+ * iteration and default value are replaced and the values are reset.
+ * @return header of the record
+ */
+AsciiOutputReader::RecordHeader AsciiOutputReader::beginRecord(
+    size_t first, OutputRecord &record) const {
+  RecordHeader h = this->parseRecordHeader(first);
+  record.setTime(h.time);
+  record.setIteration(h.iteration);
+  record.setDefaultValue(h.defaultValue);
+  record.fill(h.defaultValue);
+  return h;
+}
+
+/**
+ * @brief Decodes one block of the value lines of a record
+ * @param[in] first byte offset of the record
+ * @param[in] last byte offset following the record
+ * @param[in] block index of the block
+ * @param[in] numBlocks number of blocks the record is split into
+ * @param[in,out] record record to place the values in
+ * @param[out] count number of lines decoded
+ * @return false if a line could not be decoded
+ *
+ * Each block begins at the first line starting within its share of the bytes
+ * so that every line is decoded by exactly one block. Blocks of the same
+ * record may be decoded concurrently.
+ */
+bool AsciiOutputReader::decodeBlock(size_t first, size_t last, int block,
+                                    int numBlocks, OutputRecord &record,
+                                    size_t &count) const {
+  const size_t body = this->m_file.nextLine(first);
+  auto blockStart = [&](int k) -> size_t {
+    if (k == 0) return body;
+    if (k == numBlocks) return last;
+    size_t p = body + (last - body) * k / numBlocks;
+    return std::min(last, this->m_file.nextLine(p - 1));
+  };
+  size_t p = blockStart(block);
+  const size_t end = blockStart(block + 1);
+  const bool isVector = this->m_metadata.isVector();
+
+  count = 0;
+  while (p < end) {
+    const size_t e = std::min(end, this->m_file.lineEnd(p));
+    const char *lineFirst = this->m_file.data() + p;
+    const char *lineLast = this->m_file.data() + e;
+    size_t id;
+    if (isVector) {
+      double v1, v2;
+      if (!FileIO::AdcircIO::splitStringAttribute2Format(lineFirst, lineLast,
+                                                         id, v1, v2) ||
+          id == 0 || id > this->m_numNodes) {
+        return false;
+      }
+      record.set(id - 1, v1, v2);
+    } else {
+      double v1;
+      if (!FileIO::AdcircIO::splitStringAttribute1Format(lineFirst, lineLast,
+                                                         id, v1) ||
+          id == 0 || id > this->m_numNodes) {
+        return false;
+      }
+      record.set(id - 1, v1);
+    }
+    count++;
+    p = e + 1;
+  }
+  return true;
+}
+
+/**
+ * @brief Decodes a record from the mapped file into an existing record
+ * @param[in] first byte offset of the record
+ * @param[in] last byte offset following the record
+ * @param[in] numThreads number of threads used to parse the values
+ * @param[in,out] record record with storage for numNodes values. The time,
+ * iteration, default value and values are replaced.
+ *
+ * The values are split into blocks of whole lines which are parsed
+ * concurrently. This function does not modify the reader and may be called
+ * from background threads.
+ */
+void AsciiOutputReader::decode(size_t first, size_t last, int numThreads,
+                               OutputRecord &record) const {
+  const RecordHeader h = this->beginRecord(first, record);
+  const int numBlocks = numThreads > 1 && h.numValues > 1 ? numThreads : 1;
+
+  bool error = false;
+  size_t count = 0;
+
+#pragma omp parallel for num_threads(numBlocks) schedule(static, 1) \
+    reduction(|| : error) reduction(+ : count)
+  for (int b = 0; b < numBlocks; ++b) {
+    size_t n = 0;
+    if (!this->decodeBlock(first, last, b, numBlocks, record, n)) {
+      error = true;
+    }
+    count += n;
+  }
+
+  if (error || count != h.numValues) {
+    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+  }
+}
+
+/**
+ * @brief Decodes blocks of a prefetched record until none are left to claim
+ * @param[in,out] p record being decoded
+ */
+void AsciiOutputReader::decodeBlocks(Prefetch &p) const {
+  for (int b = p.nextBlock++; b < p.numBlocks; b = p.nextBlock++) {
+    size_t n = 0;
+    if (!this->decodeBlock(p.first, p.last, b, p.numBlocks, p.record, n)) {
+      p.error = true;
+    }
+    p.count += n;
+  }
+}
+
+/**
+ * @brief Completes a prefetched record which the caller has requested
+ * @param[in,out] p record being decoded
+ * @param[in] numThreads number of threads which decode the blocks the
+ * background thread has not reached
+ */
+void AsciiOutputReader::finishPrefetch(Prefetch &p, int numThreads) const {
+  try {
+    p.preparedFuture.get();
+  } catch (const std::exception &) {
+    p.task.wait();
+    throw;
+  }
+
+#pragma omp parallel num_threads(numThreads)
+  this->decodeBlocks(p);
+
+  //...The background thread may still be decoding the block it claimed last
+  p.task.wait();
+  if (p.error || p.count != p.header.numValues) {
+    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
+  }
+}
+
+/**
+ * @brief Starts decoding the records following a sequential read
+ * @param[in] snap first record which the caller is expected to request next
+ *
+ * Each record is split into more blocks than the caller has threads, so that
+ * the blocks left when the record is requested can be shared by the team of
+ * the caller.
+ */
+void AsciiOutputReader::schedulePrefetch(size_t snap) {
+  int numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  const int numBlocks = numThreads > 1 ? 4 * numThreads : 1;
+
+  size_t next = this->m_pending.empty() ? snap
+                                        : this->m_pending.back()->snap + 1;
+  while (this->m_pending.size() < this->m_prefetchDepth &&
+         next < this->m_numSnaps) {
+    //...Errors locating a record are reported when it is requested
+    try {
+      if (!this->indexRecords(next)) break;
+    } catch (const std::exception &) {
+      break;
+    }
+
+    std::unique_ptr<Prefetch> p(new Prefetch());
+    p->snap = next;
+    p->first = this->m_offsets[next];
+    p->last = this->m_offsets[next + 1];
+    p->numBlocks = numBlocks;
+    p->record = this->newRecord(next);
+    p->nextBlock = 0;
+    p->count = 0;
+    p->error = false;
+    p->preparedFuture = p->prepared.get_future();
+
+    Prefetch *job = p.get();
+    p->task = std::async(std::launch::async, [this, job]() {
+      try {
+        job->header = this->beginRecord(job->first, job->record);
+      } catch (const std::exception &) {
+        job->prepared.set_exception(std::current_exception());
+        return;
+      }
+      job->prepared.set_value();
+      this->decodeBlocks(*job);
+    });
+    this->m_pending.push_back(std::move(p));
+    next++;
+  }
+}
+
+/**
+ * @brief Discards records being decoded in the background after waiting for
+ * them to complete. Their storage is kept for reuse.
+ */
+void AsciiOutputReader::cancelPrefetch() {
+  //...Errors are reported if the record is requested again
+  for (auto &p : this->m_pending) {
+    p->task.wait();
+    this->recycle(std::move(p->record));
+  }
+  this->m_pending.clear();
+}
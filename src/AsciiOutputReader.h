@@ -0,0 +1,138 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_ASCIIOUTPUTREADER_H
+#define ADCMOD_ASCIIOUTPUTREADER_H
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "MappedFile.h"
+#include "OutputMetadata.h"
+#include "OutputRecord.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class AsciiOutputReader
+ * @author Zachary Cobell
+ * @brief Random access reader for ADCIRC ASCII output files (fort.63, fort.64)
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The file is memory mapped and the byte offset of each record is indexed as
+ * the records are reached, so any snap can be read without parsing the
+ * records before it. The lines of a record are split into blocks that are
+ * parsed concurrently when OpenMP is available.
+ *
+ * When records are read in order, the records following the one returned are
+ * decoded on background threads so that parsing overlaps whatever the caller
+ * does with the current record. Each of these records is split into blocks
+ * that a single background thread decodes one at a time, so it does not
+ * compete with the threads of the caller. When the caller requests a record
+ * that is still being decoded, the OpenMP team of the caller decodes the
+ * remaining blocks. The number of records decoded ahead is bounded by the
+ * prefetch depth.
+ *
+ */
+class AsciiOutputReader {
+ public:
+  explicit AsciiOutputReader(const std::string &filename);
+  ~AsciiOutputReader();
+
+  std::string headerLine(size_t index) const;
+
+  void setLayout(size_t numSnaps, size_t numNodes,
+                 const Adcirc::Output::OutputMetadata &metadata);
+
+  size_t prefetchDepth() const;
+  void setPrefetchDepth(size_t depth);
+
+  size_t numIndexedRecords() const;
+
+  Adcirc::Output::OutputRecord read(size_t snap);
+  void read(size_t snap, Adcirc::Output::OutputRecord &record,
+            int numThreads = 0);
+  void recycle(Adcirc::Output::OutputRecord &&record);
+
+ private:
+  struct RecordHeader {
+    double time;
+    long long iteration;
+    size_t numValues;
+    double defaultValue;
+  };
+
+  /// Record decoded in the background. Blocks are claimed through nextBlock
+  /// by the background thread and by the caller once the record is requested
+  struct Prefetch {
+    size_t snap;
+    size_t first;
+    size_t last;
+    int numBlocks;
+    Adcirc::Output::OutputRecord record;
+    RecordHeader header;
+    std::atomic<int> nextBlock;
+    std::atomic<size_t> count;
+    std::atomic<bool> error;
+    std::promise<void> prepared;
+    std::future<void> preparedFuture;
+    std::future<void> task;
+  };
+
+  RecordHeader parseRecordHeader(size_t position) const;
+  bool indexRecords(size_t snap);
+  Adcirc::Output::OutputRecord newRecord(size_t snap);
+  RecordHeader beginRecord(size_t first,
+                           Adcirc::Output::OutputRecord &record) const;
+  bool decodeBlock(size_t first, size_t last, int block, int numBlocks,
+                   Adcirc::Output::OutputRecord &record, size_t &count) const;
+  void decode(size_t first, size_t last, int numThreads,
+              Adcirc::Output::OutputRecord &record) const;
+  void decodeBlocks(Prefetch &p) const;
+  void finishPrefetch(Prefetch &p, int numThreads) const;
+  void schedulePrefetch(size_t snap);
+  void cancelPrefetch();
+
+  Adcirc::FileIO::MappedFile m_file;
+  Adcirc::Output::OutputMetadata m_metadata;
+  size_t m_numSnaps;
+  size_t m_numNodes;
+  size_t m_prefetchDepth;
+  size_t m_nextSequential;
+
+  /// Starting byte offset of each indexed record. The final entry is the
+  /// position following the last indexed record.
+  std::vector<size_t> m_offsets;
+
+  std::deque<std::unique_ptr<Prefetch>> m_pending;
+
+  /// Records returned by the caller which are reused for later snaps
+  std::vector<Adcirc::Output::OutputRecord> m_spare;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_ASCIIOUTPUTREADER_H
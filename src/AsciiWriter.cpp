@@ -0,0 +1,258 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "AsciiWriter.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+using namespace Adcirc::Private;
+
+//...Exact powers of ten representable as doubles
+static constexpr double c_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+static constexpr int c_maxPow10 = 22;
+
+//...Largest number of significant digits formatted without snprintf
+static constexpr int c_maxDigits = 15;
+
+//...Relative error of a single rounded double precision operation, padded.
+//   The fast paths are used only when the scaled value is further than this
+//   (times its magnitude) from a rounding boundary
+static constexpr double c_roundingTolerance = 4.0e-16;
+
+static constexpr uint64_t c_pow10Integer[] = {1ULL,
+                                              10ULL,
+                                              100ULL,
+                                              1000ULL,
+                                              10000ULL,
+                                              100000ULL,
+                                              1000000ULL,
+                                              10000000ULL,
+                                              100000000ULL,
+                                              1000000000ULL,
+                                              10000000000ULL,
+                                              100000000000ULL,
+                                              1000000000000ULL,
+                                              10000000000000ULL,
+                                              100000000000000ULL,
+                                              1000000000000000ULL,
+                                              10000000000000000ULL};
+
+/**
+ * @brief Writes the digits of value, zero padded to at least minDigits
+ * @return end of the written text
+ */
+static char *writeDigits(char *p, uint64_t value, int minDigits = 1) {
+  char tmp[24];
+  int n = 0;
+  do {
+    tmp[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (n < minDigits) tmp[n++] = '0';
+  while (n > 0) *p++ = tmp[--n];
+  return p;
+}
+
+/**
+ * @brief Right aligns the text in [start, end) to the field width, as printf
+ * does for a width without flags
+ */
+static char *pad(char *start, char *end, int width) {
+  const int len = static_cast<int>(end - start);
+  if (len >= width) return end;
+  const int shift = width - len;
+  std::memmove(start + shift, start, len);
+  std::memset(start, ' ', shift);
+  return end + shift;
+}
+
+/**
+ * @brief Rounds a non-negative scaled value to the nearest integer
+ * @param[in] m value to round, carrying a rounding error of about
+ * c_roundingTolerance * m
+ * @param[out] result rounded value
+ * @return false if m is too close to halfway between two integers for the
+ * rounding to be decided exactly
+ */
+static bool roundScaled(double m, uint64_t &result) {
+  const double r = std::floor(m);
+  const double f = m - r;
+  if (std::abs(f - 0.5) <= c_roundingTolerance * m + 1e-300) return false;
+  result = static_cast<uint64_t>(r) + (f > 0.5 ? 1 : 0);
+  return true;
+}
+
+AsciiWriter::AsciiWriter(std::ostream &stream) : m_stream(stream) {}
+
+/**
+ * @brief Writes a string to the stream
+ */
+void AsciiWriter::write(const std::string &s) {
+  m_stream.write(s.data(), s.size());
+}
+
+/**
+ * @brief Number of chunks of lines formatted concurrently
+ */
+size_t AsciiWriter::numChunks(size_t n) {
+#ifdef _OPENMP
+  if (n > 1) return static_cast<size_t>(std::max(1, omp_get_max_threads()));
+#endif
+  return 1;
+}
+
+/**
+ * @brief Formats an integer as printf("%*lld", width, value)
+ * @return end of the formatted text
+ */
+char *AsciiWriter::integer(char *p, long long value, int width) {
+  char *start = p;
+  uint64_t u;
+  if (value < 0) {
+    *p++ = '-';
+    u = static_cast<uint64_t>(-(value + 1)) + 1;
+  } else {
+    u = static_cast<uint64_t>(value);
+  }
+  return pad(start, writeDigits(p, u), width);
+}
+
+/**
+ * @brief Formats an unsigned integer as printf("%*llu", width, value)
+ * @return end of the formatted text
+ */
+char *AsciiWriter::unsignedInteger(char *p, unsigned long long value,
+                                   int width) {
+  return pad(p, writeDigits(p, value), width);
+}
+
+/**
+ * @brief Copies a null terminated string
+ * @return end of the copied text
+ */
+char *AsciiWriter::text(char *p, const char *s) {
+  const size_t n = std::strlen(s);
+  std::memcpy(p, s, n);
+  return p + n;
+}
+
+/**
+ * @brief Formats a value as printf("%*.*e", width, precision, value)
+ * @return end of the formatted text
+ */
+char *AsciiWriter::scientific(char *p, double value, int width,
+                              int precision) {
+  const double a = std::abs(value);
+  if (std::isfinite(a) && a > 0.0 && precision < c_maxDigits) {
+    //...Scale the value so that its integer part holds precision+1 digits,
+    //   using a single rounded multiplication or division by an exact power
+    //   of ten
+    int e10 = static_cast<int>(std::floor(std::log10(a)));
+    for (int attempt = 0; attempt < 2; ++attempt) {
+      const int shift = precision - e10;
+      if (shift > c_maxPow10 || shift < -c_maxPow10) break;
+      const double m = shift >= 0 ? a * c_pow10[shift] : a / c_pow10[-shift];
+      if (m < c_pow10[precision]) {
+        e10--;
+        continue;
+      }
+      if (m >= c_pow10[precision + 1]) {
+        e10++;
+        continue;
+      }
+
+      uint64_t digits;
+      if (!roundScaled(m, digits)) break;
+      int exponent = e10;
+      if (digits == c_pow10Integer[precision + 1]) {
+        digits = c_pow10Integer[precision];
+        exponent++;
+      }
+
+      char *start = p;
+      if (std::signbit(value)) *p++ = '-';
+      const uint64_t lead = digits / c_pow10Integer[precision];
+      *p++ = static_cast<char>('0' + lead);
+      if (precision > 0) {
+        *p++ = '.';
+        p = writeDigits(p, digits - lead * c_pow10Integer[precision],
+                        precision);
+      }
+      *p++ = 'e';
+      *p++ = exponent < 0 ? '-' : '+';
+      p = writeDigits(p, static_cast<uint64_t>(std::abs(exponent)), 2);
+      return pad(start, p, width);
+    }
+  } else if (a == 0.0 && precision < c_maxDigits) {
+    char *start = p;
+    if (std::signbit(value)) *p++ = '-';
+    *p++ = '0';
+    if (precision > 0) {
+      *p++ = '.';
+      p = writeDigits(p, 0, precision);
+    }
+    p = AsciiWriter::text(p, "e+00");
+    return pad(start, p, width);
+  }
+
+  char buffer[AsciiWriter::maxLineLength()];
+  const int n =
+      std::snprintf(buffer, sizeof(buffer), "%*.*e", width, precision, value);
+  std::memcpy(p, buffer, n);
+  return p + n;
+}
+
+/**
+ * @brief Formats a value as printf("%*.*f", width, precision, value)
+ * @return end of the formatted text
+ */
+char *AsciiWriter::fixed(char *p, double value, int width, int precision) {
+  const double a = std::abs(value);
+  //...The integer and fractional parts of a are separated exactly, so only
+  //   the scaling of the fractional part is rounded
+  if (a < 4503599627370496.0 && precision <= c_maxDigits) {
+    uint64_t whole = static_cast<uint64_t>(a);
+    const double m = (a - static_cast<double>(whole)) * c_pow10[precision];
+    uint64_t fraction;
+    if (roundScaled(m, fraction)) {
+      if (fraction == c_pow10Integer[precision]) {
+        fraction = 0;
+        whole++;
+      }
+      char *start = p;
+      if (std::signbit(value)) *p++ = '-';
+      p = writeDigits(p, whole);
+      if (precision > 0) {
+        *p++ = '.';
+        p = writeDigits(p, fraction, precision);
+      }
+      return pad(start, p, width);
+    }
+  }
+
+  char buffer[AsciiWriter::maxLineLength()];
+  const int n =
+      std::snprintf(buffer, sizeof(buffer), "%*.*f", width, precision, value);
+  std::memcpy(p, buffer, std::min<int>(n, sizeof(buffer) - 1));
+  return p + std::min<int>(n, sizeof(buffer) - 1);
+}
@@ -0,0 +1,141 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_ASCIIWRITER_H
+#define ADCMOD_ASCIIWRITER_H
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class AsciiWriter
+ * @author Zachary Cobell
+ * @brief Buffered writer for large line oriented ASCII files
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Lines are formatted directly into byte buffers, with blocks of lines
+ * formatted concurrently when OpenMP is available, and the buffers are then
+ * written to the stream in order.
+ *
+ * The formatting routines produce the same bytes as the equivalent printf
+ * conversions. Numbers are formatted using integer arithmetic when the
+ * rounding of the last digit can be decided exactly and fall back to
+ * snprintf otherwise, so output is identical to the printf/boost::format
+ * based output written previously.
+ *
+ */
+class AsciiWriter {
+ public:
+  /// Space that must be available in the buffer before a line is formatted
+  static constexpr size_t maxLineLength() { return 4096; }
+
+  explicit AsciiWriter(std::ostream &stream);
+
+  void write(const std::string &s);
+
+  template <typename LineFormatter>
+  void writeLines(size_t n, LineFormatter formatter);
+
+  static char *integer(char *p, long long value, int width);
+  static char *unsignedInteger(char *p, unsigned long long value, int width);
+  static char *scientific(char *p, double value, int width, int precision);
+  static char *fixed(char *p, double value, int width, int precision);
+  static char *text(char *p, const char *s);
+
+ private:
+  static size_t numChunks(size_t n);
+
+  template <typename LineFormatter>
+  static void formatLines(std::vector<char> &buffer, size_t &length,
+                          size_t first, size_t last, LineFormatter &formatter);
+
+  std::ostream &m_stream;
+  std::vector<std::vector<char>> m_buffers;
+  std::vector<size_t> m_lengths;
+};
+
+/**
+ * @brief Formats lines first to last - 1 into the buffer, growing the buffer
+ * when less than maxLineLength bytes remain
+ */
+template <typename LineFormatter>
+void AsciiWriter::formatLines(std::vector<char> &buffer, size_t &length,
+                              size_t first, size_t last,
+                              LineFormatter &formatter) {
+  length = 0;
+  for (size_t i = first; i < last; ++i) {
+    if (buffer.size() - length < AsciiWriter::maxLineLength()) {
+      buffer.resize(std::max(2 * buffer.size(),
+                             length + AsciiWriter::maxLineLength()));
+    }
+    char *start = buffer.data() + length;
+    length += formatter(start, i) - start;
+  }
+}
+
+/**
+ * @brief Writes n lines to the stream
+ * @param n number of lines
+ * @param formatter callable with the signature char*(char *p, size_t i) that
+ * formats line i at p and returns the end of the formatted text. A line may
+ * be skipped by returning p. At most maxLineLength bytes may be written.
+ *
+ * The formatter is called concurrently for different lines and must not
+ * modify shared state.
+ */
+template <typename LineFormatter>
+void AsciiWriter::writeLines(size_t n, LineFormatter formatter) {
+  //...Lines formatted by each chunk in a pass
+  constexpr size_t chunkSize = 16384;
+
+  const size_t nChunks = AsciiWriter::numChunks(n);
+  if (m_buffers.size() < nChunks) {
+    m_buffers.resize(nChunks);
+    m_lengths.resize(nChunks);
+  }
+
+  for (size_t start = 0; start < n; start += nChunks * chunkSize) {
+    const long long nc = static_cast<long long>(
+        std::min(nChunks, (n - start + chunkSize - 1) / chunkSize));
+#pragma omp parallel for schedule(static, 1) if (nc > 1)
+    for (long long c = 0; c < nc; ++c) {
+      const size_t first = start + static_cast<size_t>(c) * chunkSize;
+      const size_t last = std::min(n, first + chunkSize);
+      AsciiWriter::formatLines(m_buffers[c], m_lengths[c], first, last,
+                               formatter);
+    }
+    for (long long c = 0; c < nc; ++c) {
+      m_stream.write(m_buffers[c].data(), m_lengths[c]);
+    }
+  }
+}
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_ASCIIWRITER_H
@@ -81,8 +81,6 @@ CDate::CDate(const std::chrono::system_clock::time_point &t) { this->set(t); }
 
 CDate::CDate(const std::vector<int> &v) { this->set(v); }
 
-CDate::CDate(const CDate &d) { this->set(d.get()); }
-
 CDate::CDate(int year, int month, int day, int hour, int minute, int second,
              int millisecond) {
   this->set(year, month, day, hour, minute, second, millisecond);
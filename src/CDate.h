@@ -50,12 +50,13 @@ class CDate {
   CDate();
   explicit CDate(const std::chrono::system_clock::time_point &t);
   explicit CDate(const std::vector<int> &v);
-  CDate(const CDate &d);
+  CDate(const CDate &d) = default;
   explicit CDate(int year, int month = 1, int day = 1, int hour = 0,
                  int minute = 0, int second = 0, int millisecond = 0);
 
 #ifndef SWIG
   //...operator overloads
+  CDate &operator=(const CDate &d) = default;
   bool operator<(const CDate &d) const;
   bool operator==(const CDate &d) const;
   bool operator!=(const CDate &d) const;
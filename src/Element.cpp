@@ -18,26 +18,36 @@
 //------------------------------------------------------------------------*/
 #include "Element.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "AdcHash.h"
+#include "AsciiWriter.h"
 #include "Constants.h"
+#include "Formatting.h"
 #include "Logging.h"
+#include "MeshStorage.h"
 #include "boost/format.hpp"
 #include "boost/geometry.hpp"
 
 using namespace Adcirc::Geometry;
+using Adcirc::Private::ElementData;
+using Adcirc::Private::MeshStorage;
 namespace bg = boost::geometry;
 typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
 typedef bg::model::polygon<point_t> polygon_t;
 
+/**
+ * @brief Node pointers of a default constructed element
+ */
+static Node *const c_emptyElementNodes[4] = {nullptr, nullptr, nullptr,
+                                             nullptr};
+
 /**
  * @brief Default constructor
  */
-Element::Element()
-    : m_id(std::numeric_limits<size_t>::max()),
-      m_nodes{nullptr, nullptr, nullptr},
-      m_hash(nullptr) {}
+Element::Element() : m_storage(nullptr), m_data(nullptr) {}
 
 /**
  * @brief Constructor using references to three Node objects
@@ -47,7 +57,8 @@ Element::Element()
  * @param[in] n3 pointer to node 3
  */
 Element::Element(size_t id, Node *n1, Node *n2, Node *n3)
-    : m_id(id), m_nodes{n1, n2, n3}, m_hash(nullptr) {}
+    : m_storage(nullptr),
+      m_data(new ElementData{id, 3, {n1, n2, n3, nullptr}, nullptr}) {}
 
 /**
  * @brief Constructor using references to three Node objects
@@ -58,7 +69,15 @@ Element::Element(size_t id, Node *n1, Node *n2, Node *n3)
  * @param[in] n4 pointer to node 4
  */
 Element::Element(size_t id, Node *n1, Node *n2, Node *n3, Node *n4)
-    : m_id(id), m_nodes{n1, n2, n3, n4}, m_hash(nullptr) {}
+    : m_storage(nullptr),
+      m_data(new ElementData{id, 4, {n1, n2, n3, n4}, nullptr}) {}
+
+/**
+ * @brief Destructor
+ */
+Element::~Element() {
+  if (this->m_storage == nullptr) delete this->m_data;
+}
 
 /**
  * @brief Element::elementCopier
@@ -66,29 +85,113 @@ Element::Element(size_t id, Node *n1, Node *n2, Node *n3, Node *n4)
  * @param[in] b element to copy
  */
 void Element::elementCopier(Element *a, const Element *b) {
-  a->m_id = b->id();
-  a->m_nodes.resize(b->n());
-  for (size_t i = 0; i < b->n(); ++i) {
-    a->m_nodes[i] = b->node(i);
+  if (a->m_storage == nullptr && b->m_storage == nullptr &&
+      b->m_data == nullptr) {
+    delete a->m_data;
+    a->m_data = nullptr;
+    return;
   }
+  a->resetHash();
+  a->setId(b->id());
+  a->setSize(b->n());
+  std::copy(b->nodePointers(), b->nodePointers() + b->n(), a->nodePointers());
 }
 
 /**
  * @brief Copy constructor
  * @param[in] e element to copy
+ *
+ * The copy is never part of a mesh, even if the original element is
  */
-Element::Element(const Element &e) { Element::elementCopier(this, &e); }
+Element::Element(const Element &e) : m_storage(nullptr), m_data(nullptr) {
+  Element::elementCopier(this, &e);
+}
 
 /**
  * @brief Copy assignment operator
  * @param[in] e element to copy
- * @return copied element reference
+ * @return reference to copied element
+ *
+ * If this element is part of a mesh, the values are written to the mesh
  */
 Element &Element::operator=(const Element &e) {
-  Element::elementCopier(this, &e);
+  if (this != &e) Element::elementCopier(this, &e);
   return *this;
 }
 
+/**
+ * @brief Returns the values of an element that is not part of a mesh,
+ * allocating them if required
+ * @return pointer to the element values
+ */
+ElementData *Element::data() {
+  if (this->m_data == nullptr) {
+    this->m_data =
+        new ElementData{std::numeric_limits<size_t>::max(),
+                        3,
+                        {nullptr, nullptr, nullptr, nullptr},
+                        nullptr};
+  }
+  return this->m_data;
+}
+
+/**
+ * @brief Returns a pointer to the first of the element's node pointers
+ * @return pointer to node pointers
+ */
+Node **Element::nodePointers() {
+  if (this->m_storage) {
+    return &this->m_storage->m_elementNodes[MeshStorage::maxNodesPerElement() *
+                                            this->m_index];
+  }
+  return this->data()->nodes.data();
+}
+
+/**
+ * @brief Returns a pointer to the first of the element's node pointers
+ * @return pointer to node pointers
+ */
+Node *const *Element::nodePointers() const {
+  if (this->m_storage) {
+    return &this->m_storage->m_elementNodes[MeshStorage::maxNodesPerElement() *
+                                            this->m_index];
+  }
+  return this->m_data ? this->m_data->nodes.data() : c_emptyElementNodes;
+}
+
+/**
+ * @brief Sets the number of verticies without checking the value
+ * @param[in] n number of verticies
+ */
+void Element::setSize(size_t n) {
+  if (this->m_storage) {
+    this->m_storage->m_elementSize[this->m_index] =
+        static_cast<unsigned char>(n);
+  } else {
+    this->data()->n = n;
+  }
+}
+
+/**
+ * @brief Removes the hash if one has been computed for the element
+ */
+void Element::resetHash() {
+  if (this->m_storage) {
+    this->m_storage->resetElementHash(this->m_index);
+  } else if (this->m_data) {
+    this->m_data->hash.reset(nullptr);
+  }
+}
+
+/**
+ * @brief Returns the buffer used to hold the element hash
+ * @return reference to hash buffer
+ */
+std::unique_ptr<char[]> &Element::hashBuffer() {
+  if (this->m_storage) return this->m_storage->elementHash(this->m_index);
+  return this->data()->hash;
+}
+
 bool Element::operator==(const Element &e) {
   if (this->n() != e.n()) return false;
   for (size_t i = 0; i < this->n(); ++i) {
@@ -113,7 +216,11 @@ void Element::resize(size_t nVertex) {
   if (nVertex != 3 && nVertex != 4) {
     adcircmodules_throw_exception("Invalid number of verticies");
   }
-  this->m_nodes.resize(nVertex);
+  Node **nodes = this->nodePointers();
+  for (size_t i = this->n(); i < nVertex; ++i) {
+    nodes[i] = nullptr;
+  }
+  this->setSize(nVertex);
 }
 
 /**
@@ -125,8 +232,13 @@ void Element::resize(size_t nVertex) {
  * @param[in] n3 pointer to node 3
  */
 void Element::setElement(size_t id, Node *n1, Node *n2, Node *n3) {
-  this->m_id = id;
-  this->m_nodes = {n1, n2, n3};
+  this->setId(id);
+  this->setSize(3);
+  Node **nodes = this->nodePointers();
+  nodes[0] = n1;
+  nodes[1] = n2;
+  nodes[2] = n3;
+  nodes[3] = nullptr;
 }
 
 /**
@@ -139,15 +251,23 @@ void Element::setElement(size_t id, Node *n1, Node *n2, Node *n3) {
  * @param[in] n4 pointer to node 4
  */
 void Element::setElement(size_t id, Node *n1, Node *n2, Node *n3, Node *n4) {
-  this->m_id = id;
-  this->m_nodes = {n1, n2, n3, n4};
+  this->setId(id);
+  this->setSize(4);
+  Node **nodes = this->nodePointers();
+  nodes[0] = n1;
+  nodes[1] = n2;
+  nodes[2] = n3;
+  nodes[3] = n4;
 }
 
 /**
  * @brief Number of verticies in this element
  * @return number of nodes in element
  */
-size_t Element::n() const { return this->m_nodes.size(); }
+size_t Element::n() const {
+  if (this->m_storage) return this->m_storage->m_elementSize[this->m_index];
+  return this->m_data ? this->m_data->n : 3;
+}
 
 /**
  * @brief Sets the node at the specified position to the supplied pointer
@@ -156,7 +276,7 @@ size_t Element::n() const { return this->m_nodes.size(); }
  */
 void Element::setNode(size_t i, Node *node) {
   if (i < this->n()) {
-    this->m_nodes[i] = node;
+    this->nodePointers()[i] = node;
   }
   return;
 }
@@ -165,13 +285,22 @@ void Element::setNode(size_t i, Node *node) {
  * @brief Returns the element id/flag
  * @return element id/flag
  */
-size_t Element::id() const { return this->m_id; }
+size_t Element::id() const {
+  if (this->m_storage) return this->m_storage->m_elementId[this->m_index];
+  return this->m_data ? this->m_data->id : std::numeric_limits<size_t>::max();
+}
 
 /**
  * @brief Sets the element id/flag
  * @param[in] id element id/flag
  */
-void Element::setId(size_t id) { this->m_id = id; }
+void Element::setId(size_t id) {
+  if (this->m_storage) {
+    this->m_storage->m_elementId[this->m_index] = id;
+  } else {
+    this->data()->id = id;
+  }
+}
 
 /**
  * @brief returns a pointer to the node at the specified position
@@ -180,7 +309,7 @@ void Element::setId(size_t id) { this->m_id = id; }
  */
 Node *Element::node(size_t i) const {
   if (i < this->n()) {
-    return this->m_nodes.at(i);
+    return this->nodePointers()[i];
   }
   adcircmodules_throw_exception("Index out of bounds");
   return nullptr;
@@ -191,19 +320,15 @@ Node *Element::node(size_t i) const {
  * @return formatted string
  */
 std::string Element::toAdcircString() const {
-  if (this->n() == 3) {
-    return boost::str(boost::format("%11i %3i %11i %11i %11i") % this->id() %
-                      this->n() % this->node(0)->id() % this->node(1)->id() %
-                      this->node(2)->id());
-  } else if (this->n() == 4) {
-    return boost::str(boost::format("%11i %3i %11i %11i %11i %11i") %
-                      this->id() % this->n() % this->node(0)->id() %
-                      this->node(1)->id() % this->node(2)->id() %
-                      this->node(3)->id());
-  } else {
+  if (this->n() != 3 && this->n() != 4) {
     adcircmodules_throw_exception("Invalid number of nodes in element");
     return std::string();
   }
+  size_t nodes[4];
+  for (size_t i = 0; i < this->n(); ++i) nodes[i] = this->node(i)->id();
+  char buffer[Adcirc::Private::AsciiWriter::maxLineLength()];
+  return std::string(buffer, Adcirc::Output::Formatting::adcircMeshElementLine(
+                                 buffer, this->id(), this->n(), nodes));
 }
 
 /**
@@ -287,10 +412,11 @@ void Element::sortVerticesAboutCenter(bool clockwise) {
     return d1 > d2;
   };
 
+  Node **nodes = this->nodePointers();
   if (clockwise) {
-    std::sort(this->m_nodes.begin(), this->m_nodes.end(), compareClockwise);
+    std::sort(nodes, nodes + this->n(), compareClockwise);
   } else {
-    std::sort(this->m_nodes.begin(), this->m_nodes.end(), compareAntiClockwise);
+    std::sort(nodes, nodes + this->n(), compareAntiClockwise);
   }
 
   return;
@@ -319,13 +445,14 @@ std::pair<Node *, Node *> Element::elementLeg(size_t i) const {
 
 /**
  * @brief Creates a boost::geometry element from the element
- * @param[in] n vector of node pointers to use to create the geometry
+ * @param[in] n array of node pointers to use to create the geometry
+ * @param[in] size number of nodes in the array
  * @return boost::geometry polygon
  */
-polygon_t element2polygon(std::vector<Node *> n) {
+polygon_t element2polygon(Node *const *n, size_t size) {
   polygon_t a;
-  for (auto i : n) {
-    bg::append(a, point_t(i->x(), i->y()));
+  for (size_t i = 0; i < size; ++i) {
+    bg::append(a, point_t(n[i]->x(), n[i]->y()));
   }
   bg::append(a, point_t(n[0]->x(), n[0]->y()));
   bg::correct(a);
@@ -339,7 +466,7 @@ polygon_t element2polygon(std::vector<Node *> n) {
  */
 void Element::getElementCenter(double &xc, double &yc) const {
   point_t p;
-  bg::centroid(element2polygon(this->m_nodes), p);
+  bg::centroid(element2polygon(this->nodePointers(), this->n()), p);
   xc = p.get<0>();
   yc = p.get<1>();
   return;
@@ -350,7 +477,7 @@ void Element::getElementCenter(double &xc, double &yc) const {
  * @return Area of triangle
  */
 double Element::area() const {
-  return bg::area(element2polygon(this->m_nodes));
+  return bg::area(element2polygon(this->nodePointers(), this->n()));
 }
 
 /**
@@ -360,7 +487,8 @@ double Element::area() const {
  * @return true if point lies within element, false otherwise
  */
 bool Element::isInside(double x, double y) const {
-  return bg::covered_by(point_t(x, y), element2polygon(this->m_nodes));
+  return bg::covered_by(point_t(x, y),
+                        element2polygon(this->nodePointers(), this->n()));
 }
 
 /**
@@ -372,7 +500,7 @@ bool Element::isInside(double x, double y) const {
  */
 bool Element::isInside(Point location) const {
   return bg::covered_by(point_t(location.x(), location.y()),
-                        element2polygon(this->m_nodes));
+                        element2polygon(this->nodePointers(), this->n()));
 }
 
 /**
@@ -390,6 +518,26 @@ std::vector<double> Element::interpolationWeights(double x, double y) const {
   }
 }
 
+/**
+ * @brief Computes the interpolation weights for a given point inside an
+ * element into an existing vector
+ * @param[in] x station location
+ * @param[in] y station location
+ * @param[out] weights interpolation weights for each vertex
+ *
+ * For triangular elements the vector is reused so that no allocation is
+ * required once it has been sized
+ */
+void Element::interpolationWeights(double x, double y,
+                                   std::vector<double> &weights) const {
+  if (this->n() == 3) {
+    weights.resize(3);
+    this->triangularInterpolation(x, y, weights.data());
+  } else {
+    weights = this->polygonInterpolation(x, y);
+  }
+}
+
 /**
  * @brief Gets the hash of the element
  * @param[in] h type of cryptographic hash to generate
@@ -400,8 +548,8 @@ std::vector<double> Element::interpolationWeights(double x, double y) const {
  * moves its position.
  */
 std::string Element::hash(Adcirc::Cryptography::HashType h, bool force) {
-  if (this->m_hash.get() == nullptr || force) this->generateHash(h);
-  return std::string(this->m_hash.get());
+  if (this->hashBuffer() == nullptr || force) this->generateHash(h);
+  return std::string(this->hashBuffer().get());
 }
 
 /**
@@ -412,30 +560,22 @@ std::vector<std::pair<Node *, Node *>> Element::faces() const {
   std::vector<std::pair<Node *, Node *>> face_list;
   face_list.reserve(this->n());
   for (size_t i = 0; i < this->n() - 1; ++i) {
-    face_list.emplace_back(m_nodes[i], m_nodes[i + 1]);
+    face_list.emplace_back(this->node(i), this->node(i + 1));
   }
-  face_list.emplace_back(m_nodes[n() - 1], m_nodes[0]);
+  face_list.emplace_back(this->node(this->n() - 1), this->node(0));
   return face_list;
 }
 
-/**
- * @brief Returns a pointer to the internal array of node pointers
- * @return pointer to vector of nodes
- */
-std::vector<Adcirc::Geometry::Node *> *Adcirc::Geometry::Element::nodes() {
-  return &m_nodes;
-}
-
 /**
  * @brief Generates the hash for this element
  * @param[in] h type of cryptographic hash to generate
  */
 void Element::generateHash(Adcirc::Cryptography::HashType h) {
   Adcirc::Cryptography::Hash hash(h);
-  for (auto &n : this->m_nodes) {
-    hash.addData(n->positionHash());
+  for (size_t i = 0; i < this->n(); ++i) {
+    hash.addData(this->node(i)->positionHash());
   }
-  this->m_hash.reset(hash.getHash());
+  this->hashBuffer().reset(hash.getHash());
 }
 
 /**
@@ -446,8 +586,18 @@ void Element::generateHash(Adcirc::Cryptography::HashType h) {
  */
 std::vector<double> Element::triangularInterpolation(double x, double y) const {
   std::vector<double> weights(3);
-  std::fill(weights.begin(), weights.end(), 0.0);
+  this->triangularInterpolation(x, y, weights.data());
+  return weights;
+}
 
+/**
+ * @brief Performs a barycentric interpolation
+ * @param[in] x station location
+ * @param[in] y station location
+ * @param[out] weights interpolation weights for each vertex (3 values)
+ */
+void Element::triangularInterpolation(double x, double y,
+                                      double *weights) const {
   const double x1 = this->node(0)->x();
   const double x2 = this->node(1)->x();
   const double x3 = this->node(2)->x();
@@ -461,8 +611,6 @@ std::vector<double> Element::triangularInterpolation(double x, double y) const {
   weights[0] = (((y2 - y3) * (x - x3) + (x3 - x2) * (y - y3)) / denom);
   weights[1] = (((y3 - y1) * (x - x3) + (x1 - x3) * (y - y3)) / denom);
   weights[2] = (1.0 - weights[0] - weights[1]);
-
-  return weights;
 }
 
 /**
@@ -484,8 +632,7 @@ std::vector<double> Element::triangularInterpolation(double x, double y) const {
  *
  */
 std::vector<double> Element::polygonInterpolation(double x, double y) const {
-  std::vector<double> weights(3);
-  std::fill(weights.begin(), weights.end(), 0.0);
+  std::vector<double> weights(this->n(), 0.0);
 
   //...Make copy of this element
   Element e(*this);
@@ -510,7 +657,7 @@ std::vector<double> Element::polygonInterpolation(double x, double y) const {
   for (size_t i = 0; i < this->n(); ++i) {
     size_t i1 = i;
     size_t i2 = i + 1;
-    if (i2 > this->n()) i2 = 0;
+    if (i2 >= this->n()) i2 = 0;
     Element ec(i, e.node(i1), e.node(i2), &midpoint);
     if (ec.isInside(x, y)) {
       ee = ec;
@@ -28,6 +28,12 @@
 #include "Node.h"
 
 namespace Adcirc {
+
+namespace Private {
+class MeshStorage;
+struct ElementData;
+}  // namespace Private
+
 namespace Geometry {
 
 /**
@@ -38,6 +44,10 @@ namespace Geometry {
  * @brief The Element class describes an Element as an array
  * of Node pointers
  *
+ * Elements that belong to a mesh are views into the fixed width
+ * connectivity array of the mesh storage. Elements that are created
+ * directly or copied out of a mesh hold their own node pointers.
+ *
  */
 
 class Element {
@@ -51,6 +61,7 @@ class Element {
                                Adcirc::Geometry::Node *n3,
                                Adcirc::Geometry::Node *n4);
   ADCIRCMODULES_EXPORT Element(const Element &e);
+  ADCIRCMODULES_EXPORT ~Element();
 
   ADCIRCMODULES_EXPORT Element &operator=(const Element &e);
   ADCIRCMODULES_EXPORT bool operator==(const Element &e);
@@ -92,6 +103,9 @@ class Element {
 
   std::vector<double> interpolationWeights(double x, double y) const;
 
+  void interpolationWeights(double x, double y,
+                            std::vector<double> &weights) const;
+
   std::string ADCIRCMODULES_EXPORT
   hash(Adcirc::Cryptography::HashType h =
            Adcirc::Cryptography::AdcircDefaultHash,
@@ -100,19 +114,32 @@ class Element {
   std::vector<std::pair<Adcirc::Geometry::Node *, Adcirc::Geometry::Node *>>
   faces() const;
 
-  std::vector<Adcirc::Geometry::Node *> *nodes();
-
  private:
-  size_t m_id;
-  std::vector<Adcirc::Geometry::Node *> m_nodes;
-  std::unique_ptr<char[]> m_hash;
+  /// Mesh storage holding the element values, nullptr if not part of a mesh
+  Adcirc::Private::MeshStorage *m_storage;
+  union {
+    /// Position of the element in the mesh storage
+    size_t m_index;
+    /// Values of the element when it is not part of a mesh
+    Adcirc::Private::ElementData *m_data;
+  };
+
+  friend class Adcirc::Private::MeshStorage;
 
   static void elementCopier(Element *a, const Element *b);
 
+  Adcirc::Private::ElementData *data();
+  Adcirc::Geometry::Node **nodePointers();
+  Adcirc::Geometry::Node *const *nodePointers() const;
+  void setSize(size_t n);
+  std::unique_ptr<char[]> &hashBuffer();
+  void resetHash();
+
   void generateHash(Adcirc::Cryptography::HashType h =
                         Adcirc::Cryptography::AdcircDefaultHash);
 
   std::vector<double> triangularInterpolation(double x, double y) const;
+  void triangularInterpolation(double x, double y, double *weights) const;
   std::vector<double> polygonInterpolation(double x, double y) const;
 };
 }  // namespace Geometry
@@ -0,0 +1,292 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "ElementLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "DefaultValues.h"
+#include "Element.h"
+#include "Logging.h"
+#include "Node.h"
+
+using namespace Adcirc::Private;
+
+//...Flags describing how each edge function of a triangle is evaluated. The
+//   lower bits mark edges whose end points are swapped into canonical order,
+//   the upper bits mark edges whose value must be negated
+static constexpr unsigned char c_swapShift = 0;
+static constexpr unsigned char c_negateShift = 4;
+
+//...Target number of triangles per bucket
+static constexpr double c_trianglesPerBucket = 1.0;
+
+/**
+ * @brief Signed area (times two) of the triangle a, b, p. Positive when p is
+ * to the left of the directed edge a->b
+ */
+static inline double edgeFunction(double xa, double ya, double xb, double yb,
+                                  double x, double y) {
+  return (xb - xa) * (y - ya) - (yb - ya) * (x - xa);
+}
+
+/**
+ * @brief Ordering used to decide which end point of an edge is first when the
+ * edge function is evaluated
+ */
+static inline bool canonicalOrder(double xa, double ya, double xb, double yb) {
+  return xa < xb || (xa == xb && ya < yb);
+}
+
+ElementLocator::ElementLocator()
+    : m_initialized(false),
+      m_nx(0),
+      m_ny(0),
+      m_xmin(0.0),
+      m_ymin(0.0),
+      m_xmax(0.0),
+      m_ymax(0.0),
+      m_invDx(0.0),
+      m_invDy(0.0) {}
+
+/**
+ * @brief Returns true if the index has been built
+ */
+bool ElementLocator::initialized() const {
+  return m_initialized.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Releases the memory held by the index
+ */
+void ElementLocator::clear() {
+  if (!this->initialized()) return;
+  m_initialized.store(false, std::memory_order_release);
+  m_nx = 0;
+  m_ny = 0;
+  m_triangles.clear();
+  m_triangles.shrink_to_fit();
+  m_bucketStart.clear();
+  m_bucketStart.shrink_to_fit();
+  m_buckets.clear();
+  m_buckets.shrink_to_fit();
+}
+
+/**
+ * @brief Number of triangles held by the index
+ */
+size_t ElementLocator::numTriangles() const { return m_triangles.size(); }
+
+/**
+ * @brief Number of buckets in the uniform grid
+ */
+size_t ElementLocator::numBuckets() const { return m_nx * m_ny; }
+
+/**
+ * @brief Approximate memory used by the index in bytes
+ */
+size_t ElementLocator::memoryUsage() const {
+  return m_triangles.capacity() * sizeof(Triangle) +
+         (m_bucketStart.capacity() + m_buckets.capacity()) * sizeof(size_t);
+}
+
+void ElementLocator::addTriangle(size_t element, double x0, double y0,
+                                 double x1, double y1, double x2, double y2) {
+  const double area = edgeFunction(x0, y0, x1, y1, x2, y2);
+  if (area == 0.0 || !std::isfinite(area)) return;
+
+  Triangle t;
+  t.x[0] = x0;
+  t.x[1] = x1;
+  t.x[2] = x2;
+  t.y[0] = y0;
+  t.y[1] = y1;
+  t.y[2] = y2;
+  t.element = element;
+  t.flags = 0;
+  const bool clockwise = area < 0.0;
+  for (unsigned char k = 0; k < 3; ++k) {
+    const unsigned char k1 = (k + 1) % 3;
+    const bool swap = !canonicalOrder(t.x[k], t.y[k], t.x[k1], t.y[k1]);
+    if (swap) t.flags |= 1U << (c_swapShift + k);
+    if (swap != clockwise) t.flags |= 1U << (c_negateShift + k);
+  }
+  m_triangles.push_back(t);
+}
+
+/**
+ * @brief Builds the index from the elements of a mesh
+ * @param elements mesh elements
+ */
+void ElementLocator::build(
+    const std::vector<Adcirc::Geometry::Element> &elements) {
+  this->clear();
+  m_triangles.reserve(elements.size());
+
+  for (size_t i = 0; i < elements.size(); ++i) {
+    const auto &e = elements[i];
+    if (e.n() == 3) {
+      this->addTriangle(i, e.node(0)->x(), e.node(0)->y(), e.node(1)->x(),
+                        e.node(1)->y(), e.node(2)->x(), e.node(2)->y());
+    } else if (e.n() == 4) {
+      double x[4], y[4];
+      for (size_t k = 0; k < 4; ++k) {
+        x[k] = e.node(k)->x();
+        y[k] = e.node(k)->y();
+      }
+
+      //...Split along the diagonal from a reflex vertex, if there is one, so
+      //   that both triangles lie within a non-convex quadrilateral
+      double area = 0.0;
+      for (size_t k = 0; k < 4; ++k) {
+        area += x[k] * y[(k + 1) % 4] - x[(k + 1) % 4] * y[k];
+      }
+      size_t r = 0;
+      for (size_t k = 0; k < 4; ++k) {
+        const size_t km = (k + 3) % 4;
+        const size_t kp = (k + 1) % 4;
+        const double turn =
+            edgeFunction(x[km], y[km], x[k], y[k], x[kp], y[kp]);
+        if (turn * area < 0.0) {
+          r = k;
+          break;
+        }
+      }
+      const size_t r1 = (r + 1) % 4;
+      const size_t r2 = (r + 2) % 4;
+      const size_t r3 = (r + 3) % 4;
+      this->addTriangle(i, x[r], y[r], x[r1], y[r1], x[r2], y[r2]);
+      this->addTriangle(i, x[r], y[r], x[r2], y[r2], x[r3], y[r3]);
+    } else {
+      adcircmodules_throw_exception(
+          "ElementLocator: Only triangles and quadrilaterals are supported");
+    }
+  }
+
+  if (m_triangles.empty()) return;
+
+  m_xmin = std::numeric_limits<double>::max();
+  m_ymin = std::numeric_limits<double>::max();
+  m_xmax = -std::numeric_limits<double>::max();
+  m_ymax = -std::numeric_limits<double>::max();
+  for (const auto &t : m_triangles) {
+    for (size_t k = 0; k < 3; ++k) {
+      m_xmin = std::min(m_xmin, t.x[k]);
+      m_xmax = std::max(m_xmax, t.x[k]);
+      m_ymin = std::min(m_ymin, t.y[k]);
+      m_ymax = std::max(m_ymax, t.y[k]);
+    }
+  }
+
+  //...Size the grid so that buckets are roughly square and hold about one
+  //   triangle each on average
+  const double w =
+      std::max(m_xmax - m_xmin, std::numeric_limits<double>::min());
+  const double h =
+      std::max(m_ymax - m_ymin, std::numeric_limits<double>::min());
+  const double nb = std::max(
+      1.0, static_cast<double>(m_triangles.size()) / c_trianglesPerBucket);
+  m_nx = static_cast<size_t>(
+      std::min(nb, std::max(1.0, std::round(std::sqrt(nb * w / h)))));
+  m_ny = static_cast<size_t>(
+      std::max(1.0, std::ceil(nb / static_cast<double>(m_nx))));
+  m_invDx = static_cast<double>(m_nx) / w;
+  m_invDy = static_cast<double>(m_ny) / h;
+
+  //...Count the triangles registered in each bucket, then fill the buckets
+  m_bucketStart.assign(m_nx * m_ny + 1, 0);
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t ti = 0; ti < m_triangles.size(); ++ti) {
+      const auto &t = m_triangles[ti];
+      const size_t i0 = this->column(std::min({t.x[0], t.x[1], t.x[2]}));
+      const size_t i1 = this->column(std::max({t.x[0], t.x[1], t.x[2]}));
+      const size_t j0 = this->row(std::min({t.y[0], t.y[1], t.y[2]}));
+      const size_t j1 = this->row(std::max({t.y[0], t.y[1], t.y[2]}));
+      for (size_t j = j0; j <= j1; ++j) {
+        for (size_t i = i0; i <= i1; ++i) {
+          const size_t b = j * m_nx + i;
+          if (pass == 0) {
+            m_bucketStart[b + 1]++;
+          } else {
+            m_buckets[m_bucketStart[b]++] = ti;
+          }
+        }
+      }
+    }
+    if (pass == 0) {
+      for (size_t b = 0; b < m_nx * m_ny; ++b) {
+        m_bucketStart[b + 1] += m_bucketStart[b];
+      }
+      m_buckets.resize(m_bucketStart.back());
+    } else {
+      //...Filling advanced each start to the start of the next bucket
+      for (size_t b = m_nx * m_ny; b > 0; --b) {
+        m_bucketStart[b] = m_bucketStart[b - 1];
+      }
+      m_bucketStart[0] = 0;
+    }
+  }
+
+  m_initialized.store(true, std::memory_order_release);
+}
+
+size_t ElementLocator::column(double x) const {
+  const double c = (x - m_xmin) * m_invDx;
+  return c < static_cast<double>(m_nx) ? static_cast<size_t>(c) : m_nx - 1;
+}
+
+size_t ElementLocator::row(double y) const {
+  const double r = (y - m_ymin) * m_invDy;
+  return r < static_cast<double>(m_ny) ? static_cast<size_t>(r) : m_ny - 1;
+}
+
+bool ElementLocator::contains(const Triangle &t, double x, double y) {
+  for (unsigned k = 0; k < 3; ++k) {
+    unsigned a = k;
+    unsigned b = (k + 1) % 3;
+    if (t.flags & (1U << (c_swapShift + k))) std::swap(a, b);
+    double e = edgeFunction(t.x[a], t.y[a], t.x[b], t.y[b], x, y);
+    if (t.flags & (1U << (c_negateShift + k))) e = -e;
+    if (e < 0.0) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Finds the element containing a point
+ * @param x location to search
+ * @param y location to search
+ * @return index of the element, or the default value if the point is not
+ * inside the mesh
+ *
+ * Points on the boundary of an element are considered to be inside
+ */
+size_t ElementLocator::find(double x, double y) const {
+  if (m_triangles.empty() ||
+      !(x >= m_xmin && x <= m_xmax && y >= m_ymin && y <= m_ymax)) {
+    return adcircmodules_default_value<size_t>();
+  }
+  const size_t b = this->row(y) * m_nx + this->column(x);
+  for (size_t k = m_bucketStart[b]; k < m_bucketStart[b + 1]; ++k) {
+    const Triangle &t = m_triangles[m_buckets[k]];
+    if (ElementLocator::contains(t, x, y)) return t.element;
+  }
+  return adcircmodules_default_value<size_t>();
+}
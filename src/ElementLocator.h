@@ -0,0 +1,102 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_ELEMENTLOCATOR_H
+#define ADCMOD_ELEMENTLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Adcirc {
+
+namespace Geometry {
+class Element;
+}
+
+namespace Private {
+
+/**
+ * @class ElementLocator
+ * @author Zachary Cobell
+ * @brief Point location index used to find the element containing a point
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Elements are decomposed into triangles (quadrilaterals are split along a
+ * diagonal) and the bounding box of each triangle is registered in a uniform
+ * grid of buckets covering the mesh. A query visits only the triangles in the
+ * bucket containing the point and tests them using edge functions computed
+ * from the vertex coordinates.
+ *
+ * Each edge function is always evaluated with its end points in the same
+ * order, regardless of which of the two neighboring triangles is being
+ * tested, so the two triangles see exactly opposite values. Points on a
+ * shared edge are therefore reported in one of the neighbors and no point
+ * inside the mesh can fall into a gap caused by floating point rounding.
+ * Queries do not allocate memory and may be made concurrently.
+ *
+ */
+class ElementLocator {
+ public:
+  ElementLocator();
+
+  void build(const std::vector<Adcirc::Geometry::Element> &elements);
+  void clear();
+
+  bool initialized() const;
+
+  size_t find(double x, double y) const;
+
+  size_t numTriangles() const;
+  size_t numBuckets() const;
+  size_t memoryUsage() const;
+
+ private:
+  struct Triangle {
+    double x[3];
+    double y[3];
+    size_t element;
+    unsigned char flags;
+  };
+
+  void addTriangle(size_t element, double x0, double y0, double x1, double y1,
+                   double x2, double y2);
+  size_t column(double x) const;
+  size_t row(double y) const;
+
+  static bool contains(const Triangle &t, double x, double y);
+
+  std::atomic<bool> m_initialized;
+  size_t m_nx;
+  size_t m_ny;
+  double m_xmin;
+  double m_ymin;
+  double m_xmax;
+  double m_ymax;
+  double m_invDx;
+  double m_invDy;
+  std::vector<Triangle> m_triangles;
+  std::vector<size_t> m_bucketStart;
+  std::vector<size_t> m_buckets;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_ELEMENTLOCATOR_H
@@ -0,0 +1,105 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "FeatureWriter.h"
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "ShapefileWriter.h"
+
+#if defined(USE_GDAL) && defined(ADCMOD_ENABLE_OGR_WRITER)
+#include "OgrFeatureWriter.h"
+#endif
+
+using namespace Adcirc::Private;
+
+/**
+ * @brief Constructor
+ * @param[in] maxVertices largest number of vertices in a feature
+ * @param[in] numFields number of attribute fields
+ */
+FeatureTable::FeatureTable(size_t maxVertices, size_t numFields)
+    : m_maxVertices(maxVertices), m_numFields(numFields), m_size(0) {}
+
+/**
+ * @brief Sets the number of features in the table. Storage is only grown, so
+ * tables may be reused for each batch without reallocating.
+ * @param[in] size number of features
+ */
+void FeatureTable::resize(size_t size) {
+  this->m_size = size;
+  if (this->m_numVertices.size() < size) {
+    this->m_numVertices.resize(size);
+    this->m_x.resize(size * this->m_maxVertices);
+    this->m_y.resize(size * this->m_maxVertices);
+    this->m_attributes.resize(size * this->m_numFields);
+  }
+}
+
+/**
+ * @brief Creates a writer for the format given by the file extension
+ * @param[in] filename output file. GeoPackage (.gpkg) and FlatGeobuf (.fgb)
+ * files are written with GDAL when the library is built with
+ * ADCIRCMODULES_ENABLE_OGR_WRITER. Any other name is written as an ESRI
+ * shapefile, with the extension replaced by .shp
+ * @param[in] geometry type of the features
+ * @param[in] epsg coordinate system of the features, or 0 if unknown
+ * @return writer for the file
+ */
+std::unique_ptr<FeatureWriter> FeatureWriter::create(
+    const std::string &filename, FeatureGeometry geometry, int epsg) {
+  std::string ext = Adcirc::FileIO::Generic::getFileExtension(filename);
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+  if (ext == ".gpkg" || ext == ".fgb") {
+#if defined(USE_GDAL) && defined(ADCMOD_ENABLE_OGR_WRITER)
+    return std::unique_ptr<FeatureWriter>(new OgrFeatureWriter(
+        filename, ext == ".gpkg" ? "GPKG" : "FlatGeobuf", geometry, epsg));
+#else
+    adcircmodules_throw_exception(
+        "GeoPackage and FlatGeobuf output is not enabled.");
+#endif
+  }
+
+  return std::unique_ptr<FeatureWriter>(
+      new ShapefileWriter(filename, geometry));
+}
+
+FeatureWriter::FeatureWriter(FeatureGeometry geometry)
+    : m_geometry(geometry) {}
+
+FeatureWriter::~FeatureWriter() = default;
+
+/**
+ * @brief Adds an attribute field. Fields must be added before any features
+ * are written.
+ * @param[in] name name of the field
+ * @param[in] type type of the field
+ * @param[in] width width of the field in characters
+ * @param[in] precision number of decimal places
+ */
+void FeatureWriter::addField(const std::string &name, FieldType type,
+                             int width, int precision) {
+  this->m_fields.push_back({name, type, width, precision});
+}
+
+FeatureGeometry FeatureWriter::geometry() const { return this->m_geometry; }
+
+const std::vector<FeatureWriter::Field> &FeatureWriter::fields() const {
+  return this->m_fields;
+}
@@ -0,0 +1,178 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_FEATUREWRITER_H
+#define ADCMOD_FEATUREWRITER_H
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+enum FeatureGeometry { FeaturePoint, FeatureLine, FeaturePolygon };
+
+/**
+ * @class FeatureTable
+ * @author Zachary Cobell
+ * @brief Batch of vector features stored in fixed size slots
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Each feature has room for maxVertices vertices and one value for each
+ * attribute field, so features can be filled concurrently without any
+ * allocation. Polygon rings are stored without repeating the first vertex.
+ *
+ */
+class FeatureTable {
+ public:
+  FeatureTable(size_t maxVertices, size_t numFields);
+
+  void resize(size_t size);
+
+  size_t size() const { return this->m_size; }
+  size_t maxVertices() const { return this->m_maxVertices; }
+  size_t numFields() const { return this->m_numFields; }
+
+  size_t numVertices(size_t feature) const {
+    return this->m_numVertices[feature];
+  }
+
+  const double *x(size_t feature) const {
+    return this->m_x.data() + feature * this->m_maxVertices;
+  }
+
+  const double *y(size_t feature) const {
+    return this->m_y.data() + feature * this->m_maxVertices;
+  }
+
+  double attribute(size_t feature, size_t field) const {
+    return this->m_attributes[feature * this->m_numFields + field];
+  }
+
+  void setNumVertices(size_t feature, size_t numVertices) {
+    this->m_numVertices[feature] = numVertices;
+  }
+
+  void setVertex(size_t feature, size_t vertex, double x, double y) {
+    this->m_x[feature * this->m_maxVertices + vertex] = x;
+    this->m_y[feature * this->m_maxVertices + vertex] = y;
+  }
+
+  void setAttribute(size_t feature, size_t field, double value) {
+    this->m_attributes[feature * this->m_numFields + field] = value;
+  }
+
+ private:
+  const size_t m_maxVertices;
+  const size_t m_numFields;
+  size_t m_size;
+  std::vector<size_t> m_numVertices;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_attributes;
+};
+
+/**
+ * @class FeatureWriter
+ * @author Zachary Cobell
+ * @brief Base class for the writers used to export mesh entities as vector
+ * features
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Features are built concurrently in batches of fixed size slots and each
+ * batch is then handed to the writer, which writes the features in order.
+ * The format is selected from the file extension: GeoPackage (.gpkg) and
+ * FlatGeobuf (.fgb) files require GDAL 3.1 or later and the
+ * ADCIRCMODULES_ENABLE_OGR_WRITER build option, and any other name is written
+ * as an ESRI shapefile.
+ *
+ */
+class FeatureWriter {
+ public:
+  enum FieldType { FieldInteger, FieldDouble };
+
+  static std::unique_ptr<FeatureWriter> create(const std::string &filename,
+                                               FeatureGeometry geometry,
+                                               int epsg);
+
+  virtual ~FeatureWriter();
+
+  void addField(const std::string &name, FieldType type, int width,
+                int precision);
+
+  template <typename FeatureBuilder>
+  void writeFeatures(size_t n, size_t maxVertices, FeatureBuilder builder);
+
+  virtual void close() = 0;
+
+ protected:
+  struct Field {
+    std::string name;
+    FieldType type;
+    int width;
+    int precision;
+  };
+
+  explicit FeatureWriter(FeatureGeometry geometry);
+
+  virtual void write(const FeatureTable &table) = 0;
+
+  FeatureGeometry geometry() const;
+  const std::vector<Field> &fields() const;
+
+ private:
+  static constexpr size_t batchSize() { return 65536; }
+
+  const FeatureGeometry m_geometry;
+  std::vector<Field> m_fields;
+};
+
+/**
+ * @brief Writes n features
+ * @param n number of features
+ * @param maxVertices largest number of vertices in a feature
+ * @param builder callable with the signature
+ * void(size_t index, size_t slot, FeatureTable &table) that fills slot of the
+ * table with feature index
+ *
+ * The builder is called concurrently for different features and must not
+ * modify shared state.
+ */
+template <typename FeatureBuilder>
+void FeatureWriter::writeFeatures(size_t n, size_t maxVertices,
+                                  FeatureBuilder builder) {
+  FeatureTable table(maxVertices, this->m_fields.size());
+  for (size_t first = 0; first < n; first += FeatureWriter::batchSize()) {
+    const size_t count = std::min(FeatureWriter::batchSize(), n - first);
+    table.resize(count);
+#pragma omp parallel for schedule(static)
+    for (long long i = 0; i < static_cast<long long>(count); ++i) {
+      builder(first + i, static_cast<size_t>(i), table);
+    }
+    this->write(table);
+  }
+}
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_FEATUREWRITER_H
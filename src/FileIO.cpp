@@ -18,10 +18,18 @@
 //------------------------------------------------------------------------*/
 #include "FileIO.h"
 
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <string>
 
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+#include "Logging.h"
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/algorithm/string/split.hpp"
 #include "boost/algorithm/string/trim.hpp"
@@ -106,6 +114,41 @@ std::string Adcirc::FileIO::Generic::sanitizeString(const std::string &a) {
   return b;
 }
 
+/**
+ * @brief Name of a file in the same directory as filename which can be
+ * written and then moved over filename with replaceFile
+ * @param[in] filename file which will be replaced
+ * @return name of the temporary file. A random suffix keeps processes
+ * writing the same file from sharing a temporary file
+ */
+std::string Adcirc::FileIO::Generic::temporaryFilename(
+    const std::string &filename) {
+  std::random_device random;
+  char suffix[16];
+  std::snprintf(suffix, sizeof(suffix), ".%08x.tmp", random());
+  return filename + suffix;
+}
+
+/**
+ * @brief Moves a file over another file, so that readers of destination see
+ * either the old or the new file but never a partially written one
+ * @param[in] source file to move, which is removed if the move fails
+ * @param[in] destination file to replace
+ */
+void Adcirc::FileIO::Generic::replaceFile(const std::string &source,
+                                          const std::string &destination) {
+#ifdef _WIN32
+  const bool moved = MoveFileExA(source.c_str(), destination.c_str(),
+                                 MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  const bool moved = std::rename(source.c_str(), destination.c_str()) == 0;
+#endif
+  if (!moved) {
+    std::remove(source.c_str());
+    adcircmodules_throw_exception("Could not replace " + destination);
+  }
+}
+
 /**
  * @brief Splits a string from an ADCIRC mesh file into the data required to
  * generate an adcirc node object
@@ -119,7 +162,29 @@ std::string Adcirc::FileIO::Generic::sanitizeString(const std::string &a) {
 bool Adcirc::FileIO::AdcircIO::splitStringNodeFormat(const std::string &data,
                                                      size_t &id, double &x,
                                                      double &y, double &z) {
-  return qi::phrase_parse(data.begin(), data.end(),
+  return Adcirc::FileIO::AdcircIO::splitStringNodeFormat(
+      data.data(), data.data() + data.size(), id, x, y, z);
+}
+
+/**
+ * @brief Splits a range of characters from an ADCIRC mesh file into the data
+ * required to generate an adcirc node object
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[out] id node id
+ * @param[out] x node x-position
+ * @param[out] y node y-position
+ * @param[out] z node z-position
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringNodeFormat(const char *first,
+                                                     const char *last,
+                                                     size_t &id, double &x,
+                                                     double &y, double &z) {
+  return qi::phrase_parse(first, last,
                           (qi::int_[phoenix::ref(id) = qi::_1] >>
                            qi::double_[phoenix::ref(x) = qi::_1] >>
                            qi::double_[phoenix::ref(y) = qi::_1] >>
@@ -143,6 +208,37 @@ bool Adcirc::FileIO::AdcircIO::splitStringElemFormat(
       ascii::space);
 }
 
+/**
+ * @brief Splits a range of characters from an ADCIRC mesh file to the data
+ * for an element
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[out] id element id
+ * @param[out] nNodes number of nodes found on the line
+ * @param[out] nodes array containing the first four nodes found on the line
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data. If nNodes is larger than four, only the first four node ids are
+ * returned.
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringElemFormat(
+    const char *first, const char *last, size_t &id, size_t &nNodes,
+    std::array<size_t, 4> &nodes) {
+  nNodes = 0;
+  if (!qi::phrase_parse(first, last,
+                        (qi::int_[phoenix::ref(id) = qi::_1] >> qi::int_),
+                        ascii::space)) {
+    return false;
+  }
+  int n;
+  while (qi::phrase_parse(first, last, qi::int_, ascii::space, n)) {
+    if (nNodes < nodes.size()) nodes[nNodes] = n;
+    nNodes++;
+  }
+  return true;
+}
+
 /**
  * @brief Splits a string for a single node boundary
  * @param[in] data string read from file
@@ -234,7 +330,26 @@ bool Adcirc::FileIO::AdcircIO::splitStringBoundary25Format(
  */
 bool Adcirc::FileIO::AdcircIO::splitStringAttribute1Format(
     const std::string &data, size_t &node, double &value) {
-  return qi::phrase_parse(data.begin(), data.end(),
+  return Adcirc::FileIO::AdcircIO::splitStringAttribute1Format(
+      data.data(), data.data() + data.size(), node, value);
+}
+
+/**
+ * @brief Splits a range of characters in format of nodeid, value1
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[out] node node id for data
+ * @param[out] value data specified for the node
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringAttribute1Format(const char *first,
+                                                           const char *last,
+                                                           size_t &node,
+                                                           double &value) {
+  return qi::phrase_parse(first, last,
                           (qi::int_[phoenix::ref(node) = qi::_1] >>
                            qi::double_[phoenix::ref(value) = qi::_1]),
                           ascii::space);
@@ -250,7 +365,26 @@ bool Adcirc::FileIO::AdcircIO::splitStringAttribute1Format(
  */
 bool Adcirc::FileIO::AdcircIO::splitStringAttribute2Format(
     const std::string &data, size_t &node, double &value1, double &value2) {
-  return qi::phrase_parse(data.begin(), data.end(),
+  return Adcirc::FileIO::AdcircIO::splitStringAttribute2Format(
+      data.data(), data.data() + data.size(), node, value1, value2);
+}
+
+/**
+ * @brief Splits a range of characters in the format of nodeid, value1, value2
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[out] node node id for data
+ * @param[out] value1 first value specified for the node
+ * @param[out] value2 second value specified for the node
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringAttribute2Format(
+    const char *first, const char *last, size_t &node, double &value1,
+    double &value2) {
+  return qi::phrase_parse(first, last,
                           (qi::int_[phoenix::ref(node) = qi::_1] >>
                            qi::double_[phoenix::ref(value1) = qi::_1] >>
                            qi::double_[phoenix::ref(value2) = qi::_1]),
@@ -273,6 +407,37 @@ bool Adcirc::FileIO::AdcircIO::splitStringAttributeNFormat(
       ascii::space);
 }
 
+/**
+ * @brief Splits a range of characters in the format node, value_1, ...,
+ * value_n when the number of values is known
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[out] node node id for data
+ * @param[in] numValues number of values expected on the line
+ * @param[out] values array of numValues values
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data
+ */
+bool Adcirc::FileIO::AdcircIO::splitStringAttributeNFormat(const char *first,
+                                                           const char *last,
+                                                           size_t &node,
+                                                           size_t numValues,
+                                                           double *values) {
+  if (!qi::phrase_parse(first, last, qi::int_[phoenix::ref(node) = qi::_1],
+                        ascii::space)) {
+    return false;
+  }
+  for (size_t i = 0; i < numValues; ++i) {
+    if (!qi::phrase_parse(first, last, qi::double_, ascii::space,
+                          values[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * @brief Splits the harmonics elevation data read from an adcirc ascii
  * harmonics file
@@ -366,7 +531,28 @@ bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const std::string &data,
                                                    int &day, int &hour,
                                                    int &minute, int &second,
                                                    double &value) {
-  bool r = qi::phrase_parse(data.begin(), data.end(),
+  return Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
+      data.data(), data.data() + data.size(), year, month, day, hour, minute,
+      second, value);
+}
+
+/**
+ * @brief Splits a line of an IMEDS file in the format year month day hour
+ * minute [second] value
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @return true if successful read
+ *
+ * This overload does not allocate and can be used directly on memory mapped
+ * file data
+ */
+bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const char *first,
+                                                   const char *last, int &year,
+                                                   int &month, int &day,
+                                                   int &hour, int &minute,
+                                                   int &second, double &value) {
+  const char *p = first;
+  bool r = qi::phrase_parse(p, last,
                             qi::int_[phoenix::ref(year) = qi::_1] >>
                                 qi::int_[phoenix::ref(month) = qi::_1] >>
                                 qi::int_[phoenix::ref(day) = qi::_1] >>
@@ -376,7 +562,8 @@ bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const std::string &data,
                                 qi::double_[phoenix::ref(value) = qi::_1],
                             qi::space);
   if (!r) {
-    r = qi::phrase_parse(data.begin(), data.end(),
+    p = first;
+    r = qi::phrase_parse(p, last,
                          qi::int_[phoenix::ref(year) = qi::_1] >>
                              qi::int_[phoenix::ref(month) = qi::_1] >>
                              qi::int_[phoenix::ref(day) = qi::_1] >>
@@ -389,3 +576,56 @@ bool Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(const std::string &data,
 
   return r;
 }
+
+/**
+ * @brief Splits a line of an HMDF csv file in the format
+ * yyyy-mm-dd hh:mm:ss[.mmmm],value_1[,value_2...]
+ * @param[in] first pointer to the first character of the line
+ * @param[in] last pointer to one past the last character of the line
+ * @param[in] numValues number of values expected on the line
+ * @param[out] values array of numValues values
+ * @return true if successful read
+ */
+bool Adcirc::FileIO::HMDFIO::splitStringHmdfCsvFormat(
+    const char *first, const char *last, int &year, int &month, int &day,
+    int &hour, int &minute, int &second, int &millisecond, size_t numValues,
+    double *values) {
+  millisecond = 0;
+  if (!qi::phrase_parse(
+          first, last,
+          qi::int_[phoenix::ref(year) = qi::_1] >> '-' >>
+              qi::int_[phoenix::ref(month) = qi::_1] >> '-' >>
+              qi::int_[phoenix::ref(day) = qi::_1] >>
+              qi::int_[phoenix::ref(hour) = qi::_1] >> ':' >>
+              qi::int_[phoenix::ref(minute) = qi::_1] >> ':' >>
+              qi::int_[phoenix::ref(second) = qi::_1] >>
+              -('.' >> qi::int_[phoenix::ref(millisecond) = qi::_1]),
+          qi::space)) {
+    return false;
+  }
+  for (size_t i = 0; i < numValues; ++i) {
+    if (!qi::phrase_parse(first, last, ',' >> qi::double_, qi::space,
+                          values[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Mutex held by the library around its calls to the netCDF and HDF5
+ * libraries
+ * @return mutex shared by all objects
+ *
+ * Neither library is thread safe, but files are read and written on
+ * background threads (see OutputSnapRange and NetcdfBlockWriter). Every
+ * function of this library which calls netCDF or HDF5 holds this mutex, so
+ * the calls made by those threads never overlap other calls. Applications
+ * that call netCDF or HDF5 themselves while a background read or write is in
+ * progress must hold it as well. It is recursive so that functions holding
+ * it may call one another.
+ */
+std::recursive_mutex &Adcirc::FileIO::Netcdf::libraryMutex() {
+  static std::recursive_mutex m;
+  return m;
+}
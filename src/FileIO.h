@@ -19,6 +19,8 @@
 #ifndef ADCMOD_FILEIO_H
 #define ADCMOD_FILEIO_H
 
+#include <array>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -44,6 +46,12 @@ bool ADCIRCMODULES_EXPORT fileExists(const std::string &filename);
 
 std::string ADCIRCMODULES_EXPORT sanitizeString(const std::string &a);
 
+std::string ADCIRCMODULES_EXPORT
+temporaryFilename(const std::string &filename);
+
+void ADCIRCMODULES_EXPORT replaceFile(const std::string &source,
+                                      const std::string &destination);
+
 }  // namespace Generic
 
 namespace AdcircIO {
@@ -51,10 +59,20 @@ bool ADCIRCMODULES_EXPORT splitStringNodeFormat(const std::string &data,
                                                 size_t &id, double &x,
                                                 double &y, double &z);
 
+bool ADCIRCMODULES_EXPORT splitStringNodeFormat(const char *first,
+                                                const char *last, size_t &id,
+                                                double &x, double &y,
+                                                double &z);
+
 bool ADCIRCMODULES_EXPORT splitStringElemFormat(const std::string &data,
                                                 size_t &id,
                                                 std::vector<size_t> &nodes);
 
+bool ADCIRCMODULES_EXPORT splitStringElemFormat(const char *first,
+                                                const char *last, size_t &id,
+                                                size_t &nNodes,
+                                                std::array<size_t, 4> &nodes);
+
 bool ADCIRCMODULES_EXPORT splitStringBoundary0Format(const std::string &data,
                                                      size_t &node1);
 
@@ -76,14 +94,31 @@ bool ADCIRCMODULES_EXPORT splitStringAttribute1Format(const std::string &data,
                                                       size_t &node,
                                                       double &value);
 
+bool ADCIRCMODULES_EXPORT splitStringAttribute1Format(const char *first,
+                                                      const char *last,
+                                                      size_t &node,
+                                                      double &value);
+
 bool ADCIRCMODULES_EXPORT splitStringAttribute2Format(const std::string &data,
                                                       size_t &node,
                                                       double &value1,
                                                       double &value2);
 
+bool ADCIRCMODULES_EXPORT splitStringAttribute2Format(const char *first,
+                                                      const char *last,
+                                                      size_t &node,
+                                                      double &value1,
+                                                      double &value2);
+
 bool ADCIRCMODULES_EXPORT splitStringAttributeNFormat(
     const std::string &data, size_t &node, std::vector<double> &values);
 
+bool ADCIRCMODULES_EXPORT splitStringAttributeNFormat(const char *first,
+                                                      const char *last,
+                                                      size_t &node,
+                                                      size_t numValues,
+                                                      double *values);
+
 bool ADCIRCMODULES_EXPORT splitStringHarmonicsElevationFormat(
     const std::string &data, double &amplitude, double &phase);
 
@@ -106,6 +141,21 @@ bool ADCIRCMODULES_EXPORT splitStringHmdfFormat(const std::string &data,
                                                 int &year, int &month, int &day,
                                                 int &hour, int &minute,
                                                 int &second, double &value);
+
+bool ADCIRCMODULES_EXPORT splitStringHmdfFormat(const char *first,
+                                                const char *last, int &year,
+                                                int &month, int &day, int &hour,
+                                                int &minute, int &second,
+                                                double &value);
+
+bool ADCIRCMODULES_EXPORT splitStringHmdfCsvFormat(
+    const char *first, const char *last, int &year, int &month, int &day,
+    int &hour, int &minute, int &second, int &millisecond, size_t numValues,
+    double *values);
+}
+
+namespace Netcdf {
+std::recursive_mutex ADCIRCMODULES_EXPORT &libraryMutex();
 }
 
 }  // namespace FileIO
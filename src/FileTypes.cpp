@@ -121,6 +121,8 @@ bool checkFiletypeAsciiFull(const std::string& filename) {
  * @return true if the file format is netCDF
  */
 bool inquireNetcdfFormat(const std::string& filename, int& format) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   format = Adcirc::Output::OutputUnknown;
   int ierr = nc_open(filename.c_str(), NC_NOWRITE, &ncid);
@@ -218,6 +220,8 @@ bool checkFiletypeAsciiHarmonics(const std::string& filename) {
  * @return true if the file format is ADCIRC netCDF Harmonics
  */
 bool checkFiletypeNetcdfHarmonics(const std::string& filename) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int ierr = nc_open(filename.c_str(), NC_NOWRITE, &ncid);
   if (ierr != NC_NOERR) {
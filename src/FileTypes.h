@@ -18,9 +18,18 @@ enum MeshFormat {
   /// Aquaveo generic mesh format (*.2dm)
   Mesh2DM = 0x204,
   /// Deltares D-Flow FM format (*_net.nc)
-  MeshDFlow = 0x205
+  MeshDFlow = 0x205,
+  /// ADCIRCModules native binary mesh format (*.14b)
+  MeshAdcircBinary = 0x206
 };
-}
+
+enum MeshReaderMode {
+  /// Read ASCII meshes line by line from a file stream
+  MeshReaderStream = 0x301,
+  /// Memory map ASCII meshes and parse nodes and elements in parallel
+  MeshReaderMapped = 0x302
+};
+}  // namespace Geometry
 
 namespace Harmonics {
 enum HarmonicsFormat {
@@ -18,14 +18,13 @@
 //------------------------------------------------------------------------*/
 #include "Formatting.h"
 
+#include "AsciiWriter.h"
 #include "boost/format.hpp"
 
+using Adcirc::Private::AsciiWriter;
+
 static boost::format c_adcircAsciiFileHeader(
     "%6i %10i %10.6f %6i %6i FileFmtVersion: %10i\n");
-static boost::format c_adcircAsciiScalar("%8i     %20.10e\n");
-static boost::format c_adcircAsciiVector("%8i     %20.10e     %20.10e\n");
-static boost::format c_adcircAscii3d(
-    "%8i     %20.10e     %20.10e     %20.10e\n");
 static boost::format c_adcircRecordHeaderSparse(
     "%20.10e     %10i  %10i %20.10e\n");
 static boost::format c_adcircRecordHeaderFull("%20.10e     %10i\n");
@@ -52,16 +51,101 @@ std::string Adcirc::Output::Formatting::adcircSparseFormatRecordHeader(
 
 std::string Adcirc::Output::Formatting::adcircScalarLineFormat(
     const size_t id, const double value) {
-  return boost::str(c_adcircAsciiScalar % id % value);
+  char buffer[AsciiWriter::maxLineLength()];
+  return std::string(buffer, adcircScalarLine(buffer, id, value));
 }
 
 std::string Adcirc::Output::Formatting::adcircVectorLineFormat(
     const size_t id, const double value1, const double value2) {
-  return boost::str(c_adcircAsciiVector % id % value1 % value2);
+  char buffer[AsciiWriter::maxLineLength()];
+  return std::string(buffer, adcircVectorLine(buffer, id, value1, value2));
 }
 
 std::string Adcirc::Output::Formatting::adcirc3dLineFormat(
     const size_t id, const double value1, const double value2,
     const double value3) {
-  return boost::str(c_adcircAscii3d % id % value1 % value2 % value3);
+  char buffer[AsciiWriter::maxLineLength()];
+  return std::string(buffer,
+                     adcirc3dLine(buffer, id, value1, value2, value3));
+}
+
+/**
+ * @brief Formats a scalar output line ("%8i     %20.10e\n") at p
+ * @return end of the formatted line
+ */
+char *Adcirc::Output::Formatting::adcircScalarLine(char *p, const size_t id,
+                                                   const double value) {
+  p = AsciiWriter::unsignedInteger(p, id, 8);
+  p = AsciiWriter::text(p, "     ");
+  p = AsciiWriter::scientific(p, value, 20, 10);
+  *p++ = '\n';
+  return p;
+}
+
+/**
+ * @brief Formats a vector output line ("%8i     %20.10e     %20.10e\n") at p
+ * @return end of the formatted line
+ */
+char *Adcirc::Output::Formatting::adcircVectorLine(char *p, const size_t id,
+                                                   const double value1,
+                                                   const double value2) {
+  p = AsciiWriter::unsignedInteger(p, id, 8);
+  p = AsciiWriter::text(p, "     ");
+  p = AsciiWriter::scientific(p, value1, 20, 10);
+  p = AsciiWriter::text(p, "     ");
+  p = AsciiWriter::scientific(p, value2, 20, 10);
+  *p++ = '\n';
+  return p;
+}
+
+/**
+ * @brief Formats a three component output line at p
+ * @return end of the formatted line
+ */
+char *Adcirc::Output::Formatting::adcirc3dLine(char *p, const size_t id,
+                                               const double value1,
+                                               const double value2,
+                                               const double value3) {
+  p = adcircVectorLine(p, id, value1, value2) - 1;
+  p = AsciiWriter::text(p, "     ");
+  p = AsciiWriter::scientific(p, value3, 20, 10);
+  *p++ = '\n';
+  return p;
+}
+
+/**
+ * @brief Formats a node line of an ADCIRC mesh
+ * ("%11i   %16.10f   %16.10f  %16.10f") at p, without a line ending
+ * @return end of the formatted text
+ */
+char *Adcirc::Output::Formatting::adcircMeshNodeLine(char *p, const size_t id,
+                                                     const double x,
+                                                     const double y,
+                                                     const double z) {
+  p = AsciiWriter::unsignedInteger(p, id, 11);
+  p = AsciiWriter::text(p, "   ");
+  p = AsciiWriter::fixed(p, x, 16, 10);
+  p = AsciiWriter::text(p, "   ");
+  p = AsciiWriter::fixed(p, y, 16, 10);
+  p = AsciiWriter::text(p, "  ");
+  return AsciiWriter::fixed(p, z, 16, 10);
+}
+
+/**
+ * @brief Formats an element line of an ADCIRC mesh ("%11i %3i %11i ...") at
+ * p, without a line ending
+ * @return end of the formatted text
+ */
+char *Adcirc::Output::Formatting::adcircMeshElementLine(char *p,
+                                                        const size_t id,
+                                                        const size_t n,
+                                                        const size_t *nodes) {
+  p = AsciiWriter::unsignedInteger(p, id, 11);
+  *p++ = ' ';
+  p = AsciiWriter::unsignedInteger(p, n, 3);
+  for (size_t i = 0; i < n; ++i) {
+    *p++ = ' ';
+    p = AsciiWriter::unsignedInteger(p, nodes[i], 11);
+  }
+  return p;
 }
@@ -45,6 +45,20 @@ class Formatting {
 
   static std::string adcirc3dLineFormat(size_t id, double value1, double value2,
                                         double value3);
+
+  static char *adcircScalarLine(char *p, size_t id, double value);
+
+  static char *adcircVectorLine(char *p, size_t id, double value1,
+                                double value2);
+
+  static char *adcirc3dLine(char *p, size_t id, double value1, double value2,
+                            double value3);
+
+  static char *adcircMeshNodeLine(char *p, size_t id, double x, double y,
+                                  double z);
+
+  static char *adcircMeshElementLine(char *p, size_t id, size_t n,
+                                     const size_t *nodes);
 };
 
 }  // namespace Output
@@ -426,6 +426,64 @@ void Griddata::setRasterInMemory(bool rasterInMemory) {
   this->m_impl->setRasterInMemory(rasterInMemory);
 }
 
+/**
+ * @brief Returns the memory budget of the tile cache used when the raster is
+ * read from disk
+ * @return cache size in bytes
+ */
+size_t Griddata::rasterCacheSize() const {
+  return this->m_impl->rasterCacheSize();
+}
+
+/**
+ * @brief Sets the memory budget of the tile cache used when the raster is read
+ * from disk
+ * @param[in] bytes cache size in bytes
+ *
+ * Pixels are read from disk in blocks which are held in a cache shared between
+ * threads. This has no effect when rasterInMemory is true.
+ */
+void Griddata::setRasterCacheSize(size_t bytes) {
+  this->m_impl->setRasterCacheSize(bytes);
+}
+
+/**
+ * @brief Returns the order in which query points are processed
+ * @return query ordering
+ */
+Adcirc::Interpolation::QueryOrder Griddata::queryOrder() const {
+  return this->m_impl->queryOrder();
+}
+
+/**
+ * @brief Sets the order in which query points are processed
+ * @param[in] order query ordering
+ *
+ * Sorting the query points along a space filling curve means consecutive
+ * queries read neighboring parts of the raster, which improves the hit rate
+ * of the raster tile cache. Results are always returned in the original
+ * order. The default is HilbertOrder.
+ */
+void Griddata::setQueryOrder(Adcirc::Interpolation::QueryOrder order) {
+  this->m_impl->setQueryOrder(order);
+}
+
+/**
+ * @brief Number of raster tile requests that were found in the cache
+ * @return cache hits
+ */
+size_t Griddata::rasterCacheHits() const {
+  return this->m_impl->rasterCacheHits();
+}
+
+/**
+ * @brief Number of raster tile requests that required a read from disk
+ * @return cache misses
+ */
+size_t Griddata::rasterCacheMisses() const {
+  return this->m_impl->rasterCacheMisses();
+}
+
 /**
  * @brief Returns the datum shift that is added to the interpolated value
  * @return datum shift value
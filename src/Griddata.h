@@ -127,6 +127,15 @@ class Griddata {
   bool ADCIRCMODULES_EXPORT rasterInMemory() const;
   void ADCIRCMODULES_EXPORT setRasterInMemory(bool rasterInMemory);
 
+  size_t ADCIRCMODULES_EXPORT rasterCacheSize() const;
+  void ADCIRCMODULES_EXPORT setRasterCacheSize(size_t bytes);
+
+  Interpolation::QueryOrder ADCIRCMODULES_EXPORT queryOrder() const;
+  void ADCIRCMODULES_EXPORT setQueryOrder(Interpolation::QueryOrder order);
+
+  size_t ADCIRCMODULES_EXPORT rasterCacheHits() const;
+  size_t ADCIRCMODULES_EXPORT rasterCacheMisses() const;
+
   double ADCIRCMODULES_EXPORT datumShift() const;
   void ADCIRCMODULES_EXPORT setDatumShift(double datumShift);
 
@@ -37,6 +37,7 @@
 #include "Logging.h"
 #include "ProgressBar.h"
 #include "Projection.h"
+#include "SpaceFillingCurve.h"
 #include "StringConversion.h"
 
 using namespace Adcirc;
@@ -54,7 +55,8 @@ GriddataPrivate::GriddataPrivate(Mesh *mesh, const std::string &rasterFile,
       m_rasterFile(rasterFile),
       m_epsg(epsgRaster),
       m_showProgressBar(false),
-      m_rasterInMemory(false) {
+      m_rasterInMemory(false),
+      m_queryOrder(HilbertOrder) {
   auto locations =
       Adcirc::Private::GriddataPrivate::meshToQueryPoints(mesh, epsgRaster);
   auto resolution = mesh->computeMeshSize(epsgRaster);
@@ -79,7 +81,8 @@ GriddataPrivate::GriddataPrivate(const std::vector<double> &x,
       m_rasterFile(rasterFile),
       m_epsg(epsgRaster),
       m_showProgressBar(false),
-      m_rasterInMemory(false) {
+      m_rasterInMemory(false),
+      m_queryOrder(HilbertOrder) {
   assert(!x.empty());
   assert(x.size() == y.size());
 
@@ -317,6 +320,49 @@ void GriddataPrivate::setRasterInMemory(bool rasterInMemory) {
   this->m_rasterInMemory = rasterInMemory;
 }
 
+size_t GriddataPrivate::rasterCacheSize() const {
+  return this->m_raster->tileCacheSize();
+}
+
+void GriddataPrivate::setRasterCacheSize(size_t bytes) {
+  this->m_raster->setTileCacheSize(bytes);
+}
+
+Interpolation::QueryOrder GriddataPrivate::queryOrder() const {
+  return this->m_queryOrder;
+}
+
+void GriddataPrivate::setQueryOrder(Interpolation::QueryOrder order) {
+  this->m_queryOrder = order;
+}
+
+std::vector<size_t> GriddataPrivate::queryPermutation() const {
+  if (this->m_queryOrder == OriginalOrder) {
+    std::vector<size_t> idx(m_attributes.size());
+    std::iota(idx.begin(), idx.end(), 0);
+    return idx;
+  }
+  std::vector<double> x, y;
+  x.reserve(m_attributes.size());
+  y.reserve(m_attributes.size());
+  for (const auto &a : m_attributes) {
+    x.push_back(a.point().x());
+    y.push_back(a.point().y());
+  }
+  return SpaceFillingCurve::order(x, y,
+                                  this->m_queryOrder == MortonOrder
+                                      ? SpaceFillingCurve::Morton
+                                      : SpaceFillingCurve::Hilbert);
+}
+
+size_t GriddataPrivate::rasterCacheHits() const {
+  return this->m_raster->tileCacheHits();
+}
+
+size_t GriddataPrivate::rasterCacheMisses() const {
+  return this->m_raster->tileCacheMisses();
+}
+
 double GriddataPrivate::calculatePoint(const size_t index,
                                        const Interpolation::Method &method) {
   std::unique_ptr<GriddataMethod> calc_method;
@@ -417,12 +463,14 @@ std::vector<double> GriddataPrivate::computeValuesFromRaster(
   this->m_config.setUseLookup(useLookupTable);
 
   std::vector<double> result(m_attributes.size(), m_config.defaultValue());
+  const std::vector<size_t> order = this->queryPermutation();
 
   if (this->showProgressBar()) progress.begin();
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result, useLookupTable)
-  for (size_t i = 0; i < m_attributes.size(); ++i) {
+#pragma omp parallel for schedule(dynamic, 16) default(none) \
+    shared(progress, result, useLookupTable, order)
+  for (size_t k = 0; k < order.size(); ++k) {
+    const size_t i = order[k];
     if (this->m_showProgressBar) progress.tick();
     if (m_attributes[i].interpolationFlag() != Interpolation::NoMethod) {
       double v = this->calculatePoint(i, m_attributes[i].interpolationFlag());
@@ -450,13 +498,15 @@ GriddataPrivate::computeDirectionalWindReduction(bool useLookupTable) {
 
   std::vector<std::vector<double>> result;
   result.resize(m_attributes.size());
+  const std::vector<size_t> order = this->queryPermutation();
 
   ProgressBar progress(m_attributes.size());
   if (this->showProgressBar()) progress.begin();
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result, useLookupTable)
-  for (size_t i = 0; i < m_attributes.size(); ++i) {
+#pragma omp parallel for schedule(dynamic, 16) default(none) \
+    shared(progress, result, useLookupTable, order)
+  for (size_t k = 0; k < order.size(); ++k) {
+    const size_t i = order[k];
     if (this->m_showProgressBar) progress.tick();
     GriddataWindRoughness wind(m_raster.get(), &m_attributes[i], &m_config);
     result[i] = wind.computeMultiple();
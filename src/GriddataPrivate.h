@@ -90,6 +90,15 @@ class GriddataPrivate {
   bool rasterInMemory() const;
   void setRasterInMemory(bool rasterInMemory);
 
+  size_t rasterCacheSize() const;
+  void setRasterCacheSize(size_t bytes);
+
+  Interpolation::QueryOrder queryOrder() const;
+  void setQueryOrder(Interpolation::QueryOrder order);
+
+  size_t rasterCacheHits() const;
+  size_t rasterCacheMisses() const;
+
   double datumShift() const;
   void setDatumShift(double datumShift);
 
@@ -108,6 +117,8 @@ class GriddataPrivate {
 
   void checkRasterOpen();
 
+  std::vector<size_t> queryPermutation() const;
+
   static std::vector<Point> meshToQueryPoints(Adcirc::Geometry::Mesh *m,
                                               int epsgRaster);
 
@@ -124,6 +135,7 @@ class GriddataPrivate {
 
   bool m_showProgressBar;
   bool m_rasterInMemory;
+  Interpolation::QueryOrder m_queryOrder;
 };
 
 }  // namespace Private
@@ -296,6 +296,8 @@ void HarmonicsOutputPrivate::writeAsciiFormatVelocity(std::ofstream& fid) {
 }
 
 void HarmonicsOutputPrivate::writeNetcdfFormat(const std::string& filename) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int ierr = nc_create(filename.c_str(),
                        NC_NETCDF4 | NC_CLASSIC_MODEL | NC_CLOBBER, &ncid);
@@ -600,6 +602,8 @@ void HarmonicsOutputPrivate::readAsciiFormat() {
 }
 
 void HarmonicsOutputPrivate::readNetcdfFormat() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int ierr = nc_open(this->filename().c_str(), NC_NOWRITE, &ncid);
   if (ierr != NC_NOERR) {
@@ -18,6 +18,8 @@
 //------------------------------------------------------------------------*/
 #include "Hmdf.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
 #include <fstream>
 
@@ -31,6 +33,7 @@
 #include "FileIO.h"
 #include "Formatting.h"
 #include "Logging.h"
+#include "MappedFile.h"
 #include "NetcdfTimeseries.h"
 #include "Projection.h"
 #include "boost/algorithm/string.hpp"
@@ -167,60 +170,289 @@ bool Hmdf::null() const { return this->m_null; }
 
 void Hmdf::setNull(bool null) { this->m_null = null; }
 
-int Hmdf::readImeds(const std::string &filename) {
-  if (this->m_dimension > 1) {
-    adcircmodules_throw_exception(
-        "imeds format files cannot contain vector data.");
+int Hmdf::read(const std::string &filename) {
+  HmdfFileType ft = this->getFiletype(filename);
+  if (ft == HmdfImeds) {
+    return this->readImeds(filename);
+  } else if (ft == HmdfCsv) {
+    return this->readCsv(filename);
+  } else if (ft == HmdfNetCdf) {
+    return this->readNetcdf(filename);
   }
-  std::ifstream fid(filename.c_str());
-  if (fid.bad()) return -1;
+  return 1;
+}
 
-  //...Read Header
-  std::string templine;
-  std::getline(fid, templine);
-  this->m_header1 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header2 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header3 = Adcirc::FileIO::Generic::sanitizeString(templine);
+namespace {
+
+//...Classification of a line of an IMEDS or csv file
+enum class HmdfLine : unsigned char { Data, Text, Blank, InvalidDate };
+
+struct HmdfSample {
+  HmdfLine type;
+  long long date;
+  double value[2];
+};
+
+//...Number of lines that are parsed concurrently at a time
+constexpr size_t c_hmdfChunkLines = 1 << 18;
+
+/**
+ * @brief Converts a date to milliseconds since 1970-01-01 without
+ * constructing a CDate
+ * @return false if the calendar date is invalid. As in CDate, the time of day
+ * is not checked and rolls over into the following days
+ */
+bool epochMilliseconds(int year, int month, int day, int hour, int minute,
+                       int second, int millisecond, long long &ms) {
+  static const int daysInMonth[12] = {31, 28, 31, 30, 31, 30,
+                                      31, 31, 30, 31, 30, 31};
+  if (month < 1 || month > 12 || day < 1) return false;
+  const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  if (day > daysInMonth[month - 1] + (month == 2 && leap ? 1 : 0)) {
+    return false;
+  }
 
-  //...Read Body
-  std::getline(fid, templine);
+  //...Days since the epoch of the proleptic Gregorian calendar date
+  const long long y = year - (month <= 2 ? 1 : 0);
+  const long long era = (y >= 0 ? y : y - 399) / 400;
+  const long long yoe = y - era * 400;
+  const long long doy = (153 * ((month + 9) % 12) + 2) / 5 + day - 1;
+  const long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  const long long days = era * 146097 + doe - 719468;
 
-  while (!fid.eof()) {
-    HmdfStation station(1);
+  ms = (((days * 24 + hour) * 60 + minute) * 60 + second) * 1000 + millisecond;
+  return true;
+}
 
-    templine = Adcirc::FileIO::Generic::sanitizeString(templine);
+/**
+ * @brief Parses the lines of a file from position to the end in chunks. The
+ * lines of a chunk are located serially, parsed concurrently with parseLine
+ * and then passed to consume in the order they appear in the file
+ */
+template <typename ParseLine, typename Consume>
+void parseHmdfLines(const Adcirc::FileIO::MappedFile &file, size_t position,
+                    ParseLine parseLine, Consume consume) {
+  std::vector<size_t> offsets;
+  std::vector<HmdfSample> samples;
+
+  auto lineText = [&](size_t i) {
+    const char *first = file.data() + offsets[i];
+    const char *last = file.data() + offsets[i + 1];
+    while (last > first && (*(last - 1) == '\n' || *(last - 1) == '\r')) {
+      --last;
+    }
+    return std::make_pair(first, last);
+  };
+
+  while (position < file.size()) {
+    const size_t n = file.lineOffsets(position, c_hmdfChunkLines, offsets);
+    samples.resize(n);
+
+#pragma omp parallel for schedule(static)
+    for (long long i = 0; i < static_cast<long long>(n); ++i) {
+      auto line = lineText(i);
+      const bool blank = std::all_of(line.first, line.second, [](char c) {
+        return std::isspace(static_cast<unsigned char>(c));
+      });
+      if (blank) {
+        samples[i].type = HmdfLine::Blank;
+      } else {
+        samples[i] = parseLine(line.first, line.second);
+      }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      auto line = lineText(i);
+      consume(samples[i], line.first, line.second);
+    }
+    position = offsets[n];
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Reads an IMEDS file
+ * @param[in] filename file to read
+ * @return 0 on success
+ *
+ * Each station starts with a line containing its name, latitude and longitude
+ * and is followed by one line per sample. The samples are parsed concurrently
+ * and stored directly in the columns of the stations.
+ */
+int Hmdf::readImeds(const std::string &filename) {
+  if (this->m_dimension > 1) {
+    adcircmodules_throw_exception(
+        "imeds format files cannot contain vector data.");
+  }
+  if (!Adcirc::FileIO::Generic::fileExists(filename)) return -1;
 
-    std::vector<std::string> templist;
-    Adcirc::FileIO::Generic::splitString(templine, templist);
+  Adcirc::FileIO::MappedFile file(filename);
 
-    station.setName(templist[0]);
-    station.setLongitude(stod(templist[2]));
-    station.setLatitude(stod(templist[1]));
+  //...Read Header
+  size_t position = 0;
+  for (std::string *header : {&this->m_header1, &this->m_header2,
+                              &this->m_header3}) {
+    *header = Adcirc::FileIO::Generic::sanitizeString(std::string(
+        file.data() + position, file.data() + file.lineEnd(position)));
+    position = file.nextLine(position);
+  }
 
-    while (!fid.eof()) {
-      std::getline(fid, templine);
+  //...Read Body. Any line which is not a sample starts a new station
+  std::vector<long long> dates;
+  std::vector<double> values;
+  bool hasStation = false;
+  auto finishStation = [&]() {
+    if (!hasStation) return;
+    std::vector<std::vector<double>> data(1);
+    data[0] = std::move(values);
+    this->m_station.back().setColumns(std::move(dates), std::move(data));
+    dates.clear();
+    values.clear();
+  };
+
+  parseHmdfLines(
+      file, position,
+      [](const char *first, const char *last) {
+        HmdfSample s;
+        int year, month, day, hour, minute, second;
+        if (!Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
+                first, last, year, month, day, hour, minute, second,
+                s.value[0])) {
+          s.type = HmdfLine::Text;
+        } else if (epochMilliseconds(year, month, day, hour, minute, second,
+                                     0, s.date)) {
+          s.type = HmdfLine::Data;
+        } else {
+          s.type = HmdfLine::InvalidDate;
+        }
+        return s;
+      },
+      [&](const HmdfSample &s, const char *first, const char *last) {
+        if (s.type == HmdfLine::Blank) return;
+        if (s.type == HmdfLine::InvalidDate) {
+          adcircmodules_throw_exception("Invalid date in " + filename + ": " +
+                                        std::string(first, last));
+        }
+        if (s.type == HmdfLine::Data) {
+          if (!hasStation) {
+            adcircmodules_throw_exception("Data found before station in " +
+                                          filename);
+          }
+          dates.push_back(s.date);
+          values.push_back(s.value[0]);
+          return;
+        }
 
-      int year, month, day, hour, minute, second;
-      double value;
+        finishStation();
+        std::string templine = Adcirc::FileIO::Generic::sanitizeString(
+            std::string(first, last));
+        std::vector<std::string> templist;
+        Adcirc::FileIO::Generic::splitString(templine, templist);
+        if (templist.size() < 3) {
+          adcircmodules_throw_exception("Invalid station header in " +
+                                        filename + ": " + templine);
+        }
 
-      bool status = Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
-          templine, year, month, day, hour, minute, second, value);
+        HmdfStation station(1);
+        station.setName(templist[0]);
+        station.setLongitude(stod(templist[2]));
+        station.setLatitude(stod(templist[1]));
+        this->addStation(station);
+        hasStation = true;
+      });
+  finishStation();
 
-      if (status) {
-        Adcirc::CDate d(year, month, day, hour, minute, second);
+  this->setNull(false);
 
-        //...Append to the station data
-        station.setNext(d, value);
-      } else {
-        break;
-      }
-    }
+  return 0;
+}
 
-    //...Add the station
-    this->addStation(station);
+/**
+ * @brief Reads a csv file in the format written by writeCsv
+ * @param[in] filename file to read
+ * @return 0 on success
+ *
+ * The csv format does not contain the station locations, so the stations are
+ * named by the identifier following the "Station" keyword.
+ */
+int Hmdf::readCsv(const std::string &filename) {
+  if (this->m_dimension > 2) {
+    adcircmodules_throw_exception(
+        "csv format files cannot contain more than two dimensions.");
   }
+  if (!Adcirc::FileIO::Generic::fileExists(filename)) return -1;
+
+  Adcirc::FileIO::MappedFile file(filename);
+  const size_t dimension = this->m_dimension;
+
+  std::vector<long long> dates;
+  std::vector<std::vector<double>> values(dimension);
+  bool hasStation = false;
+  auto finishStation = [&]() {
+    if (!hasStation) return;
+    this->m_station.back().setColumns(std::move(dates), std::move(values));
+    dates.clear();
+    values.assign(dimension, std::vector<double>());
+  };
+
+  parseHmdfLines(
+      file, 0,
+      [dimension](const char *first, const char *last) {
+        HmdfSample s;
+        int year, month, day, hour, minute, second, millisecond;
+        if (!Adcirc::FileIO::HMDFIO::splitStringHmdfCsvFormat(
+                first, last, year, month, day, hour, minute, second,
+                millisecond, dimension, s.value)) {
+          s.type = HmdfLine::Text;
+        } else if (epochMilliseconds(year, month, day, hour, minute, second,
+                                     millisecond, s.date)) {
+          s.type = HmdfLine::Data;
+        } else {
+          s.type = HmdfLine::InvalidDate;
+        }
+        return s;
+      },
+      [&](const HmdfSample &s, const char *first, const char *last) {
+        if (s.type == HmdfLine::Blank) return;
+        if (s.type == HmdfLine::InvalidDate) {
+          adcircmodules_throw_exception("Invalid date in " + filename + ": " +
+                                        std::string(first, last));
+        }
+        if (s.type == HmdfLine::Data) {
+          if (!hasStation) {
+            adcircmodules_throw_exception("Data found before station in " +
+                                          filename);
+          }
+          dates.push_back(s.date);
+          for (size_t d = 0; d < dimension; ++d) {
+            values[d].push_back(s.value[d]);
+          }
+          return;
+        }
+
+        std::string templine = Adcirc::FileIO::Generic::sanitizeString(
+            std::string(first, last));
+        auto keyValue = [&](const std::string &key) {
+          return boost::algorithm::trim_copy(templine.substr(key.size()));
+        };
+        if (boost::algorithm::starts_with(templine, "Station")) {
+          finishStation();
+          HmdfStation station(dimension);
+          station.setName(keyValue("Station"));
+          station.setId(station.name());
+          this->addStation(station);
+          hasStation = true;
+        } else if (boost::algorithm::starts_with(templine, "Datum:")) {
+          this->setDatum(keyValue("Datum:"));
+        } else if (boost::algorithm::starts_with(templine, "Units:")) {
+          this->setUnits(keyValue("Units:"));
+        } else {
+          adcircmodules_throw_exception("Invalid line in " + filename + ": " +
+                                        templine);
+        }
+      });
+  finishStation();
 
   this->setNull(false);
 
@@ -323,6 +555,8 @@ int Hmdf::writeImeds(const std::string &filename) {
 }
 
 int Hmdf::writeNetcdf(const std::string &filename) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int dimid_nstations, dimid_stationNameLength;
   int varid_stationName, varid_stationx, varid_stationy;
@@ -49,7 +49,9 @@ class Hmdf {
   int ADCIRCMODULES_EXPORT writeNetcdf(const std::string &filename);
   int ADCIRCMODULES_EXPORT writeAdcirc(const std::string &filename);
 
+  int ADCIRCMODULES_EXPORT read(const std::string &filename);
   int ADCIRCMODULES_EXPORT readImeds(const std::string &filename);
+  int ADCIRCMODULES_EXPORT readCsv(const std::string &filename);
   int ADCIRCMODULES_EXPORT readNetcdf(const std::string &filename,
                                       bool stationsOnly = false);
 
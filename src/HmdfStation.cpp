@@ -22,21 +22,13 @@
 
 using namespace Adcirc::Output;
 
-struct m_DataPair {
-  Adcirc::CDate m_date;
-  double m_data_u = Adcirc::Output::HmdfStation::nullDataValue();
-  double m_data_v = Adcirc::Output::HmdfStation::nullDataValue();
-};
-
-bool operator<(const m_DataPair& a, const m_DataPair& b) {
-  return a.m_date < b.m_date;
-}
-
-bool operator==(const m_DataPair& a, const m_DataPair& b) {
-  return a.m_date == b.m_date &&
-         Adcirc::FpCompare::equalTo(a.m_data_u, b.m_data_u) &&
-         Adcirc::FpCompare::equalTo(a.m_data_v, b.m_data_v);
+namespace {
+const std::chrono::system_clock::time_point &epoch() {
+  static const std::chrono::system_clock::time_point e =
+      Adcirc::CDate(1970, 1, 1).time_point();
+  return e;
 }
+}  // namespace
 
 Adcirc::Output::HmdfStation::HmdfStation(size_t dimension)
     : m_coordinate(Coordinate()),
@@ -46,7 +38,8 @@ Adcirc::Output::HmdfStation::HmdfStation(size_t dimension)
       m_stationIndex(0),
       m_nullValue(nullDataValue()),
       m_positiveDirection(0),
-      m_dimension(dimension) {}
+      m_dimension(dimension),
+      m_data(dimension) {}
 
 void Adcirc::Output::HmdfStation::clear() {
   m_coordinate = Coordinate();
@@ -55,7 +48,12 @@ void Adcirc::Output::HmdfStation::clear() {
   m_isNull = true;
   m_stationIndex = 0;
   m_positiveDirection = 0;
-  m_data.clear();
+  m_date.clear();
+  for (auto& d : m_data) {
+    d.clear();
+  }
+  m_adcircTime.clear();
+  m_adcircIteration.clear();
 }
 
 Adcirc::Output::Coordinate* Adcirc::Output::HmdfStation::coordinate() {
@@ -92,7 +90,7 @@ std::string Adcirc::Output::HmdfStation::id() const { return m_id; }
 
 void Adcirc::Output::HmdfStation::setId(const std::string& id) { m_id = id; }
 
-size_t Adcirc::Output::HmdfStation::numSnaps() const { return m_data.size(); }
+size_t Adcirc::Output::HmdfStation::numSnaps() const { return m_date.size(); }
 
 size_t Adcirc::Output::HmdfStation::stationIndex() const {
   return m_stationIndex;
@@ -102,47 +100,82 @@ void Adcirc::Output::HmdfStation::setStationIndex(size_t stationIndex) {
   m_stationIndex = stationIndex;
 }
 
+/**
+ * @brief Converts a date to milliseconds since 1970-01-01 00:00:00, the
+ * representation used in dateColumn
+ */
+long long Adcirc::Output::HmdfStation::toEpochMilliseconds(
+    const Adcirc::CDate& date) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             date.time_point() - epoch())
+      .count();
+}
+
+/**
+ * @brief Converts milliseconds since 1970-01-01 00:00:00 to a date
+ */
+Adcirc::CDate Adcirc::Output::HmdfStation::fromEpochMilliseconds(
+    long long milliseconds) {
+  return Adcirc::CDate(epoch() + std::chrono::milliseconds(milliseconds));
+}
+
 Adcirc::CDate Adcirc::Output::HmdfStation::date(size_t index) const {
-  assert(index < m_data.size());
-  return m_data[index].datetime();
+  assert(index < m_date.size());
+  return fromEpochMilliseconds(m_date[index]);
 }
 
 void Adcirc::Output::HmdfStation::setDate(const Adcirc::CDate& date,
                                           size_t index) {
-  assert(index < m_data.size());
-  m_data[index].setDatetime(date);
+  assert(index < m_date.size());
+  m_date[index] = toEpochMilliseconds(date);
 }
 
+/**
+ * @brief Sets the dates of all samples. If the station does not have data
+ * yet, it is sized to the dates and the data is set to the null value
+ */
 void Adcirc::Output::HmdfStation::setDate(
     const std::vector<Adcirc::CDate>& date) {
-  assert(date.size() == m_data.size());
-  for (auto i = 0; i < m_data.size(); ++i) {
-    m_data[i].setDatetime(date[i]);
+  assert(m_date.empty() || date.size() == m_date.size());
+  if (m_date.empty()) this->resize(date.size());
+  for (size_t i = 0; i < m_date.size(); ++i) {
+    m_date[i] = toEpochMilliseconds(date[i]);
   }
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const std::vector<double>& data) {
-  m_data.template emplace_back(date, data);
+  assert(data.size() == m_dimension);
+  m_date.push_back(toEpochMilliseconds(date));
+  for (size_t i = 0; i < m_dimension; ++i) {
+    m_data[i].push_back(i < data.size() ? data[i] : nullDataValue());
+  }
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const double& data) {
-  m_data.emplace_back(date, data);
+  m_date.push_back(toEpochMilliseconds(date));
+  m_data[0].push_back(data);
+  for (size_t i = 1; i < m_dimension; ++i) {
+    m_data[i].push_back(nullDataValue());
+  }
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const double& data_u,
                                           const double& data_v) {
-  m_data.emplace_back(date, data_u, data_v);
+  m_date.push_back(toEpochMilliseconds(date));
+  m_data[0].push_back(data_u);
+  if (m_dimension > 1) m_data[1].push_back(data_v);
+  for (size_t i = 2; i < m_dimension; ++i) {
+    m_data[i].push_back(nullDataValue());
+  }
 }
 
 void Adcirc::Output::HmdfStation::setNext(
     const Adcirc::CDate& date, const std::tuple<double, double>& data) {
   assert(m_dimension == 2);
-  auto d1 = std::get<0>(data);
-  auto d2 = std::get<1>(data);
-  m_data.emplace_back(date, d1, d2);
+  this->setNext(date, std::get<0>(data), std::get<1>(data));
 }
 
 bool Adcirc::Output::HmdfStation::isNull() const { return m_isNull; }
@@ -151,47 +184,80 @@ void Adcirc::Output::HmdfStation::setIsNull(bool isNull) { m_isNull = isNull; }
 
 void Adcirc::Output::HmdfStation::setData(const double& data, size_t index,
                                           size_t dim) {
-  assert(index < m_data.size());
+  assert(index < m_date.size());
   assert(dim < m_dimension);
-  m_data[index].setData(data, dim);
+  m_data[dim][index] = data;
 }
 
 std::vector<Adcirc::CDate> Adcirc::Output::HmdfStation::allDate() const {
   std::vector<Adcirc::CDate> dates;
-  dates.reserve(m_data.size());
-  for (const auto& i : m_data) {
-    dates.push_back(i.datetime());
+  dates.reserve(m_date.size());
+  for (const auto& d : m_date) {
+    dates.push_back(fromEpochMilliseconds(d));
   }
   return dates;
 }
 
 std::vector<double> Adcirc::Output::HmdfStation::allData(size_t dim) const {
   assert(dim < m_dimension);
-  std::vector<double> data;
-  data.reserve(m_data.size());
-  for (const auto& i : m_data) {
-    data.push_back(i.data(dim));
+  return m_data[dim];
+}
+
+/**
+ * @brief Dates of the samples in milliseconds since 1970-01-01 00:00:00
+ */
+const std::vector<long long>& Adcirc::Output::HmdfStation::dateColumn() const {
+  return m_date;
+}
+
+/**
+ * @brief Values of one dimension of the samples
+ */
+const std::vector<double>& Adcirc::Output::HmdfStation::dataColumn(
+    size_t dim) const {
+  assert(dim < m_dimension);
+  return m_data[dim];
+}
+
+/**
+ * @brief Replaces the samples of the station
+ * @param[in] dates dates of the samples in milliseconds since 1970-01-01
+ * @param[in] data one vector of values for each dimension of the station,
+ * each the same length as dates
+ */
+void Adcirc::Output::HmdfStation::setColumns(
+    std::vector<long long> dates, std::vector<std::vector<double>> data) {
+  if (data.size() != m_dimension) {
+    adcircmodules_throw_exception(
+        "Number of data columns does not match the station dimension");
   }
-  return data;
+  for (const auto& d : data) {
+    if (d.size() != dates.size()) {
+      adcircmodules_throw_exception(
+          "Data columns must be the same length as the dates");
+    }
+  }
+  m_date = std::move(dates);
+  m_data = std::move(data);
+  m_adcircTime.clear();
+  m_adcircIteration.clear();
 }
 
 void Adcirc::Output::HmdfStation::dataBounds(Adcirc::CDate& minDate,
                                              Adcirc::CDate& maxDate,
                                              double& minValue,
                                              double& maxValue) {
-  auto data_u = this->allData(0);
-  auto date = this->allDate();
-  minDate = *std::min_element(date.begin(), date.end());
-  maxDate = *std::max_element(date.begin(), date.end());
+  auto date = std::minmax_element(m_date.begin(), m_date.end());
+  minDate = fromEpochMilliseconds(*date.first);
+  maxDate = fromEpochMilliseconds(*date.second);
   if (this->m_dimension == 2) {
-    auto data_v = this->allData(1);
     double umin, umax, vmin, vmax;
-    std::tie(umin, umax) = this->getVectorBounds(data_u);
-    std::tie(vmin, vmax) = this->getVectorBounds(data_v);
+    std::tie(umin, umax) = this->getVectorBounds(m_data[0]);
+    std::tie(vmin, vmax) = this->getVectorBounds(m_data[1]);
     minValue = std::min(umin, vmin);
     maxValue = std::min(umax, vmax);
   } else {
-    std::tie(minValue, maxValue) = this->getVectorBounds(data_u);
+    std::tie(minValue, maxValue) = this->getVectorBounds(m_data[0]);
   }
 }
 
@@ -201,9 +267,23 @@ void Adcirc::Output::HmdfStation::setNullValue(double nullValue) {
   m_nullValue = nullValue;
 }
 
-void Adcirc::Output::HmdfStation::reserve(size_t size) { m_data.reserve(size); }
+void Adcirc::Output::HmdfStation::reserve(size_t size) {
+  m_date.reserve(size);
+  for (auto& d : m_data) {
+    d.reserve(size);
+  }
+}
 
-void Adcirc::Output::HmdfStation::resize(size_t size) { m_data.resize(size); }
+void Adcirc::Output::HmdfStation::resize(size_t size) {
+  m_date.resize(size, 0);
+  for (auto& d : m_data) {
+    d.resize(size, nullDataValue());
+  }
+  if (!m_adcircTime.empty()) m_adcircTime.resize(size, defaultAdcircTime());
+  if (!m_adcircIteration.empty()) {
+    m_adcircIteration.resize(size, defaultAdcircIteration());
+  }
+}
 
 size_t Adcirc::Output::HmdfStation::dimension() const { return m_dimension; }
 
@@ -225,29 +305,30 @@ void Adcirc::Output::HmdfStation::setPositiveDirection(
 
 void Adcirc::Output::HmdfStation::sanitize(const double minValid,
                                            const double maxValid) {
-  std::vector<m_DataPair> d(m_data.size());
-  for (auto i = 0; i < d.size(); ++i) {
-    d[i].m_date = m_data[i].datetime();
-    d[i].m_data_u = this->m_data[i].data(0);
-    if (m_dimension == 2) {
-      d[i].m_data_v = this->m_data[i].data(1);
+  std::vector<size_t> order(m_date.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return m_date[a] < m_date[b];
+  });
+
+  auto permute = [&](auto& v) {
+    if (v.empty()) return;
+    auto sorted = v;
+    for (size_t i = 0; i < order.size(); ++i) {
+      sorted[i] = v[order[i]];
     }
-  }
-  std::sort(d.begin(), d.end());
-  for (size_t i = 0; i < d.size(); ++i) {
-    this->m_data[i].setDatetime(d[i].m_date);
-    this->m_data[i].setData(d[i].m_data_u < minValid
-                                ? Adcirc::Output::HmdfStation::nullDataValue()
-                            : d[i].m_data_u > maxValid
-                                ? Adcirc::Output::HmdfStation::nullDataValue()
-                                : d[i].m_data_u);
-    if (m_dimension == 2) {
-      this->m_data[i].setData(d[i].m_data_v < minValid
-                                  ? Adcirc::Output::HmdfStation::nullDataValue()
-                              : d[i].m_data_v > maxValid
-                                  ? Adcirc::Output::HmdfStation::nullDataValue()
-                                  : d[i].m_data_v,
-                              1);
+    v = std::move(sorted);
+  };
+
+  permute(m_date);
+  permute(m_adcircTime);
+  permute(m_adcircIteration);
+  for (size_t dim = 0; dim < m_dimension && dim < 2; ++dim) {
+    permute(m_data[dim]);
+    for (auto& v : m_data[dim]) {
+      if (v < minValid || v > maxValid) {
+        v = Adcirc::Output::HmdfStation::nullDataValue();
+      }
     }
   }
 }
@@ -267,26 +348,34 @@ std::tuple<double, double> Adcirc::Output::HmdfStation::getVectorBounds(
 }
 
 size_t Adcirc::Output::HmdfStation::adcircIteration(size_t index) {
-  assert(index < m_data.size());
-  return m_data[index].adcircIteration();
+  assert(index < m_date.size());
+  return index < m_adcircIteration.size() ? m_adcircIteration[index]
+                                          : defaultAdcircIteration();
 }
 
 void Adcirc::Output::HmdfStation::setAdcircIteration(size_t index, size_t it) {
-  assert(index < m_data.size());
-  m_data[index].setAdcircIteration(it);
+  assert(index < m_date.size());
+  if (m_adcircIteration.size() < m_date.size()) {
+    m_adcircIteration.resize(m_date.size(), defaultAdcircIteration());
+  }
+  m_adcircIteration[index] = it;
 }
 
 double Adcirc::Output::HmdfStation::adcircTime(size_t index) {
-  assert(index < m_data.size());
-  return m_data[index].adcircTime();
+  assert(index < m_date.size());
+  return index < m_adcircTime.size() ? m_adcircTime[index]
+                                     : defaultAdcircTime();
 }
 
 void Adcirc::Output::HmdfStation::setAdcircTime(size_t index, double time) {
-  assert(index < m_data.size());
-  m_data[index].setAdcircTime(time);
+  assert(index < m_date.size());
+  if (m_adcircTime.size() < m_date.size()) {
+    m_adcircTime.resize(m_date.size(), defaultAdcircTime());
+  }
+  m_adcircTime[index] = time;
 }
 double Adcirc::Output::HmdfStation::data(size_t index, size_t dim) const {
-  assert(index < m_data.size());
+  assert(index < m_date.size());
   assert(dim < m_dimension);
-  return m_data[index].data(dim);
+  return m_data[dim][index];
 }
\ No newline at end of file
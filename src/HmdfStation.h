@@ -112,10 +112,9 @@ class HmdfStation {
   template <typename T>
   void ADCIRCMODULES_EXPORT setData(const std::vector<T> &data,
                                     size_t dim = 0) {
-    assert(data.size() == m_data.size());
-    for (auto i = 0; i < m_data.size(); ++i) {
-      m_data[i].setData(dim, data[i]);
-    }
+    assert(data.size() == m_date.size());
+    assert(dim < m_dimension);
+    std::copy(data.begin(), data.end(), m_data[dim].begin());
   }
 
   size_t ADCIRCMODULES_EXPORT adcircIteration(size_t index);
@@ -130,6 +129,20 @@ class HmdfStation {
 
   std::vector<double> ADCIRCMODULES_EXPORT allData(size_t dim = 0) const;
 
+  const std::vector<long long> ADCIRCMODULES_EXPORT &dateColumn() const;
+
+  const std::vector<double> ADCIRCMODULES_EXPORT &dataColumn(
+      size_t dim = 0) const;
+
+  void ADCIRCMODULES_EXPORT setColumns(std::vector<long long> dates,
+                                       std::vector<std::vector<double>> data);
+
+  static long long ADCIRCMODULES_EXPORT
+  toEpochMilliseconds(const Adcirc::CDate &date);
+
+  static Adcirc::CDate ADCIRCMODULES_EXPORT
+  fromEpochMilliseconds(long long milliseconds);
+
   void ADCIRCMODULES_EXPORT dataBounds(Adcirc::CDate &minDate,
                                        Adcirc::CDate &maxDate, double &minValue,
                                        double &maxValue);
@@ -161,7 +174,13 @@ class HmdfStation {
   double m_positiveDirection;
   size_t m_dimension;
   bool m_isNull;
-  std::vector<HmdfDataContainer> m_data;
+
+  //...Samples are stored by column. Dates are milliseconds since the epoch
+  //   and the adcirc time and iteration columns are only allocated once set
+  std::vector<long long> m_date;
+  std::vector<std::vector<double>> m_data;
+  std::vector<double> m_adcircTime;
+  std::vector<size_t> m_adcircIteration;
 };
 
 #ifndef SWIG
@@ -58,6 +58,15 @@ enum Threshold {
   ThresholdBelow = 2
 };
 
+enum QueryOrder {
+  /// Process query points in the order they were provided
+  OriginalOrder = 0,
+  /// Process query points sorted along a Morton (z-order) curve
+  MortonOrder = 1,
+  /// Process query points sorted along a Hilbert curve
+  HilbertOrder = 2
+};
+
 }  // namespace Interpolation
 }  // namespace Adcirc
 
@@ -0,0 +1,116 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "MappedFile.h"
+
+#include <cstring>
+
+#include "Logging.h"
+#include "boost/interprocess/file_mapping.hpp"
+#include "boost/interprocess/mapped_region.hpp"
+
+using namespace Adcirc::FileIO;
+namespace bip = boost::interprocess;
+
+/**
+ * @brief Constructor which maps the specified file into memory
+ * @param[in] filename file to map
+ */
+MappedFile::MappedFile(const std::string &filename)
+    : m_data(nullptr), m_size(0) {
+  try {
+    this->m_file = std::make_unique<bip::file_mapping>(filename.c_str(),
+                                                       bip::read_only);
+    this->m_region =
+        std::make_unique<bip::mapped_region>(*this->m_file, bip::read_only);
+  } catch (const bip::interprocess_exception &e) {
+    adcircmodules_throw_exception("Could not map file " + filename + ": " +
+                                  e.what());
+  }
+  this->m_data = static_cast<const char *>(this->m_region->get_address());
+  this->m_size = this->m_region->get_size();
+}
+
+MappedFile::~MappedFile() = default;
+
+/**
+ * @brief Pointer to the first byte of the mapped file
+ * @return pointer to beginning of file data
+ */
+const char *MappedFile::data() const { return this->m_data; }
+
+/**
+ * @brief Pointer to one past the last byte of the mapped file
+ * @return pointer to end of file data
+ */
+const char *MappedFile::end() const { return this->m_data + this->m_size; }
+
+/**
+ * @brief Size of the mapped file in bytes
+ * @return file size
+ */
+size_t MappedFile::size() const { return this->m_size; }
+
+/**
+ * @brief Returns the position of the first character of the line following
+ * the line which contains position
+ * @param[in] position byte offset into the file
+ * @return byte offset of the next line or size() if there is no next line
+ */
+size_t MappedFile::nextLine(size_t position) const {
+  size_t e = this->lineEnd(position);
+  return e < this->m_size ? e + 1 : this->m_size;
+}
+
+/**
+ * @brief Returns the position of the newline character which terminates the
+ * line containing position
+ * @param[in] position byte offset into the file
+ * @return byte offset of the newline or size() for an unterminated last line
+ */
+size_t MappedFile::lineEnd(size_t position) const {
+  if (position >= this->m_size) return this->m_size;
+  const void *p = std::memchr(this->m_data + position, '\n',
+                              this->m_size - position);
+  return p == nullptr ? this->m_size
+                      : static_cast<const char *>(p) - this->m_data;
+}
+
+/**
+ * @brief Generates the starting byte offset for a number of lines
+ * @param[in] position byte offset of the first line to index
+ * @param[in] numLines number of lines to index
+ * @param[out] offsets vector of size numLines + 1 containing the starting
+ * offset of each line followed by the offset of the line after the last
+ * @return number of lines that were found before the end of file
+ *
+ * The last entry in the offsets vector allows the caller to compute the
+ * extent of each line as [offsets[i], offsets[i+1])
+ */
+size_t MappedFile::lineOffsets(size_t position, size_t numLines,
+                               std::vector<size_t> &offsets) const {
+  offsets.resize(numLines + 1);
+  size_t n = 0;
+  for (; n < numLines && position < this->m_size; ++n) {
+    offsets[n] = position;
+    position = this->nextLine(position);
+  }
+  offsets[n] = position;
+  offsets.resize(n + 1);
+  return n;
+}
@@ -0,0 +1,75 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MAPPEDFILE_H
+#define ADCMOD_MAPPEDFILE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace interprocess {
+class file_mapping;
+class mapped_region;
+}  // namespace interprocess
+}  // namespace boost
+
+namespace Adcirc {
+namespace FileIO {
+
+/**
+ * @class MappedFile
+ * @author Zachary Cobell
+ * @brief Read-only memory mapped view of a file on disk
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The MappedFile class maps an entire file into the address space of the
+ * process so that large ASCII files can be split into lines and parsed
+ * without copying each line into a temporary string. The mapping is
+ * released when the object is destroyed.
+ *
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &filename);
+  ~MappedFile();
+
+  const char *data() const;
+  const char *end() const;
+  size_t size() const;
+
+  size_t lineOffsets(size_t position, size_t numLines,
+                     std::vector<size_t> &offsets) const;
+
+  size_t nextLine(size_t position) const;
+  size_t lineEnd(size_t position) const;
+
+ private:
+  std::unique_ptr<boost::interprocess::file_mapping> m_file;
+  std::unique_ptr<boost::interprocess::mapped_region> m_region;
+  const char *m_data;
+  size_t m_size;
+};
+
+}  // namespace FileIO
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MAPPEDFILE_H
@@ -129,6 +129,41 @@ void Mesh::setFilename(const std::string &filename) {
   this->m_impl->setFilename(filename);
 }
 
+/**
+ * @brief Returns the method used to read ASCII formatted meshes
+ * @return reader mode
+ */
+Adcirc::Geometry::MeshReaderMode Mesh::readerMode() const {
+  return this->m_impl->readerMode();
+}
+
+/**
+ * @brief Sets the method used to read ASCII formatted meshes
+ * @param[in] readerMode MeshReaderStream to read line by line or
+ * MeshReaderMapped to memory map the file and parse it in parallel
+ */
+void Mesh::setReaderMode(Adcirc::Geometry::MeshReaderMode readerMode) {
+  this->m_impl->setReaderMode(readerMode);
+}
+
+/**
+ * @brief Returns the name of the binary cache used when reading the mesh
+ * @return cache file name, empty if no cache is used
+ */
+std::string Mesh::cacheFile() const { return this->m_impl->cacheFile(); }
+
+/**
+ * @brief Sets a binary cache file to use when reading the mesh
+ * @param[in] cacheFile name of the cache file, or an empty string to disable
+ *
+ * When a cache file is set, Mesh::read computes the hash of the source file
+ * and loads the mesh from the cache if it was generated from identical file
+ * contents. Otherwise, the source file is read and the cache is rewritten.
+ */
+void Mesh::setCacheFile(const std::string &cacheFile) {
+  this->m_impl->setCacheFile(cacheFile);
+}
+
 /**
  * @brief Returns the mesh header from the processed mesh
  * @return mesh header
@@ -455,6 +490,52 @@ size_t Mesh::findElement(double x, double y, std::vector<double> &weights) {
   return this->m_impl->findElement(x, y, weights);
 }
 
+/**
+ * @brief Finds the nearest mesh node to each of a set of locations
+ * @param[in] x locations to search
+ * @param[in] y locations to search
+ * @return nearest node index for each location
+ *
+ * The search is run in parallel when OpenMP is available
+ */
+std::vector<size_t> Mesh::findNearestNodes(const std::vector<double> &x,
+                                           const std::vector<double> &y) {
+  return this->m_impl->findNearestNodes(x, y);
+}
+
+/**
+ * @brief Finds the mesh element that each of a set of locations lies within
+ * @param[in] x locations to search
+ * @param[in] y locations to search
+ * @return element index for each location, ELEMENT_NOT_FOUND if the location
+ * is outside the mesh
+ *
+ * The search is run in parallel when OpenMP is available
+ */
+std::vector<size_t> Mesh::findElements(const std::vector<double> &x,
+                                       const std::vector<double> &y) {
+  return this->m_impl->findElements(x, y, nullptr);
+}
+
+/**
+ * @brief Finds the mesh element that each of a set of locations lies within
+ * and the interpolation weights for each location
+ * @param[in] x locations to search
+ * @param[in] y locations to search
+ * @param[out] weights interpolation weights. The weights for location i are
+ * stored at i*MAX_NODES_PER_ELEMENT in the order of the element's nodes.
+ * Unused entries and entries for locations outside the mesh are zero.
+ * @return element index for each location, ELEMENT_NOT_FOUND if the location
+ * is outside the mesh
+ *
+ * The search is run in parallel when OpenMP is available
+ */
+std::vector<size_t> Mesh::findElements(const std::vector<double> &x,
+                                       const std::vector<double> &y,
+                                       std::vector<double> &weights) {
+  return this->m_impl->findElements(x, y, &weights);
+}
+
 /**
  * @brief Returns a pointer to the requested node in the internal node vector
  * @param[in] index location of the node in the vector
@@ -101,6 +101,9 @@ class Mesh {
   static constexpr size_t ADCIRCMODULES_EXPORT ELEMENT_NOT_FOUND =
       adcircmodules_default_value<size_t>();
 
+  /// Number of weights stored for each point by findElements
+  static constexpr size_t ADCIRCMODULES_EXPORT MAX_NODES_PER_ELEMENT = 4;
+
   void ADCIRCMODULES_EXPORT
   read(Adcirc::Geometry::MeshFormat format = MeshUnknown);
 
@@ -111,6 +114,13 @@ class Mesh {
   std::string ADCIRCMODULES_EXPORT filename() const;
   void ADCIRCMODULES_EXPORT setFilename(const std::string &filename);
 
+  Adcirc::Geometry::MeshReaderMode ADCIRCMODULES_EXPORT readerMode() const;
+  void ADCIRCMODULES_EXPORT
+  setReaderMode(Adcirc::Geometry::MeshReaderMode readerMode);
+
+  std::string ADCIRCMODULES_EXPORT cacheFile() const;
+  void ADCIRCMODULES_EXPORT setCacheFile(const std::string &cacheFile);
+
   std::string ADCIRCMODULES_EXPORT meshHeaderString() const;
   void ADCIRCMODULES_EXPORT
   setMeshHeaderString(const std::string &meshHeaderString);
@@ -172,6 +182,14 @@ class Mesh {
   size_t ADCIRCMODULES_EXPORT findElement(double x, double y,
                                           std::vector<double> &weights);
 
+  std::vector<size_t> ADCIRCMODULES_EXPORT
+  findNearestNodes(const std::vector<double> &x, const std::vector<double> &y);
+  std::vector<size_t> ADCIRCMODULES_EXPORT
+  findElements(const std::vector<double> &x, const std::vector<double> &y);
+  std::vector<size_t> ADCIRCMODULES_EXPORT
+  findElements(const std::vector<double> &x, const std::vector<double> &y,
+               std::vector<double> &weights);
+
   Adcirc::Geometry::Node ADCIRCMODULES_EXPORT *node(size_t index);
   Adcirc::Geometry::Element ADCIRCMODULES_EXPORT *element(size_t index);
   Adcirc::Geometry::Boundary ADCIRCMODULES_EXPORT *openBoundary(size_t index);
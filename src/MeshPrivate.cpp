@@ -19,20 +19,30 @@
 #include "MeshPrivate.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <set>
 #include <string>
 #include <tuple>
 #include <utility>
 
 #include "AdcHash.h"
+#include "AsciiWriter.h"
 #include "DefaultValues.h"
 #include "ElementTable.h"
 #include "FPCompare.h"
+#include "FeatureWriter.h"
 #include "FileIO.h"
 #include "FileTypes.h"
+#include "Formatting.h"
 #include "KDTree.h"
 #include "Logging.h"
+#include "MappedFile.h"
 #include "Mesh.h"
+#include "MeshRasterizer.h"
 #include "Projection.h"
 #include "StringConversion.h"
 #include "boost/format.hpp"
@@ -45,6 +55,7 @@
 #endif
 
 #ifdef USE_GDAL
+#include "RasterFileWriter.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "gdal_priv.h"
@@ -61,6 +72,7 @@ Adcirc::Geometry::Mesh::~Mesh() = default;
  */
 MeshPrivate::MeshPrivate()
     : m_hashType(Adcirc::Cryptography::AdcircDefaultHash),
+      m_readerMode(Adcirc::Geometry::MeshReaderStream),
       m_filename("none"),
       m_epsg(-1),
       m_topology(std::make_unique<Adcirc::Geometry::Topology>(this)) {
@@ -73,6 +85,7 @@ MeshPrivate::MeshPrivate()
  */
 MeshPrivate::MeshPrivate(std::string filename)
     : m_hashType(Adcirc::Cryptography::AdcircDefaultHash),
+      m_readerMode(Adcirc::Geometry::MeshReaderStream),
       m_filename(std::move(filename)),
       m_epsg(-1),
       m_topology(std::make_unique<Adcirc::Geometry::Topology>(this)) {
@@ -147,6 +160,51 @@ void MeshPrivate::setFilename(const std::string &filename) {
   this->m_filename = filename;
 }
 
+/**
+ * @brief Returns the method used to read ASCII formatted meshes
+ * @return reader mode
+ */
+Adcirc::Geometry::MeshReaderMode MeshPrivate::readerMode() const {
+  return this->m_readerMode;
+}
+
+/**
+ * @brief Sets the method used to read ASCII formatted meshes
+ * @param readerMode reader mode
+ */
+void MeshPrivate::setReaderMode(Adcirc::Geometry::MeshReaderMode readerMode) {
+  this->m_readerMode = readerMode;
+}
+
+/**
+ * @brief Returns the name of the binary cache used when reading the mesh
+ * @return cache file name, empty if no cache is used
+ */
+std::string MeshPrivate::cacheFile() const { return this->m_cacheFile; }
+
+/**
+ * @brief Sets the name of the binary cache used when reading the mesh
+ * @param cacheFile name of the cache file, or an empty string to disable
+ */
+void MeshPrivate::setCacheFile(const std::string &cacheFile) {
+  this->m_cacheFile = cacheFile;
+}
+
+/**
+ * @brief Returns the structure of arrays storage behind the nodes and
+ * elements of the mesh
+ * @return reference to mesh storage
+ *
+ * The node and element vectors are re-attached to the storage first in
+ * case they were modified through the vector pointers returned by
+ * MeshPrivate::nodes or MeshPrivate::elements
+ */
+Adcirc::Private::MeshStorage &MeshPrivate::storage() {
+  this->m_storage.bindNodes(this->m_nodes);
+  this->m_storage.bindElements(this->m_elements);
+  return this->m_storage;
+}
+
 /**
  * @brief Returns the mesh header from the processed mesh
  * @return mesh header
@@ -175,6 +233,7 @@ size_t MeshPrivate::numNodes() const { return this->m_nodes.size(); }
  */
 void MeshPrivate::setNumNodes(size_t numNodes) {
   this->m_nodes.resize(numNodes);
+  this->m_storage.bindNodes(this->m_nodes);
 }
 
 /**
@@ -189,6 +248,7 @@ size_t MeshPrivate::numElements() const { return this->m_elements.size(); }
  */
 void MeshPrivate::setNumElements(size_t numElements) {
   this->m_elements.resize(numElements);
+  this->m_storage.bindElements(this->m_elements);
 }
 
 /**
@@ -247,10 +307,40 @@ void MeshPrivate::read(MeshFormat format) {
 
   //...Wipes the old data if it was there
   this->_init();
+  this->resizeMesh(0, 0, 0, 0);
+  this->m_nodeLookup.clear();
+  this->m_elementLookup.clear();
 
-  switch (fmt) {
+  if (this->m_cacheFile.empty() || fmt == MeshAdcircBinary) {
+    this->readFormat(fmt);
+    return;
+  }
+
+  //...Reuse the binary cache if it was generated from this exact file,
+  //   otherwise read the original file and regenerate the cache
+  std::string sourceHash =
+      MeshPrivate::fileHash(this->m_filename, this->m_hashType);
+  if (MeshPrivate::binaryMeshSourceHash(this->m_cacheFile, this->m_hashType) ==
+      sourceHash) {
+    this->readAdcircMeshBinary(this->m_cacheFile);
+  } else {
+    this->readFormat(fmt);
+    this->writeAdcircMeshBinary(this->m_cacheFile, sourceHash);
+  }
+}
+
+/**
+ * @brief Calls the reader for the specified mesh format
+ * @param format MeshFormat enum describing the format of the mesh
+ */
+void MeshPrivate::readFormat(MeshFormat format) {
+  switch (format) {
     case MeshAdcirc:
-      this->readAdcircMeshAscii();
+      if (this->m_readerMode == MeshReaderMapped) {
+        this->readAdcircMeshAsciiMapped();
+      } else {
+        this->readAdcircMeshAscii();
+      }
       break;
     case MeshAdcircNetcdf:
       this->readAdcircMeshNetcdf();
@@ -261,13 +351,23 @@ void MeshPrivate::read(MeshFormat format) {
     case MeshDFlow:
       this->readDflowMesh();
       break;
+    case MeshAdcircBinary:
+      this->readAdcircMeshBinary(this->m_filename);
+      break;
     default:
       adcircmodules_throw_exception("Invalid mesh format selected.");
       break;
   }
+
+  //...Readers that append to the node and element vectors produce objects
+  //   that are not yet attached to the mesh storage
+  this->m_storage.bindNodes(this->m_nodes);
+  this->m_storage.bindElements(this->m_elements);
 }
 
 void MeshPrivate::readAdcircMeshNetcdf() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int ierr = nc_open(this->m_filename.c_str(), NC_NOWRITE, &ncid);
   if (ierr != NC_NOERR)
@@ -306,9 +406,9 @@ void MeshPrivate::readAdcircMeshNetcdf() {
     adcircmodules_throw_exception("Could not read nodal data");
   }
 
-  this->m_nodes.reserve(nn);
+  this->setNumNodes(nn);
   for (size_t i = 0; i < nn; ++i) {
-    this->m_nodes.emplace_back(i + 1, x[i], y[i], z[i]);
+    this->m_nodes[i].setNode(i + 1, x[i], y[i], z[i]);
   }
 
   this->m_nodeOrderingLogical = true;
@@ -340,14 +440,14 @@ void MeshPrivate::readAdcircMeshNetcdf() {
     adcircmodules_throw_exception("Could not read the element data");
   }
 
-  this->m_elements.reserve(ne);
+  this->setNumElements(ne);
   for (size_t i = 0; i < ne; ++i) {
     if (n4[i] == NC_FILL_INT) {
-      this->m_elements.emplace_back(i + 1, &this->m_nodes[n1[i] - 1],
-                                    &this->m_nodes[n2[i] - 1],
-                                    &this->m_nodes[n3[i] - 1]);
+      this->m_elements[i].setElement(i + 1, &this->m_nodes[n1[i] - 1],
+                                     &this->m_nodes[n2[i] - 1],
+                                     &this->m_nodes[n3[i] - 1]);
     } else {
-      this->m_elements.emplace_back(
+      this->m_elements[i].setElement(
           i + 1, &this->m_nodes[n1[i] - 1], &this->m_nodes[n2[i] - 1],
           &this->m_nodes[n3[i] - 1], &this->m_nodes[n4[i] - 1]);
     }
@@ -371,6 +471,395 @@ void MeshPrivate::readAdcircMeshAscii() {
   fid.close();
 }
 
+/**
+ * @brief Reads an ASCII formatted ADCIRC mesh using a memory mapped file
+ *
+ * The file is mapped into memory and the starting position of each line in
+ * the node and element sections is computed. The lines are then parsed in
+ * parallel without making temporary copies of the data. The boundary
+ * sections are small and are read sequentially using the same routines as
+ * the stream based reader.
+ */
+void MeshPrivate::readAdcircMeshAsciiMapped() {
+  Adcirc::FileIO::MappedFile f(this->filename());
+
+  //...Mesh title and dimensions
+  size_t headerEnd = f.lineEnd(0);
+  this->setMeshHeaderString(StringConversion::sanitizeString(
+      std::string(f.data(), f.data() + headerEnd)));
+
+  size_t dimStart = f.nextLine(headerEnd);
+  size_t dimEnd = f.lineEnd(dimStart);
+  std::string tempLine(f.data() + dimStart, f.data() + dimEnd);
+  std::vector<std::string> tempList;
+  Adcirc::FileIO::Generic::splitString(tempLine, tempList);
+  if (tempList.size() < 2) {
+    adcircmodules_throw_exception("Error reading mesh header");
+  }
+
+  bool ok1, ok2;
+  size_t ne = StringConversion::stringToSizet(tempList[0], ok1);
+  size_t nn = StringConversion::stringToSizet(tempList[1], ok2);
+  if (!ok1 || !ok2) {
+    adcircmodules_throw_exception("Error reading mesh header");
+  }
+
+  //...Position of every line in the node and element sections
+  std::vector<size_t> offsets;
+  if (f.lineOffsets(f.nextLine(dimEnd), nn + ne, offsets) != nn + ne) {
+    adcircmodules_throw_exception("Unexpected end of file in mesh");
+  }
+
+  //...Nodes
+  this->setNumNodes(nn);
+  bool nodeError = false;
+  bool nodeOrderingLogical = true;
+
+#pragma omp parallel for schedule(static) \
+    reduction(|| : nodeError) reduction(&& : nodeOrderingLogical)
+  for (size_t i = 0; i < nn; ++i) {
+    size_t id;
+    double x, y, z;
+    if (!FileIO::AdcircIO::splitStringNodeFormat(f.data() + offsets[i],
+                                                 f.data() + offsets[i + 1],
+                                                 id, x, y, z)) {
+      nodeError = true;
+      continue;
+    }
+    if (i != id - 1) nodeOrderingLogical = false;
+    this->m_nodes[i].setNode(id, x, y, z);
+  }
+
+  if (nodeError) {
+    adcircmodules_throw_exception("Error reading nodes");
+  }
+
+  this->m_nodeOrderingLogical = nodeOrderingLogical;
+  if (!this->m_nodeOrderingLogical) {
+    this->buildNodeLookupTable();
+  }
+
+  //...Elements
+  this->setNumElements(ne);
+  bool elementError = false;
+  bool elementOrderingLogical = true;
+
+#pragma omp parallel for schedule(static) \
+    reduction(|| : elementError) reduction(&& : elementOrderingLogical)
+  for (size_t i = 0; i < ne; ++i) {
+    size_t id, n;
+    std::array<size_t, 4> nodes;
+    if (!FileIO::AdcircIO::splitStringElemFormat(
+            f.data() + offsets[nn + i], f.data() + offsets[nn + i + 1], id, n,
+            nodes)) {
+      elementError = true;
+      continue;
+    }
+    if (n != 3 && n != 4) continue;
+
+    std::array<Node *, 4> np{nullptr, nullptr, nullptr, nullptr};
+    for (size_t j = 0; j < n; ++j) {
+      size_t idx;
+      if (this->m_nodeOrderingLogical) {
+        idx = nodes[j] - 1;
+      } else {
+        auto it = this->m_nodeLookup.find(nodes[j]);
+        idx = it == this->m_nodeLookup.end() ? nn : it->second;
+      }
+      if (idx >= nn) {
+        elementError = true;
+        break;
+      }
+      np[j] = &this->m_nodes[idx];
+    }
+    if (np[n - 1] == nullptr) continue;
+
+    //...Element ordering is only checked for meshes with unordered nodes
+    //   to match the behavior of the stream reader
+    if (!this->m_nodeOrderingLogical && i != id - 1) {
+      elementOrderingLogical = false;
+    }
+
+    if (n == 3) {
+      this->m_elements[i].setElement(id, np[0], np[1], np[2]);
+    } else {
+      this->m_elements[i].setElement(id, np[0], np[1], np[2], np[3]);
+    }
+  }
+
+  if (elementError) {
+    adcircmodules_throw_exception("Error reading elements");
+  }
+
+  this->m_elementOrderingLogical = elementOrderingLogical;
+  if (!this->m_elementOrderingLogical) {
+    this->m_elementLookup.reserve(this->numElements());
+    for (size_t i = 0; i < this->numElements(); ++i) {
+      this->m_elementLookup[this->m_elements[i].id()] = i;
+    }
+  }
+
+  //...Boundaries
+  std::ifstream fid(this->filename());
+  fid.seekg(static_cast<std::streamoff>(offsets.back()));
+  this->readAdcircOpenBoundaries(fid);
+  this->readAdcircLandBoundaries(fid);
+  fid.close();
+}
+
+/**
+ * The binary mesh format stores every value as a 64-bit word in native byte
+ * order so that each section can be used in place from a memory mapped file.
+ * The file begins with a fixed header followed by three strings (mesh title,
+ * hash of the file the cache was generated from and the mesh hash), each
+ * padded to a multiple of 8 bytes. The header is followed by flat arrays for
+ * node ids, x, y, z, element ids, element connectivity (4 zero based node
+ * indices per element, unused vertices set to c_binaryMeshNoNode), boundary
+ * codes and lengths, boundary node indices and the six weir attribute
+ * arrays.
+ */
+static const char c_binaryMeshMagic[8] = {'A', 'D', 'C', 'M',
+                                          'E', 'S', 'H', 'B'};
+static constexpr uint64_t c_binaryMeshVersion = 1;
+static constexpr uint64_t c_binaryMeshByteOrder = 0x0102030405060708;
+static constexpr uint64_t c_binaryMeshNoNode =
+    std::numeric_limits<uint64_t>::max();
+static constexpr size_t c_binaryMeshHeaderWords = 11;
+
+/**
+ * @brief Returns a pointer to the next section of a binary mesh and advances
+ * the position past the section
+ * @param f mapped binary mesh file
+ * @param position current position in the file, updated on return
+ * @param numValues number of 64-bit values in the section
+ * @return pointer to the first value in the section
+ */
+template <typename T>
+static const T *binaryMeshSection(const Adcirc::FileIO::MappedFile &f,
+                                  size_t &position, size_t numValues) {
+  static_assert(sizeof(T) == sizeof(uint64_t),
+                "Binary mesh values must be 64-bit");
+  if (numValues > (f.size() - position) / sizeof(T)) {
+    adcircmodules_throw_exception("Unexpected end of file in binary mesh");
+  }
+  const T *p = reinterpret_cast<const T *>(f.data() + position);
+  position += numValues * sizeof(T);
+  return p;
+}
+
+/**
+ * @brief Reads a padded string from a binary mesh
+ * @param f mapped binary mesh file
+ * @param position current position in the file, updated on return
+ * @return string read from the file
+ */
+static std::string binaryMeshString(const Adcirc::FileIO::MappedFile &f,
+                                    size_t &position) {
+  uint64_t length = *binaryMeshSection<uint64_t>(f, position, 1);
+  size_t words = (length + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  const char *s = reinterpret_cast<const char *>(
+      binaryMeshSection<uint64_t>(f, position, words));
+  return std::string(s, length);
+}
+
+/**
+ * @brief Checks that a file is a binary mesh that can be read by this
+ * version of the code and returns the header values
+ * @param f mapped binary mesh file
+ * @param position position after the fixed header on return
+ * @return pointer to the fixed header words, nullptr if the file is not a
+ * compatible binary mesh
+ */
+static const uint64_t *binaryMeshHeader(const Adcirc::FileIO::MappedFile &f,
+                                        size_t &position) {
+  position = 0;
+  if (f.size() < sizeof(c_binaryMeshMagic) +
+                     c_binaryMeshHeaderWords * sizeof(uint64_t) ||
+      std::memcmp(f.data(), c_binaryMeshMagic, sizeof(c_binaryMeshMagic)) !=
+          0) {
+    return nullptr;
+  }
+  position = sizeof(c_binaryMeshMagic);
+  const uint64_t *header =
+      binaryMeshSection<uint64_t>(f, position, c_binaryMeshHeaderWords);
+  if (header[0] != c_binaryMeshByteOrder || header[1] != c_binaryMeshVersion) {
+    return nullptr;
+  }
+  return header;
+}
+
+/**
+ * @brief Computes the hash of the contents of a file
+ * @param filename file to hash
+ * @param hashType type of hash to compute
+ * @return hash string
+ */
+std::string MeshPrivate::fileHash(const std::string &filename,
+                                  Adcirc::Cryptography::HashType hashType) {
+  Adcirc::FileIO::MappedFile f(filename);
+  Adcirc::Cryptography::Hash h(hashType);
+  h.addData(f.data(), f.size());
+  std::unique_ptr<char[]> hash(h.getHash());
+  return std::string(hash.get());
+}
+
+/**
+ * @brief Returns the hash of the source file that a binary mesh cache was
+ * generated from
+ * @param filename name of the binary mesh
+ * @param hashType type of hash expected by the caller
+ * @return source file hash, or an empty string if the file does not exist,
+ * is not a compatible binary mesh or was hashed with a different algorithm
+ */
+std::string MeshPrivate::binaryMeshSourceHash(
+    const std::string &filename, Adcirc::Cryptography::HashType hashType) {
+  std::ifstream fid(filename, std::ios::binary | std::ios::ate);
+  if (!fid || fid.tellg() <= 0) return std::string();
+  fid.close();
+
+  Adcirc::FileIO::MappedFile f(filename);
+  size_t position;
+  const uint64_t *header = binaryMeshHeader(f, position);
+  if (header == nullptr || header[2] != static_cast<uint64_t>(hashType)) {
+    return std::string();
+  }
+  binaryMeshString(f, position);
+  return binaryMeshString(f, position);
+}
+
+/**
+ * @brief Reads a mesh in the ADCIRCModules binary format
+ * @param filename name of the binary mesh
+ *
+ * The file is memory mapped and the flat arrays are copied directly into
+ * the mesh objects. No text parsing is required.
+ */
+void MeshPrivate::readAdcircMeshBinary(const std::string &filename) {
+  Adcirc::FileIO::MappedFile f(filename);
+
+  size_t position;
+  const uint64_t *header = binaryMeshHeader(f, position);
+  if (header == nullptr) {
+    adcircmodules_throw_exception("File is not a compatible binary mesh");
+  }
+
+  auto hashType = static_cast<Adcirc::Cryptography::HashType>(header[2]);
+  int epsg = static_cast<int>(static_cast<int64_t>(header[3]));
+  uint64_t flags = header[4];
+  size_t nn = header[5];
+  size_t ne = header[6];
+  size_t nopen = header[7];
+  size_t nland = header[8];
+  size_t nbnode = header[9];
+
+  this->setMeshHeaderString(binaryMeshString(f, position));
+  binaryMeshString(f, position);
+  std::string meshHash = binaryMeshString(f, position);
+
+  this->defineProjection(epsg, (flags & 0x1) != 0);
+  this->m_nodeOrderingLogical = (flags & 0x2) != 0;
+  this->m_elementOrderingLogical = (flags & 0x4) != 0;
+
+  const auto *nodeId = binaryMeshSection<uint64_t>(f, position, nn);
+  const auto *x = binaryMeshSection<double>(f, position, nn);
+  const auto *y = binaryMeshSection<double>(f, position, nn);
+  const auto *z = binaryMeshSection<double>(f, position, nn);
+  const auto *elementId = binaryMeshSection<uint64_t>(f, position, ne);
+  const auto *connectivity = binaryMeshSection<uint64_t>(f, position, 4 * ne);
+  const auto *boundaryCode =
+      binaryMeshSection<int64_t>(f, position, nopen + nland);
+  const auto *boundaryLength =
+      binaryMeshSection<uint64_t>(f, position, nopen + nland);
+  const auto *node1 = binaryMeshSection<uint64_t>(f, position, nbnode);
+  const auto *node2 = binaryMeshSection<uint64_t>(f, position, nbnode);
+  const auto *crest = binaryMeshSection<double>(f, position, nbnode);
+  const auto *supercritical = binaryMeshSection<double>(f, position, nbnode);
+  const auto *subcritical = binaryMeshSection<double>(f, position, nbnode);
+  const auto *pipeHeight = binaryMeshSection<double>(f, position, nbnode);
+  const auto *pipeDiameter = binaryMeshSection<double>(f, position, nbnode);
+  const auto *pipeCoefficient = binaryMeshSection<double>(f, position, nbnode);
+
+  this->setNumNodes(nn);
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < nn; ++i) {
+    this->m_nodes[i].setNode(nodeId[i], x[i], y[i], z[i]);
+  }
+
+  this->setNumElements(ne);
+  bool elementError = false;
+#pragma omp parallel for schedule(static) reduction(|| : elementError)
+  for (size_t i = 0; i < ne; ++i) {
+    const uint64_t *c = &connectivity[4 * i];
+    if (c[0] >= nn || c[1] >= nn || c[2] >= nn ||
+        (c[3] != c_binaryMeshNoNode && c[3] >= nn)) {
+      elementError = true;
+      continue;
+    }
+    if (c[3] == c_binaryMeshNoNode) {
+      this->m_elements[i].setElement(elementId[i], &this->m_nodes[c[0]],
+                                     &this->m_nodes[c[1]],
+                                     &this->m_nodes[c[2]]);
+    } else {
+      this->m_elements[i].setElement(elementId[i], &this->m_nodes[c[0]],
+                                     &this->m_nodes[c[1]],
+                                     &this->m_nodes[c[2]],
+                                     &this->m_nodes[c[3]]);
+    }
+  }
+  if (elementError) {
+    adcircmodules_throw_exception("Invalid connectivity in binary mesh");
+  }
+
+  if (!this->m_nodeOrderingLogical) this->buildNodeLookupTable();
+  if (!this->m_elementOrderingLogical) {
+    this->m_elementLookup.reserve(ne);
+    for (size_t i = 0; i < ne; ++i) {
+      this->m_elementLookup[this->m_elements[i].id()] = i;
+    }
+  }
+
+  this->m_openBoundaries.resize(nopen);
+  this->m_landBoundaries.resize(nland);
+  size_t k = 0;
+  for (size_t i = 0; i < nopen + nland; ++i) {
+    Boundary &b = i < nopen ? this->m_openBoundaries[i]
+                            : this->m_landBoundaries[i - nopen];
+    b.setBoundary(static_cast<int>(boundaryCode[i]), boundaryLength[i]);
+    if (k + b.length() > nbnode) {
+      adcircmodules_throw_exception("Invalid boundary in binary mesh");
+    }
+    for (size_t j = 0; j < b.length(); ++j, ++k) {
+      if (node1[k] >= nn) {
+        adcircmodules_throw_exception("Invalid boundary in binary mesh");
+      }
+      b.setNode1(j, &this->m_nodes[node1[k]]);
+      if (b.isWeir()) {
+        b.setCrestElevation(j, crest[k]);
+        b.setSupercriticalWeirCoefficient(j, supercritical[k]);
+      }
+      if (b.isInternalWeir()) {
+        if (node2[k] >= nn) {
+          adcircmodules_throw_exception("Invalid boundary in binary mesh");
+        }
+        b.setNode2(j, &this->m_nodes[node2[k]]);
+        b.setSubcriticalWeirCoefficient(j, subcritical[k]);
+      }
+      if (b.isInternalWeirWithPipes()) {
+        b.setPipeHeight(j, pipeHeight[k]);
+        b.setPipeDiameter(j, pipeDiameter[k]);
+        b.setPipeCoefficient(j, pipeCoefficient[k]);
+      }
+    }
+  }
+
+  //...The stored hash is only valid if the same algorithm is in use
+  if (!meshHash.empty() && hashType == this->m_hashType) {
+    this->m_hash.reset(new char[meshHash.size() + 1]);
+    std::copy(meshHash.begin(), meshHash.end(), this->m_hash.get());
+    this->m_hash[meshHash.size()] = '\0';
+  }
+}
+
 /**
  * @brief Reads an Aquaveo generic mesh format (2dm)
  *
@@ -386,6 +875,8 @@ void MeshPrivate::read2dmMesh() {
  * @brief Read a DFlow-FM unstructured mesh file
  */
 void MeshPrivate::readDflowMesh() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid;
   int ierr = nc_open(this->m_filename.c_str(), NC_NOWRITE, &ncid);
 
@@ -445,15 +936,16 @@ void MeshPrivate::readDflowMesh() {
     return;
   }
 
-  this->m_nodes.resize(nn);
+  this->setNumNodes(nn);
   for (size_t i = 0; i < nn; ++i) {
-    this->m_nodes[i] = Node(i + 1, xcoor[i], ycoor[i], zcoor[i]);
+    this->m_nodes[i].setNode(i + 1, xcoor[i], ycoor[i], zcoor[i]);
   }
 
   xcoor.clear();
   ycoor.clear();
   zcoor.clear();
 
+  this->setNumElements(ne);
   for (size_t i = 0; i < ne; ++i) {
     std::vector<size_t> n(nmaxnode);
     size_t nfill = 0;
@@ -469,7 +961,6 @@ void MeshPrivate::readDflowMesh() {
       return;
     }
 
-    this->m_elements.resize(ne);
     if (nnodeelem == 3) {
       Element etemp(i + 1, &this->m_nodes[n[0] - 1], &this->m_nodes[n[1] - 1],
                     &this->m_nodes[n[2] - 1]);
@@ -601,6 +1092,8 @@ Adcirc::Geometry::MeshFormat MeshPrivate::getMeshFormat(
   std::string extension = Adcirc::FileIO::Generic::getFileExtension(filename);
   if (extension == ".14" || extension == ".grd") {
     return MeshAdcirc;
+  } else if (extension == ".14b") {
+    return MeshAdcircBinary;
   } else if (extension == ".2dm") {
     return Mesh2DM;
   } else if (filename.find("_net.nc") != std::string::npos) {
@@ -653,8 +1146,6 @@ void MeshPrivate::readAdcircMeshHeader(std::ifstream &fid) {
  * @param fid std::ifstream reference for the currently opened mesh
  */
 void MeshPrivate::readAdcircNodes(std::ifstream &fid) {
-  this->m_nodes.resize(this->numNodes());
-
   size_t i = 0;
   for (auto &n : this->m_nodes) {
     size_t id;
@@ -670,7 +1161,7 @@ void MeshPrivate::readAdcircNodes(std::ifstream &fid) {
       this->m_nodeOrderingLogical = false;
     }
 
-    n = Node(id, x, y, z);
+    n.setNode(id, x, y, z);
     i++;
   }
 
@@ -687,8 +1178,6 @@ void MeshPrivate::readAdcircElements(std::ifstream &fid) {
   size_t id;
   std::string tempLine;
 
-  this->m_elements.resize(this->numElements());
-
   if (this->m_nodeOrderingLogical) {
     for (auto &e : this->m_elements) {
       std::getline(fid, tempLine);
@@ -925,6 +1414,21 @@ Adcirc::Kdtree *MeshPrivate::nodalSearchTree() const {
   return m_nodalSearchTree.get();
 }
 
+/**
+ * @brief Returns the point location index used to find the element containing
+ * a point, building it if required
+ * @return element locator
+ */
+const ElementLocator &MeshPrivate::elementLocator() {
+  if (!this->m_elementLocator.initialized()) {
+    std::lock_guard<std::mutex> lock(this->m_elementLocatorMutex);
+    if (!this->m_elementLocator.initialized()) {
+      this->m_elementLocator.build(this->m_elements);
+    }
+  }
+  return this->m_elementLocator;
+}
+
 /**
  * @brief Returns the number of land boundary nodes in the mesh
  * @return Number of nodes that fall on a land boundary
@@ -943,9 +1447,7 @@ size_t MeshPrivate::totalLandBoundaryNodes() {
  */
 void MeshPrivate::setZ(std::vector<double> &z) {
   assert(z.size() == this->numNodes());
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->m_nodes[i].setZ(z[i]);
-  }
+  std::copy(z.begin(), z.end(), this->storage().z().begin());
 }
 
 /**
@@ -1163,44 +1665,49 @@ void MeshPrivate::reproject(int epsg) {
     this->node(i)->setX(xout[i]);
     this->node(i)->setY(yout[i]);
   }
+  this->m_elementLocator.clear();
 
   this->defineProjection(epsg, isLatLon);
 }
 
 /**
  * @brief Writes the mesh nodes into ESRI shapefile format
- * @param outputFile output file with .shp extension
+ * @param outputFile output file with .shp extension. GeoPackage (.gpkg) and
+ * FlatGeobuf (.fgb) files may also be written when the OGR writer is enabled.
  */
 void MeshPrivate::toNodeShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_POINT);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-
-  DBFAddField(dbfid, "nodeid", FTInteger, 16, 0);
-  DBFAddField(dbfid, "longitude", FTDouble, 16, 8);
-  DBFAddField(dbfid, "latitude", FTDouble, 16, 8);
-  DBFAddField(dbfid, "elevation", FTDouble, 16, 4);
-
-  for (auto &n : this->m_nodes) {
-    int nodeid = static_cast<int>(n.id());
-    double longitude = n.x();
-    double latitude = n.y();
-    double elevation = n.z();
-
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_POINT, 1, &longitude, &latitude, &elevation);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
-
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, nodeid);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 1, longitude);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 2, latitude);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 3, elevation);
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
-
-  if (this->m_epsg != 0) {
+  std::unique_ptr<FeatureWriter> writer =
+      FeatureWriter::create(outputFile, FeaturePoint, this->m_epsg);
+  writer->addField("nodeid", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("longitude", FeatureWriter::FieldDouble, 16, 8);
+  writer->addField("latitude", FeatureWriter::FieldDouble, 16, 8);
+  writer->addField("elevation", FeatureWriter::FieldDouble, 16, 4);
+
+  writer->writeFeatures(
+      this->m_nodes.size(), 1,
+      [this](size_t index, size_t slot, FeatureTable &table) {
+        const Node &n = this->m_nodes[index];
+        table.setNumVertices(slot, 1);
+        table.setVertex(slot, 0, n.x(), n.y());
+        table.setAttribute(slot, 0, static_cast<int>(n.id()));
+        table.setAttribute(slot, 1, n.x());
+        table.setAttribute(slot, 2, n.y());
+        table.setAttribute(slot, 3, n.z());
+      });
+  writer->close();
+
+  this->writeShapefilePrj(outputFile);
+}
+
+/**
+ * @brief Writes the .prj file for a shapefile if the mesh has a projection.
+ * Other vector formats store the projection in the file.
+ * @param outputFile name of output file being created
+ */
+void MeshPrivate::writeShapefilePrj(const std::string &outputFile) const {
+  std::string ext = Adcirc::FileIO::Generic::getFileExtension(outputFile);
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  if (this->m_epsg != 0 && ext == ".shp") {
     this->writePrjFile(outputFile);
   }
 }
@@ -1268,113 +1775,78 @@ std::vector<std::pair<Node *, Node *>> MeshPrivate::generateLinkTable() {
 
 /**
  * @brief Writes the mesh connectivity into ESRI shapefile format
- * @param outputFile output file with .shp extension
+ * @param outputFile output file with .shp extension. GeoPackage (.gpkg) and
+ * FlatGeobuf (.fgb) files may also be written when the OGR writer is enabled.
  */
 void MeshPrivate::toConnectivityShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_ARC);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-
-  DBFAddField(dbfid, "node1", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node2", FTInteger, 16, 0);
-  DBFAddField(dbfid, "znode1", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode2", FTDouble, 16, 4);
+  std::unique_ptr<FeatureWriter> writer =
+      FeatureWriter::create(outputFile, FeatureLine, this->m_epsg);
+  writer->addField("node1", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("node2", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("znode1", FeatureWriter::FieldDouble, 16, 4);
+  writer->addField("znode2", FeatureWriter::FieldDouble, 16, 4);
 
   std::vector<std::pair<Node *, Node *>> legs = this->generateLinkTable();
 
-  for (auto &l : legs) {
-    double latitude[2], longitude[2], elevation[2];
-    int nodeid[2];
-
-    nodeid[0] = l.first->id();
-    nodeid[1] = l.second->id();
-    longitude[0] = l.first->x();
-    longitude[1] = l.second->x();
-    latitude[0] = l.first->y();
-    latitude[1] = l.second->y();
-    elevation[0] = l.first->z();
-    elevation[1] = l.second->z();
-
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_ARC, 2, longitude, latitude, elevation);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
+  writer->writeFeatures(
+      legs.size(), 2, [&legs](size_t index, size_t slot, FeatureTable &table) {
+        const Node *n1 = legs[index].first;
+        const Node *n2 = legs[index].second;
+        table.setNumVertices(slot, 2);
+        table.setVertex(slot, 0, n1->x(), n1->y());
+        table.setVertex(slot, 1, n2->x(), n2->y());
+        table.setAttribute(slot, 0, static_cast<int>(n1->id()));
+        table.setAttribute(slot, 1, static_cast<int>(n2->id()));
+        table.setAttribute(slot, 2, n1->z());
+        table.setAttribute(slot, 3, n2->z());
+      });
+  writer->close();
 
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, nodeid[0]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 1, nodeid[1]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 2, elevation[0]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 3, elevation[1]);
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
-
-  if (this->m_epsg != 0) {
-    this->writePrjFile(outputFile);
-  }
+  this->writeShapefilePrj(outputFile);
 }
 
 /**
  * @brief Writes the mesh elements as polygons into ESRI shapefile format
- * @param outputFile output file with .shp extension
+ * @param outputFile output file with .shp extension. GeoPackage (.gpkg) and
+ * FlatGeobuf (.fgb) files may also be written when the OGR writer is enabled.
  */
 void MeshPrivate::toElementShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_POLYGON);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-  DBFAddField(dbfid, "elementid", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node1", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node2", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node3", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node4", FTInteger, 16, 0);
-  DBFAddField(dbfid, "znode1", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode2", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode3", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode4", FTDouble, 16, 4);
-  DBFAddField(dbfid, "zmean", FTDouble, 16, 4);
-
-  for (auto &e : this->m_elements) {
-    double zmean;
-    double longitude[4], latitude[4];
-    double nodeid[4], nodez[4];
-    int id = static_cast<int>(e.id());
-
-    zmean = 0.0;
-    for (size_t i = 0; i < e.n(); ++i) {
-      longitude[i] = e.node(i)->x();
-      latitude[i] = e.node(i)->y();
-      nodez[i] = e.node(i)->z();
-      nodeid[i] = e.node(i)->id();
-      zmean += nodez[i];
-    }
-    zmean = zmean / e.n();
-
-    if (e.n() == 3) {
-      nodez[3] = adcircmodules_default_value<double>();
-      nodeid[3] = -1;
-    }
-
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_POLYGON, e.n(), longitude, latitude, nodez);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
-
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, id);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 1, nodeid[0]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 2, nodeid[1]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 3, nodeid[2]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 4, nodeid[3]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 5, nodez[0]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 6, nodez[1]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 7, nodez[2]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 8, nodez[3]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 9, zmean);
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
+  std::unique_ptr<FeatureWriter> writer =
+      FeatureWriter::create(outputFile, FeaturePolygon, this->m_epsg);
+  writer->addField("elementid", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("node1", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("node2", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("node3", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("node4", FeatureWriter::FieldInteger, 16, 0);
+  writer->addField("znode1", FeatureWriter::FieldDouble, 16, 4);
+  writer->addField("znode2", FeatureWriter::FieldDouble, 16, 4);
+  writer->addField("znode3", FeatureWriter::FieldDouble, 16, 4);
+  writer->addField("znode4", FeatureWriter::FieldDouble, 16, 4);
+  writer->addField("zmean", FeatureWriter::FieldDouble, 16, 4);
+
+  writer->writeFeatures(
+      this->m_elements.size(), 4,
+      [this](size_t index, size_t slot, FeatureTable &table) {
+        const Element &e = this->m_elements[index];
+        double zmean = 0.0;
+        table.setNumVertices(slot, e.n());
+        table.setAttribute(slot, 0, static_cast<int>(e.id()));
+        for (size_t i = 0; i < e.n(); ++i) {
+          const Node *n = e.node(i);
+          table.setVertex(slot, i, n->x(), n->y());
+          table.setAttribute(slot, 1 + i, static_cast<int>(n->id()));
+          table.setAttribute(slot, 5 + i, n->z());
+          zmean += n->z();
+        }
+        if (e.n() == 3) {
+          table.setAttribute(slot, 4, -1);
+          table.setAttribute(slot, 8, adcircmodules_default_value<double>());
+        }
+        table.setAttribute(slot, 9, zmean / e.n());
+      });
+  writer->close();
 
-  if (this->m_epsg != 0) {
-    this->writePrjFile(outputFile);
-  }
+  this->writeShapefilePrj(outputFile);
 }
 
 void MeshPrivate::toBoundaryShapefile(const std::string &outputFile) {
@@ -1643,20 +2115,11 @@ void MeshPrivate::toWeirPolygonShapefile(const std::string &outputFile) {
  */
 void MeshPrivate::buildNodalSearchTree() {
   int ierr;
-  std::vector<double> x, y;
+  std::vector<double> x = this->storage().x();
+  std::vector<double> y = this->storage().y();
 
-  x.reserve(this->numNodes());
-  y.reserve(this->numNodes());
-
-  for (const auto &n : this->m_nodes) {
-    x.push_back(n.x());
-    y.push_back(n.y());
-  }
-
-  if (this->m_nodalSearchTree != nullptr) {
-    if (this->m_nodalSearchTree->initialized()) {
-      this->m_nodalSearchTree.reset(nullptr);
-    }
+  if (this->m_nodalSearchTree->initialized()) {
+    this->m_nodalSearchTree = std::make_unique<Kdtree>();
   }
 
   ierr = this->m_nodalSearchTree->build(x, y);
@@ -1683,16 +2146,17 @@ void MeshPrivate::buildElementalSearchTree() {
     y.push_back(tempY);
   }
 
-  if (this->m_elementalSearchTree != nullptr) {
-    if (this->m_elementalSearchTree->initialized()) {
-      this->m_elementalSearchTree.reset(nullptr);
-    }
+  if (this->m_elementalSearchTree->initialized()) {
+    this->m_elementalSearchTree = std::make_unique<Kdtree>();
   }
 
   int ierr = this->m_elementalSearchTree->build(x, y);
   if (ierr != Kdtree::NoError) {
     adcircmodules_throw_exception("Mesh: KDTree2 library error");
   }
+
+  std::lock_guard<std::mutex> lock(this->m_elementLocatorMutex);
+  this->m_elementLocator.build(this->m_elements);
 }
 
 /**
@@ -1700,7 +2164,7 @@ void MeshPrivate::buildElementalSearchTree() {
  */
 void MeshPrivate::deleteNodalSearchTree() {
   if (this->nodalSearchTreeInitialized()) {
-    this->m_nodalSearchTree.reset();
+    this->m_nodalSearchTree = std::make_unique<Kdtree>();
   }
 }
 
@@ -1709,8 +2173,9 @@ void MeshPrivate::deleteNodalSearchTree() {
  */
 void MeshPrivate::deleteElementalSearchTree() {
   if (this->elementalSearchTreeInitialized()) {
-    this->m_elementalSearchTree.reset();
+    this->m_elementalSearchTree = std::make_unique<Kdtree>();
   }
+  this->m_elementLocator.clear();
 }
 
 /**
@@ -1741,6 +2206,7 @@ bool MeshPrivate::elementalSearchTreeInitialized() {
 void MeshPrivate::resizeMesh(size_t numNodes, size_t numElements,
                              size_t numOpenBoundaries,
                              size_t numLandBoundaries) {
+  this->m_elementLocator.clear();
   if (numNodes != this->numNodes()) {
     this->setNumNodes(numNodes);
   }
@@ -1768,6 +2234,7 @@ void MeshPrivate::addNode(size_t index, const Node &node) {
     this->m_nodes[index] = node;
   } else if (index == this->numNodes()) {
     this->m_nodes.push_back(node);
+    this->m_storage.bindNodes(this->m_nodes);
   } else {
     adcircmodules_throw_exception("Mesh: Node index > number of nodes");
   }
@@ -1801,10 +2268,12 @@ void MeshPrivate::deleteNode(size_t index) {
  * @param element reference to the Element to add
  */
 void MeshPrivate::addElement(size_t index, const Element &element) {
+  this->m_elementLocator.clear();
   if (index < this->numElements()) {
     this->m_elements[index] = element;
   } else if (index == this->numElements()) {
     this->m_elements.push_back(element);
+    this->m_storage.bindElements(this->m_elements);
   } else {
     adcircmodules_throw_exception("Mesh: Element index > number of elements");
   }
@@ -1816,6 +2285,7 @@ void MeshPrivate::addElement(size_t index, const Element &element) {
  * @param index location where the element should be deleted from
  */
 void MeshPrivate::deleteElement(size_t index) {
+  this->m_elementLocator.clear();
   if (index < this->numElements()) {
     this->m_elements.erase(this->m_elements.begin() + index);
     this->setNumElements(this->m_elements.size());
@@ -1889,6 +2359,9 @@ void MeshPrivate::write(const std::string &outputFile, MeshFormat format) {
     case MeshDFlow:
       this->writeDflowMesh(outputFile);
       break;
+    case MeshAdcircBinary:
+      this->writeAdcircMeshBinary(outputFile);
+      break;
     default:
       adcircmodules_throw_exception("No valid mesh format specified.");
       break;
@@ -1910,15 +2383,30 @@ void MeshPrivate::writeAdcircMesh(const std::string &filename) {
                                       this->numElements() % this->numNodes());
   outputFile << tempString << "\n";
 
-  //...Write the mesh nodes
-  for (auto n : this->m_nodes) {
-    outputFile << n.toAdcircString(this->isLatLon()) << "\n";
+  for (const auto &e : this->m_elements) {
+    if (e.n() != 3 && e.n() != 4) {
+      adcircmodules_throw_exception("Invalid number of nodes in element");
+    }
   }
 
-  //...Write the mesh elements
-  for (auto &e : this->m_elements) {
-    outputFile << e.toAdcircString() << "\n";
-  }
+  //...Write the mesh nodes and elements
+  Adcirc::Private::AsciiWriter writer(outputFile);
+  writer.writeLines(this->numNodes(), [this](char *p, size_t i) {
+    const Node &n = this->m_nodes[i];
+    p = Adcirc::Output::Formatting::adcircMeshNodeLine(p, n.id(), n.x(),
+                                                       n.y(), n.z());
+    *p++ = '\n';
+    return p;
+  });
+  writer.writeLines(this->numElements(), [this](char *p, size_t i) {
+    const Element &e = this->m_elements[i];
+    size_t nodes[4];
+    for (size_t j = 0; j < e.n(); ++j) nodes[j] = e.node(j)->id();
+    p = Adcirc::Output::Formatting::adcircMeshElementLine(p, e.id(), e.n(),
+                                                          nodes);
+    *p++ = '\n';
+    return p;
+  });
 
   //...Write the open boundary header
   outputFile << this->numOpenBoundaries() << "\n";
@@ -1946,6 +2434,176 @@ void MeshPrivate::writeAdcircMesh(const std::string &filename) {
   outputFile.close();
 }
 
+/**
+ * @brief Writes a padded string to a binary mesh
+ * @param fid output stream
+ * @param s string to write
+ */
+static void writeBinaryMeshString(std::ofstream &fid, const std::string &s) {
+  static const char padding[sizeof(uint64_t)] = {0};
+  uint64_t length = s.size();
+  fid.write(reinterpret_cast<const char *>(&length), sizeof(uint64_t));
+  fid.write(s.data(), s.size());
+  fid.write(padding, (sizeof(uint64_t) - length % sizeof(uint64_t)) %
+                         sizeof(uint64_t));
+}
+
+/**
+ * @brief Writes an array to a binary mesh
+ * @param fid output stream
+ * @param v values to write
+ */
+template <typename T>
+static void writeBinaryMeshArray(std::ofstream &fid, const std::vector<T> &v) {
+  static_assert(sizeof(T) == sizeof(uint64_t),
+                "Binary mesh values must be 64-bit");
+  fid.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(T));
+}
+
+/**
+ * @brief Writes an Mesh object to disk in the ADCIRCModules binary format
+ * @param filename name of the output file to write
+ * @param sourceHash hash of the file the mesh was read from when the binary
+ * mesh is used as a cache
+ */
+void MeshPrivate::writeAdcircMeshBinary(const std::string &filename,
+                                        const std::string &sourceHash) {
+  const size_t nn = this->numNodes();
+  const size_t ne = this->numElements();
+  const size_t nopen = this->numOpenBoundaries();
+  const size_t nland = this->numLandBoundaries();
+  const size_t nbnode =
+      this->totalOpenBoundaryNodes() + this->totalLandBoundaryNodes();
+  const Node *firstNode = this->m_nodes.data();
+
+  auto nodeIndex = [&](const Node *n) -> uint64_t {
+    if (n == nullptr || n < firstNode || n >= firstNode + nn) {
+      adcircmodules_throw_exception(
+          "Mesh references a node that is not part of the mesh");
+    }
+    return static_cast<uint64_t>(n - firstNode);
+  };
+
+  std::vector<uint64_t> nodeId(nn);
+  std::vector<double> x(nn), y(nn), z(nn);
+  for (size_t i = 0; i < nn; ++i) {
+    nodeId[i] = this->m_nodes[i].id();
+    x[i] = this->m_nodes[i].x();
+    y[i] = this->m_nodes[i].y();
+    z[i] = this->m_nodes[i].z();
+  }
+
+  std::vector<uint64_t> elementId(ne);
+  std::vector<uint64_t> connectivity(4 * ne, c_binaryMeshNoNode);
+  for (size_t i = 0; i < ne; ++i) {
+    const Element &e = this->m_elements[i];
+    if (e.n() != 3 && e.n() != 4) {
+      adcircmodules_throw_exception(
+          "Binary meshes only support triangles and quadrilaterals");
+    }
+    elementId[i] = e.id();
+    for (size_t j = 0; j < e.n(); ++j) {
+      connectivity[4 * i + j] = nodeIndex(e.node(j));
+    }
+  }
+
+  std::vector<int64_t> boundaryCode;
+  std::vector<uint64_t> boundaryLength;
+  std::vector<uint64_t> node1, node2;
+  std::vector<double> crest, supercritical, subcritical, pipeHeight,
+      pipeDiameter, pipeCoefficient;
+  boundaryCode.reserve(nopen + nland);
+  boundaryLength.reserve(nopen + nland);
+  node1.reserve(nbnode);
+  node2.reserve(nbnode);
+  crest.reserve(nbnode);
+  supercritical.reserve(nbnode);
+  subcritical.reserve(nbnode);
+  pipeHeight.reserve(nbnode);
+  pipeDiameter.reserve(nbnode);
+  pipeCoefficient.reserve(nbnode);
+
+  auto addBoundary = [&](const Boundary &b) {
+    boundaryCode.push_back(b.boundaryCode());
+    boundaryLength.push_back(b.length());
+    for (size_t j = 0; j < b.length(); ++j) {
+      node1.push_back(nodeIndex(b.node1(j)));
+      node2.push_back(b.isInternalWeir() ? nodeIndex(b.node2(j))
+                                         : c_binaryMeshNoNode);
+      crest.push_back(b.isWeir() ? b.crestElevation(j) : 0.0);
+      supercritical.push_back(b.isWeir() ? b.supercriticalWeirCoefficient(j)
+                                         : 0.0);
+      subcritical.push_back(
+          b.isInternalWeir() ? b.subcriticalWeirCoefficient(j) : 0.0);
+      pipeHeight.push_back(b.isInternalWeirWithPipes() ? b.pipeHeight(j)
+                                                       : 0.0);
+      pipeDiameter.push_back(b.isInternalWeirWithPipes() ? b.pipeDiameter(j)
+                                                         : 0.0);
+      pipeCoefficient.push_back(
+          b.isInternalWeirWithPipes() ? b.pipeCoefficient(j) : 0.0);
+    }
+  };
+  for (const auto &b : this->m_openBoundaries) addBoundary(b);
+  for (const auto &b : this->m_landBoundaries) addBoundary(b);
+
+  std::string meshHash;
+#ifdef ADCMOD_HAVE_OPENSSL
+  meshHash = this->hash();
+#endif
+
+  uint64_t flags = (this->m_isLatLon ? 0x1 : 0x0) |
+                   (this->m_nodeOrderingLogical ? 0x2 : 0x0) |
+                   (this->m_elementOrderingLogical ? 0x4 : 0x0);
+  std::vector<uint64_t> header = {c_binaryMeshByteOrder,
+                                  c_binaryMeshVersion,
+                                  static_cast<uint64_t>(this->m_hashType),
+                                  static_cast<uint64_t>(
+                                      static_cast<int64_t>(this->m_epsg)),
+                                  flags,
+                                  nn,
+                                  ne,
+                                  nopen,
+                                  nland,
+                                  nbnode,
+                                  0};
+
+  //...The file is written under a temporary name and moved into place, so a
+  //   reader of a cache that is being regenerated never sees a partial file
+  const std::string temporary =
+      Adcirc::FileIO::Generic::temporaryFilename(filename);
+  std::ofstream fid(temporary, std::ios::binary | std::ios::trunc);
+  if (!fid) {
+    adcircmodules_throw_exception("Could not open binary mesh for writing");
+  }
+  fid.write(c_binaryMeshMagic, sizeof(c_binaryMeshMagic));
+  writeBinaryMeshArray(fid, header);
+  writeBinaryMeshString(fid, this->m_meshHeaderString);
+  writeBinaryMeshString(fid, sourceHash);
+  writeBinaryMeshString(fid, meshHash);
+  writeBinaryMeshArray(fid, nodeId);
+  writeBinaryMeshArray(fid, x);
+  writeBinaryMeshArray(fid, y);
+  writeBinaryMeshArray(fid, z);
+  writeBinaryMeshArray(fid, elementId);
+  writeBinaryMeshArray(fid, connectivity);
+  writeBinaryMeshArray(fid, boundaryCode);
+  writeBinaryMeshArray(fid, boundaryLength);
+  writeBinaryMeshArray(fid, node1);
+  writeBinaryMeshArray(fid, node2);
+  writeBinaryMeshArray(fid, crest);
+  writeBinaryMeshArray(fid, supercritical);
+  writeBinaryMeshArray(fid, subcritical);
+  writeBinaryMeshArray(fid, pipeHeight);
+  writeBinaryMeshArray(fid, pipeDiameter);
+  writeBinaryMeshArray(fid, pipeCoefficient);
+  fid.close();
+  if (!fid) {
+    std::remove(temporary.c_str());
+    adcircmodules_throw_exception("Error writing binary mesh");
+  }
+  Adcirc::FileIO::Generic::replaceFile(temporary, filename);
+}
+
 /**
  * @brief Writes an Mesh object to disk in Aquaveo 2dm ASCII format
  * @param filename name of the output file to write
@@ -1988,6 +2646,8 @@ size_t MeshPrivate::getMaxNodesPerElement() {
  * @param filename name of the output file (*_net.nc)
  */
 void MeshPrivate::writeDflowMesh(const std::string &filename) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   std::vector<std::pair<Node *, Node *>> links = this->generateLinkTable();
   size_t nlinks = links.size();
   size_t maxelemnode = this->getMaxNodesPerElement();
@@ -2220,14 +2880,7 @@ size_t MeshPrivate::elementIndexById(size_t id) {
  *
  * Implemented mostly for the python interface
  */
-std::vector<double> MeshPrivate::x() {
-  std::vector<double> x;
-  x.reserve(this->numNodes());
-  for (const auto &n : this->m_nodes) {
-    x.push_back(n.x());
-  }
-  return x;
-}
+std::vector<double> MeshPrivate::x() { return this->storage().x(); }
 
 /**
  * @brief Returns a vector of the y-coordinates
@@ -2235,14 +2888,7 @@ std::vector<double> MeshPrivate::x() {
  *
  * Implemented mostly for the python interface
  */
-std::vector<double> MeshPrivate::y() {
-  std::vector<double> y;
-  y.reserve(this->numNodes());
-  for (const auto &n : this->m_nodes) {
-    y.push_back(n.y());
-  }
-  return y;
-}
+std::vector<double> MeshPrivate::y() { return this->storage().y(); }
 
 /**
  * @brief Returns a vector of the z-coordinates
@@ -2250,14 +2896,7 @@ std::vector<double> MeshPrivate::y() {
  *
  * Implemented mostly for the python interface
  */
-std::vector<double> MeshPrivate::z() {
-  std::vector<double> z;
-  z.reserve(this->numNodes());
-  for (const auto &n : this->m_nodes) {
-    z.push_back(n.z());
-  }
-  return z;
-}
+std::vector<double> MeshPrivate::z() { return this->storage().z(); }
 
 /**
  * @brief Returns a 2d-vector of the xyz-coordinates
@@ -2306,6 +2945,7 @@ void MeshPrivate::cpp(double lambda, double phi) {
     n.setX(xout);
     n.setY(yout);
   }
+  this->m_elementLocator.clear();
 }
 
 /**
@@ -2318,6 +2958,7 @@ void MeshPrivate::inverseCpp(double lambda, double phi) {
     n.setX(xout);
     n.setY(yout);
   }
+  this->m_elementLocator.clear();
 }
 
 /**
@@ -2382,30 +3023,82 @@ size_t MeshPrivate::findElement(double x, double y) {
  */
 size_t MeshPrivate::findElement(double x, double y,
                                 std::vector<double> &weights) {
-  constexpr int searchDepth = 20;
+  const size_t en = this->elementLocator().find(x, y);
 
-  if (!this->elementalSearchTreeInitialized()) {
-    this->buildElementalSearchTree();
+  if (en == adcircmodules_default_value<size_t>()) {
+    std::fill(weights.begin(), weights.end(), 0.0);
+    return en;
   }
 
-  std::vector<size_t> indicies =
-      this->elementalSearchTree()->findXNearest(x, y, searchDepth);
-  auto en = adcircmodules_default_value<size_t>();
+  this->m_elements[en].interpolationWeights(x, y, weights);
+  return en;
+}
 
-  for (auto i : indicies) {
-    if (this->element(i)->isInside(x, y)) {
-      en = i;
-      break;
-    }
+/**
+ * @brief Finds the nearest mesh node to each of a set of locations
+ * @param x locations to search
+ * @param y locations to search
+ * @return nearest node index for each location
+ */
+std::vector<size_t> MeshPrivate::findNearestNodes(
+    const std::vector<double> &x, const std::vector<double> &y) {
+  if (x.size() != y.size()) {
+    adcircmodules_throw_exception("Mesh: x and y arrays differ in size");
+  }
+  if (!this->nodalSearchTreeInitialized()) {
+    this->buildNodalSearchTree();
   }
 
-  if (en == adcircmodules_default_value<size_t>()) {
-    std::fill(weights.begin(), weights.end(), 0.0);
-    return en;
+  Kdtree *tree = this->m_nodalSearchTree.get();
+  std::vector<size_t> index(x.size());
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < x.size(); ++i) {
+    index[i] = tree->findNearest(x[i], y[i]);
   }
+  return index;
+}
 
-  weights = this->element(en)->interpolationWeights(x, y);
-  return en;
+/**
+ * @brief Finds the mesh element that each of a set of locations lies within
+ * @param x locations to search
+ * @param y locations to search
+ * @param weights if not nullptr, interpolation weights for each location
+ * stored with a stride of Mesh::MAX_NODES_PER_ELEMENT
+ * @return element index for each location, large integer if not found
+ */
+std::vector<size_t> MeshPrivate::findElements(const std::vector<double> &x,
+                                              const std::vector<double> &y,
+                                              std::vector<double> *weights) {
+  constexpr size_t stride = Adcirc::Geometry::Mesh::MAX_NODES_PER_ELEMENT;
+  static_assert(stride == MeshStorage::maxNodesPerElement(),
+                "Weight stride must hold all nodes of an element");
+
+  if (x.size() != y.size()) {
+    adcircmodules_throw_exception("Mesh: x and y arrays differ in size");
+  }
+
+  //...Build the element locator before entering the parallel region
+  const ElementLocator &locator = this->elementLocator();
+
+  std::vector<size_t> index(x.size());
+  if (weights) weights->assign(x.size() * stride, 0.0);
+
+#pragma omp parallel
+  {
+    //...Scratch space reused by each thread for the element weights
+    std::vector<double> w;
+    w.reserve(stride);
+
+#pragma omp for schedule(dynamic, 256)
+    for (size_t i = 0; i < x.size(); ++i) {
+      index[i] = locator.find(x[i], y[i]);
+      if (weights && index[i] != adcircmodules_default_value<size_t>()) {
+        this->m_elements[index[i]].interpolationWeights(x[i], y[i], w);
+        std::copy(w.begin(), w.end(), weights->begin() + i * stride);
+      }
+    }
+  }
+  return index;
 }
 
 /**
@@ -2698,27 +3391,28 @@ bool MeshPrivate::containsElement(const Adcirc::Geometry::Element &e,
   return found;
 }
 
-std::vector<double> MeshPrivate::extent() const {
+std::vector<double> MeshPrivate::extent() {
   double xmax = -std::numeric_limits<double>::max();
   double xmin = std::numeric_limits<double>::max();
   double ymax = -std::numeric_limits<double>::max();
   double ymin = std::numeric_limits<double>::max();
   double zmax = -std::numeric_limits<double>::max();
   double zmin = std::numeric_limits<double>::max();
-  for (auto &n : this->m_nodes) {
-    double x = n.x();
-    double y = n.y();
-    double z = n.z();
-    xmin = std::min(xmin, x);
-    xmax = std::max(xmax, x);
-    ymin = std::min(ymin, y);
-    ymax = std::max(ymax, y);
-    zmin = std::min(zmin, z);
-    zmax = std::max(zmax, z);
+  const Adcirc::Private::MeshStorage &s = this->storage();
+  for (size_t i = 0; i < s.numNodes(); ++i) {
+    xmin = std::min(xmin, s.x()[i]);
+    xmax = std::max(xmax, s.x()[i]);
+    ymin = std::min(ymin, s.y()[i]);
+    ymax = std::max(ymax, s.y()[i]);
+    zmin = std::min(zmin, s.z()[i]);
+    zmax = std::max(zmax, s.z()[i]);
   }
   return std::vector<double>{xmin, ymin, xmax, ymax, zmin, zmax};
 }
 
+//...Width and height of the raster blocks, which are rasterized concurrently
+static constexpr size_t c_rasterTileSize = 512;
+
 void MeshPrivate::toRaster(const std::string &filename,
                            const std::vector<double> &z,
                            const std::vector<double> &extent,
@@ -2729,31 +3423,6 @@ void MeshPrivate::toRaster(const std::string &filename,
 #ifndef USE_GDAL
   adcircmodules_throw_exception("GDAL is not enabled.");
 #else
-
-  auto getfmt = [&](const std::string &ext) -> std::string {
-    if (ext == ".tif") return "GTiff";
-    if (ext == ".img") return "HFA";
-    return std::string();
-  };
-
-  std::string fmt = getfmt(Adcirc::FileIO::Generic::getFileExtension(filename));
-
-  if (fmt.empty()) {
-    adcircmodules_throw_exception("Could not determine the raster format");
-  }
-
-  GDALAllRegister();
-  GDALDriver *driver = GetGDALDriverManager()->GetDriverByName(fmt.c_str());
-
-  char **options = nullptr;
-  if (fmt == "GTiff") {
-    options = CSLSetNameValue(options, "BIGTIFF", "IF_SAFER");
-    options = CSLSetNameValue(options, "TILED", "YES");
-    options = CSLSetNameValue(options, "COMPRESS", "LZW");
-  } else {
-    options = CSLSetNameValue(options, "COMPRESS", "YES");
-  }
-
   double xmax = std::max(extent[0], extent[2]);
   double xmin = std::min(extent[0], extent[2]);
   double ymax = std::max(extent[3], extent[1]);
@@ -2761,172 +3430,39 @@ void MeshPrivate::toRaster(const std::string &filename,
   int nx = std::floor(std::abs(xmax - xmin) / resolution) + 1;
   int ny = std::floor(std::abs(ymax - ymin) / resolution) + 1;
 
-  //...Make sure to fix the extents vector
-  std::vector<double> extent_ordered = {xmin, ymin, xmax, ymax};
-
   if (nx < 3 || ny < 3) {
     adcircmodules_throw_exception("Invalid resolution specified.");
   }
 
-  GDALDataset *raster =
-      driver->Create(filename.c_str(), nx, ny, 1, GDT_Float32, options);
-
-  double transform[6] = {xmin, resolution, 0, ymax, 0, -resolution};
-  raster->SetGeoTransform(transform);
-
-  char *cwkt = nullptr;
-  OGRSpatialReference sref;
-  std::string srefstr = boost::str(boost::format("EPSG:%i") % this->m_epsg);
-  sref.SetWellKnownGeogCS(srefstr.c_str());
-  sref.exportToWkt(&cwkt);
-  raster->SetProjection(cwkt);
-  CPLFree(cwkt);
-
-  GDALRasterBand *band = raster->GetRasterBand(1);
-  band->SetDescription(description.c_str());
-  band->SetUnitType(units.c_str());
-  band->SetNoDataValue(nullvalue);
-  band->Fill(nullvalue);
-
-  std::vector<std::vector<double>> weight;
-  std::vector<size_t> elements;
-  std::tie(weight, elements) =
-      this->computeRasterInterpolationWeights(extent_ordered, nx, ny, resolution);
-  std::vector<float> zr =
-      this->getRasterValues(z, nullvalue, elements, weight, partialWetting);
-
-  CPLErr cr = band->RasterIO(GF_Write, 0, 0, nx, ny, zr.data(), nx, ny,
-                             GDT_Float32, 0, 0);
-  if (cr != CE_None) {
-    GDALClose(static_cast<GDALDatasetH>(raster));
-    CSLDestroy(options);
-    adcircmodules_throw_exception("Error during Raster I/O in GDAL library");
-  }
-
-  double bmin, bmax, bmean, bsigma;
-  band->ComputeStatistics(true, &bmin, &bmax, &bmean, &bsigma, nullptr,
-                          nullptr);
-  band->SetStatistics(bmin, bmax, bmean, bsigma);
-
-  GDALClose(static_cast<GDALDatasetH>(raster));
-  CSLDestroy(options);
-
-#endif
-}
-
-std::vector<float> MeshPrivate::getRasterValues(
-    const std::vector<double> &z, const double nullvalue,
-    const std::vector<size_t> &elements,
-    const std::vector<std::vector<double>> &weights,
-    const bool partialWetting) {
-  size_t sz = elements.size();
-  auto zv = std::vector<float>(sz);
-  for (size_t i = 0; i < sz; ++i) {
-    size_t e = elements[i];
-    if (e == adcircmodules_default_value<size_t>()) {
-      zv[i] = nullvalue;
-    } else {
-      size_t n1 = this->element(e)->node(0)->id() - 1;
-      size_t n2 = this->element(e)->node(1)->id() - 1;
-      size_t n3 = this->element(e)->node(2)->id() - 1;
-      double v1 = z[n1];
-      double v2 = z[n2];
-      double v3 = z[n3];
-      zv[i] = partialWetting ? MeshPrivate::calculateValueWithPartialWetting(
-                                   v1, v2, v3, nullvalue, weights[i])
-                             : MeshPrivate::calculateValueWithoutPartialWetting(
-                                   v1, v2, v3, nullvalue, weights[i]);
+  if (z.size() != this->numNodes()) {
+    adcircmodules_throw_exception(
+        "Number of values does not match the number of mesh nodes");
+  }
+
+  RasterFileWriter raster(filename, nx, ny, xmin, ymax, resolution,
+                          this->m_epsg, nullvalue, description, units,
+                          c_rasterTileSize);
+
+  //...The tiles in each row of tiles are rasterized concurrently and then
+  //   written in order, so only one row of tiles is held in memory
+  MeshRasterizer rasterizer(this->m_nodes, this->m_elements, xmin, ymax,
+                            resolution, nx, ny, c_rasterTileSize);
+  std::vector<std::vector<float>> tiles(rasterizer.numTileColumns());
+  for (size_t row = 0; row < rasterizer.numTileRows(); ++row) {
+#pragma omp parallel for schedule(dynamic)
+    for (long long col = 0;
+         col < static_cast<long long>(rasterizer.numTileColumns()); ++col) {
+      rasterizer.rasterize(col, row, z, nullvalue, partialWetting,
+                           tiles[col]);
     }
-  }
-  return zv;
-}
-
-std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
-MeshPrivate::computeRasterInterpolationWeights(
-    const std::vector<double> &extent, const size_t nx, const size_t ny,
-    const double resolution) {
-  double xmin = extent[0];
-  double ymax = extent[3];
-
-  std::vector<size_t> elements;
-  std::vector<std::vector<double>> weight;
-  elements.resize(nx * ny);
-  weight.resize(nx * ny);
-
-#ifdef _OPENMP
-  std::string parmessage = boost::str(
-      boost::format("Using %i threads to compute interpolation weights.") %
-      omp_get_num_procs());
-  Adcirc::Logging::log(parmessage);
-#endif
-
-  if (!this->elementalSearchTreeInitialized()) {
-    this->buildElementalSearchTree();
-  }
-
-#pragma omp parallel for shared(weight, elements, xmin, ymax) \
-    schedule(dynamic) collapse(2)
-  for (size_t j = 0; j < ny; ++j) {
-    for (size_t i = 0; i < nx; ++i) {
-      size_t k = j * nx + i;
-      double x, y;
-      std::tie(x, y) =
-          MeshPrivate::pixelToCoordinate(i, j, resolution, xmin, ymax);
-      std::vector<double> w;
-      elements[k] = this->findElement(x, y, weight[k]);
+    for (size_t col = 0; col < rasterizer.numTileColumns(); ++col) {
+      raster.write(col * rasterizer.tileSize(), row * rasterizer.tileSize(),
+                   rasterizer.tileWidth(col), rasterizer.tileHeight(row),
+                   tiles[col].data());
     }
   }
-  return {weight, elements};
-}
-
-std::pair<double, double> MeshPrivate::pixelToCoordinate(
-    const size_t i, const size_t j, const double resolution, const double xmin,
-    const double ymax) {
-  return {i * resolution + xmin + 0.5 * resolution,
-          ymax - (j + 1) * resolution + 0.5 * resolution};
-}
-
-float MeshPrivate::calculateValueWithoutPartialWetting(
-    const double v1, const double v2, const double v3, const double nullvalue,
-    const std::vector<double> &weight) {
-  return FpCompare::equalTo(v1, nullvalue) ||
-                 FpCompare::equalTo(v2, nullvalue) ||
-                 FpCompare::equalTo(v3, nullvalue)
-             ? static_cast<float>(nullvalue)
-             : static_cast<float>(v1 * weight[0] + v2 * weight[1] +
-                                  v3 * weight[2]);
-}
-
-float MeshPrivate::calculateValueWithPartialWetting(
-    const double v1, const double v2, const double v3, const double nullvalue,
-    const std::vector<double> &weight) {
-  bool b1 = FpCompare::equalTo(v1, nullvalue) ||
-            FpCompare::equalTo(v1, adcircmodules_default_value<double>());
-  bool b2 = FpCompare::equalTo(v2, nullvalue) ||
-            FpCompare::equalTo(v2, adcircmodules_default_value<double>());
-  bool b3 = FpCompare::equalTo(v3, nullvalue) ||
-            FpCompare::equalTo(v3, adcircmodules_default_value<double>());
-  if (!b1 && !b2 && !b3) {
-    return weight[0] * v1 + weight[1] * v2 + weight[2] * v3;
-  } else if (b1 && b2 && b3) {
-    return static_cast<float>(nullvalue);
-  } else if (b1 && b2 && !b3) {
-    return static_cast<float>(v3);
-  } else if (b1 && b3 && !b2) {
-    return static_cast<float>(v2);
-  } else if (b2 && b3 && !b1) {
-    return static_cast<float>(v1);
-  } else if (b1 && b2 && !b3) {
-    double f = 1.0 / (weight[0] + weight[1]);
-    return static_cast<float>(weight[0] * f * v1 + weight[1] * f * v2);
-  } else if (b1 && b3 && !b2) {
-    double f = 1.0 / (weight[0] + weight[2]);
-    return static_cast<float>(weight[0] * f * v1 + weight[2] * f * v3);
-  } else if (b2 && b3 && !b1) {
-    double f = 1.0 / (weight[1] + weight[2]);
-    return static_cast<float>(weight[1] * f * v2 + weight[2] * f * v3);
-  }
-  return std::numeric_limits<float>::max();
+  raster.close();
+#endif
 }
 
 Adcirc::Geometry::Topology *MeshPrivate::topology() { return m_topology.get(); }
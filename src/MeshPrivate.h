@@ -21,6 +21,7 @@
 
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -29,9 +30,11 @@
 #include "AdcircModules_Global.h"
 #include "Boundary.h"
 #include "Element.h"
+#include "ElementLocator.h"
 #include "FaceTable.h"
 #include "FileTypes.h"
 #include "KDTree.h"
+#include "MeshStorage.h"
 #include "Node.h"
 #include "Point.h"
 #include "Topology.h"
@@ -72,6 +75,12 @@ class MeshPrivate {
   std::string filename() const;
   void setFilename(const std::string &filename);
 
+  Adcirc::Geometry::MeshReaderMode readerMode() const;
+  void setReaderMode(Adcirc::Geometry::MeshReaderMode readerMode);
+
+  std::string cacheFile() const;
+  void setCacheFile(const std::string &cacheFile);
+
   std::string meshHeaderString() const;
   void setMeshHeaderString(const std::string &meshHeaderString);
 
@@ -129,6 +138,12 @@ class MeshPrivate {
   size_t findElement(double x, double y);
   size_t findElement(double x, double y, std::vector<double> &weights);
 
+  std::vector<size_t> findNearestNodes(const std::vector<double> &x,
+                                       const std::vector<double> &y);
+  std::vector<size_t> findElements(const std::vector<double> &x,
+                                   const std::vector<double> &y,
+                                   std::vector<double> *weights);
+
   std::vector<Adcirc::Geometry::Node *> boundaryNodes();
 
   Adcirc::Geometry::Node nodeC(size_t index) const;
@@ -165,6 +180,7 @@ class MeshPrivate {
 
   Adcirc::Kdtree *nodalSearchTree() const;
   Adcirc::Kdtree *elementalSearchTree() const;
+  const Adcirc::Private::ElementLocator &elementLocator();
 
   std::vector<double> computeMeshSize(int epsg = 0);
 
@@ -183,7 +199,7 @@ class MeshPrivate {
   bool containsElement(const Adcirc::Geometry::Element *e, size_t &index);
   bool containsElement(const Adcirc::Geometry::Element &e, size_t &index);
 
-  std::vector<double> extent() const;
+  std::vector<double> extent();
 
   void toRaster(const std::string &filename, const std::vector<double> &z,
                 const std::vector<double> &extent, double resolution,
@@ -192,12 +208,16 @@ class MeshPrivate {
 
   Adcirc::Geometry::Topology *topology();
 
+  Adcirc::Private::MeshStorage &storage();
+
  private:
   static void meshCopier(MeshPrivate *a, const MeshPrivate *b);
   static Adcirc::Geometry::MeshFormat getMeshFormat(
       const std::string &filename);
   void readAdcircMeshAscii();
+  void readAdcircMeshAsciiMapped();
   void readAdcircMeshNetcdf();
+  void readAdcircMeshBinary(const std::string &filename);
   void readAdcircMeshHeader(std::ifstream &fid);
   void readAdcircNodes(std::ifstream &fid);
   void readAdcircElements(std::ifstream &fid);
@@ -212,11 +232,20 @@ class MeshPrivate {
 
   void readDflowMesh();
 
+  void readFormat(Adcirc::Geometry::MeshFormat format);
+
+  static std::string fileHash(const std::string &filename,
+                              Adcirc::Cryptography::HashType hashType);
+  static std::string binaryMeshSourceHash(
+      const std::string &filename, Adcirc::Cryptography::HashType hashType);
+
   void _init();
 
   void writeAdcircMesh(const std::string &filename);
   void write2dmMesh(const std::string &filename);
   void writeDflowMesh(const std::string &filename);
+  void writeAdcircMeshBinary(const std::string &filename,
+                             const std::string &sourceHash = std::string());
 
   std::vector<std::pair<Adcirc::Geometry::Node *, Adcirc::Geometry::Node *>>
   generateLinkTable();
@@ -227,15 +256,19 @@ class MeshPrivate {
   void generateHash(bool force = false);
 
   void writePrjFile(const std::string &outputFile) const;
+  void writeShapefilePrj(const std::string &outputFile) const;
 
   std::unordered_map<size_t, size_t> m_nodeLookup;
   std::unordered_map<size_t, size_t> m_elementLookup;
 
   Adcirc::Cryptography::HashType m_hashType;
+  Adcirc::Geometry::MeshReaderMode m_readerMode;
 
   std::string m_filename;
+  std::string m_cacheFile;
   std::string m_meshHeaderString;
   std::unique_ptr<char[]> m_hash;
+  Adcirc::Private::MeshStorage m_storage;
   std::vector<Adcirc::Geometry::Node> m_nodes;
   std::vector<Adcirc::Geometry::Element> m_elements;
   std::vector<Adcirc::Geometry::Boundary> m_openBoundaries;
@@ -249,28 +282,8 @@ class MeshPrivate {
   std::unique_ptr<Adcirc::Geometry::Topology> m_topology;
   std::unique_ptr<Kdtree> m_nodalSearchTree;
   std::unique_ptr<Kdtree> m_elementalSearchTree;
-
-  std::vector<float> getRasterValues(
-      const std::vector<double> &z, double nullvalue,
-      const std::vector<size_t> &elements,
-      const std::vector<std::vector<double>> &weights,
-      bool partialWetting = false);
-
-  std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
-  computeRasterInterpolationWeights(const std::vector<double> &extent,
-                                    size_t nx, size_t ny, double resolution);
-
-  static std::pair<double, double> pixelToCoordinate(size_t i, size_t j,
-                                                     double resolution,
-                                                     double xmin, double ymax);
-
-  static float calculateValueWithoutPartialWetting(
-      double v1, double v2, double v3, double nullvalue,
-      const std::vector<double> &weight);
-
-  static float calculateValueWithPartialWetting(
-      double v1, const double v2, double v3, double nullvalue,
-      const std::vector<double> &weight);
+  Adcirc::Private::ElementLocator m_elementLocator;
+  std::mutex m_elementLocatorMutex;
 };
 }  // namespace Private
 }  // namespace Adcirc
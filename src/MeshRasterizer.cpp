@@ -0,0 +1,500 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "MeshRasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "DefaultValues.h"
+#include "Element.h"
+#include "FPCompare.h"
+#include "Logging.h"
+#include "Node.h"
+
+using namespace Adcirc::Private;
+
+//...Flags describing how each edge function of a triangle is evaluated, as
+//   in ElementLocator
+static constexpr unsigned char c_swapShift = 0;
+static constexpr unsigned char c_negateShift = 4;
+
+/**
+ * @brief Signed area (times two) of the triangle a, b, p. Positive when p is
+ * to the left of the directed edge a->b
+ */
+static inline double edgeFunction(double xa, double ya, double xb, double yb,
+                                  double x, double y) {
+  return (xb - xa) * (y - ya) - (yb - ya) * (x - xa);
+}
+
+/**
+ * @brief Ordering used to decide which end point of an edge is first when the
+ * edge function is evaluated
+ */
+static inline bool canonicalOrder(double xa, double ya, double xb, double yb) {
+  return xa < xb || (xa == xb && ya < yb);
+}
+
+/**
+ * @brief Clamps a pixel index computed in floating point to [0, n)
+ */
+static inline size_t clampIndex(double i, size_t n) {
+  if (i <= 0.0) return 0;
+  if (i >= static_cast<double>(n - 1)) return n - 1;
+  return static_cast<size_t>(i);
+}
+
+/**
+ * @brief Constructor
+ * @param[in] nodes mesh nodes
+ * @param[in] elements mesh elements
+ * @param[in] xmin left edge of the raster
+ * @param[in] ymax top edge of the raster
+ * @param[in] resolution pixel size
+ * @param[in] nx number of raster columns
+ * @param[in] ny number of raster rows
+ * @param[in] tileSize width and height of the tiles in pixels
+ */
+MeshRasterizer::MeshRasterizer(
+    const std::vector<Adcirc::Geometry::Node> &nodes,
+    const std::vector<Adcirc::Geometry::Element> &elements, double xmin,
+    double ymax, double resolution, size_t nx, size_t ny, size_t tileSize)
+    : m_xmin(xmin),
+      m_ymax(ymax),
+      m_resolution(resolution),
+      m_nx(nx),
+      m_ny(ny),
+      m_tileSize(std::max<size_t>(tileSize, 1)),
+      m_numTileColumns((nx + m_tileSize - 1) / m_tileSize),
+      m_numTileRows((ny + m_tileSize - 1) / m_tileSize) {
+  if (nx == 0 || ny == 0 || !(resolution > 0.0)) {
+    adcircmodules_throw_exception("MeshRasterizer: Invalid raster dimensions");
+  }
+
+  const Adcirc::Geometry::Node *firstNode = nodes.data();
+  auto index = [firstNode](const Adcirc::Geometry::Node *n) {
+    return static_cast<size_t>(n - firstNode);
+  };
+
+  this->m_triangles.reserve(elements.size());
+  for (const auto &e : elements) {
+    if (e.n() == 3) {
+      this->addTriangle(index(e.node(0)), index(e.node(1)), index(e.node(2)),
+                        nodes);
+    } else if (e.n() == 4) {
+      size_t n[4];
+      double x[4], y[4];
+      for (size_t k = 0; k < 4; ++k) {
+        n[k] = index(e.node(k));
+        x[k] = nodes[n[k]].x();
+        y[k] = nodes[n[k]].y();
+      }
+
+      //...Split along the diagonal from a reflex vertex, if there is one, as
+      //   ElementLocator does
+      double area = 0.0;
+      for (size_t k = 0; k < 4; ++k) {
+        area += x[k] * y[(k + 1) % 4] - x[(k + 1) % 4] * y[k];
+      }
+      size_t r = 0;
+      for (size_t k = 0; k < 4; ++k) {
+        const size_t km = (k + 3) % 4;
+        const size_t kp = (k + 1) % 4;
+        if (edgeFunction(x[km], y[km], x[k], y[k], x[kp], y[kp]) * area <
+            0.0) {
+          r = k;
+          break;
+        }
+      }
+      this->addTriangle(n[r], n[(r + 1) % 4], n[(r + 2) % 4], nodes);
+      this->addTriangle(n[r], n[(r + 2) % 4], n[(r + 3) % 4], nodes);
+    } else {
+      adcircmodules_throw_exception(
+          "MeshRasterizer: Only triangles and quadrilaterals are supported");
+    }
+  }
+
+  this->binTriangles();
+}
+
+size_t MeshRasterizer::nx() const { return this->m_nx; }
+
+size_t MeshRasterizer::ny() const { return this->m_ny; }
+
+size_t MeshRasterizer::tileSize() const { return this->m_tileSize; }
+
+size_t MeshRasterizer::numTileColumns() const {
+  return this->m_numTileColumns;
+}
+
+size_t MeshRasterizer::numTileRows() const { return this->m_numTileRows; }
+
+/**
+ * @brief Number of pixel columns in a column of tiles. Tiles on the right edge
+ * of the raster may be narrower than the tile size
+ */
+size_t MeshRasterizer::tileWidth(size_t tileColumn) const {
+  return std::min(this->m_tileSize,
+                  this->m_nx - tileColumn * this->m_tileSize);
+}
+
+/**
+ * @brief Number of pixel rows in a row of tiles. Tiles on the bottom edge of
+ * the raster may be shorter than the tile size
+ */
+size_t MeshRasterizer::tileHeight(size_t tileRow) const {
+  return std::min(this->m_tileSize, this->m_ny - tileRow * this->m_tileSize);
+}
+
+void MeshRasterizer::addTriangle(
+    size_t n0, size_t n1, size_t n2,
+    const std::vector<Adcirc::Geometry::Node> &nodes) {
+  Triangle t;
+  t.node[0] = n0;
+  t.node[1] = n1;
+  t.node[2] = n2;
+  for (size_t k = 0; k < 3; ++k) {
+    t.x[k] = nodes[t.node[k]].x();
+    t.y[k] = nodes[t.node[k]].y();
+  }
+
+  const double area =
+      edgeFunction(t.x[0], t.y[0], t.x[1], t.y[1], t.x[2], t.y[2]);
+  if (area == 0.0 || !std::isfinite(area)) return;
+
+  t.flags = 0;
+  const bool clockwise = area < 0.0;
+  for (unsigned char k = 0; k < 3; ++k) {
+    const unsigned char k1 = (k + 1) % 3;
+    const bool swap = !canonicalOrder(t.x[k], t.y[k], t.x[k1], t.y[k1]);
+    if (swap) t.flags |= 1U << (c_swapShift + k);
+    if (swap != clockwise) t.flags |= 1U << (c_negateShift + k);
+  }
+  this->m_triangles.push_back(t);
+}
+
+/**
+ * @brief Registers each triangle with the tiles overlapped by its bounding
+ * box, keeping the triangles of each tile in mesh order
+ */
+void MeshRasterizer::binTriangles() {
+  const size_t numTiles = this->m_numTileColumns * this->m_numTileRows;
+  this->m_tileStart.assign(numTiles + 1, 0);
+
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t ti = 0; ti < this->m_triangles.size(); ++ti) {
+      const Triangle &t = this->m_triangles[ti];
+      const double c0 = (std::min({t.x[0], t.x[1], t.x[2]}) - this->m_xmin) /
+                            this->m_resolution -
+                        1.5;
+      const double c1 = (std::max({t.x[0], t.x[1], t.x[2]}) - this->m_xmin) /
+                            this->m_resolution +
+                        0.5;
+      const double r0 = (this->m_ymax - std::max({t.y[0], t.y[1], t.y[2]})) /
+                            this->m_resolution -
+                        1.5;
+      const double r1 = (this->m_ymax - std::min({t.y[0], t.y[1], t.y[2]})) /
+                            this->m_resolution +
+                        0.5;
+      if (c1 < 0.0 || r1 < 0.0 || c0 > static_cast<double>(this->m_nx) ||
+          r0 > static_cast<double>(this->m_ny)) {
+        continue;
+      }
+      const size_t i0 = clampIndex(c0, this->m_nx) / this->m_tileSize;
+      const size_t i1 = clampIndex(c1, this->m_nx) / this->m_tileSize;
+      const size_t j0 = clampIndex(r0, this->m_ny) / this->m_tileSize;
+      const size_t j1 = clampIndex(r1, this->m_ny) / this->m_tileSize;
+      for (size_t j = j0; j <= j1; ++j) {
+        for (size_t i = i0; i <= i1; ++i) {
+          const size_t b = j * this->m_numTileColumns + i;
+          if (pass == 0) {
+            this->m_tileStart[b + 1]++;
+          } else {
+            this->m_tiles[this->m_tileStart[b]++] = ti;
+          }
+        }
+      }
+    }
+    if (pass == 0) {
+      for (size_t b = 0; b < numTiles; ++b) {
+        this->m_tileStart[b + 1] += this->m_tileStart[b];
+      }
+      this->m_tiles.resize(this->m_tileStart.back());
+    } else {
+      //...Filling advanced each start to the start of the next tile
+      for (size_t b = numTiles; b > 0; --b) {
+        this->m_tileStart[b] = this->m_tileStart[b - 1];
+      }
+      this->m_tileStart[0] = 0;
+    }
+  }
+}
+
+/**
+ * @brief Computes the barycentric weights of a point in a triangle
+ * @return false if the point is outside of the triangle
+ *
+ * The edge function of each edge is the weight of the opposite vertex, scaled
+ * by twice the area of the triangle
+ */
+bool MeshRasterizer::barycentric(const Triangle &t, double x, double y,
+                                 double *weight) const {
+  double sum = 0.0;
+  for (unsigned k = 0; k < 3; ++k) {
+    unsigned a = k;
+    unsigned b = (k + 1) % 3;
+    if (t.flags & (1U << (c_swapShift + k))) std::swap(a, b);
+    double e = edgeFunction(t.x[a], t.y[a], t.x[b], t.y[b], x, y);
+    if (t.flags & (1U << (c_negateShift + k))) e = -e;
+    if (e < 0.0) return false;
+    weight[(k + 2) % 3] = e;
+    sum += e;
+  }
+  if (!(sum > 0.0)) return false;
+  for (size_t k = 0; k < 3; ++k) weight[k] /= sum;
+  return true;
+}
+
+/**
+ * @brief Visits the pixels of a tile covered by a triangle which have not
+ * been covered by an earlier triangle
+ * @param[in] t triangle to scan
+ * @param[in] column0 first column of the tile
+ * @param[in] row0 first row of the tile
+ * @param[in] width number of columns in the tile
+ * @param[in] height number of rows in the tile
+ * @param[in,out] covered flags marking the pixels of the tile which have
+ * been visited
+ * @param[in] visit callable with the signature
+ * void(size_t pixel, const double *weight), where pixel is the position in
+ * the tile
+ */
+template <typename PixelVisitor>
+void MeshRasterizer::scanTriangle(const Triangle &t, size_t column0,
+                                  size_t row0, size_t width, size_t height,
+                                  std::vector<unsigned char> &covered,
+                                  PixelVisitor visit) const {
+  const double res = this->m_resolution;
+  const double tymin = std::min({t.y[0], t.y[1], t.y[2]});
+  const double tymax = std::max({t.y[0], t.y[1], t.y[2]});
+
+  //...Rows whose pixel centers may lie within the triangle, widened by one
+  //   row so that rounding never drops a row
+  const double r0 = (this->m_ymax - tymax) / res - 1.5;
+  const double r1 = (this->m_ymax - tymin) / res + 0.5;
+  if (r1 < static_cast<double>(row0) ||
+      r0 >= static_cast<double>(row0 + height)) {
+    return;
+  }
+  const size_t jBegin = std::max(row0, clampIndex(std::ceil(r0), this->m_ny));
+  const size_t jEnd =
+      std::min(row0 + height - 1, clampIndex(std::floor(r1), this->m_ny));
+
+  for (size_t j = jBegin; j <= jEnd; ++j) {
+    const double y = this->m_ymax - (j + 1) * res + 0.5 * res;
+
+    //...Span of the triangle along the scanline
+    double xl = std::numeric_limits<double>::max();
+    double xr = -std::numeric_limits<double>::max();
+    for (size_t k = 0; k < 3; ++k) {
+      const size_t k1 = (k + 1) % 3;
+      const double ya = t.y[k];
+      const double yb = t.y[k1];
+      if (y < std::min(ya, yb) || y > std::max(ya, yb)) continue;
+      if (ya == yb) {
+        xl = std::min({xl, t.x[k], t.x[k1]});
+        xr = std::max({xr, t.x[k], t.x[k1]});
+      } else {
+        const double x = t.x[k] + (y - ya) * (t.x[k1] - t.x[k]) / (yb - ya);
+        xl = std::min(xl, x);
+        xr = std::max(xr, x);
+      }
+    }
+    if (xl > xr) continue;
+
+    const double c0 = (xl - this->m_xmin) / res - 1.5;
+    const double c1 = (xr - this->m_xmin) / res + 0.5;
+    if (c1 < static_cast<double>(column0) ||
+        c0 >= static_cast<double>(column0 + width)) {
+      continue;
+    }
+    const size_t iBegin =
+        std::max(column0, clampIndex(std::ceil(c0), this->m_nx));
+    const size_t iEnd =
+        std::min(column0 + width - 1, clampIndex(std::floor(c1), this->m_nx));
+
+    for (size_t i = iBegin; i <= iEnd; ++i) {
+      const size_t p = (j - row0) * width + (i - column0);
+      if (covered[p]) continue;
+      const double x = i * res + this->m_xmin + 0.5 * res;
+      double w[3];
+      if (!this->barycentric(t, x, y, w)) continue;
+      visit(p, w);
+      covered[p] = 1;
+    }
+  }
+}
+
+/**
+ * @brief Computes the values of the pixels in a tile
+ * @param[in] tileColumn column of the tile
+ * @param[in] tileRow row of the tile
+ * @param[in] z values at the mesh nodes
+ * @param[in] nullvalue value used for pixels outside of the mesh
+ * @param[in] partialWetting interpolate from the wet vertices of partially
+ * wet elements
+ * @param[out] values pixel values in row major order, tileWidth(tileColumn)
+ * by tileHeight(tileRow)
+ */
+void MeshRasterizer::rasterize(size_t tileColumn, size_t tileRow,
+                               const std::vector<double> &z, double nullvalue,
+                               bool partialWetting,
+                               std::vector<float> &values) const {
+  const size_t width = this->tileWidth(tileColumn);
+  const size_t height = this->tileHeight(tileRow);
+
+  values.assign(width * height, static_cast<float>(nullvalue));
+  std::vector<unsigned char> covered(width * height, 0);
+
+  const size_t b = tileRow * this->m_numTileColumns + tileColumn;
+  for (size_t k = this->m_tileStart[b]; k < this->m_tileStart[b + 1]; ++k) {
+    const Triangle &t = this->m_triangles[this->m_tiles[k]];
+    const double v[3] = {z[t.node[0]], z[t.node[1]], z[t.node[2]]};
+
+    //...Elements with no dry vertex are interpolated directly, without
+    //   testing the vertex values for every pixel
+    bool wet = true;
+    for (size_t n = 0; n < 3; ++n) {
+      wet = wet && !MeshRasterizer::isDry(v[n], nullvalue, partialWetting);
+    }
+
+    this->scanTriangle(
+        t, tileColumn * this->m_tileSize, tileRow * this->m_tileSize, width,
+        height, covered, [&](size_t p, const double *w) {
+          values[p] = wet ? static_cast<float>(w[0] * v[0] + w[1] * v[1] +
+                                               w[2] * v[2])
+                          : MeshRasterizer::interpolate(v, w, nullvalue,
+                                                        partialWetting);
+        });
+  }
+}
+
+/**
+ * @brief Computes the triangle and interpolation weights of the pixels in a
+ * tile
+ * @param[in] tileColumn column of the tile
+ * @param[in] tileRow row of the tile
+ * @param[out] triangle triangle containing each pixel, or noTriangle() for
+ * pixels outside of the mesh. The first pixel of the tile is written to
+ * triangle[0]
+ * @param[out] weight weights of the first two vertices of the triangle for
+ * each pixel. The weight of the third vertex is one minus their sum
+ * @param[in] stride distance between the rows of the tile in the output
+ * arrays, in pixels
+ */
+void MeshRasterizer::project(size_t tileColumn, size_t tileRow,
+                             uint32_t *triangle, float *weight,
+                             size_t stride) const {
+  const size_t width = this->tileWidth(tileColumn);
+  const size_t height = this->tileHeight(tileRow);
+
+  for (size_t j = 0; j < height; ++j) {
+    std::fill(triangle + j * stride, triangle + j * stride + width,
+              MeshRasterizer::noTriangle());
+    std::fill(weight + 2 * j * stride, weight + 2 * (j * stride + width),
+              0.0f);
+  }
+  std::vector<unsigned char> covered(width * height, 0);
+
+  const size_t b = tileRow * this->m_numTileColumns + tileColumn;
+  for (size_t k = this->m_tileStart[b]; k < this->m_tileStart[b + 1]; ++k) {
+    const uint32_t ti = static_cast<uint32_t>(this->m_tiles[k]);
+    this->scanTriangle(this->m_triangles[ti], tileColumn * this->m_tileSize,
+                       tileRow * this->m_tileSize, width, height, covered,
+                       [&](size_t p, const double *w) {
+                         const size_t q = (p / width) * stride + p % width;
+                         triangle[q] = ti;
+                         weight[2 * q] = static_cast<float>(w[0]);
+                         weight[2 * q + 1] = static_cast<float>(w[1]);
+                       });
+  }
+}
+
+/**
+ * @brief Number of triangles the mesh was decomposed into
+ */
+size_t MeshRasterizer::numTriangles() const {
+  return this->m_triangles.size();
+}
+
+/**
+ * @brief Indices of the three mesh nodes of a triangle
+ */
+const size_t *MeshRasterizer::triangleNodes(size_t triangle) const {
+  return this->m_triangles[triangle].node;
+}
+
+/**
+ * @brief Returns true if a vertex value marks a dry node. The default value
+ * is only treated as dry when partial wetting is enabled
+ */
+bool MeshRasterizer::isDry(double v, double nullvalue, bool partialWetting) {
+  return FpCompare::equalTo(v, nullvalue) ||
+         (partialWetting &&
+          FpCompare::equalTo(v, adcircmodules_default_value<double>()));
+}
+
+/**
+ * @brief Interpolates a value within a triangle
+ * @param[in] v values at the three vertices
+ * @param[in] weight interpolation weights of the three vertices
+ * @param[in] nullvalue value marking a dry vertex
+ * @param[in] partialWetting if true, the value is interpolated from the wet
+ * vertices only. Otherwise the value is null if any vertex is dry
+ */
+float MeshRasterizer::interpolate(const double *v, const double *weight,
+                                  double nullvalue, bool partialWetting) {
+  bool dry[3];
+  size_t numDry = 0;
+  for (size_t k = 0; k < 3; ++k) {
+    dry[k] = MeshRasterizer::isDry(v[k], nullvalue, partialWetting);
+    if (dry[k]) numDry++;
+  }
+
+  if (numDry == 0) {
+    return static_cast<float>(weight[0] * v[0] + weight[1] * v[1] +
+                              weight[2] * v[2]);
+  }
+  if (!partialWetting || numDry == 3) return static_cast<float>(nullvalue);
+
+  //...Renormalize the weights of the wet vertices. A point on a dry vertex
+  //   takes the average of the wet vertices
+  double sum = 0.0;
+  double sumWeight = 0.0;
+  double average = 0.0;
+  for (size_t k = 0; k < 3; ++k) {
+    if (dry[k]) continue;
+    sum += weight[k] * v[k];
+    sumWeight += weight[k];
+    average += v[k];
+  }
+  if (sumWeight > 0.0) return static_cast<float>(sum / sumWeight);
+  return static_cast<float>(average / static_cast<double>(3 - numDry));
+}
@@ -0,0 +1,125 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHRASTERIZER_H
+#define ADCMOD_MESHRASTERIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Adcirc {
+
+namespace Geometry {
+class Node;
+class Element;
+}  // namespace Geometry
+
+namespace Private {
+
+/**
+ * @class MeshRasterizer
+ * @author Zachary Cobell
+ * @brief Interpolates values defined at the mesh nodes onto a raster
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The raster is divided into square tiles and the triangles of the mesh
+ * (quadrilaterals are split along a diagonal) are binned by the tiles their
+ * bounding boxes overlap. A tile is rasterized by scanning the rows of each of
+ * its triangles, testing the pixel centers with the same edge functions used
+ * by ElementLocator and computing the barycentric weights from them, so no
+ * point location queries or per pixel allocations are required. Pixels take
+ * the value of the first triangle containing them, which is the element that
+ * Mesh::findElement would return.
+ *
+ * Tiles are independent and may be rasterized concurrently.
+ *
+ */
+class MeshRasterizer {
+ public:
+  MeshRasterizer(const std::vector<Adcirc::Geometry::Node> &nodes,
+                 const std::vector<Adcirc::Geometry::Element> &elements,
+                 double xmin, double ymax, double resolution, size_t nx,
+                 size_t ny, size_t tileSize = 512);
+
+  size_t nx() const;
+  size_t ny() const;
+  size_t tileSize() const;
+  size_t numTileColumns() const;
+  size_t numTileRows() const;
+  size_t tileWidth(size_t tileColumn) const;
+  size_t tileHeight(size_t tileRow) const;
+
+  void rasterize(size_t tileColumn, size_t tileRow,
+                 const std::vector<double> &z, double nullvalue,
+                 bool partialWetting, std::vector<float> &values) const;
+
+  void project(size_t tileColumn, size_t tileRow, uint32_t *triangle,
+               float *weight, size_t stride) const;
+
+  size_t numTriangles() const;
+  const size_t *triangleNodes(size_t triangle) const;
+
+  static constexpr uint32_t noTriangle() {
+    return std::numeric_limits<uint32_t>::max();
+  }
+
+  static bool isDry(double v, double nullvalue, bool partialWetting);
+
+  static float interpolate(const double *v, const double *weight,
+                           double nullvalue, bool partialWetting);
+
+ private:
+  struct Triangle {
+    size_t node[3];
+    double x[3];
+    double y[3];
+    unsigned char flags;
+  };
+
+  void addTriangle(size_t n0, size_t n1, size_t n2,
+                   const std::vector<Adcirc::Geometry::Node> &nodes);
+  void binTriangles();
+  bool barycentric(const Triangle &t, double x, double y,
+                   double *weight) const;
+
+  template <typename PixelVisitor>
+  void scanTriangle(const Triangle &t, size_t column0, size_t row0,
+                    size_t width, size_t height,
+                    std::vector<unsigned char> &covered,
+                    PixelVisitor visit) const;
+
+  const double m_xmin;
+  const double m_ymax;
+  const double m_resolution;
+  const size_t m_nx;
+  const size_t m_ny;
+  const size_t m_tileSize;
+  const size_t m_numTileColumns;
+  const size_t m_numTileRows;
+  std::vector<Triangle> m_triangles;
+  std::vector<size_t> m_tileStart;
+  std::vector<size_t> m_tiles;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHRASTERIZER_H
@@ -0,0 +1,201 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "MeshStorage.h"
+
+#include <algorithm>
+
+#include "DefaultValues.h"
+#include "Element.h"
+#include "Node.h"
+
+using namespace Adcirc::Private;
+using Adcirc::Geometry::Element;
+using Adcirc::Geometry::Node;
+
+MeshStorage::MeshStorage() = default;
+
+/**
+ * @brief Resizes the node arrays, including the hash arrays
+ * @param[in] n number of nodes
+ */
+void MeshStorage::resizeNodes(size_t n) {
+  this->m_nodeId.resize(n, 0);
+  this->m_x.resize(n, adcircmodules_default_value<double>());
+  this->m_y.resize(n, adcircmodules_default_value<double>());
+  this->m_z.resize(n, adcircmodules_default_value<double>());
+  this->m_isBoundaryNode.resize(n, 0);
+  this->m_nodeHash.resize(n);
+  this->m_nodePositionHash.resize(n);
+}
+
+/**
+ * @brief Resizes the element arrays, including the hash array
+ * @param[in] n number of elements
+ */
+void MeshStorage::resizeElements(size_t n) {
+  this->m_elementId.resize(n, adcircmodules_default_value<size_t>());
+  this->m_elementSize.resize(n, 3);
+  this->m_elementNodes.resize(MeshStorage::maxNodesPerElement() * n, nullptr);
+  this->m_elementHash.resize(n);
+}
+
+/**
+ * @brief Attaches the nodes in a vector to this storage
+ * @param[inout] nodes vector of nodes owned by the mesh
+ *
+ * On return, nodes[i] is a view of position i in the storage. Nodes that
+ * are already attached at the correct position are not modified. Nodes
+ * that hold their own values, such as those inserted into the vector by
+ * copy, have their values moved into the storage.
+ */
+void MeshStorage::bindNodes(std::vector<Node> &nodes) {
+  const size_t n = nodes.size();
+  if (n > this->numNodes()) this->resizeNodes(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    Node &node = nodes[i];
+    if (node.m_storage == this && node.m_index == i) continue;
+
+    size_t id = node.id();
+    double x = node.x();
+    double y = node.y();
+    double z = node.z();
+    bool isBoundaryNode = node.isBoundaryNode();
+
+    if (node.m_storage == nullptr) delete node.m_data;
+    node.m_storage = this;
+    node.m_index = i;
+
+    this->m_nodeId[i] = id;
+    this->m_x[i] = x;
+    this->m_y[i] = y;
+    this->m_z[i] = z;
+    this->m_isBoundaryNode[i] = isBoundaryNode ? 1 : 0;
+    this->resetNodeHash(i);
+  }
+
+  if (n < this->numNodes()) this->resizeNodes(n);
+}
+
+/**
+ * @brief Attaches the elements in a vector to this storage
+ * @param[inout] elements vector of elements owned by the mesh
+ *
+ * On return, elements[i] is a view of position i in the storage. Elements
+ * that are already attached at the correct position are not modified.
+ */
+void MeshStorage::bindElements(std::vector<Element> &elements) {
+  const size_t n = elements.size();
+  if (n > this->numElements()) this->resizeElements(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    Element &element = elements[i];
+    if (element.m_storage == this && element.m_index == i) continue;
+
+    size_t id = element.id();
+    size_t size = element.n();
+    std::array<Node *, 4> nodes;
+    std::copy(element.nodePointers(), element.nodePointers() + size,
+              nodes.begin());
+    std::fill(nodes.begin() + size, nodes.end(), nullptr);
+
+    if (element.m_storage == nullptr) delete element.m_data;
+    element.m_storage = this;
+    element.m_index = i;
+
+    this->m_elementId[i] = id;
+    this->m_elementSize[i] = static_cast<unsigned char>(size);
+    std::copy(nodes.begin(), nodes.end(),
+              &this->m_elementNodes[MeshStorage::maxNodesPerElement() * i]);
+    this->resetElementHash(i);
+  }
+
+  if (n < this->numElements()) this->resizeElements(n);
+}
+
+/**
+ * @brief Returns the hash buffer for a node
+ * @param[in] index position of the node
+ * @return reference to hash buffer
+ */
+std::unique_ptr<char[]> &MeshStorage::nodeHash(size_t index) {
+  return this->m_nodeHash[index];
+}
+
+/**
+ * @brief Returns the position hash buffer for a node
+ * @param[in] index position of the node
+ * @return reference to hash buffer
+ */
+std::unique_ptr<char[]> &MeshStorage::nodePositionHash(size_t index) {
+  return this->m_nodePositionHash[index];
+}
+
+/**
+ * @brief Returns the hash buffer for an element
+ * @param[in] index position of the element
+ * @return reference to hash buffer
+ */
+std::unique_ptr<char[]> &MeshStorage::elementHash(size_t index) {
+  return this->m_elementHash[index];
+}
+
+/**
+ * @brief Removes the hashes of a node if they have been computed
+ * @param[in] index position of the node
+ */
+void MeshStorage::resetNodeHash(size_t index) {
+  this->m_nodeHash[index].reset(nullptr);
+  this->m_nodePositionHash[index].reset(nullptr);
+}
+
+/**
+ * @brief Removes the hash of an element if it has been computed
+ * @param[in] index position of the element
+ */
+void MeshStorage::resetElementHash(size_t index) {
+  this->m_elementHash[index].reset(nullptr);
+}
+
+/**
+ * @brief Releases all node and element hashes
+ */
+void MeshStorage::clearHashes() {
+  for (auto &h : this->m_nodeHash) h.reset(nullptr);
+  for (auto &h : this->m_nodePositionHash) h.reset(nullptr);
+  for (auto &h : this->m_elementHash) h.reset(nullptr);
+}
+
+/**
+ * @brief Approximate number of bytes held by the storage, excluding the
+ * contents of hash buffers
+ * @return memory usage in bytes
+ */
+size_t MeshStorage::memoryUsage() const {
+  return this->m_nodeId.capacity() * sizeof(size_t) +
+         (this->m_x.capacity() + this->m_y.capacity() + this->m_z.capacity()) *
+             sizeof(double) +
+         this->m_isBoundaryNode.capacity() +
+         (this->m_nodeHash.capacity() + this->m_nodePositionHash.capacity() +
+          this->m_elementHash.capacity()) *
+             sizeof(std::unique_ptr<char[]>) +
+         this->m_elementId.capacity() * sizeof(size_t) +
+         this->m_elementSize.capacity() +
+         this->m_elementNodes.capacity() * sizeof(Node *);
+}
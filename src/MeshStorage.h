@@ -0,0 +1,133 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHSTORAGE_H
+#define ADCMOD_MESHSTORAGE_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Adcirc {
+
+namespace Geometry {
+class Node;
+class Element;
+}  // namespace Geometry
+
+namespace Private {
+
+/**
+ * @brief Values of a node that does not belong to a mesh
+ */
+struct NodeData {
+  size_t id;
+  std::array<double, 3> position;
+  bool isBoundaryNode;
+  std::unique_ptr<char[]> hash;
+  std::unique_ptr<char[]> positionHash;
+};
+
+/**
+ * @brief Values of an element that does not belong to a mesh
+ */
+struct ElementData {
+  size_t id;
+  size_t n;
+  std::array<Adcirc::Geometry::Node *, 4> nodes;
+  std::unique_ptr<char[]> hash;
+};
+
+/**
+ * @class MeshStorage
+ * @author Zachary Cobell
+ * @brief Structure of arrays storage for the nodes and elements of a mesh
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The nodes and elements held by a mesh are lightweight views into this
+ * storage. Node positions are kept in contiguous x, y, z arrays and element
+ * connectivity in a fixed width array of four node pointers per element so
+ * that no per-object allocations are required. Hash buffers are only
+ * allocated once they are requested, but the arrays holding them are sized
+ * with the storage so that hashes may be computed from several threads.
+ *
+ * Node and Element objects that are copied out of a mesh keep their own
+ * values. The bind functions re-attach the objects in a mesh vector to the
+ * storage after the vector has been modified.
+ *
+ */
+class MeshStorage {
+ public:
+  MeshStorage();
+
+  static constexpr size_t maxNodesPerElement() { return 4; }
+
+  size_t numNodes() const { return this->m_nodeId.size(); }
+  size_t numElements() const { return this->m_elementId.size(); }
+
+  const std::vector<double> &x() const { return this->m_x; }
+  const std::vector<double> &y() const { return this->m_y; }
+  const std::vector<double> &z() const { return this->m_z; }
+  std::vector<double> &z() { return this->m_z; }
+
+  const std::vector<Adcirc::Geometry::Node *> &connectivity() const {
+    return this->m_elementNodes;
+  }
+  const std::vector<unsigned char> &elementSize() const {
+    return this->m_elementSize;
+  }
+
+  void bindNodes(std::vector<Adcirc::Geometry::Node> &nodes);
+  void bindElements(std::vector<Adcirc::Geometry::Element> &elements);
+
+  void clearHashes();
+
+  size_t memoryUsage() const;
+
+  friend class Adcirc::Geometry::Node;
+  friend class Adcirc::Geometry::Element;
+
+ private:
+  void resizeNodes(size_t n);
+  void resizeElements(size_t n);
+
+  std::unique_ptr<char[]> &nodeHash(size_t index);
+  std::unique_ptr<char[]> &nodePositionHash(size_t index);
+  std::unique_ptr<char[]> &elementHash(size_t index);
+  void resetNodeHash(size_t index);
+  void resetElementHash(size_t index);
+
+  std::vector<size_t> m_nodeId;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<unsigned char> m_isBoundaryNode;
+  std::vector<std::unique_ptr<char[]>> m_nodeHash;
+  std::vector<std::unique_ptr<char[]>> m_nodePositionHash;
+
+  std::vector<size_t> m_elementId;
+  std::vector<unsigned char> m_elementSize;
+  std::vector<Adcirc::Geometry::Node *> m_elementNodes;
+  std::vector<std::unique_ptr<char[]>> m_elementHash;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHSTORAGE_H
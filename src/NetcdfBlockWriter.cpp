@@ -0,0 +1,310 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "NetcdfBlockWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "FPCompare.h"
+#include "FileIO.h"
+#include "Logging.h"
+#include "netcdf.h"
+
+using namespace Adcirc::Private;
+using Adcirc::Output::NetcdfWriteOptions;
+using Adcirc::Output::OutputRecord;
+
+//...Number of bits in the mantissa of a double
+static constexpr int c_mantissaBits = 52;
+
+//...Smallest number of values quantized using multiple threads
+static constexpr size_t c_parallelQuantizeSize = 65536;
+
+/**
+ * @brief Constructor
+ * @param[in] ncid netCDF file, which must be out of define mode
+ * @param[in] varidTime time variable
+ * @param[in] varids data variables, one for each component
+ * @param[in] numNodes number of nodes in each record
+ * @param[in] isMax true if the variables have no time dimension
+ * @param[in] defaultValue value for dry nodes, which is never quantized
+ * @param[in] options storage options
+ */
+NetcdfBlockWriter::NetcdfBlockWriter(int ncid, int varidTime,
+                                     const std::vector<int> &varids,
+                                     size_t numNodes, bool isMax,
+                                     double defaultValue,
+                                     const NetcdfWriteOptions &options)
+    : m_ncid(ncid),
+      m_varidTime(varidTime),
+      m_varids(varids),
+      m_numNodes(numNodes),
+      m_isMax(isMax),
+      m_defaultValue(defaultValue),
+      m_options(options),
+      m_blockSnaps(isMax ? 1 : options.blockSnaps()),
+      m_snap(0),
+      m_stop(false),
+      m_numBlocks(0) {
+  if (this->m_options.asyncWrite()) {
+    this->m_thread = std::thread(&NetcdfBlockWriter::run, this);
+  }
+}
+
+/**
+ * @brief Destructor. Stops the background thread without writing records
+ * which have not been submitted. Call finish() to write them.
+ */
+NetcdfBlockWriter::~NetcdfBlockWriter() {
+  if (this->m_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_stop = true;
+    }
+    this->m_condition.notify_all();
+    this->m_thread.join();
+  }
+}
+
+/**
+ * @brief Adds a record to the file
+ * @param[in] record record to write
+ *
+ * Errors from records written on the background thread are reported by the
+ * next call to append() or finish().
+ */
+void NetcdfBlockWriter::append(const OutputRecord *record) {
+  this->checkError();
+
+  if (record->numNodes() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "WriteOutput: Record size does not match the netCDF file");
+  }
+
+  if (this->m_current == nullptr) {
+    this->m_current = this->takeBlock();
+  }
+
+  Block &block = *this->m_current;
+  const size_t row = block.numSnaps;
+  block.time[row] = record->time();
+  for (size_t c = 0; c < this->m_varids.size(); ++c) {
+    Adcirc::Output::OutputSpan values = record->span(c);
+    double *destination = block.values[c].data() + row * this->m_numNodes;
+    std::copy(values.begin(), values.end(), destination);
+    if (this->m_options.significantDigits() > 0) {
+      NetcdfBlockWriter::quantize(destination, this->m_numNodes,
+                                  this->m_options.significantDigits(),
+                                  this->m_defaultValue);
+    }
+  }
+  block.numSnaps++;
+  this->m_snap++;
+
+  if (block.numSnaps == this->m_blockSnaps) {
+    this->submit(std::move(this->m_current));
+  }
+}
+
+/**
+ * @brief Writes any records which have not been written and waits for the
+ * background thread to finish
+ */
+void NetcdfBlockWriter::finish() {
+  if (this->m_current != nullptr && this->m_current->numSnaps > 0) {
+    this->submit(std::move(this->m_current));
+  }
+  this->m_current.reset();
+
+  if (this->m_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_stop = true;
+    }
+    this->m_condition.notify_all();
+    this->m_thread.join();
+  }
+  this->checkError();
+}
+
+/**
+ * @brief Rounds values to a number of significant decimal digits by clearing
+ * the low bits of the mantissa (bit rounding)
+ * @param[in,out] values values to quantize
+ * @param[in] n number of values
+ * @param[in] significantDigits number of significant decimal digits to keep
+ * @param[in] defaultValue values equal to this are not modified
+ *
+ * The rounded values differ from the originals by at most half of the last
+ * kept bit, and the runs of zero bits compress well.
+ */
+void NetcdfBlockWriter::quantize(double *values, size_t n,
+                                 int significantDigits, double defaultValue) {
+  const int keepBits =
+      static_cast<int>(std::ceil(significantDigits * std::log2(10.0))) + 1;
+  if (significantDigits <= 0 || keepBits >= c_mantissaBits) return;
+
+  const int dropBits = c_mantissaBits - keepBits;
+  const uint64_t mask = ~((uint64_t(1) << dropBits) - 1);
+  const uint64_t half = uint64_t(1) << (dropBits - 1);
+
+#pragma omp parallel for schedule(static) if (n >= c_parallelQuantizeSize)
+  for (long long i = 0; i < static_cast<long long>(n); ++i) {
+    const double v = values[i];
+    if (!std::isfinite(v) || FpCompare::equalTo(v, defaultValue)) continue;
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(double));
+    bits = (bits + half) & mask;
+    std::memcpy(&values[i], &bits, sizeof(double));
+  }
+}
+
+/**
+ * @brief Returns an empty block, waiting for the background thread to return
+ * one if the queue is full
+ */
+std::unique_ptr<NetcdfBlockWriter::Block> NetcdfBlockWriter::takeBlock() {
+  std::unique_ptr<Block> block;
+  {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    if (this->m_options.asyncWrite()) {
+      const size_t maxBlocks = this->m_options.asyncQueueDepth() + 1;
+      this->m_condition.wait(lock, [this, maxBlocks]() {
+        return !this->m_free.empty() || this->m_numBlocks < maxBlocks ||
+               this->m_error;
+      });
+    }
+    if (!this->m_free.empty()) {
+      block = std::move(this->m_free.back());
+      this->m_free.pop_back();
+    }
+  }
+  this->checkError();
+
+  if (block == nullptr) {
+    block = std::make_unique<Block>();
+    block->time.resize(this->m_blockSnaps);
+    for (size_t c = 0; c < this->m_varids.size(); ++c) {
+      block->values[c].resize(this->m_blockSnaps * this->m_numNodes);
+    }
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_numBlocks++;
+  }
+  block->firstSnap = this->m_snap;
+  block->numSnaps = 0;
+  return block;
+}
+
+/**
+ * @brief Writes a full block, or queues it for the background thread
+ */
+void NetcdfBlockWriter::submit(std::unique_ptr<Block> block) {
+  if (this->m_options.asyncWrite()) {
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_queue.push_back(std::move(block));
+    }
+    this->m_condition.notify_all();
+  } else {
+    this->writeBlock(*block);
+    this->m_free.push_back(std::move(block));
+  }
+}
+
+/**
+ * @brief Writes the snaps of a block with one request per variable
+ */
+void NetcdfBlockWriter::writeBlock(const Block &block) const {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
+  int ierr = NC_NOERR;
+  if (this->m_isMax) {
+    const size_t start = 0;
+    const size_t count = this->m_numNodes;
+    for (size_t c = 0; c < this->m_varids.size(); ++c) {
+      ierr += nc_put_vara_double(this->m_ncid, this->m_varids[c], &start,
+                                 &count, block.values[c].data());
+    }
+  } else {
+    const size_t start[2] = {block.firstSnap, 0};
+    const size_t count[2] = {block.numSnaps, this->m_numNodes};
+    ierr += nc_put_vara_double(this->m_ncid, this->m_varidTime, start, count,
+                               block.time.data());
+    for (size_t c = 0; c < this->m_varids.size(); ++c) {
+      ierr += nc_put_vara_double(this->m_ncid, this->m_varids[c], start, count,
+                                 block.values[c].data());
+    }
+  }
+  if (ierr != NC_NOERR) {
+    adcircmodules_throw_exception("WriteOutput: Error writing netCDF record");
+  }
+}
+
+/**
+ * @brief Body of the background thread. Writes queued blocks in order.
+ */
+void NetcdfBlockWriter::run() {
+  for (;;) {
+    std::unique_ptr<Block> block;
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+      this->m_condition.wait(lock, [this]() {
+        return this->m_stop || !this->m_queue.empty();
+      });
+      if (this->m_queue.empty()) break;
+      block = std::move(this->m_queue.front());
+      this->m_queue.pop_front();
+    }
+
+    bool failed;
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      failed = this->m_error != nullptr;
+    }
+    if (!failed) {
+      try {
+        this->writeBlock(*block);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_error = std::current_exception();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_free.push_back(std::move(block));
+    }
+    this->m_condition.notify_all();
+  }
+}
+
+/**
+ * @brief Rethrows an error from the background thread. Once an error occurs,
+ * no further blocks are written.
+ */
+void NetcdfBlockWriter::checkError() {
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    error = this->m_error;
+  }
+  if (error) std::rethrow_exception(error);
+}
@@ -0,0 +1,111 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_NETCDFBLOCKWRITER_H
+#define ADCMOD_NETCDFBLOCKWRITER_H
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "NetcdfWriteOptions.h"
+#include "OutputRecord.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class NetcdfBlockWriter
+ * @author Zachary Cobell
+ * @brief Writes the records of a netCDF output file in blocks of snaps
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Records are copied into a block buffer, quantizing the values if requested,
+ * and the block is written with one request per variable once it holds
+ * NetcdfWriteOptions::blockSnaps() snaps. When asynchronous writes are
+ * enabled, full blocks are queued for a background thread which makes the
+ * netCDF calls, so the compression done by the library overlaps the work of
+ * the caller. Block buffers are recycled.
+ *
+ * The netCDF and HDF5 libraries are not thread safe, so the background
+ * thread holds FileIO::Netcdf::libraryMutex() while it writes a block. Other
+ * netCDF files may be read and written through this library in the
+ * meantime. Netcdf calls made directly by the application before finish()
+ * returns must hold the same mutex.
+ *
+ */
+class NetcdfBlockWriter {
+ public:
+  NetcdfBlockWriter(int ncid, int varidTime, const std::vector<int> &varids,
+                    size_t numNodes, bool isMax, double defaultValue,
+                    const Adcirc::Output::NetcdfWriteOptions &options);
+
+  ~NetcdfBlockWriter();
+
+  void append(const Adcirc::Output::OutputRecord *record);
+  void finish();
+
+  static void quantize(double *values, size_t n, int significantDigits,
+                       double defaultValue);
+
+ private:
+  struct Block {
+    size_t firstSnap;
+    size_t numSnaps;
+    std::vector<double> time;
+    std::array<std::vector<double>, 3> values;
+  };
+
+  std::unique_ptr<Block> takeBlock();
+  void submit(std::unique_ptr<Block> block);
+  void writeBlock(const Block &block) const;
+  void run();
+  void checkError();
+
+  const int m_ncid;
+  const int m_varidTime;
+  const std::vector<int> m_varids;
+  const size_t m_numNodes;
+  const bool m_isMax;
+  const double m_defaultValue;
+  const Adcirc::Output::NetcdfWriteOptions m_options;
+  const size_t m_blockSnaps;
+
+  size_t m_snap;
+  std::unique_ptr<Block> m_current;
+
+  bool m_stop;
+  std::exception_ptr m_error;
+  std::deque<std::unique_ptr<Block>> m_queue;
+  std::vector<std::unique_ptr<Block>> m_free;
+  size_t m_numBlocks;
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_NETCDFBLOCKWRITER_H
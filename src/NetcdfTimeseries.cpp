@@ -55,6 +55,8 @@ int NetcdfTimeseries::epsg() const { return this->m_epsg; }
 void NetcdfTimeseries::setEpsg(int epsg) { this->m_epsg = epsg; }
 
 int NetcdfTimeseries::read(bool stationsOnly = false) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   if (this->m_filename == std::string()) return 1;
 
   std::string station_dim_string, station_time_var_string,
@@ -200,6 +202,8 @@ int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
 }
 
 int NetcdfTimeseries::getEpsg(const std::string &file) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ncid, varid_xcoor, epsg;
   NCCHECK(nc_open(file.c_str(), NC_NOWRITE, &ncid))
   NCCHECK(nc_inq_varid(ncid, "stationXCoordinate", &varid_xcoor))
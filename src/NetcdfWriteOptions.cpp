@@ -0,0 +1,154 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "NetcdfWriteOptions.h"
+
+#include "Logging.h"
+
+using namespace Adcirc::Output;
+
+NetcdfWriteOptions::NetcdfWriteOptions()
+    : m_chunkLayout(ChunkLibraryDefault),
+      m_chunkSnaps(24),
+      m_chunkNodes(4096),
+      m_deflateLevel(2),
+      m_shuffle(true),
+      m_significantDigits(0),
+      m_fillPolicy(FillDefaultValue),
+      m_asyncWrite(false),
+      m_asyncQueueDepth(2) {}
+
+NetcdfChunkLayout NetcdfWriteOptions::chunkLayout() const {
+  return this->m_chunkLayout;
+}
+
+void NetcdfWriteOptions::setChunkLayout(NetcdfChunkLayout chunkLayout) {
+  this->m_chunkLayout = chunkLayout;
+}
+
+/**
+ * @brief Number of snaps in a chunk when using ChunkNodeBlocked
+ */
+size_t NetcdfWriteOptions::chunkSnaps() const { return this->m_chunkSnaps; }
+
+void NetcdfWriteOptions::setChunkSnaps(size_t chunkSnaps) {
+  if (chunkSnaps == 0) {
+    adcircmodules_throw_exception(
+        "NetcdfWriteOptions: Chunk size must be greater than zero");
+  }
+  this->m_chunkSnaps = chunkSnaps;
+}
+
+/**
+ * @brief Number of nodes in a chunk when using ChunkNodeBlocked
+ */
+size_t NetcdfWriteOptions::chunkNodes() const { return this->m_chunkNodes; }
+
+void NetcdfWriteOptions::setChunkNodes(size_t chunkNodes) {
+  if (chunkNodes == 0) {
+    adcircmodules_throw_exception(
+        "NetcdfWriteOptions: Chunk size must be greater than zero");
+  }
+  this->m_chunkNodes = chunkNodes;
+}
+
+/**
+ * @brief Deflate compression level from 1 to 9, or 0 for no compression
+ */
+int NetcdfWriteOptions::deflateLevel() const { return this->m_deflateLevel; }
+
+void NetcdfWriteOptions::setDeflateLevel(int deflateLevel) {
+  if (deflateLevel < 0 || deflateLevel > 9) {
+    adcircmodules_throw_exception(
+        "NetcdfWriteOptions: Deflate level must be between 0 and 9");
+  }
+  this->m_deflateLevel = deflateLevel;
+}
+
+/**
+ * @brief True if the shuffle filter is applied before compression
+ */
+bool NetcdfWriteOptions::shuffle() const { return this->m_shuffle; }
+
+void NetcdfWriteOptions::setShuffle(bool shuffle) { this->m_shuffle = shuffle; }
+
+/**
+ * @brief Number of significant decimal digits kept when values are quantized,
+ * or 0 to write values without loss
+ *
+ * Quantized values have the unneeded low bits of the mantissa rounded away,
+ * which makes them compress much better.
+ */
+int NetcdfWriteOptions::significantDigits() const {
+  return this->m_significantDigits;
+}
+
+void NetcdfWriteOptions::setSignificantDigits(int significantDigits) {
+  if (significantDigits < 0 || significantDigits > 15) {
+    adcircmodules_throw_exception(
+        "NetcdfWriteOptions: Significant digits must be between 0 and 15");
+  }
+  this->m_significantDigits = significantDigits;
+}
+
+NetcdfFillPolicy NetcdfWriteOptions::fillPolicy() const {
+  return this->m_fillPolicy;
+}
+
+void NetcdfWriteOptions::setFillPolicy(NetcdfFillPolicy fillPolicy) {
+  this->m_fillPolicy = fillPolicy;
+}
+
+/**
+ * @brief True if records are handed to the netCDF library on a background
+ * thread, so compression overlaps the work of the caller
+ *
+ * The netCDF library is not thread safe, so no other netCDF file may be read
+ * or written while a file is open with asynchronous writes, including by
+ * ReadOutput, NetcdfTimeseries or Mesh.
+ */
+bool NetcdfWriteOptions::asyncWrite() const { return this->m_asyncWrite; }
+
+void NetcdfWriteOptions::setAsyncWrite(bool asyncWrite) {
+  this->m_asyncWrite = asyncWrite;
+}
+
+/**
+ * @brief Number of blocks of records which may wait for the background
+ * thread before write() blocks
+ */
+size_t NetcdfWriteOptions::asyncQueueDepth() const {
+  return this->m_asyncQueueDepth;
+}
+
+void NetcdfWriteOptions::setAsyncQueueDepth(size_t asyncQueueDepth) {
+  if (asyncQueueDepth == 0) {
+    adcircmodules_throw_exception(
+        "NetcdfWriteOptions: Queue depth must be greater than zero");
+  }
+  this->m_asyncQueueDepth = asyncQueueDepth;
+}
+
+/**
+ * @brief Number of snaps collected before they are written to the file. With
+ * node blocked chunks, a full row of chunks is written at once so that each
+ * chunk is compressed a single time.
+ */
+size_t NetcdfWriteOptions::blockSnaps() const {
+  return this->m_chunkLayout == ChunkNodeBlocked ? this->m_chunkSnaps : 1;
+}
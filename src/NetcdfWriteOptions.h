@@ -0,0 +1,105 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_NETCDFWRITEOPTIONS_H
+#define ADCMOD_NETCDFWRITEOPTIONS_H
+
+#include <cstddef>
+
+namespace Adcirc {
+namespace Output {
+
+enum NetcdfChunkLayout {
+  /// Chunk shape chosen by the netCDF library
+  ChunkLibraryDefault = 0,
+  /// One chunk holds every node of a single snap. Fastest to write and to
+  /// read full snaps
+  ChunkSnapMajor = 1,
+  /// Chunks hold a block of nodes over a block of snaps, so time series at a
+  /// few nodes read a small part of the file
+  ChunkNodeBlocked = 2
+};
+
+enum NetcdfFillPolicy {
+  /// The default value of the output is used as the netCDF fill value
+  FillDefaultValue = 0,
+  /// Data variables are not prefilled by the library
+  FillNone = 1
+};
+
+/**
+ * @class NetcdfWriteOptions
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Storage and compression settings used by WriteOutput for netCDF
+ * files
+ *
+ * The defaults reproduce the files written by earlier versions: library
+ * chunking, deflate level 2 with shuffle, lossless values and the default
+ * value as the fill value.
+ *
+ */
+class NetcdfWriteOptions {
+ public:
+  NetcdfWriteOptions();
+
+  NetcdfChunkLayout chunkLayout() const;
+  void setChunkLayout(NetcdfChunkLayout chunkLayout);
+
+  size_t chunkSnaps() const;
+  void setChunkSnaps(size_t chunkSnaps);
+
+  size_t chunkNodes() const;
+  void setChunkNodes(size_t chunkNodes);
+
+  int deflateLevel() const;
+  void setDeflateLevel(int deflateLevel);
+
+  bool shuffle() const;
+  void setShuffle(bool shuffle);
+
+  int significantDigits() const;
+  void setSignificantDigits(int significantDigits);
+
+  NetcdfFillPolicy fillPolicy() const;
+  void setFillPolicy(NetcdfFillPolicy fillPolicy);
+
+  bool asyncWrite() const;
+  void setAsyncWrite(bool asyncWrite);
+
+  size_t asyncQueueDepth() const;
+  void setAsyncQueueDepth(size_t asyncQueueDepth);
+
+  size_t blockSnaps() const;
+
+ private:
+  NetcdfChunkLayout m_chunkLayout;
+  size_t m_chunkSnaps;
+  size_t m_chunkNodes;
+  int m_deflateLevel;
+  bool m_shuffle;
+  int m_significantDigits;
+  NetcdfFillPolicy m_fillPolicy;
+  bool m_asyncWrite;
+  size_t m_asyncQueueDepth;
+};
+}  // namespace Output
+}  // namespace Adcirc
+
+#endif  // ADCMOD_NETCDFWRITEOPTIONS_H
@@ -198,5 +198,26 @@ void NodalAttributes::addAttribute(AttributeMetadata &metadata,
   this->m_impl->addAttribute(metadata, data);
 }
 
+/**
+ * @brief Returns the values of a nodal parameter for all nodes
+ * @param[in] parameter index where the parameter is located
+ * @return values ordered by node, with metadata(parameter)->numberOfValues()
+ * values for each node
+ */
+std::vector<double> NodalAttributes::values(size_t parameter) {
+  return this->m_impl->values(parameter);
+}
+
+/**
+ * @brief Sets the values of a nodal parameter for all nodes
+ * @param[in] parameter index where the parameter is located
+ * @param[in] values values ordered by node, with
+ * metadata(parameter)->numberOfValues() values for each node
+ */
+void NodalAttributes::setValues(size_t parameter,
+                                const std::vector<double> &values) {
+  this->m_impl->setValues(parameter, values);
+}
+
 }  // namespace ModelParameters
 }  // namespace Adcirc
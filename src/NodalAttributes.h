@@ -73,6 +73,10 @@ class NodalAttributes {
   addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                std::vector<Adcirc::ModelParameters::Attribute> &data);
 
+  std::vector<double> ADCIRCMODULES_EXPORT values(size_t parameter);
+  void ADCIRCMODULES_EXPORT setValues(size_t parameter,
+                                      const std::vector<double> &values);
+
  private:
   std::unique_ptr<Adcirc::Private::NodalAttributesPrivate> m_impl;
 };
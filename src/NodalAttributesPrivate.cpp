@@ -24,10 +24,13 @@
 #include <iostream>
 #include <utility>
 
+#include "AsciiWriter.h"
 #include "Attribute.h"
 #include "DefaultValues.h"
+#include "FPCompare.h"
 #include "FileIO.h"
 #include "Logging.h"
+#include "MappedFile.h"
 #include "NodalAttributes.h"
 #include "StringConversion.h"
 #include "boost/format.hpp"
@@ -41,11 +44,16 @@ NodalAttributesPrivate::NodalAttributesPrivate()
     : m_filename(std::string()),
       m_mesh(nullptr),
       m_numParameters(0),
-      m_numNodes(0) {}
+      m_numNodes(0),
+      m_nodeOrderingLogical(true) {}
 
 NodalAttributesPrivate::NodalAttributesPrivate(const std::string &filename,
                                                Adcirc::Geometry::Mesh *mesh)
-    : m_filename(filename), m_mesh(mesh), m_numParameters(0) {
+    : m_filename(filename),
+      m_mesh(mesh),
+      m_numParameters(0),
+      m_numNodes(0),
+      m_nodeOrderingLogical(true) {
   if (this->m_mesh != nullptr) {
     this->m_numNodes = mesh->numNodes();
   }
@@ -75,19 +83,30 @@ size_t NodalAttributesPrivate::locateAttribute(
   }
 }
 
+/**
+ * @brief Reads the nodal attributes file
+ *
+ * The header and default values are read sequentially. The body is then read
+ * from a memory mapped view of the file, with the lines of each attribute
+ * section parsed in parallel directly into the contiguous value arrays
+ */
 void NodalAttributesPrivate::read() {
   std::ifstream fid(this->filename(), std::ifstream::in);
+  if (!fid.is_open()) {
+    adcircmodules_throw_exception("NodalAttributes: Could not open file");
+  }
 
   this->_readFort13Header(fid);
   this->_readFort13Defaults(fid);
-  this->_fillDefaultValues();
-  this->_readFort13Body(fid);
 
+  std::streamoff position = fid.tellg();
+  if (!fid || position < 0) {
+    adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+  }
   fid.close();
 
-  if (this->m_mesh != nullptr) {
-    this->_mapNodes();
-  }
+  this->_fillDefaultValues();
+  this->_readFort13Body(static_cast<size_t>(position));
 
   return;
 }
@@ -121,24 +140,38 @@ void NodalAttributesPrivate::_readFort13Header(std::ifstream &fid) {
       adcircmodules_throw_exception(
           "NodalAttributes: Number of nodes does not match provided mesh.");
     }
-  } else {
-    this->setNumNodes(numnodes);
   }
+  this->setNumNodes(numnodes);
 
   this->m_nodalParameters.resize(this->numParameters());
+  this->m_values.clear();
+  this->m_values.resize(this->numParameters());
+  this->m_nodalData.clear();
   this->m_nodalData.resize(this->numParameters());
-  for (size_t i = 0; i < this->numParameters(); ++i) {
-    this->m_nodalData[i].resize(this->numNodes());
+  this->_buildNodeIndex();
+
+  return;
+}
+
+/**
+ * @brief Generates the node ids for the stored values and the lookup used to
+ * locate a node from the id found in the file
+ */
+void NodalAttributesPrivate::_buildNodeIndex() {
+  this->m_nodeIds.resize(this->numNodes());
+  this->m_nodeLookup.clear();
+  this->m_nodeOrderingLogical = true;
+  for (size_t j = 0; j < this->numNodes(); ++j) {
+    this->m_nodeIds[j] =
+        this->m_mesh != nullptr ? this->mesh()->node(j)->id() : j + 1;
+    if (this->m_nodeIds[j] != j + 1) this->m_nodeOrderingLogical = false;
+  }
+  if (!this->m_nodeOrderingLogical) {
+    this->m_nodeLookup.reserve(this->numNodes());
     for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (this->m_mesh != nullptr) {
-        this->m_nodalData[i][j].setId(this->mesh()->node(j)->id());
-      } else {
-        this->m_nodalData[i][j].setId(j + 1);
-      }
+      this->m_nodeLookup[this->m_nodeIds[j]] = j;
     }
   }
-
-  return;
 }
 
 void NodalAttributesPrivate::_readFort13Defaults(std::ifstream &fid) {
@@ -198,91 +231,93 @@ void NodalAttributesPrivate::_readFort13Defaults(std::ifstream &fid) {
 
 void NodalAttributesPrivate::_fillDefaultValues() {
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    if (this->m_nodalParameters[i].numberOfValues() == 1) {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(1);
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].defaultValue());
-      }
-    } else {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(
-            this->m_nodalParameters[i].numberOfValues());
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].getDefaultValues());
-      }
-    }
-  }
-}
-
-void NodalAttributesPrivate::_mapNodes() {
-  for (size_t i = 0; i < this->numParameters(); ++i) {
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      this->m_nodalData[i][j].setNode(
-          this->mesh()->nodeById(this->m_nodalData[i][j].id()));
+    const std::vector<double> defaults =
+        this->m_nodalParameters[i].getDefaultValues();
+    const size_t nValues = defaults.size();
+    std::vector<double> &values = this->m_values[i];
+    values.resize(this->numNodes() * nValues);
+#pragma omp parallel for schedule(static)
+    for (long long j = 0; j < static_cast<long long>(this->numNodes()); ++j) {
+      std::copy(defaults.begin(), defaults.end(), &values[j * nValues]);
     }
   }
-  return;
 }
 
-void NodalAttributesPrivate::_readFort13Body(std::ifstream &fid) {
-  std::string tempLine, name;
-  size_t node;
-  double value;
+void NodalAttributesPrivate::_readFort13Body(size_t position) {
+  Adcirc::FileIO::MappedFile f(this->filename());
+  std::vector<size_t> offsets;
   bool ok;
 
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    std::getline(fid, name);
-    name = StringConversion::sanitizeString(name);
-    size_t index = this->m_attributeLocations[name];
+    size_t end = f.lineEnd(position);
+    std::string name = StringConversion::sanitizeString(
+        std::string(f.data() + position, f.data() + end));
+    auto location = this->m_attributeLocations.find(name);
+    if (location == this->m_attributeLocations.end()) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Unknown attribute " + name + " in file body");
+    }
+    size_t index = location->second;
 
-    std::getline(fid, tempLine);
-    size_t numNonDefault = StringConversion::stringToSizet(tempLine, ok);
-    assert(ok);
+    position = f.nextLine(end);
+    end = f.lineEnd(position);
+    size_t numNonDefault = StringConversion::stringToSizet(
+        std::string(f.data() + position, f.data() + end), ok);
     if (!ok) {
       adcircmodules_throw_exception("NodalAttributes: Error reading file data");
     }
+    position = f.nextLine(end);
 
-    size_t nValues = this->m_nodalParameters[index].numberOfValues();
-
-    for (size_t j = 0; j < numNonDefault; ++j) {
-      std::getline(fid, tempLine);
-
-      if (nValues == 1) {
-        if (!FileIO::AdcircIO::splitStringAttribute1Format(tempLine, node,
-                                                           value)) {
-          adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
-        }
-
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
+    if (f.lineOffsets(position, numNonDefault, offsets) != numNonDefault) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Unexpected end of file");
+    }
+    position = offsets.back();
+
+    const size_t nValues = this->m_nodalParameters[index].numberOfValues();
+    double *values = this->m_values[index].data();
+    bool error = false;
+
+#pragma omp parallel reduction(|| : error)
+    {
+      std::vector<double> v(nValues);
+
+#pragma omp for schedule(static)
+      for (long long j = 0; j < static_cast<long long>(numNonDefault); ++j) {
+        const char *first = f.data() + offsets[j];
+        const char *last = f.data() + offsets[j + 1];
+
+        size_t node;
+        bool parsed;
+        if (nValues == 1) {
+          parsed = FileIO::AdcircIO::splitStringAttribute1Format(first, last,
+                                                                node, v[0]);
         } else {
-          a = &this->m_nodalData[i][node - 1];
+          parsed = FileIO::AdcircIO::splitStringAttributeNFormat(
+              first, last, node, nValues, v.data());
         }
-        a->setValue(value);
-        a->setId(node);
-
-      } else {
-        std::vector<double> values;
-        values.reserve(nValues);
-        if (!FileIO::AdcircIO::splitStringAttributeNFormat(tempLine, node,
-                                                           values)) {
-          adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
-        };
 
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
-        } else {
-          a = &this->m_nodalData[i][node - 1];
+        size_t idx = this->numNodes();
+        if (parsed) {
+          if (this->m_nodeOrderingLogical) {
+            idx = node - 1;
+          } else {
+            auto it = this->m_nodeLookup.find(node);
+            if (it != this->m_nodeLookup.end()) idx = it->second;
+          }
+        }
+        if (idx >= this->numNodes()) {
+          error = true;
+          continue;
         }
-        a->setValue(values);
-        a->setId(node);
+
+        std::copy(v.begin(), v.end(), values + idx * nValues);
       }
     }
+
+    if (error) {
+      adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+    }
   }
   return;
 }
@@ -312,6 +347,9 @@ Attribute *NodalAttributesPrivate::attribute(size_t parameter, size_t node) {
   assert(parameter < this->numParameters());
 
   if (node < this->numNodes() && parameter < this->numParameters()) {
+    if (this->m_nodalData[parameter].empty()) {
+      this->_createAttributes(parameter);
+    }
     return &this->m_nodalData[parameter][node];
   }
   adcircmodules_throw_exception(
@@ -319,6 +357,97 @@ Attribute *NodalAttributesPrivate::attribute(size_t parameter, size_t node) {
   return nullptr;
 }
 
+/**
+ * @brief Creates the Attribute objects for a parameter from the stored values
+ * @param[in] parameter index of the nodal parameter
+ *
+ * The objects are only created when they are requested through attribute(),
+ * since a separate object for every node is expensive for large meshes.
+ * Afterwards, the objects hold the values of the parameter, since they may be
+ * modified through the returned pointers.
+ */
+void NodalAttributesPrivate::_createAttributes(size_t parameter) {
+  const size_t nValues = this->m_nodalParameters[parameter].numberOfValues();
+  const std::vector<double> &values = this->m_values[parameter];
+  std::vector<Attribute> &attributes = this->m_nodalData[parameter];
+
+  attributes.resize(this->numNodes(), Attribute(nValues));
+  for (size_t j = 0; j < this->numNodes(); ++j) {
+    attributes[j].setId(this->m_nodeIds[j]);
+    for (size_t k = 0; k < nValues; ++k) {
+      attributes[j].setValue(k, values[j * nValues + k]);
+    }
+    if (this->m_mesh != nullptr) {
+      attributes[j].setNode(this->mesh()->node(j));
+    }
+  }
+}
+
+/**
+ * @brief Copies the values of a parameter back from its Attribute objects,
+ * if they have been created
+ * @param[in] parameter index of the nodal parameter
+ */
+void NodalAttributesPrivate::_updateValues(size_t parameter) {
+  const std::vector<Attribute> &attributes = this->m_nodalData[parameter];
+  if (attributes.empty()) return;
+
+  const size_t nValues = this->m_nodalParameters[parameter].numberOfValues();
+  std::vector<double> &values = this->m_values[parameter];
+  values.resize(attributes.size() * nValues);
+  for (size_t j = 0; j < attributes.size(); ++j) {
+    if (attributes[j].size() != nValues) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Attribute size does not match its metadata");
+    }
+    for (size_t k = 0; k < nValues; ++k) {
+      values[j * nValues + k] = attributes[j].value(k);
+    }
+  }
+}
+
+/**
+ * @brief Returns the values of a nodal parameter for all nodes
+ * @param[in] parameter index of the nodal parameter
+ * @return values stored by node, with numberOfValues() entries per node
+ */
+std::vector<double> NodalAttributesPrivate::values(size_t parameter) {
+  if (parameter >= this->numParameters()) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Attribute could not be located");
+  }
+  this->_updateValues(parameter);
+  return this->m_values[parameter];
+}
+
+/**
+ * @brief Sets the values of a nodal parameter for all nodes
+ * @param[in] parameter index of the nodal parameter
+ * @param[in] values values stored by node, with numberOfValues() entries per
+ * node
+ */
+void NodalAttributesPrivate::setValues(size_t parameter,
+                                       const std::vector<double> &values) {
+  if (parameter >= this->numParameters()) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Attribute could not be located");
+  }
+  const size_t nValues = this->m_nodalParameters[parameter].numberOfValues();
+  if (values.size() != this->numNodes() * nValues) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Number of values does not match the number of "
+        "nodes");
+  }
+  this->m_values[parameter] = values;
+
+  std::vector<Attribute> &attributes = this->m_nodalData[parameter];
+  for (size_t j = 0; j < attributes.size(); ++j) {
+    for (size_t k = 0; k < nValues; ++k) {
+      attributes[j].setValue(k, values[j * nValues + k]);
+    }
+  }
+}
+
 Attribute *NodalAttributesPrivate::attribute(const std::string &name,
                                              size_t node) {
   size_t index = this->locateAttribute(name);
@@ -353,32 +482,75 @@ void NodalAttributesPrivate::_writeFort13Header(std::ofstream &fid) {
   return;
 }
 
+/**
+ * @brief Checks if the values at a node are the default values
+ */
+static bool isDefaultValue(const double *values,
+                           const std::vector<double> &defaults) {
+  for (size_t k = 0; k < defaults.size(); ++k) {
+    if (!Adcirc::FpCompare::equalTo(values[k], defaults[k])) return false;
+  }
+  return true;
+}
+
 void NodalAttributesPrivate::_writeFort13Body(std::ofstream &fid) {
+  AsciiWriter writer(fid);
+
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    size_t ndefault =
-        this->_countDefault(this->m_nodalParameters[i], this->m_nodalData[i]);
-    fid << this->m_nodalParameters[i].name() << "\n";
-    fid << boost::str(boost::format("%11i\n") % ndefault);
+    this->_updateValues(i);
 
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (!this->m_nodalParameters[i].checkIfDefaultValue(
-              this->m_nodalData[i][j])) {
-        fid << this->m_nodalData[i][j].write();
-      }
+    const std::vector<double> defaults =
+        this->m_nodalParameters[i].getDefaultValues();
+    const size_t nValues = defaults.size();
+    const double *values = this->m_values[i].data();
+    const std::vector<Attribute> &attributes = this->m_nodalData[i];
+
+    if (this->m_values[i].size() != this->numNodes() * nValues) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Number of values does not match the number of "
+          "nodes");
     }
+    if (13 + 14 * nValues + 1 > AsciiWriter::maxLineLength()) {
+      adcircmodules_throw_exception(
+          "NodalAttributes: Too many values per node to write");
+    }
+
+    writer.write(this->m_nodalParameters[i].name() + "\n");
+    writer.write(
+        boost::str(boost::format("%11i\n") % this->_countNonDefault(i)));
+
+    writer.writeLines(this->numNodes(), [&](char *p, size_t j) {
+      const double *v = values + j * nValues;
+      if (isDefaultValue(v, defaults)) return p;
+      const size_t id =
+          attributes.empty() ? this->m_nodeIds[j] : attributes[j].id();
+      p = AsciiWriter::integer(p, static_cast<long long>(id), 11);
+      p = AsciiWriter::text(p, "  ");
+      for (size_t k = 0; k < nValues; ++k) {
+        p = AsciiWriter::fixed(p, v[k], 12, 6);
+        p = AsciiWriter::text(p, "  ");
+      }
+      *p++ = '\n';
+      return p;
+    });
   }
   return;
 }
 
-size_t NodalAttributesPrivate::_countDefault(AttributeMetadata &metadata,
-                                             std::vector<Attribute> &values) {
-  size_t n = 0;
-  for (auto &v : values) {
-    if (!metadata.checkIfDefaultValue(v)) {
-      n++;
-    }
+size_t NodalAttributesPrivate::_countNonDefault(size_t parameter) const {
+  const std::vector<double> defaults =
+      this->m_nodalParameters[parameter].getDefaultValues();
+  const size_t nValues = defaults.size();
+  const double *values = this->m_values[parameter].data();
+  const long long numNodes = static_cast<long long>(
+      this->m_values[parameter].size() / std::max<size_t>(nValues, 1));
+
+  long long n = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n)
+  for (long long j = 0; j < numNodes; ++j) {
+    if (!isDefaultValue(values + j * nValues, defaults)) n++;
   }
-  return n;
+  return static_cast<size_t>(n);
 }
 
 AttributeMetadata *NodalAttributesPrivate::metadata(size_t parameter) {
@@ -401,7 +573,16 @@ void NodalAttributesPrivate::addAttribute(AttributeMetadata &metadata,
                                           std::vector<Attribute> &attribute) {
   this->m_nodalParameters.push_back(metadata);
   this->m_nodalData.push_back(attribute);
+  this->m_values.emplace_back();
   this->m_attributeLocations[metadata.name()] =
       this->m_nodalParameters.size() - 1;
   this->m_numParameters = this->m_nodalParameters.size();
+
+  if (this->m_nodeIds.empty()) {
+    this->m_nodeIds.reserve(attribute.size());
+    for (const auto &a : attribute) {
+      this->m_nodeIds.push_back(a.id());
+    }
+  }
+  this->_updateValues(this->m_numParameters - 1);
 }
@@ -70,16 +70,20 @@ class NodalAttributesPrivate {
   void addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                     std::vector<Adcirc::ModelParameters::Attribute> &attribute);
 
+  std::vector<double> values(size_t parameter);
+  void setValues(size_t parameter, const std::vector<double> &values);
+
  private:
   void _readFort13Header(std::ifstream &fid);
   void _readFort13Defaults(std::ifstream &fid);
-  void _readFort13Body(std::ifstream &fid);
+  void _readFort13Body(size_t position);
   void _writeFort13Body(std::ofstream &fid);
   void _writeFort13Header(std::ofstream &fid);
   void _fillDefaultValues();
-  void _mapNodes();
-  size_t _countDefault(Adcirc::ModelParameters::AttributeMetadata &metadata,
-                       std::vector<Adcirc::ModelParameters::Attribute> &values);
+  void _buildNodeIndex();
+  void _createAttributes(size_t parameter);
+  void _updateValues(size_t parameter);
+  size_t _countNonDefault(size_t parameter) const;
 
   /// Mapping function between the name of a nodal parameter and its position in
   /// the nodalParameters vector
@@ -103,7 +107,22 @@ class NodalAttributesPrivate {
   /// Vector of objects containing the nodal parameters read from the file
   std::vector<Adcirc::ModelParameters::AttributeMetadata> m_nodalParameters;
 
-  /// Vector of objects for the nodal parameters
+  /// Values of each nodal parameter, stored contiguously by node with
+  /// numberOfValues() entries per node
+  std::vector<std::vector<double> > m_values;
+
+  /// Node ids in the order the values are stored
+  std::vector<size_t> m_nodeIds;
+
+  /// Mapping between node id and position when the ids are not sequential
+  std::unordered_map<size_t, size_t> m_nodeLookup;
+
+  /// True if the node ids are sequential and start at 1
+  bool m_nodeOrderingLogical;
+
+  /// Attribute objects for the nodal parameters, created on the first call
+  /// to attribute(). Once created they hold the current values of that
+  /// parameter
   std::vector<std::vector<Adcirc::ModelParameters::Attribute> > m_nodalData;
 };
 }  // namespace Private
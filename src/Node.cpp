@@ -19,23 +19,20 @@
 #include "Node.h"
 
 #include "AdcHash.h"
+#include "AsciiWriter.h"
 #include "DefaultValues.h"
 #include "FPCompare.h"
+#include "Formatting.h"
+#include "MeshStorage.h"
 #include "boost/format.hpp"
 
 using namespace Adcirc::Geometry;
+using Adcirc::Private::NodeData;
 
 /**
  * @brief Default constructor
  */
-Node::Node()
-    : m_id(0),
-      m_hash(nullptr),
-      m_positionHash(nullptr),
-      m_position{adcircmodules_default_value<double>(),
-                 adcircmodules_default_value<double>(),
-                 adcircmodules_default_value<double>()},
-      m_isBoundaryNode(false) {}
+Node::Node() : m_storage(nullptr), m_data(nullptr) {}
 
 /**
  * @brief Constructor taking the id, x, y, and z for the node
@@ -45,11 +42,15 @@ Node::Node()
  * @param[in] z z elevation
  */
 Node::Node(size_t id, double x, double y, double z)
-    : m_id(id),
-      m_hash(nullptr),
-      m_positionHash(nullptr),
-      m_position{x, y, z},
-      m_isBoundaryNode(false) {}
+    : m_storage(nullptr),
+      m_data(new NodeData{id, {x, y, z}, false, nullptr, nullptr}) {}
+
+/**
+ * @brief Destructor
+ */
+Node::~Node() {
+  if (this->m_storage == nullptr) delete this->m_data;
+}
 
 /**
  * @brief Copies a Node object
@@ -57,26 +58,36 @@ Node::Node(size_t id, double x, double y, double z)
  * @param[in] b Node to be copied
  */
 void Node::nodeCopier(Node *a, const Node *b) {
-  a->m_id = b->id();
-  a->m_position = {b->x(), b->y(), b->z()};
-  a->m_hash.reset(nullptr);
-  a->m_positionHash.reset(nullptr);
-  a->m_isBoundaryNode = b->isBoundaryNode();
+  if (a->m_storage == nullptr && b->m_storage == nullptr &&
+      b->m_data == nullptr) {
+    delete a->m_data;
+    a->m_data = nullptr;
+    return;
+  }
+  a->resetHash();
+  a->setNode(b->id(), b->x(), b->y(), b->z());
+  a->setIsBoundaryNode(b->isBoundaryNode());
 }
 
 /**
  * @brief Copy constructor
  * @param n copied Node
+ *
+ * The copy is never part of a mesh, even if the original node is
  */
-Node::Node(const Node &n) { Node::nodeCopier(this, &n); }
+Node::Node(const Node &n) : m_storage(nullptr), m_data(nullptr) {
+  Node::nodeCopier(this, &n);
+}
 
 /**
  * @brief Copy assignment operator
  * @param[in] n node to copy
  * @return reference to copied node
+ *
+ * If this node is part of a mesh, the values are written to the mesh
  */
 Node &Node::operator=(const Node &n) {
-  Node::nodeCopier(this, &n);
+  if (this != &n) Node::nodeCopier(this, &n);
   return *this;
 }
 
@@ -88,6 +99,54 @@ bool Node::operator==(const Node *n) {
   return n->x() == this->x() && n->y() == this->y() && n->z() == this->z();
 }
 
+/**
+ * @brief Returns the values of a node that is not part of a mesh, allocating
+ * them if required
+ * @return pointer to the node values
+ */
+NodeData *Node::data() {
+  if (this->m_data == nullptr) {
+    this->m_data = new NodeData{0,
+                                {adcircmodules_default_value<double>(),
+                                 adcircmodules_default_value<double>(),
+                                 adcircmodules_default_value<double>()},
+                                false,
+                                nullptr,
+                                nullptr};
+  }
+  return this->m_data;
+}
+
+/**
+ * @brief Returns the buffer used to hold the node hash
+ * @return reference to hash buffer
+ */
+std::unique_ptr<char[]> &Node::hashBuffer() {
+  if (this->m_storage) return this->m_storage->nodeHash(this->m_index);
+  return this->data()->hash;
+}
+
+/**
+ * @brief Returns the buffer used to hold the node position hash
+ * @return reference to position hash buffer
+ */
+std::unique_ptr<char[]> &Node::positionHashBuffer() {
+  if (this->m_storage) return this->m_storage->nodePositionHash(this->m_index);
+  return this->data()->positionHash;
+}
+
+/**
+ * @brief Removes any hashes that have been computed for the node
+ */
+void Node::resetHash() {
+  if (this->m_storage) {
+    this->m_storage->resetNodeHash(this->m_index);
+  } else if (this->m_data) {
+    this->m_data->hash.reset(nullptr);
+    this->m_data->positionHash.reset(nullptr);
+  }
+}
+
 /**
  * @brief Function taking the id, x, y, and z for the node
  * @param[in] id nodal identifier. Can be either array index or label
@@ -96,9 +155,21 @@ bool Node::operator==(const Node *n) {
  * @param[in] z z elevation
  */
 void Node::setNode(size_t id, double x, double y, double z) {
-  this->m_id = id;
-  this->m_position = {x, y, z};
-  if (this->m_hash.get() != nullptr) this->generateHash();
+  bool hashed;
+  if (this->m_storage) {
+    const size_t i = this->m_index;
+    this->m_storage->m_nodeId[i] = id;
+    this->m_storage->m_x[i] = x;
+    this->m_storage->m_y[i] = y;
+    this->m_storage->m_z[i] = z;
+    hashed = this->m_storage->m_nodeHash[i] != nullptr;
+  } else {
+    NodeData *d = this->data();
+    d->id = id;
+    d->position = {x, y, z};
+    hashed = d->hash != nullptr;
+  }
+  if (hashed) this->generateHash();
   return;
 }
 
@@ -106,49 +177,88 @@ void Node::setNode(size_t id, double x, double y, double z) {
  * @brief Returns the x-location of the node
  * @return x-location
  */
-double Node::x() const { return this->m_position[0]; }
+double Node::x() const {
+  if (this->m_storage) return this->m_storage->m_x[this->m_index];
+  return this->m_data ? this->m_data->position[0]
+                      : adcircmodules_default_value<double>();
+}
 
 /**
  * @brief Sets the x-location of the node
  * @param[in] x x-location
  */
-void Node::setX(double x) { this->m_position[0] = x; }
+void Node::setX(double x) {
+  if (this->m_storage) {
+    this->m_storage->m_x[this->m_index] = x;
+  } else {
+    this->data()->position[0] = x;
+  }
+}
 
 /**
  * @brief Returns the y-location of the node
  * @return y-location
  */
-double Node::y() const { return this->m_position[1]; }
+double Node::y() const {
+  if (this->m_storage) return this->m_storage->m_y[this->m_index];
+  return this->m_data ? this->m_data->position[1]
+                      : adcircmodules_default_value<double>();
+}
 
 /**
  * @brief Sets the y-location of the node
  * @param[in] y y-location
  */
-void Node::setY(double y) { this->m_position[1] = y; }
+void Node::setY(double y) {
+  if (this->m_storage) {
+    this->m_storage->m_y[this->m_index] = y;
+  } else {
+    this->data()->position[1] = y;
+  }
+}
 
 /**
  * @brief Returns the z-elevation of the node
  * @return y-elevation
  */
-double Node::z() const { return this->m_position[2]; }
+double Node::z() const {
+  if (this->m_storage) return this->m_storage->m_z[this->m_index];
+  return this->m_data ? this->m_data->position[2]
+                      : adcircmodules_default_value<double>();
+}
 
 /**
  * @brief Sets the z-elevation of the node
  * @param[in] z z-location
  */
-void Node::setZ(double z) { this->m_position[2] = z; }
+void Node::setZ(double z) {
+  if (this->m_storage) {
+    this->m_storage->m_z[this->m_index] = z;
+  } else {
+    this->data()->position[2] = z;
+  }
+}
 
 /**
  * @brief Returns the nodal id/label
  * @return nodal id/label
  */
-size_t Node::id() const { return this->m_id; }
+size_t Node::id() const {
+  if (this->m_storage) return this->m_storage->m_nodeId[this->m_index];
+  return this->m_data ? this->m_data->id : 0;
+}
 
 /**
  * @brief Sets the nodal id/label
  * @param[in] id nodal id/label
  */
-void Node::setId(size_t id) { this->m_id = id; }
+void Node::setId(size_t id) {
+  if (this->m_storage) {
+    this->m_storage->m_nodeId[this->m_index] = id;
+  } else {
+    this->data()->id = id;
+  }
+}
 
 /**
  * @brief Formats the node for writing into an Adcirc ASCII mesh file
@@ -157,8 +267,10 @@ void Node::setId(size_t id) { this->m_id = id; }
  * @return formatted string
  */
 std::string Node::toAdcircString(bool geographicCoordinates) {
-  return boost::str(boost::format("%11i   %16.10f   %16.10f  %16.10f") %
-                    this->id() % this->x() % this->y() % this->z());
+  char buffer[Adcirc::Private::AsciiWriter::maxLineLength()];
+  return std::string(buffer, Adcirc::Output::Formatting::adcircMeshNodeLine(
+                                 buffer, this->id(), this->x(), this->y(),
+                                 this->z()));
 }
 
 /**
@@ -176,9 +288,7 @@ std::string Node::to2dmString(bool geographicCoordinates) {
  * @brief Generates a point object from a node
  * @return Point (x,y) using node coordinates
  */
-Adcirc::Point Node::toPoint() {
-  return Adcirc::Point(this->m_position[0], this->m_position[1]);
-}
+Adcirc::Point Node::toPoint() { return Adcirc::Point(this->x(), this->y()); }
 
 /**
  * @brief Returns the hash of this node based upon it's position and elevation
@@ -189,8 +299,8 @@ Adcirc::Point Node::toPoint() {
  * the node's position and z-elevation
  */
 std::string Node::hash(Adcirc::Cryptography::HashType h, bool force) {
-  if (this->m_hash.get() == nullptr || force) this->generateHash(h);
-  return std::string(this->m_hash.get());
+  if (this->hashBuffer() == nullptr || force) this->generateHash(h);
+  return std::string(this->hashBuffer().get());
 }
 
 /**
@@ -203,9 +313,9 @@ std::string Node::hash(Adcirc::Cryptography::HashType h, bool force) {
  * z-elevation is the same.
  */
 std::string Node::positionHash(Adcirc::Cryptography::HashType h, bool force) {
-  if (this->m_positionHash.get() == nullptr || force)
+  if (this->positionHashBuffer() == nullptr || force)
     this->generatePositionHash();
-  return std::string(this->m_positionHash.get());
+  return std::string(this->positionHashBuffer().get());
 }
 
 /**
@@ -217,7 +327,7 @@ void Node::generateHash(Adcirc::Cryptography::HashType h) {
   hash.addData(boost::str(boost::format("%16.10f") % this->x()));
   hash.addData(boost::str(boost::format("%16.10f") % this->y()));
   hash.addData(boost::str(boost::format("%16.10f") % this->z()));
-  this->m_hash.reset(hash.getHash());
+  this->hashBuffer().reset(hash.getHash());
   return;
 }
 
@@ -229,7 +339,7 @@ void Node::generatePositionHash(Adcirc::Cryptography::HashType h) {
   Adcirc::Cryptography::Hash hash(h);
   hash.addData(boost::str(boost::format("%16.10f") % this->x()));
   hash.addData(boost::str(boost::format("%16.10f") % this->y()));
-  this->m_positionHash.reset(hash.getHash());
+  this->positionHashBuffer().reset(hash.getHash());
   return;
 }
 
@@ -238,10 +348,21 @@ void Node::generatePositionHash(Adcirc::Cryptography::HashType h) {
  * mesh
  * @return true if boundary node
  */
-bool Node::isBoundaryNode() const { return m_isBoundaryNode; }
+bool Node::isBoundaryNode() const {
+  if (this->m_storage) {
+    return this->m_storage->m_isBoundaryNode[this->m_index] != 0;
+  }
+  return this->m_data ? this->m_data->isBoundaryNode : false;
+}
 
 /**
  * @brief Sets the boundary node status
  * @param b true if node is on the boundary
  */
-void Node::setIsBoundaryNode(bool b) { m_isBoundaryNode = b; }
+void Node::setIsBoundaryNode(bool b) {
+  if (this->m_storage) {
+    this->m_storage->m_isBoundaryNode[this->m_index] = b ? 1 : 0;
+  } else {
+    this->data()->isBoundaryNode = b;
+  }
+}
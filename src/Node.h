@@ -29,6 +29,12 @@
 #include "Point.h"
 
 namespace Adcirc {
+
+namespace Private {
+class MeshStorage;
+struct NodeData;
+}  // namespace Private
+
 namespace Geometry {
 
 /**
@@ -39,12 +45,16 @@ namespace Geometry {
  * @brief The Node class describes the x, y, z position of a single mesh
  * node
  *
+ * Nodes that belong to a mesh are views into the mesh storage. Nodes that
+ * are created directly or copied out of a mesh hold their own values.
+ *
  */
 class Node {
  public:
   ADCIRCMODULES_EXPORT Node();
   ADCIRCMODULES_EXPORT Node(size_t id, double x, double y, double z);
   ADCIRCMODULES_EXPORT Node(const Node &n);
+  ADCIRCMODULES_EXPORT ~Node();
 
   ADCIRCMODULES_EXPORT Node &operator=(const Node &n);
   ADCIRCMODULES_EXPORT bool operator==(const Node &n);
@@ -83,14 +93,24 @@ class Node {
                bool force = false);
 
  private:
-  size_t m_id;                             /// Integer name of a mesh node
-  std::unique_ptr<char[]> m_hash;          /// hash identifier for the node
-  std::unique_ptr<char[]> m_positionHash;  /// hash of only node's position
-  std::array<double, 3> m_position;
-  bool m_isBoundaryNode;
+  /// Mesh storage holding the node values, nullptr if not part of a mesh
+  Adcirc::Private::MeshStorage *m_storage;
+  union {
+    /// Position of the node in the mesh storage
+    size_t m_index;
+    /// Values of the node when it is not part of a mesh
+    Adcirc::Private::NodeData *m_data;
+  };
+
+  friend class Adcirc::Private::MeshStorage;
 
   static void nodeCopier(Node *a, const Node *b);
 
+  Adcirc::Private::NodeData *data();
+  std::unique_ptr<char[]> &hashBuffer();
+  std::unique_ptr<char[]> &positionHashBuffer();
+  void resetHash();
+
   void generateHash(Adcirc::Cryptography::HashType h =
                         Adcirc::Cryptography::AdcircDefaultHash);
   void generatePositionHash(Adcirc::Cryptography::HashType h =
@@ -24,7 +24,10 @@
 using namespace Adcirc;
 
 Oceanweather::Oceanweather()
-    : m_currentSnap(0), m_isOpen(false), m_record(OceanweatherRecord()) {}
+    : m_currentSnap(0),
+      m_isOpen(false),
+      m_useIndexCache(true),
+      m_record(OceanweatherRecord()) {}
 
 int Oceanweather::addDomain(std::string pressureFile, std::string windFile) {
   if (!Adcirc::FileIO::Generic::fileExists(pressureFile) ||
@@ -34,6 +37,8 @@ int Oceanweather::addDomain(std::string pressureFile, std::string windFile) {
   }
   m_pressureFiles.push_back(std::move(pressureFile));
   m_windFiles.push_back(std::move(windFile));
+  m_pressureIndex.clear();
+  m_windIndex.clear();
   return 0;
 }
 
@@ -44,6 +49,9 @@ size_t Oceanweather::nDomains() const {
   return 0;
 }
 
+/**
+ * @brief Index of the snap that will be returned by the next read
+ */
 size_t Oceanweather::currentSnap() const { return m_currentSnap; }
 
 int Oceanweather::open() {
@@ -81,10 +89,50 @@ int Oceanweather::read() {
   if (!m_isOpen) {
     this->open();
   }
-  return this->m_record.read();
+  int ierr = this->m_record.read();
+  if (ierr == 0) m_currentSnap++;
+  return ierr;
 }
 
-OceanweatherRecord Oceanweather::record() const { return m_record; }
+/**
+ * @brief The record filled by the last read. The record is overwritten by the
+ * next read, so a copy must be made to keep it
+ */
+const OceanweatherRecord &Oceanweather::record() const { return m_record; }
+
+/**
+ * @brief Reads the remaining snaps and returns the storm information of each
+ *
+ * The storm information is computed from the record as each snap is read, so
+ * the records are never copied.
+ */
+std::vector<OceanweatherTrackInfo> Oceanweather::track() {
+  std::vector<OceanweatherTrackInfo> track;
+  while (this->read() == 0) {
+    track.push_back(m_record.get_current_storm_info());
+  }
+  return track;
+}
+
+/**
+ * @brief Returns the storm information of the snaps between two times
+ * @param[in] start first time of the window
+ * @param[in] end last time of the window
+ */
+std::vector<OceanweatherTrackInfo> Oceanweather::track(const CDate &start,
+                                                       const CDate &end) {
+  std::vector<OceanweatherTrackInfo> track;
+  const auto range = this->snapRange(start, end);
+  if (range.first == range.second || this->seek(range.first) != 0) {
+    return track;
+  }
+  track.reserve(range.second - range.first);
+  for (size_t s = range.first; s < range.second; ++s) {
+    if (this->read() != 0) break;
+    track.push_back(m_record.get_current_storm_info());
+  }
+  return track;
+}
 
 std::string Oceanweather::windFile(int domain) const {
   return m_windFiles[domain];
@@ -103,3 +151,123 @@ int Oceanweather::close() {
   }
   return 0;
 }
+
+bool Oceanweather::useIndexCache() const { return m_useIndexCache; }
+
+/**
+ * @brief Sets if the snap indices are read from and written to cache files
+ * next to the Oceanweather files
+ */
+void Oceanweather::setUseIndexCache(bool useIndexCache) {
+  m_useIndexCache = useIndexCache;
+}
+
+/**
+ * @brief Indexes the pressure and wind files of all domains and checks that
+ * they contain the same snaps
+ */
+void Oceanweather::buildIndex() {
+  if (m_pressureIndex.size() == nDomains() &&
+      m_windIndex.size() == nDomains()) {
+    return;
+  }
+
+  std::vector<OceanweatherIndex> pressure(nDomains()), wind(nDomains());
+  for (size_t i = 0; i < nDomains(); ++i) {
+    pressure[i] =
+        OceanweatherIndex(m_pressureFiles[i], false, m_useIndexCache);
+    wind[i] = OceanweatherIndex(m_windFiles[i], true, m_useIndexCache);
+  }
+
+  for (size_t i = 0; i < nDomains(); ++i) {
+    for (const auto *idx : {&pressure[i], &wind[i]}) {
+      bool aligned = idx->nSnaps() == pressure[0].nSnaps();
+      for (size_t j = 0; aligned && j < idx->nSnaps(); ++j) {
+        aligned = idx->time(j) == pressure[0].time(j);
+      }
+      if (!aligned) {
+        adcircmodules_throw_exception(
+            "The snaps in " + idx->filename() + " are not aligned with " +
+            pressure[0].filename());
+      }
+    }
+  }
+
+  m_pressureIndex = std::move(pressure);
+  m_windIndex = std::move(wind);
+}
+
+/**
+ * @brief Index of the pressure or wind file of a domain
+ * @param[in] domain domain number
+ * @param[in] wind return the index of the wind file instead of the pressure
+ * file
+ */
+const OceanweatherIndex &Oceanweather::index(size_t domain, bool wind) {
+  this->buildIndex();
+  if (domain >= nDomains()) {
+    adcircmodules_throw_exception("Domain index out of range");
+  }
+  return wind ? m_windIndex[domain] : m_pressureIndex[domain];
+}
+
+/**
+ * @brief Number of snaps in the files
+ */
+size_t Oceanweather::nSnaps() { return this->index().nSnaps(); }
+
+/**
+ * @brief Times of all snaps in the files
+ */
+std::vector<CDate> Oceanweather::snapTimes() {
+  const OceanweatherIndex &idx = this->index();
+  std::vector<CDate> times;
+  times.reserve(idx.nSnaps());
+  for (size_t i = 0; i < idx.nSnaps(); ++i) {
+    times.push_back(idx.time(i));
+  }
+  return times;
+}
+
+/**
+ * @brief Snaps between two times
+ * @return pair of snap indices [first, last) within the window
+ */
+std::pair<size_t, size_t> Oceanweather::snapRange(const CDate &start,
+                                                  const CDate &end) {
+  return this->index().range(start, end);
+}
+
+/**
+ * @brief Positions the files so that the next read returns the specified snap
+ * @param[in] snap index of the snap
+ * @return 0 on success, 1 if the snap does not exist
+ */
+int Oceanweather::seek(size_t snap) {
+  if (!m_isOpen) {
+    this->open();
+  }
+  this->buildIndex();
+  if (nDomains() == 0 || snap >= m_pressureIndex[0].nSnaps()) {
+    Adcirc::Logging::warning("Snap is outside of the Oceanweather files");
+    return 1;
+  }
+  for (size_t i = 0; i < nDomains(); ++i) {
+    m_fid_pressure[i]->clear();
+    m_fid_pressure[i]->seekg(m_pressureIndex[i].snap(snap).offset);
+    m_fid_wind[i]->clear();
+    m_fid_wind[i]->seekg(m_windIndex[i].snap(snap).offset);
+  }
+  m_currentSnap = snap;
+  return 0;
+}
+
+/**
+ * @brief Positions the files so that the next read returns the first snap at
+ * or after a time
+ * @param[in] time time to seek to
+ * @return 0 on success, 1 if all snaps are before the time
+ */
+int Oceanweather::seek(const CDate &time) {
+  return this->seek(this->index().find(time));
+}
@@ -22,9 +22,11 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "OceanweatherHeader.h"
+#include "OceanweatherIndex.h"
 #include "OceanweatherRecord.h"
 
 namespace Adcirc {
@@ -45,20 +47,46 @@ class Oceanweather {
 
   int close();
 
+  int seek(size_t snap);
+
+  int seek(const Adcirc::CDate &time);
+
+  size_t nSnaps();
+
+  std::vector<Adcirc::CDate> snapTimes();
+
+  std::pair<size_t, size_t> snapRange(const Adcirc::CDate &start,
+                                      const Adcirc::CDate &end);
+
+  const Adcirc::OceanweatherIndex &index(size_t domain = 0, bool wind = false);
+
+  bool useIndexCache() const;
+  void setUseIndexCache(bool useIndexCache);
+
   std::string pressureFile(int domain = 0) const;
   std::string windFile(int domain = 0) const;
 
-  Adcirc::OceanweatherRecord record() const;
+  const Adcirc::OceanweatherRecord &record() const;
+
+  std::vector<Adcirc::OceanweatherTrackInfo> track();
+
+  std::vector<Adcirc::OceanweatherTrackInfo> track(const Adcirc::CDate &start,
+                                                   const Adcirc::CDate &end);
 
  private:
   std::vector<std::string> m_pressureFiles;
   std::vector<std::string> m_windFiles;
   size_t m_currentSnap;
   bool m_isOpen;
+  bool m_useIndexCache;
   std::vector<std::unique_ptr<std::ifstream>> m_fid_pressure;
   std::vector<std::unique_ptr<std::ifstream>> m_fid_wind;
   std::vector<OceanweatherHeader> m_headers;
+  std::vector<OceanweatherIndex> m_pressureIndex;
+  std::vector<OceanweatherIndex> m_windIndex;
   Adcirc::OceanweatherRecord m_record;
+
+  void buildIndex();
 };
 
 }  // namespace Adcirc
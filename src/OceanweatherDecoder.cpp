@@ -0,0 +1,225 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OceanweatherDecoder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "boost/spirit/include/qi.hpp"
+
+using namespace Adcirc::Private;
+
+namespace qi = boost::spirit::qi;
+namespace ascii = boost::spirit::ascii;
+
+//...Exact powers of ten representable as doubles
+static constexpr double c_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+//...Largest number of significant digits that is always exact in a double
+static constexpr int c_maxDigits = 15;
+
+/**
+ * @brief Reads a data block from the stream
+ * @param[in] fid stream positioned at the first line of the block
+ * @param[in] n number of values in the block
+ * @param[out] values decoded values
+ * @return 0 if the block was read, 1 otherwise
+ *
+ * The lines of the block are read into a buffer with as few reads as
+ * possible. Any bytes read past the end of the block are returned to the
+ * stream so that the next record can be read.
+ */
+int OceanweatherDecoder::read(std::istream &fid, size_t n,
+                              std::vector<double> &values) {
+  //...Length of a line with 8 values, including the newline
+  constexpr size_t lineLength =
+      OceanweatherDecoder::valuesPerLine() * OceanweatherDecoder::fieldWidth() +
+      1;
+
+  values.resize(n);
+  if (n == 0) return 0;
+
+  const size_t numLines = (n + OceanweatherDecoder::valuesPerLine() - 1) /
+                          OceanweatherDecoder::valuesPerLine();
+
+  std::vector<char> buffer;
+  size_t length = 0;
+  size_t blockEnd = 0;
+  size_t numFound = 0;
+  size_t request = numLines * lineLength + 2;
+
+  while (numFound < numLines) {
+    buffer.resize(length + request);
+    fid.read(buffer.data() + length, static_cast<std::streamsize>(request));
+    const size_t count = static_cast<size_t>(fid.gcount());
+    length += count;
+
+    while (numFound < numLines && blockEnd < length) {
+      const void *p =
+          std::memchr(buffer.data() + blockEnd, '\n', length - blockEnd);
+      if (p == nullptr) break;
+      blockEnd = static_cast<const char *>(p) - buffer.data() + 1;
+      numFound++;
+    }
+
+    if (count < request) {
+      //...End of file, which may end with an unterminated line
+      if (numFound + 1 == numLines && blockEnd < length) {
+        blockEnd = length;
+        numFound++;
+      }
+      break;
+    }
+    request = (numLines - numFound) * lineLength + 2;
+  }
+
+  if (blockEnd < length) {
+    fid.clear();
+    fid.seekg(-static_cast<std::streamoff>(length - blockEnd), std::ios::cur);
+  }
+
+  if (numFound < numLines) return 1;
+  return OceanweatherDecoder::decode(buffer.data(), buffer.data() + blockEnd,
+                                     n, values.data())
+             ? 0
+             : 1;
+}
+
+/**
+ * @brief Decodes the lines of a data block
+ * @param[in] first first character of the block
+ * @param[in] last one past the last character of the block
+ * @param[in] n number of values in the block
+ * @param[out] values array of n values
+ * @return true if all values were decoded
+ */
+bool OceanweatherDecoder::decode(const char *first, const char *last, size_t n,
+                                 double *values) {
+  size_t i = 0;
+  while (i < n && first < last) {
+    const void *p = std::memchr(first, '\n', last - first);
+    const char *lineEnd = p == nullptr ? last : static_cast<const char *>(p);
+    const size_t count = std::min(OceanweatherDecoder::valuesPerLine(), n - i);
+    if (OceanweatherDecoder::parseLine(first, lineEnd, count, values + i) !=
+        count) {
+      return false;
+    }
+    i += count;
+    first = lineEnd + 1;
+  }
+  return i == n;
+}
+
+/**
+ * @brief Parses the values on one line of a data block
+ * @param[in] first first character of the line
+ * @param[in] last one past the last character of the line
+ * @param[in] n number of values expected on the line
+ * @param[out] values parsed values
+ * @return number of values parsed
+ */
+size_t OceanweatherDecoder::parseLine(const char *first, const char *last,
+                                      size_t n, double *values) {
+  if (last > first && *(last - 1) == '\r') --last;
+  if (static_cast<size_t>(last - first) >=
+      n * OceanweatherDecoder::fieldWidth()) {
+    size_t i = 0;
+    for (; i < n; ++i) {
+      const char *field = first + i * OceanweatherDecoder::fieldWidth();
+      if (!OceanweatherDecoder::parseField(
+              field, field + OceanweatherDecoder::fieldWidth(), values[i])) {
+        break;
+      }
+    }
+    if (i == n) return n;
+  }
+  return OceanweatherDecoder::parseLineFree(first, last, n, values);
+}
+
+/**
+ * @brief Parses up to n whitespace separated values from a line
+ * @param[in] first first character of the line
+ * @param[in] last one past the last character of the line
+ * @param[in] n maximum number of values to parse
+ * @param[out] values parsed values
+ * @return number of values parsed
+ */
+size_t OceanweatherDecoder::parseLineFree(const char *first, const char *last,
+                                          size_t n, double *values) {
+  size_t i = 0;
+  while (i < n &&
+         qi::phrase_parse(first, last, qi::double_, ascii::space, values[i])) {
+    ++i;
+  }
+  return i;
+}
+
+/**
+ * @brief Parses a fixed width field holding a decimal number without an
+ * exponent
+ * @param[in] first first character of the field
+ * @param[in] last one past the last character of the field
+ * @param[out] value parsed value
+ * @return true if the field holds a single number
+ *
+ * The digits are accumulated into an integer which is divided by an exact
+ * power of ten, so the result is the correctly rounded value of the text.
+ * Fields with more digits than can be represented exactly are rejected and
+ * left to the general parser.
+ */
+bool OceanweatherDecoder::parseField(const char *first, const char *last,
+                                     double &value) {
+  while (first < last && *first == ' ') ++first;
+
+  bool negative = false;
+  if (first < last && (*first == '-' || *first == '+')) {
+    negative = *first == '-';
+    ++first;
+  }
+
+  uint64_t mantissa = 0;
+  int numDigits = 0;
+  int numDecimals = 0;
+  bool point = false;
+  for (; first < last; ++first) {
+    const char c = *first;
+    if (c >= '0' && c <= '9') {
+      mantissa = 10 * mantissa + static_cast<uint64_t>(c - '0');
+      numDigits++;
+      if (point) numDecimals++;
+    } else if (c == '.' && !point) {
+      point = true;
+    } else {
+      break;
+    }
+  }
+
+  while (first < last && *first == ' ') ++first;
+
+  if (first != last || numDigits == 0 || numDigits > c_maxDigits) {
+    return false;
+  }
+
+  value = static_cast<double>(mantissa) / c_pow10[numDecimals];
+  if (negative) value = -value;
+  return true;
+}
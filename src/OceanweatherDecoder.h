@@ -0,0 +1,73 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OCEANWEATHERDECODER_H
+#define ADCMOD_OCEANWEATHERDECODER_H
+
+#include <cstddef>
+#include <istream>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class OceanweatherDecoder
+ * @author Zachary Cobell
+ * @brief Decodes the data blocks of Oceanweather (OWI) pressure and wind
+ * files
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * A data block holds the values of one field on the grid, written 8 per line
+ * in fields 10 characters wide (Fortran format 8F10.4). The lines of a block
+ * are read from the stream into a single buffer and each field is parsed in
+ * place with integer arithmetic. Lines which do not follow the fixed width
+ * layout, such as values in exponential notation, are parsed as whitespace
+ * separated values.
+ *
+ * The decoder holds no state, so different streams may be decoded
+ * concurrently.
+ *
+ */
+class OceanweatherDecoder {
+ public:
+  /// Number of values on each line of a data block
+  static constexpr size_t valuesPerLine() { return 8; }
+
+  /// Width of each value on a line
+  static constexpr size_t fieldWidth() { return 10; }
+
+  static int read(std::istream &fid, size_t n, std::vector<double> &values);
+
+  static bool decode(const char *first, const char *last, size_t n,
+                     double *values);
+
+  static size_t parseLine(const char *first, const char *last, size_t n,
+                          double *values);
+
+  static size_t parseLineFree(const char *first, const char *last, size_t n,
+                              double *values);
+
+  static bool parseField(const char *first, const char *last, double &value);
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OCEANWEATHERDECODER_H
@@ -20,6 +20,8 @@
 
 #include <fstream>
 
+#include "Logging.h"
+
 using namespace Adcirc;
 
 OceanweatherHeader::OceanweatherHeader() = default;
@@ -27,6 +29,13 @@ OceanweatherHeader::OceanweatherHeader() = default;
 void OceanweatherHeader::read(std::ifstream *fid) {
   std::string line;
   std::getline(*(fid), line);
+  this->parse(line);
+}
+
+void OceanweatherHeader::parse(const std::string &line) {
+  if (line.size() < 80) {
+    adcircmodules_throw_exception("Invalid Oceanweather file header");
+  }
   auto sdate1 = std::string(line.begin() + 55, line.begin() + 65);
   auto sdate2 = std::string(line.begin() + 70, line.begin() + 80);
 
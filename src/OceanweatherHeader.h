@@ -19,6 +19,8 @@
 #ifndef OCEANWEATHERHEADER_H
 #define OCEANWEATHERHEADER_H
 
+#include <string>
+
 #include "CDate.h"
 
 namespace Adcirc {
@@ -29,6 +31,8 @@ class OceanweatherHeader {
 
   void read(std::ifstream *fid);
 
+  void parse(const std::string &line);
+
   Adcirc::CDate startDate() const;
 
   void setStartDate(const Adcirc::CDate &startDate);
@@ -0,0 +1,288 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OceanweatherIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "Logging.h"
+#include "MappedFile.h"
+
+using namespace Adcirc;
+
+//...Identifies the cache files and the version of their layout
+static const char *const c_cacheSignature = "OWIINDEX 1";
+
+OceanweatherIndex::OceanweatherIndex() : m_fileSize(0) {}
+
+/**
+ * @brief Indexes a file, reusing the cached index when it is still valid
+ * @param[in] filename Oceanweather pressure or wind file
+ * @param[in] wind true if filename is a wind file
+ * @param[in] useCache read the index from and write it to the cache file
+ */
+OceanweatherIndex::OceanweatherIndex(const std::string &filename, bool wind,
+                                     bool useCache)
+    : m_fileSize(0) {
+  if (useCache && this->readCache(filename)) return;
+  this->build(filename, wind);
+  if (useCache) this->writeCache();
+}
+
+/**
+ * @brief Name of the file the index of an Oceanweather file is cached in
+ */
+std::string OceanweatherIndex::cacheFilename(const std::string &filename) {
+  return filename + ".idx";
+}
+
+bool OceanweatherIndex::isGridLine(const char *first, const char *last) {
+  const char *key = "ilat=";
+  if (last - first < 5) return false;
+  for (size_t i = 0; i < 5; ++i) {
+    if (std::tolower(static_cast<unsigned char>(first[i])) != key[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Determines whether a file holds wind or pressure data
+ * @param[in] filename Oceanweather pressure or wind file
+ * @return true if the first snap has a u and a v block, false if it has a
+ * single pressure block
+ *
+ * The data lines between the first grid line and the next grid line (or the
+ * end of the file) are counted and compared to the block size of the grid.
+ */
+bool OceanweatherIndex::isWindFile(const std::string &filename) {
+  FileIO::MappedFile file(filename);
+
+  size_t position = file.nextLine(file.lineEnd(0));
+  size_t blockLines = 0, numLines = 0;
+  bool foundGrid = false;
+  while (position < file.size()) {
+    const size_t end = file.lineEnd(position);
+    const char *first = file.data() + position;
+    const char *last = file.data() + end;
+    if (last > first && *(last - 1) == '\r') --last;
+    position = file.nextLine(end);
+    if (first == last) continue;
+
+    if (OceanweatherIndex::isGridLine(first, last)) {
+      if (foundGrid) break;
+      foundGrid = true;
+      const OceanweatherRecord::Grid grid =
+          OceanweatherRecord::parseOwiGridLine(std::string(first, last));
+      blockLines = (grid.nx * grid.ny + 7) / 8;
+    } else if (!foundGrid) {
+      adcircmodules_throw_exception("Invalid grid line in " + filename);
+    } else {
+      numLines++;
+    }
+  }
+
+  if (foundGrid && numLines == blockLines) return false;
+  if (foundGrid && numLines == 2 * blockLines) return true;
+  adcircmodules_throw_exception("Could not determine the data layout of " +
+                                filename);
+  return false;
+}
+
+/**
+ * @brief Indexes a file by reading the grid line that starts each snap and
+ * skipping the data blocks that follow it
+ * @param[in] filename Oceanweather pressure or wind file
+ * @param[in] wind true for a wind file, which has a u and a v block per snap
+ *
+ * Each data block holds nx*ny values written 8 per line, so only the line
+ * ends of the block are searched and the next grid line is expected directly
+ * after it.
+ */
+void OceanweatherIndex::build(const std::string &filename, bool wind) {
+  FileIO::MappedFile file(filename);
+
+  auto lineText = [&](size_t position, size_t end) {
+    const char *first = file.data() + position;
+    const char *last = file.data() + end;
+    if (last > first && *(last - 1) == '\r') --last;
+    return std::make_pair(first, last);
+  };
+
+  size_t end = file.lineEnd(0);
+  auto header = lineText(0, end);
+  std::string headerLine(header.first, header.second);
+  OceanweatherHeader h;
+  h.parse(headerLine);
+
+  std::vector<Snap> snaps;
+  size_t position = file.nextLine(end);
+  while (position < file.size()) {
+    end = file.lineEnd(position);
+    auto line = lineText(position, end);
+
+    //...Blank lines at the end of the file
+    if (line.first == line.second) {
+      position = file.nextLine(end);
+      continue;
+    }
+
+    if (!OceanweatherIndex::isGridLine(line.first, line.second) ||
+        line.second - line.first < 80) {
+      adcircmodules_throw_exception("Invalid grid line in " + filename);
+    }
+    Snap s;
+    s.offset = position;
+    s.gridLine.assign(line.first, line.second);
+    s.grid = OceanweatherRecord::parseOwiGridLine(s.gridLine);
+
+    const size_t blockLines = (s.grid.nx * s.grid.ny + 7) / 8;
+    const size_t numLines = wind ? 2 * blockLines : blockLines;
+    position = file.nextLine(end);
+    for (size_t i = 0; i < numLines; ++i) {
+      if (position >= file.size()) {
+        adcircmodules_throw_exception("Unexpected end of file in " +
+                                      filename);
+      }
+      position = file.nextLine(position);
+    }
+    snaps.push_back(std::move(s));
+  }
+
+  this->m_filename = filename;
+  this->m_fileSize = file.size();
+  this->m_headerLine = std::move(headerLine);
+  this->m_header = h;
+  this->m_snaps = std::move(snaps);
+}
+
+/**
+ * @brief Reads the cached index of a file
+ * @param[in] filename Oceanweather pressure or wind file
+ * @return true if the cache exists and matches the file
+ */
+bool OceanweatherIndex::readCache(const std::string &filename) {
+  std::ifstream fid(OceanweatherIndex::cacheFilename(filename));
+  if (!fid.good()) return false;
+
+  std::string line, headerLine;
+  size_t fileSize = 0, n = 0;
+  std::getline(fid, line);
+  if (line != c_cacheSignature) return false;
+  std::getline(fid, line);
+  if (std::sscanf(line.c_str(), "%zu %zu", &fileSize, &n) != 2) return false;
+  std::getline(fid, headerLine);
+
+  std::vector<Snap> snaps(n);
+  for (auto &s : snaps) {
+    if (!std::getline(fid, line)) return false;
+    size_t split = line.find(' ');
+    if (split == std::string::npos) return false;
+    if (std::sscanf(line.c_str(), "%zu", &s.offset) != 1) return false;
+    s.gridLine = line.substr(split + 1);
+  }
+
+  try {
+    //...The grid line of each snap must still be at its offset
+    FileIO::MappedFile file(filename);
+    if (file.size() != fileSize) return false;
+    auto at = [&](size_t position, const std::string &text) {
+      return position <= file.size() &&
+             file.size() - position >= text.size() &&
+             std::memcmp(file.data() + position, text.data(), text.size()) ==
+                 0;
+    };
+    if (!at(0, headerLine)) return false;
+    for (auto &s : snaps) {
+      if (!at(s.offset, s.gridLine)) return false;
+      s.grid = OceanweatherRecord::parseOwiGridLine(s.gridLine);
+    }
+    this->m_header.parse(headerLine);
+  } catch (const std::exception &) {
+    return false;
+  }
+
+  this->m_filename = filename;
+  this->m_fileSize = fileSize;
+  this->m_headerLine = std::move(headerLine);
+  this->m_snaps = std::move(snaps);
+  return true;
+}
+
+/**
+ * @brief Writes the index to the cache file next to the indexed file
+ * @return true if the cache was written. The cache is optional, so a
+ * directory that is not writable is not an error
+ */
+bool OceanweatherIndex::writeCache() const {
+  std::ofstream fid(OceanweatherIndex::cacheFilename(this->m_filename));
+  if (!fid.good()) return false;
+  fid << c_cacheSignature << "\n";
+  fid << this->m_fileSize << " " << this->m_snaps.size() << "\n";
+  fid << this->m_headerLine << "\n";
+  for (const auto &s : this->m_snaps) {
+    fid << s.offset << " " << s.gridLine << "\n";
+  }
+  return fid.good();
+}
+
+std::string OceanweatherIndex::filename() const { return this->m_filename; }
+
+OceanweatherHeader OceanweatherIndex::header() const { return this->m_header; }
+
+size_t OceanweatherIndex::nSnaps() const { return this->m_snaps.size(); }
+
+const OceanweatherIndex::Snap &OceanweatherIndex::snap(size_t index) const {
+  return this->m_snaps[index];
+}
+
+CDate OceanweatherIndex::time(size_t index) const {
+  return this->m_snaps[index].grid.time;
+}
+
+/**
+ * @brief Finds the first snap at or after a time
+ * @param[in] time time to search for
+ * @return index of the snap or nSnaps() if all snaps are before time
+ */
+size_t OceanweatherIndex::find(const CDate &time) const {
+  auto it = std::lower_bound(
+      this->m_snaps.begin(), this->m_snaps.end(), time,
+      [](const Snap &s, const CDate &t) { return s.grid.time < t; });
+  return static_cast<size_t>(it - this->m_snaps.begin());
+}
+
+/**
+ * @brief Snaps between two times
+ * @param[in] start first time of the window
+ * @param[in] end last time of the window
+ * @return pair of indices [first, last) of the snaps within the window
+ */
+std::pair<size_t, size_t> OceanweatherIndex::range(const CDate &start,
+                                                   const CDate &end) const {
+  auto it = std::upper_bound(
+      this->m_snaps.begin(), this->m_snaps.end(), end,
+      [](const CDate &t, const Snap &s) { return t < s.grid.time; });
+  const size_t last = static_cast<size_t>(it - this->m_snaps.begin());
+  return {std::min(this->find(start), last), last};
+}
@@ -0,0 +1,93 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef OCEANWEATHERINDEX_H
+#define OCEANWEATHERINDEX_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CDate.h"
+#include "OceanweatherHeader.h"
+#include "OceanweatherRecord.h"
+
+namespace Adcirc {
+
+/**
+ * @class OceanweatherIndex
+ * @brief Byte offset and grid of every record (snap) in an Oceanweather
+ * pressure or wind file
+ *
+ * The index is built by reading the grid line of each snap and skipping its
+ * data blocks, and is cached in a text file next to it (see cacheFilename).
+ * A cached index is used only if the file has the same size and the grid
+ * line of every snap is still found at its recorded offset, so a modified
+ * file is indexed again.
+ */
+class OceanweatherIndex {
+ public:
+  struct Snap {
+    size_t offset;
+    std::string gridLine;
+    Adcirc::OceanweatherRecord::Grid grid;
+  };
+
+  OceanweatherIndex();
+
+  OceanweatherIndex(const std::string &filename, bool wind,
+                    bool useCache = true);
+
+  void build(const std::string &filename, bool wind);
+
+  bool readCache(const std::string &filename);
+
+  bool writeCache() const;
+
+  static std::string cacheFilename(const std::string &filename);
+
+  static bool isWindFile(const std::string &filename);
+
+  std::string filename() const;
+
+  Adcirc::OceanweatherHeader header() const;
+
+  size_t nSnaps() const;
+
+  const Snap &snap(size_t index) const;
+
+  Adcirc::CDate time(size_t index) const;
+
+  size_t find(const Adcirc::CDate &time) const;
+
+  std::pair<size_t, size_t> range(const Adcirc::CDate &start,
+                                  const Adcirc::CDate &end) const;
+
+ private:
+  static bool isGridLine(const char *first, const char *last);
+
+  std::string m_filename;
+  size_t m_fileSize;
+  std::string m_headerLine;
+  Adcirc::OceanweatherHeader m_header;
+  std::vector<Snap> m_snaps;
+};
+
+}  // namespace Adcirc
+
+#endif  // OCEANWEATHERINDEX_H
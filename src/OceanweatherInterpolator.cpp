@@ -0,0 +1,183 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OceanweatherInterpolator.h"
+
+#include "Logging.h"
+#include "Mesh.h"
+
+using namespace Adcirc;
+
+OceanweatherInterpolator::OceanweatherInterpolator() : m_built(false) {}
+
+OceanweatherInterpolator::OceanweatherInterpolator(const std::vector<double> &x,
+                                                   const std::vector<double> &y)
+    : m_built(false) {
+  this->setPoints(x, y);
+}
+
+OceanweatherInterpolator::OceanweatherInterpolator(Geometry::Mesh *mesh)
+    : m_built(false) {
+  this->setPoints(mesh->x(), mesh->y());
+}
+
+/**
+ * @brief Sets the points the fields are interpolated to. The operator is
+ * rebuilt with the next record
+ */
+void OceanweatherInterpolator::setPoints(const std::vector<double> &x,
+                                         const std::vector<double> &y) {
+  if (x.size() != y.size()) {
+    adcircmodules_throw_exception(
+        "OceanweatherInterpolator: x and y must be the same size");
+  }
+  m_x = x;
+  m_y = y;
+  m_built = false;
+}
+
+size_t OceanweatherInterpolator::numPoints() const { return m_x.size(); }
+
+/**
+ * @brief Computes the domain, grid cell and bilinear weights of every point
+ * for the grids of a record
+ */
+void OceanweatherInterpolator::build(const OceanweatherRecord &record) {
+  const size_t n = m_x.size();
+  m_domain.resize(n);
+  m_index.resize(n);
+  m_weight.resize(n);
+
+#pragma omp parallel for schedule(static)
+  for (long long p = 0; p < static_cast<long long>(n); ++p) {
+    size_t i, j, d;
+    std::array<double, 4> &w = m_weight[p];
+    std::tie(i, j, d, w[0], w[1], w[2], w[3]) =
+        record.interpolationWeight(m_x[p], m_y[p]);
+    if (d == noDomain()) {
+      m_domain[p] = noDomain();
+      m_index[p] = {0, 0, 0, 0};
+      w = {0.0, 0.0, 0.0, 0.0};
+      continue;
+    }
+    const auto &g = record.domain(d)->grid;
+    m_domain[p] = d;
+    m_index[p] = {g.index2DtoIndex1D(i, j), g.index2DtoIndex1D(i + 1, j),
+                  g.index2DtoIndex1D(i + 1, j + 1),
+                  g.index2DtoIndex1D(i, j + 1)};
+  }
+
+  m_grids.clear();
+  for (size_t d = 0; d < record.ndomain(); ++d) {
+    m_grids.push_back(record.domain(d)->grid);
+  }
+  m_built = true;
+}
+
+/**
+ * @brief Checks if the operator was built for grids with the same geometry as
+ * the grids of the record
+ */
+bool OceanweatherInterpolator::matches(const OceanweatherRecord &record) const {
+  if (m_grids.size() != record.ndomain()) return false;
+  for (size_t d = 0; d < record.ndomain(); ++d) {
+    if (!m_grids[d].sameGeometry(record.domain(d)->grid)) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Rebuilds the operator if it has not been built or the grids of the
+ * record differ from the grids it was built for
+ * @return true if the operator was rebuilt
+ *
+ * The grids are always compared, since OceanweatherRecord::gridChanged()
+ * only describes the most recent read and the grids may have changed on a
+ * read where the operator was not used.
+ */
+bool OceanweatherInterpolator::update(const OceanweatherRecord &record) {
+  if (m_built && this->matches(record)) return false;
+  this->build(record);
+  return true;
+}
+
+/**
+ * @brief Interpolates the pressure and wind fields of a record to the points
+ * @param[in] record record read from the Oceanweather files
+ * @param[out] pressure pressure at each point
+ * @param[out] u x-component of the wind at each point
+ * @param[out] v y-component of the wind at each point
+ */
+void OceanweatherInterpolator::interpolate(const OceanweatherRecord &record,
+                                           std::vector<double> &pressure,
+                                           std::vector<double> &u,
+                                           std::vector<double> &v) {
+  this->update(record);
+
+  const size_t nd = record.ndomain();
+  std::vector<const double *> dp(nd), du(nd), dv(nd);
+  for (size_t d = 0; d < nd; ++d) {
+    const auto *domain = record.domain(d);
+    const size_t nv = domain->grid.nx * domain->grid.ny;
+    if (domain->data_pressure.size() != nv || domain->data_u.size() != nv ||
+        domain->data_v.size() != nv) {
+      adcircmodules_throw_exception(
+          "OceanweatherInterpolator: Record does not contain data for every "
+          "grid point");
+    }
+    dp[d] = domain->data_pressure.data();
+    du[d] = domain->data_u.data();
+    dv[d] = domain->data_v.data();
+  }
+
+  const size_t n = m_x.size();
+  const double background = record.backgroundPressure();
+  pressure.resize(n);
+  u.resize(n);
+  v.resize(n);
+
+#pragma omp parallel for schedule(static)
+  for (long long p = 0; p < static_cast<long long>(n); ++p) {
+    const size_t d = m_domain[p];
+    if (d == noDomain()) {
+      pressure[p] = background;
+      u[p] = 0.0;
+      v[p] = 0.0;
+      continue;
+    }
+    const std::array<size_t, 4> &k = m_index[p];
+    const std::array<double, 4> &w = m_weight[p];
+    const double *fp = dp[d];
+    const double *fu = du[d];
+    const double *fv = dv[d];
+    pressure[p] =
+        w[0] * fp[k[0]] + w[1] * fp[k[1]] + w[2] * fp[k[2]] + w[3] * fp[k[3]];
+    u[p] =
+        w[0] * fu[k[0]] + w[1] * fu[k[1]] + w[2] * fu[k[2]] + w[3] * fu[k[3]];
+    v[p] =
+        w[0] * fv[k[0]] + w[1] * fv[k[1]] + w[2] * fv[k[2]] + w[3] * fv[k[3]];
+  }
+}
+
+/**
+ * @brief Domain used for a point, or noDomain() if the point is outside of
+ * all domains
+ */
+size_t OceanweatherInterpolator::domain(size_t point) const {
+  return point < m_domain.size() ? m_domain[point] : noDomain();
+}
@@ -0,0 +1,89 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef OCEANWEATHERINTERPOLATOR_H
+#define OCEANWEATHERINTERPOLATOR_H
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include "OceanweatherRecord.h"
+
+namespace Adcirc {
+
+namespace Geometry {
+class Mesh;
+}
+
+/**
+ * @class OceanweatherInterpolator
+ * @brief Bilinear interpolation of Oceanweather fields to a fixed set of
+ * points, such as the nodes of a mesh
+ *
+ * The domain, grid cell and weights used for each point are computed once
+ * and stored as a sparse operator with four entries per point. Each record
+ * is then interpolated with a parallel gather over the points. The operator
+ * is rebuilt only when the geometry of the grids changes between records.
+ *
+ * Points covered by more than one domain use the last domain containing
+ * them, and points outside of all domains are assigned the background
+ * pressure and zero wind, as in OceanweatherRecord::get.
+ */
+class OceanweatherInterpolator {
+ public:
+  OceanweatherInterpolator();
+
+  OceanweatherInterpolator(const std::vector<double> &x,
+                           const std::vector<double> &y);
+
+  explicit OceanweatherInterpolator(Adcirc::Geometry::Mesh *mesh);
+
+  void setPoints(const std::vector<double> &x, const std::vector<double> &y);
+
+  size_t numPoints() const;
+
+  void build(const Adcirc::OceanweatherRecord &record);
+
+  bool update(const Adcirc::OceanweatherRecord &record);
+
+  void interpolate(const Adcirc::OceanweatherRecord &record,
+                   std::vector<double> &pressure, std::vector<double> &u,
+                   std::vector<double> &v);
+
+  size_t domain(size_t point) const;
+
+  static constexpr size_t noDomain() {
+    return std::numeric_limits<size_t>::max();
+  }
+
+ private:
+  bool matches(const Adcirc::OceanweatherRecord &record) const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<size_t> m_domain;
+  std::vector<std::array<size_t, 4>> m_index;
+  std::vector<std::array<double, 4>> m_weight;
+  std::vector<Adcirc::OceanweatherRecord::Grid> m_grids;
+  bool m_built;
+};
+
+}  // namespace Adcirc
+
+#endif  // OCEANWEATHERINTERPOLATOR_H
@@ -19,20 +19,18 @@
 
 #include "OceanweatherRecord.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 #include "Constants.h"
 #include "Logging.h"
+#include "OceanweatherDecoder.h"
 #include "boost/format.hpp"
-#include "boost/spirit/include/phoenix.hpp"
-#include "boost/spirit/include/qi.hpp"
 
 using namespace Adcirc;
 
-namespace qi = boost::spirit::qi;
-namespace ascii = boost::spirit::ascii;
-namespace phoenix = boost::phoenix;
-
 OceanweatherRecord::OceanweatherRecord()
     : m_backgroundPressure(1013.0), m_gridchanged(true) {}
 
@@ -44,9 +42,21 @@ void OceanweatherRecord::addDomain(std::ifstream *fid_pressure,
   this->m_domains.push_back(d);
 }
 
+/**
+ * @brief Reads the next record from the pressure and wind files of every
+ * domain
+ * @return 0 if the record was read, 1 otherwise
+ *
+ * The grid lines are read first. The data blocks of the pressure and wind
+ * files of all domains are then decoded concurrently, since each file is
+ * read through its own stream.
+ */
 int OceanweatherRecord::read() {
   int has_error = 0;
-  for (auto &d : m_domains) {
+  bool gridChanged = false;
+  std::vector<char> domainRead(m_domains.size(), 0);
+  for (size_t i = 0; i < m_domains.size(); ++i) {
+    Domain &d = m_domains[i];
     if (d.fid_pressure->peek() && d.fid_wind->peek()) {
       std::string header_pressure, header_wind;
       std::getline(*(d.fid_pressure), header_pressure);
@@ -62,23 +72,33 @@ int OceanweatherRecord::read() {
             "Grids between pressure and wind fields are not identical");
       }
 
-      if (p != d.grid) {
-        m_gridchanged = true;
-        d.grid = std::move(p);
-      } else {
-        m_gridchanged = false;
-      }
-
-      int ierr =
-          OceanweatherRecord::readData(d, d.fid_pressure, d.data_pressure);
-      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_u);
-      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_v);
-      if (ierr != 0) has_error = 1;
+      if (!p.sameGeometry(d.grid)) gridChanged = true;
+      d.grid = std::move(p);
+      domainRead[i] = 1;
     } else {
       Logging::warning("Reached end of file");
       has_error = 1;
     }
   }
+
+  //...Even tasks decode the pressure file of a domain, odd tasks the u and
+  //   v blocks of its wind file
+  const long long numTasks = 2 * static_cast<long long>(m_domains.size());
+  int ierr = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : ierr)
+  for (long long t = 0; t < numTasks; ++t) {
+    Domain &d = m_domains[t / 2];
+    if (!domainRead[t / 2]) continue;
+    if (t % 2 == 0) {
+      ierr += OceanweatherRecord::readData(d, d.fid_pressure, d.data_pressure);
+    } else {
+      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_u);
+      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_v);
+    }
+  }
+  if (ierr != 0) has_error = 1;
+  m_gridchanged = gridChanged;
+
   return has_error;
 }
 
@@ -89,6 +109,12 @@ OceanweatherRecord::Domain *OceanweatherRecord::domain(size_t index) {
   return &m_domains[index];
 }
 
+const OceanweatherRecord::Domain *OceanweatherRecord::domain(
+    size_t index) const {
+  assert(index < ndomain());
+  return &m_domains[index];
+}
+
 std::tuple<double, double, double, size_t> OceanweatherRecord::get(
     const size_t i, const size_t j, const size_t domain) const {
   const auto idx = m_domains[domain].grid.index2DtoIndex1D(i, j);
@@ -123,7 +149,7 @@ std::tuple<double, double, double, size_t> OceanweatherRecord::get(
   std::tie(p3, u3, v3, std::ignore) = this->get(i + 1, j + 1, domain);
 
   double p4, u4, v4;
-  std::tie(p4, u4, v4, std::ignore) = this->get(i + 1, j, domain);
+  std::tie(p4, u4, v4, std::ignore) = this->get(i, j + 1, domain);
 
   double pv = w1 * p1 + w2 * p2 + w3 * p3 + w4 * p4;
   double uv = w1 * u1 + w2 * u2 + w3 * u3 + w4 * u4;
@@ -141,10 +167,13 @@ OceanweatherRecord::interpolationWeight(const double x, const double y,
     }
   }
   if (inDomain(domain, x, y)) {
-    int xi = std::floor((x - m_domains[domain].grid.xmin) /
-                        m_domains[domain].grid.dx);
-    int yj = std::floor((y - m_domains[domain].grid.ymin) /
-                        m_domains[domain].grid.dy);
+    //...Limited to the last cell, since x and y may round up to the edge
+    int xi = std::min<int>(std::floor((x - m_domains[domain].grid.xmin) /
+                                      m_domains[domain].grid.dx),
+                           m_domains[domain].grid.nx - 2);
+    int yj = std::min<int>(std::floor((y - m_domains[domain].grid.ymin) /
+                                      m_domains[domain].grid.dy),
+                           m_domains[domain].grid.ny - 2);
     double x1 = m_domains[domain].grid.x(xi);
     double x2 = m_domains[domain].grid.x(xi + 1);
     double y1 = m_domains[domain].grid.y(yj);
@@ -167,7 +196,7 @@ bool OceanweatherRecord::inDomain(size_t domain, const double x,
 }
 
 size_t OceanweatherRecord::findDomain(const double x, const double y) const {
-  for (auto i = ndomain() - 1; i >= 0; --i) {
+  for (auto i = ndomain(); i-- > 0;) {
     if (this->inDomain(i, x, y)) {
       return i;
     }
@@ -188,21 +217,8 @@ void OceanweatherRecord::setBackgroundPressure(double backgroundPressure) {
 int OceanweatherRecord::readData(const OceanweatherRecord::Domain &d,
                                  std::ifstream *fid,
                                  std::vector<double> &array) {
-  constexpr size_t rpl = 8;  // 8 records per line for OWI format
-  const size_t nv = d.grid.nx * d.grid.ny;
-
-  array.clear();
-  array.reserve(nv);
-
-  for (size_t i = 0; i < nv; i += rpl) {
-    std::string line;
-    std::getline(*(fid), line);
-    auto err = qi::phrase_parse(
-        line.begin(), line.end(),
-        (*(qi::double_[phoenix::push_back(phoenix::ref(array), qi::_1)])),
-        ascii::space);
-  }
-  return 0;
+  return Adcirc::Private::OceanweatherDecoder::read(
+      *fid, d.grid.nx * d.grid.ny, array);
 }
 
 OceanweatherRecord::Grid OceanweatherRecord::parseOwiGridLine(
@@ -232,24 +248,83 @@ OceanweatherRecord::Grid OceanweatherRecord::parseOwiGridLine(
   return g;
 }
 
+/**
+ * @brief Finds the first minimum pressure and maximum squared wind speed in
+ * the fields of a domain
+ *
+ * The fields are reduced in blocks with a vectorized loop. Only a block which
+ * improves on the extrema found so far is searched again for the location.
+ */
+static void domainExtrema(const double *p, const double *u, const double *v,
+                          size_t n, double &pmin, size_t &imin, double &vmax2,
+                          size_t &imax) {
+  constexpr size_t blockSize = 2048;
+  for (size_t b = 0; b < n; b += blockSize) {
+    const size_t e = std::min(n, b + blockSize);
+    double bp = pmin;
+    double bv = vmax2;
+#pragma omp simd reduction(min : bp) reduction(max : bv)
+    for (size_t i = b; i < e; ++i) {
+      bp = std::min(bp, p[i]);
+      bv = std::max(bv, u[i] * u[i] + v[i] * v[i]);
+    }
+    if (bp < pmin) {
+      pmin = bp;
+      imin = std::find(p + b, p + e, bp) - p;
+    }
+    if (bv > vmax2) {
+      vmax2 = bv;
+      for (size_t i = b; i < e; ++i) {
+        if (u[i] * u[i] + v[i] * v[i] == bv) {
+          imax = i;
+          break;
+        }
+      }
+    }
+  }
+}
+
 Adcirc::OceanweatherTrackInfo OceanweatherRecord::get_current_storm_info()
     const {
+  struct Extrema {
+    double pmin = std::numeric_limits<double>::infinity();
+    double vmax2 = 0.0;
+    size_t imin = 0;
+    size_t imax = 0;
+  };
+
+  //...Domains are reduced concurrently, then combined in order so that the
+  //   first domain containing an extreme value is used
+  std::vector<Extrema> extrema(m_domains.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long long k = 0; k < static_cast<long long>(m_domains.size()); ++k) {
+    const Domain &d = m_domains[k];
+    const size_t n =
+        std::min({d.grid.nx * d.grid.ny, d.data_pressure.size(),
+                  d.data_u.size(), d.data_v.size()});
+    Extrema &e = extrema[k];
+    domainExtrema(d.data_pressure.data(), d.data_u.data(), d.data_v.data(), n,
+                  e.pmin, e.imin, e.vmax2, e.imax);
+  }
+
   OceanweatherTrackInfo info;
+  if (!m_domains.empty()) info.set_time(this->current_time());
 
-  for (const auto &d : m_domains) {
-    for (auto i = 0; i < d.grid.nx * d.grid.ny; ++i) {
+  for (size_t k = 0; k < m_domains.size(); ++k) {
+    const Grid &g = m_domains[k].grid;
+    const Extrema &e = extrema[k];
+    if (e.pmin < info.min_central_pressure()) {
       size_t ii, jj;
-      std::tie(ii, jj) = d.grid.index1DtoIndex2D(i);
-      double vel = Constants::magnitude(d.data_u[i], d.data_v[i]);
-      double cp = d.data_pressure[i];
-      if (cp < info.min_central_pressure()) {
-        info.set_min_central_pressure(cp);
-        info.set_storm_center(Point(d.grid.x(ii), d.grid.y(jj)));
-      }
-      if (vel > info.maximum_wind_velocity()) {
-        info.set_maximum_wind_velocity(vel);
-        info.set_max_velocity_location(Point(d.grid.x(ii), d.grid.y(jj)));
-      }
+      std::tie(ii, jj) = g.index1DtoIndex2D(e.imin);
+      info.set_min_central_pressure(e.pmin);
+      info.set_storm_center(Point(g.x(ii), g.y(jj)));
+    }
+    const double vel = std::sqrt(e.vmax2);
+    if (vel > info.maximum_wind_velocity()) {
+      size_t ii, jj;
+      std::tie(ii, jj) = g.index1DtoIndex2D(e.imax);
+      info.set_maximum_wind_velocity(vel);
+      info.set_max_velocity_location(Point(g.x(ii), g.y(jj)));
     }
   }
 
@@ -37,14 +37,14 @@ class OceanweatherRecord {
   int read();
 
   struct Grid {
-    double xmin;
-    double ymin;
-    double xmax;
-    double ymax;
-    double dx;
-    double dy;
-    size_t nx;
-    size_t ny;
+    double xmin = 0.0;
+    double ymin = 0.0;
+    double xmax = 0.0;
+    double ymax = 0.0;
+    double dx = 0.0;
+    double dy = 0.0;
+    size_t nx = 0;
+    size_t ny = 0;
     Adcirc::CDate time;
 
     double x(size_t i) const { return i < nx ? xmin + i * dx : 0.0; }
@@ -56,6 +56,11 @@ class OceanweatherRecord {
       return {i % nx, i / nx};
     }
 
+    bool sameGeometry(const Grid &g) const {
+      return xmin == g.xmin && ymin == g.ymin && dx == g.dx && dy == g.dy &&
+             nx == g.nx && ny == g.ny;
+    }
+
     bool operator==(const Grid &g) const {
       if (xmin != g.xmin) return false;
       if (xmax != g.xmax) return false;
@@ -86,6 +91,7 @@ class OceanweatherRecord {
   size_t ndomain() const;
 
   Domain *domain(size_t index);
+  const Domain *domain(size_t index) const;
 
   std::tuple<double, double, double, size_t> get(size_t i, size_t j,
                                                  size_t domain) const;
@@ -105,8 +111,9 @@ class OceanweatherRecord {
 
   Adcirc::CDate current_time() const;
 
- private:
   static OceanweatherRecord::Grid parseOwiGridLine(const std::string &gridline);
+
+ private:
   static int readData(const Domain &d, std::ifstream *fid,
                       std::vector<double> &array);
   bool inDomain(size_t domain, double x, double y) const;
@@ -19,6 +19,7 @@
 #ifndef ADCIRCMODULES_OCEANWEATHERTRACKINFO_H
 #define ADCIRCMODULES_OCEANWEATHERTRACKINFO_H
 
+#include "CDate.h"
 #include "Point.h"
 
 namespace Adcirc {
@@ -53,12 +54,16 @@ class OceanweatherTrackInfo {
     m_radius_to_max_winds = radius;
   }
 
+  Adcirc::CDate time() const { return m_time; }
+  void set_time(const Adcirc::CDate &time) { m_time = time; }
+
  private:
   double m_min_cp;
   double m_max_vel;
   Point m_min_cp_loc;
   Point m_max_vel_loc;
   double m_radius_to_max_winds;
+  Adcirc::CDate m_time;
 };
 
 }  // namespace Adcirc
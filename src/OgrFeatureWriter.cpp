@@ -0,0 +1,188 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OgrFeatureWriter.h"
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "cpl_conv.h"
+#include "gdal_priv.h"
+#include "ogr_feature.h"
+#include "ogr_geometry.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+
+using namespace Adcirc::Private;
+
+/**
+ * @brief Constructor
+ * @param[in] filename output file, which is replaced if it exists
+ * @param[in] driverName name of the OGR driver
+ * @param[in] geometry type of the features
+ * @param[in] epsg coordinate system of the features, or 0 if unknown
+ */
+OgrFeatureWriter::OgrFeatureWriter(const std::string &filename,
+                                   const std::string &driverName,
+                                   FeatureGeometry geometry, int epsg)
+    : FeatureWriter(geometry),
+      m_filename(filename),
+      m_driverName(driverName),
+      m_epsg(epsg),
+      m_closed(false),
+      m_dataset(nullptr),
+      m_layer(nullptr) {}
+
+OgrFeatureWriter::~OgrFeatureWriter() {
+  if (!this->m_closed) {
+    try {
+      this->close();
+    } catch (const std::exception &e) {
+      Adcirc::Logging::logError(e.what());
+    }
+  }
+}
+
+/**
+ * @brief Creates the file and a layer holding the attribute fields
+ */
+void OgrFeatureWriter::createLayer() {
+  GDALAllRegister();
+  GDALDriver *driver =
+      GetGDALDriverManager()->GetDriverByName(this->m_driverName.c_str());
+  if (driver == nullptr) {
+    adcircmodules_throw_exception("The GDAL " + this->m_driverName +
+                                  " driver is not available");
+  }
+
+  if (Adcirc::FileIO::Generic::fileExists(this->m_filename)) {
+    driver->Delete(this->m_filename.c_str());
+  }
+
+  this->m_dataset = driver->Create(this->m_filename.c_str(), 0, 0, 0,
+                                   GDT_Unknown, nullptr);
+  if (this->m_dataset == nullptr) {
+    adcircmodules_throw_exception("Could not create " + this->m_filename);
+  }
+
+  OGRSpatialReference srs;
+  if (this->m_epsg != 0) {
+    if (srs.importFromEPSG(this->m_epsg) != OGRERR_NONE) {
+      Adcirc::Logging::warning("Could not convert EPSG to a spatial reference");
+    }
+#if GDAL_VERSION_MAJOR >= 3
+    srs.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+#endif
+  }
+
+  OGRwkbGeometryType type = wkbPoint;
+  if (this->geometry() == FeatureLine) {
+    type = wkbLineString;
+  } else if (this->geometry() == FeaturePolygon) {
+    type = wkbPolygon;
+  }
+
+  this->m_layer = this->m_dataset->CreateLayer(
+      CPLGetBasename(this->m_filename.c_str()),
+      this->m_epsg != 0 ? &srs : nullptr, type, nullptr);
+  if (this->m_layer == nullptr) {
+    adcircmodules_throw_exception("Could not create a layer in " +
+                                  this->m_filename);
+  }
+
+  for (const auto &f : this->fields()) {
+    OGRFieldDefn field(f.name.c_str(),
+                       f.type == FieldInteger ? OFTInteger : OFTReal);
+    field.SetWidth(f.width);
+    field.SetPrecision(f.precision);
+    if (this->m_layer->CreateField(&field) != OGRERR_NONE) {
+      adcircmodules_throw_exception("Could not create the field " + f.name);
+    }
+  }
+}
+
+/**
+ * @brief Writes a batch of features inside a transaction
+ * @param[in] table batch of features
+ */
+void OgrFeatureWriter::write(const FeatureTable &table) {
+  if (this->m_layer == nullptr) this->createLayer();
+
+  const bool transaction =
+      this->m_dataset->TestCapability(ODsCTransactions) &&
+      this->m_dataset->StartTransaction() == OGRERR_NONE;
+
+  OGRFeature *feature =
+      OGRFeature::CreateFeature(this->m_layer->GetLayerDefn());
+  OGRErr ierr = OGRERR_NONE;
+  for (size_t i = 0; i < table.size() && ierr == OGRERR_NONE; ++i) {
+    for (size_t j = 0; j < this->fields().size(); ++j) {
+      if (this->fields()[j].type == FieldInteger) {
+        feature->SetField(static_cast<int>(j),
+                          static_cast<int>(table.attribute(i, j)));
+      } else {
+        feature->SetField(static_cast<int>(j), table.attribute(i, j));
+      }
+    }
+
+    const double *x = table.x(i);
+    const double *y = table.y(i);
+    const int nv = static_cast<int>(table.numVertices(i));
+    if (this->geometry() == FeaturePoint) {
+      feature->SetGeometryDirectly(new OGRPoint(x[0], y[0]));
+    } else if (this->geometry() == FeatureLine) {
+      OGRLineString *line = new OGRLineString();
+      line->setNumPoints(nv, FALSE);
+      for (int k = 0; k < nv; ++k) line->setPoint(k, x[k], y[k]);
+      feature->SetGeometryDirectly(line);
+    } else {
+      OGRLinearRing *ring = new OGRLinearRing();
+      ring->setNumPoints(nv + 1, FALSE);
+      for (int k = 0; k < nv; ++k) ring->setPoint(k, x[k], y[k]);
+      ring->setPoint(nv, x[0], y[0]);
+      OGRPolygon *polygon = new OGRPolygon();
+      polygon->addRingDirectly(ring);
+      feature->SetGeometryDirectly(polygon);
+    }
+
+    feature->SetFID(OGRNullFID);
+    ierr = this->m_layer->CreateFeature(feature);
+  }
+  OGRFeature::DestroyFeature(feature);
+
+  if (ierr != OGRERR_NONE) {
+    if (transaction) this->m_dataset->RollbackTransaction();
+    adcircmodules_throw_exception("Error writing features to " +
+                                  this->m_filename);
+  }
+  if (transaction && this->m_dataset->CommitTransaction() != OGRERR_NONE) {
+    adcircmodules_throw_exception("Error writing features to " +
+                                  this->m_filename);
+  }
+}
+
+/**
+ * @brief Closes the file
+ */
+void OgrFeatureWriter::close() {
+  if (this->m_closed) return;
+  this->m_closed = true;
+  if (this->m_dataset == nullptr) this->createLayer();
+  GDALClose(static_cast<GDALDatasetH>(this->m_dataset));
+  this->m_dataset = nullptr;
+  this->m_layer = nullptr;
+}
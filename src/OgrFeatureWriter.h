@@ -0,0 +1,70 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OGRFEATUREWRITER_H
+#define ADCMOD_OGRFEATUREWRITER_H
+
+#include <string>
+
+#include "FeatureWriter.h"
+
+class GDALDataset;
+class OGRLayer;
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class OgrFeatureWriter
+ * @author Zachary Cobell
+ * @brief Writes vector features to any OGR format, used for GeoPackage and
+ * FlatGeobuf files
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Each batch of features is written inside a single transaction when the
+ * driver supports them, which avoids a commit for every feature in
+ * GeoPackage files. A single feature object is reused for the whole batch.
+ *
+ */
+class OgrFeatureWriter : public FeatureWriter {
+ public:
+  OgrFeatureWriter(const std::string &filename, const std::string &driverName,
+                   FeatureGeometry geometry, int epsg);
+  ~OgrFeatureWriter() override;
+
+  void close() override;
+
+ protected:
+  void write(const FeatureTable &table) override;
+
+ private:
+  void createLayer();
+
+  const std::string m_filename;
+  const std::string m_driverName;
+  const int m_epsg;
+  bool m_closed;
+  GDALDataset *m_dataset;
+  OGRLayer *m_layer;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OGRFEATUREWRITER_H
@@ -112,7 +112,8 @@ double OutputRecord::time() const { return this->m_time; }
 
 void OutputRecord::setTime(double time) {
   this->m_time = time;
-  this->m_date = this->m_coldstart += time;
+  this->m_date = this->m_coldstart;
+  this->m_date += time;
 }
 
 size_t OutputRecord::numNodes() const { return this->m_numNodes; }
@@ -443,6 +444,22 @@ std::vector<double> OutputRecord::values(size_t column) {
   }
 }
 
+/**
+ * @brief Returns a view of one component of the record without copying it
+ * @param[in] column 0, 1 or 2 for the u, v or w component
+ * @return span over numNodes() values, valid until the record is modified or
+ * destroyed
+ */
+OutputSpan OutputRecord::span(size_t column) const {
+  if (column >= this->m_metadata.dimension()) {
+    adcircmodules_throw_exception("OutputRecord: Invalid column specified");
+    return OutputSpan();
+  }
+  const std::vector<double>& v =
+      column == 0 ? this->m_u : column == 1 ? this->m_v : this->m_w;
+  return OutputSpan(v.data(), v.size());
+}
+
 void OutputRecord::setAll(size_t size, const double* values) {
   assert(this->m_metadata.dimension() == 1);
   assert(size == this->m_numNodes);
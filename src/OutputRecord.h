@@ -28,6 +28,7 @@
 #include "DefaultValues.h"
 #include "Node.h"
 #include "OutputMetadata.h"
+#include "OutputSpan.h"
 
 namespace Adcirc {
 
@@ -83,6 +84,7 @@ class OutputRecord {
               const double* values_w);
 
   std::vector<double> values(size_t column = 0);
+  Adcirc::Output::OutputSpan span(size_t column = 0) const;
   std::vector<double> magnitudes();
   std::vector<double> directions(AngleUnits angleType = AngleUnits::Degrees);
 
@@ -0,0 +1,89 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OutputRecordPool.h"
+
+#include <cassert>
+
+using namespace Adcirc::Private;
+using Adcirc::Output::OutputRecord;
+
+/**
+ * @brief Constructor
+ * @param[in] slabSize number of records allocated at once
+ * @param[in] maxCached number of released records which keep their value
+ * arrays for reuse
+ */
+OutputRecordPool::OutputRecordPool(size_t slabSize, size_t maxCached)
+    : m_slabSize(slabSize > 0 ? slabSize : 1),
+      m_maxCached(maxCached),
+      m_size(0) {}
+
+/**
+ * @brief Returns a record which is not in use. Records released with their
+ * value arrays intact are returned first.
+ * @return pointer to the record, which remains valid until the pool is
+ * destroyed
+ */
+OutputRecord *OutputRecordPool::acquire() {
+  OutputRecord *record;
+  if (!this->m_cached.empty()) {
+    record = this->m_cached.back();
+    this->m_cached.pop_back();
+  } else {
+    if (this->m_empty.empty()) {
+      this->m_slabs.emplace_back(new OutputRecord[this->m_slabSize]);
+      OutputRecord *slab = this->m_slabs.back().get();
+      for (size_t i = this->m_slabSize; i > 0; --i) {
+        this->m_empty.push_back(&slab[i - 1]);
+      }
+    }
+    record = this->m_empty.back();
+    this->m_empty.pop_back();
+  }
+  this->m_size++;
+  return record;
+}
+
+/**
+ * @brief Returns a record to the pool
+ * @param[in] record record previously returned by acquire()
+ */
+void OutputRecordPool::release(OutputRecord *record) {
+  assert(record != nullptr);
+  assert(this->m_size > 0);
+  this->m_size--;
+  if (this->m_cached.size() < this->m_maxCached) {
+    this->m_cached.push_back(record);
+  } else {
+    *record = OutputRecord();
+    this->m_empty.push_back(record);
+  }
+}
+
+/**
+ * @brief Number of records in use
+ */
+size_t OutputRecordPool::size() const { return this->m_size; }
+
+/**
+ * @brief Number of records allocated
+ */
+size_t OutputRecordPool::capacity() const {
+  return this->m_slabs.size() * this->m_slabSize;
+}
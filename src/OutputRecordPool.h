@@ -0,0 +1,71 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OUTPUTRECORDPOOL_H
+#define ADCMOD_OUTPUTRECORDPOOL_H
+
+#include <memory>
+#include <vector>
+
+#include "OutputRecord.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class OutputRecordPool
+ * @author Zachary Cobell
+ * @brief Storage for the records held by a ReadOutput object
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Records are allocated in fixed size slabs which are never moved, so the
+ * address of a record does not change while it is in use. Released records
+ * keep their value arrays so that reading the next snap into them does not
+ * allocate. The number of released records which keep their arrays is
+ * bounded so that clearing a large number of records returns the memory.
+ *
+ */
+class OutputRecordPool {
+ public:
+  explicit OutputRecordPool(size_t slabSize = 16, size_t maxCached = 4);
+
+  Adcirc::Output::OutputRecord *acquire();
+  void release(Adcirc::Output::OutputRecord *record);
+
+  size_t size() const;
+  size_t capacity() const;
+
+ private:
+  size_t m_slabSize;
+  size_t m_maxCached;
+  size_t m_size;
+
+  std::vector<std::unique_ptr<Adcirc::Output::OutputRecord[]>> m_slabs;
+
+  /// Released records which still hold value arrays, used first
+  std::vector<Adcirc::Output::OutputRecord *> m_cached;
+
+  /// Released records without value arrays
+  std::vector<Adcirc::Output::OutputRecord *> m_empty;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OUTPUTRECORDPOOL_H
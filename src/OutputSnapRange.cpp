@@ -0,0 +1,300 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OutputSnapRange.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Logging.h"
+#include "ReadOutput.h"
+
+using namespace Adcirc::Output;
+
+OutputSnapIterator::OutputSnapIterator()
+    : m_range(nullptr), m_record(nullptr) {}
+
+/**
+ * @brief Constructor which reads the next record of the range
+ * @param[in] range range to iterate
+ */
+OutputSnapIterator::OutputSnapIterator(OutputSnapRange *range)
+    : m_range(range), m_record(range->next()) {}
+
+OutputRecord &OutputSnapIterator::operator*() const {
+  assert(this->m_record != nullptr);
+  return *this->m_record;
+}
+
+OutputRecord *OutputSnapIterator::operator->() const { return this->m_record; }
+
+/**
+ * @brief Moves to the next record. The storage of the current record is
+ * returned to the pool of the range.
+ */
+OutputSnapIterator &OutputSnapIterator::operator++() {
+  if (this->m_range != nullptr) {
+    this->m_record = this->m_range->next();
+  }
+  return *this;
+}
+
+bool OutputSnapIterator::operator==(const OutputSnapIterator &other) const {
+  return this->m_record == other.m_record;
+}
+
+bool OutputSnapIterator::operator!=(const OutputSnapIterator &other) const {
+  return !(*this == other);
+}
+
+/**
+ * @brief Constructor
+ * @param[in] output open output file to read
+ * @param[in] firstSnap zero based index of the first snap to read
+ * @param[in] numSnaps number of snaps to read
+ */
+OutputSnapRange::OutputSnapRange(ReadOutput *output, size_t firstSnap,
+                                 size_t numSnaps)
+    : m_output(output),
+      m_firstSnap(firstSnap),
+      m_numSnaps(numSnaps),
+      m_queueDepth(OutputSnapRange::defaultQueueDepth()),
+      m_memoryLimit(OutputSnapRange::defaultMemoryLimit()),
+      m_nextSnap(firstSnap),
+      m_started(false),
+      m_finished(false),
+      m_stop(false),
+      m_current(nullptr) {
+  if (output == nullptr || !output->isOpen()) {
+    adcircmodules_throw_exception("OutputSnapRange: File not open");
+  }
+  if (firstSnap + numSnaps > output->numSnaps()) {
+    adcircmodules_throw_exception(
+        "OutputSnapRange: Record requested > number of records in file");
+  }
+}
+
+/**
+ * @brief Destructor. Stops the background thread, discarding any records which
+ * have not been requested.
+ */
+OutputSnapRange::~OutputSnapRange() { this->stop(); }
+
+size_t OutputSnapRange::firstSnap() const { return this->m_firstSnap; }
+
+size_t OutputSnapRange::numSnaps() const { return this->m_numSnaps; }
+
+/**
+ * @brief Maximum number of snaps read ahead of the caller
+ */
+size_t OutputSnapRange::queueDepth() const { return this->m_queueDepth; }
+
+/**
+ * @brief Sets the maximum number of snaps read ahead of the caller. A depth of
+ * zero reads each snap on the calling thread when it is requested.
+ * @param[in] queueDepth number of snaps
+ */
+void OutputSnapRange::setQueueDepth(size_t queueDepth) {
+  if (this->m_started) {
+    adcircmodules_throw_exception(
+        "OutputSnapRange: Queue depth cannot be changed after reading begins");
+  }
+  this->m_queueDepth = queueDepth;
+}
+
+/**
+ * @brief Maximum number of bytes used by the pool of records
+ */
+size_t OutputSnapRange::memoryLimit() const { return this->m_memoryLimit; }
+
+/**
+ * @brief Sets the maximum number of bytes used by the pool of records,
+ * including the record held by the caller
+ * @param[in] bytes memory limit
+ */
+void OutputSnapRange::setMemoryLimit(size_t bytes) {
+  if (this->m_started) {
+    adcircmodules_throw_exception(
+        "OutputSnapRange: Memory limit cannot be changed after reading begins");
+  }
+  this->m_memoryLimit = bytes;
+}
+
+/**
+ * @brief Number of bytes of values held by one record
+ */
+size_t OutputSnapRange::recordSize() const {
+  return this->m_output->numNodes() * this->m_output->metadata()->dimension() *
+         sizeof(double);
+}
+
+/**
+ * @brief Number of snaps which will be read ahead of the caller after the
+ * queue depth is limited by the memory limit and the length of the range
+ */
+size_t OutputSnapRange::effectiveQueueDepth() const {
+  size_t depth = std::min(this->m_queueDepth, this->m_numSnaps);
+  const size_t size = this->recordSize();
+  if (size > 0) {
+    const size_t maxRecords = this->m_memoryLimit / size;
+    depth = maxRecords > 1 ? std::min(depth, maxRecords - 1) : 0;
+  }
+  return depth;
+}
+
+/**
+ * @brief Returns an iterator to the next record of the range. Reading begins
+ * the first time this is called.
+ */
+OutputSnapIterator OutputSnapRange::begin() { return OutputSnapIterator(this); }
+
+OutputSnapIterator OutputSnapRange::end() { return OutputSnapIterator(); }
+
+/**
+ * @brief Returns the next record of the range
+ * @return pointer to the record, or nullptr after the last snap of the range.
+ * The record is valid until the next call.
+ *
+ * Errors encountered while reading are reported by the call that would have
+ * returned the record.
+ */
+OutputRecord *OutputSnapRange::next() {
+  this->start();
+  this->release();
+
+  if (this->effectiveQueueDepth() == 0) {
+    if (this->m_nextSnap == this->m_firstSnap + this->m_numSnaps) {
+      return nullptr;
+    }
+    OutputRecord *record = this->m_free.front();
+    this->m_free.pop_front();
+    this->m_current = record;
+    this->m_output->read(this->m_nextSnap++, *record);
+    return record;
+  }
+
+  std::unique_lock<std::mutex> lock(this->m_mutex);
+  this->m_condition.wait(lock, [this]() {
+    return !this->m_ready.empty() || this->m_finished;
+  });
+
+  if (!this->m_ready.empty()) {
+    this->m_current = this->m_ready.front();
+    this->m_ready.pop_front();
+    this->m_nextSnap++;
+    return this->m_current;
+  }
+
+  if (this->m_error) {
+    std::exception_ptr error = this->m_error;
+    this->m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Allocates the pool of records and starts the background thread
+ */
+void OutputSnapRange::start() {
+  if (this->m_started) return;
+  this->m_started = true;
+
+  if (this->m_numSnaps == 0) {
+    this->m_finished = true;
+    return;
+  }
+
+  const size_t depth = this->effectiveQueueDepth();
+  for (size_t i = 0; i < depth + 1; ++i) {
+    this->m_pool.push_back(std::make_unique<OutputRecord>(
+        this->m_firstSnap, this->m_output->numNodes(),
+        *this->m_output->metadata(), this->m_output->coldstart()));
+    this->m_free.push_back(this->m_pool.back().get());
+  }
+
+  if (depth > 0) {
+    this->m_thread = std::thread(&OutputSnapRange::run, this);
+  }
+}
+
+/**
+ * @brief Stops the background thread
+ */
+void OutputSnapRange::stop() {
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_stop = true;
+  }
+  this->m_condition.notify_all();
+  if (this->m_thread.joinable()) this->m_thread.join();
+}
+
+/**
+ * @brief Returns the record held by the caller to the pool
+ */
+void OutputSnapRange::release() {
+  if (this->m_current == nullptr) return;
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_free.push_back(this->m_current);
+    this->m_current = nullptr;
+  }
+  this->m_condition.notify_all();
+}
+
+/**
+ * @brief Body of the background thread. Reads each snap of the range into a
+ * free record and queues it for the caller.
+ */
+void OutputSnapRange::run() {
+  const size_t last = this->m_firstSnap + this->m_numSnaps;
+  for (size_t snap = this->m_firstSnap; snap < last; ++snap) {
+    OutputRecord *record;
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+      this->m_condition.wait(
+          lock, [this]() { return this->m_stop || !this->m_free.empty(); });
+      if (this->m_stop) break;
+      record = this->m_free.front();
+      this->m_free.pop_front();
+    }
+
+    //...ASCII records are decoded by this thread alone so that an OpenMP
+    //   team is not started next to the threads of the caller
+    try {
+      this->m_output->read(snap, *record, 1);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_error = std::current_exception();
+      break;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_ready.push_back(record);
+    }
+    this->m_condition.notify_all();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_finished = true;
+  }
+  this->m_condition.notify_all();
+}
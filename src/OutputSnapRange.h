@@ -0,0 +1,164 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OUTPUTSNAPRANGE_H
+#define ADCMOD_OUTPUTSNAPRANGE_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "OutputRecord.h"
+
+namespace Adcirc {
+
+namespace Output {
+
+class ReadOutput;
+class OutputSnapRange;
+
+/**
+ * @class OutputSnapIterator
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Input iterator over the records of an OutputSnapRange
+ *
+ * The record referenced by the iterator remains valid until the iterator is
+ * incremented, after which its storage is reused for a later snap.
+ *
+ */
+class OutputSnapIterator {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = Adcirc::Output::OutputRecord;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Adcirc::Output::OutputRecord *;
+  using reference = Adcirc::Output::OutputRecord &;
+
+  OutputSnapIterator();
+  explicit OutputSnapIterator(OutputSnapRange *range);
+
+  reference operator*() const;
+  pointer operator->() const;
+  OutputSnapIterator &operator++();
+
+  bool operator==(const OutputSnapIterator &other) const;
+  bool operator!=(const OutputSnapIterator &other) const;
+
+ private:
+  OutputSnapRange *m_range;
+  Adcirc::Output::OutputRecord *m_record;
+};
+
+/**
+ * @class OutputSnapRange
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Reads a range of snaps from an open ReadOutput object on a
+ * background thread
+ *
+ * While the caller works on one snap, the following snaps are read into a
+ * fixed pool of OutputRecord buffers. Buffers are returned to the pool as the
+ * caller moves to the next snap, so records are only allocated when the
+ * iteration begins. The number of snaps read ahead is the queue depth, and is
+ * reduced if the pool would otherwise exceed the memory limit. With a queue
+ * depth of zero, snaps are read on the calling thread. Snaps of ASCII files
+ * which are read ahead are parsed by the background thread alone, so that
+ * it does not start an OpenMP team next to the threads of the caller.
+ *
+ * The netCDF and HDF5 libraries are not thread safe, so snaps of netCDF
+ * files are read while holding FileIO::Netcdf::libraryMutex(). The caller
+ * may read or write other netCDF files through this library while the range
+ * is read, and those calls wait for the read in progress. Netcdf calls made
+ * directly by the application must hold the same mutex.
+ *
+ * The ReadOutput object must not be used by the caller until the range has
+ * been read completely or destroyed.
+ *
+ * @code
+ * Adcirc::Output::OutputSnapRange range(&output, 0, output.numSnaps());
+ * for (auto &record : range) {
+ *   ...
+ * }
+ * @endcode
+ *
+ */
+class OutputSnapRange {
+ public:
+  OutputSnapRange(ReadOutput *output, size_t firstSnap, size_t numSnaps);
+
+  ~OutputSnapRange();
+
+  size_t firstSnap() const;
+  size_t numSnaps() const;
+
+  size_t queueDepth() const;
+  void setQueueDepth(size_t queueDepth);
+
+  size_t memoryLimit() const;
+  void setMemoryLimit(size_t bytes);
+
+  size_t effectiveQueueDepth() const;
+  size_t recordSize() const;
+
+  OutputSnapIterator begin();
+  OutputSnapIterator end();
+
+  Adcirc::Output::OutputRecord *next();
+
+  static constexpr size_t defaultQueueDepth() { return 2; }
+  static constexpr size_t defaultMemoryLimit() { return 1073741824; }
+
+ private:
+  void start();
+  void stop();
+  void run();
+  void release();
+
+  ReadOutput *m_output;
+  size_t m_firstSnap;
+  size_t m_numSnaps;
+  size_t m_queueDepth;
+  size_t m_memoryLimit;
+  size_t m_nextSnap;
+  bool m_started;
+  bool m_finished;
+  bool m_stop;
+
+  std::vector<std::unique_ptr<Adcirc::Output::OutputRecord>> m_pool;
+  std::deque<Adcirc::Output::OutputRecord *> m_free;
+  std::deque<Adcirc::Output::OutputRecord *> m_ready;
+  Adcirc::Output::OutputRecord *m_current;
+  std::exception_ptr m_error;
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+};
+}  // namespace Output
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OUTPUTSNAPRANGE_H
@@ -0,0 +1,70 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OUTPUTSPAN_H
+#define ADCMOD_OUTPUTSPAN_H
+
+#include <cstddef>
+
+#include "Logging.h"
+
+namespace Adcirc {
+namespace Output {
+
+/**
+ * @class OutputSpan
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Non-owning, read only view of a contiguous array of output values
+ *
+ * A span is valid as long as the object which owns the values is not
+ * modified or destroyed.
+ *
+ */
+class OutputSpan {
+ public:
+  OutputSpan() : m_data(nullptr), m_size(0) {}
+
+  OutputSpan(const double *data, size_t size) : m_data(data), m_size(size) {}
+
+  const double *data() const { return m_data; }
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  const double *begin() const { return m_data; }
+  const double *end() const { return m_data + m_size; }
+
+  double operator[](size_t index) const { return m_data[index]; }
+
+  double at(size_t index) const {
+    if (index >= m_size) {
+      adcircmodules_throw_exception("OutputSpan: Index out of range");
+    }
+    return m_data[index];
+  }
+
+ private:
+  const double *m_data;
+  size_t m_size;
+};
+
+}  // namespace Output
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OUTPUTSPAN_H
@@ -0,0 +1,205 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OutputTimeseries.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "FPCompare.h"
+#include "Logging.h"
+#include "OutputRecord.h"
+
+using namespace Adcirc::Output;
+
+OutputTimeseries::OutputTimeseries()
+    : m_firstSnap(0),
+      m_numSnaps(0),
+      m_dimension(1),
+      m_defaultValue(Adcirc::Output::defaultOutputValue()) {}
+
+/**
+ * @brief Constructor which allocates the storage for the time series
+ * @param[in] nodes zero based indices of the nodes in the time series
+ * @param[in] firstSnap zero based index of the first snap in the file
+ * @param[in] numSnaps number of snaps
+ * @param[in] dimension number of components (1, 2 or 3)
+ * @param[in] defaultValue value used for dry or missing data
+ */
+OutputTimeseries::OutputTimeseries(const std::vector<size_t> &nodes,
+                                   size_t firstSnap, size_t numSnaps,
+                                   size_t dimension, double defaultValue)
+    : m_nodes(nodes),
+      m_firstSnap(firstSnap),
+      m_numSnaps(numSnaps),
+      m_dimension(dimension),
+      m_defaultValue(defaultValue),
+      m_time(numSnaps, 0.0),
+      m_iteration(numSnaps, 0) {
+  if (dimension < 1 || dimension > 3) {
+    adcircmodules_throw_exception("OutputTimeseries: Invalid dimension");
+  }
+  for (size_t i = 0; i < dimension; ++i) {
+    this->m_values[i].resize(numSnaps * nodes.size(), defaultValue);
+  }
+}
+
+size_t OutputTimeseries::numSnaps() const { return this->m_numSnaps; }
+
+size_t OutputTimeseries::numNodes() const { return this->m_nodes.size(); }
+
+size_t OutputTimeseries::firstSnap() const { return this->m_firstSnap; }
+
+size_t OutputTimeseries::dimension() const { return this->m_dimension; }
+
+double OutputTimeseries::defaultValue() const { return this->m_defaultValue; }
+
+/**
+ * @brief Returns the zero based node index stored in a column
+ * @param[in] position column of the time series
+ * @return node index
+ */
+size_t OutputTimeseries::node(size_t position) const {
+  assert(position < this->m_nodes.size());
+  return this->m_nodes[position];
+}
+
+const std::vector<size_t> &OutputTimeseries::nodes() const {
+  return this->m_nodes;
+}
+
+/**
+ * @brief Model time of a snap, relative to firstSnap
+ */
+double OutputTimeseries::time(size_t snap) const {
+  assert(snap < this->m_numSnaps);
+  return this->m_time[snap];
+}
+
+void OutputTimeseries::setTime(size_t snap, double time) {
+  assert(snap < this->m_numSnaps);
+  this->m_time[snap] = time;
+}
+
+/**
+ * @brief Model iteration of a snap, relative to firstSnap
+ */
+long long OutputTimeseries::iteration(size_t snap) const {
+  assert(snap < this->m_numSnaps);
+  return this->m_iteration[snap];
+}
+
+void OutputTimeseries::setIteration(size_t snap, long long iteration) {
+  assert(snap < this->m_numSnaps);
+  this->m_iteration[snap] = iteration;
+}
+
+size_t OutputTimeseries::index(size_t snap, size_t position) const {
+  assert(snap < this->m_numSnaps);
+  assert(position < this->m_nodes.size());
+  if (snap >= this->m_numSnaps || position >= this->m_nodes.size()) {
+    adcircmodules_throw_exception("OutputTimeseries: Index out of range");
+  }
+  return snap * this->m_nodes.size() + position;
+}
+
+double OutputTimeseries::z(size_t snap, size_t position) const {
+  return this->m_values[0][this->index(snap, position)];
+}
+
+double OutputTimeseries::u(size_t snap, size_t position) const {
+  return this->m_values[0][this->index(snap, position)];
+}
+
+double OutputTimeseries::v(size_t snap, size_t position) const {
+  assert(this->m_dimension > 1);
+  if (this->m_dimension < 2) {
+    adcircmodules_throw_exception("OutputTimeseries: Datatype not a vector");
+  }
+  return this->m_values[1][this->index(snap, position)];
+}
+
+double OutputTimeseries::w(size_t snap, size_t position) const {
+  assert(this->m_dimension > 2);
+  if (this->m_dimension < 3) {
+    adcircmodules_throw_exception("OutputTimeseries: Datatype not 3d");
+  }
+  return this->m_values[2][this->index(snap, position)];
+}
+
+/**
+ * @brief Magnitude of a vector value, or the default value if all
+ * components are default
+ */
+double OutputTimeseries::magnitude(size_t snap, size_t position) const {
+  if (this->m_dimension < 2) {
+    adcircmodules_throw_exception("OutputTimeseries: Datatype not a vector");
+  }
+  if (this->isDefault(snap, position)) return this->m_defaultValue;
+  const size_t i = this->index(snap, position);
+  double m = std::pow(this->m_values[0][i], 2.0) +
+             std::pow(this->m_values[1][i], 2.0);
+  if (this->m_dimension == 3) m += std::pow(this->m_values[2][i], 2.0);
+  return std::pow(m, 0.5);
+}
+
+/**
+ * @brief Checks if every component of a value is equal to the default value
+ */
+bool OutputTimeseries::isDefault(size_t snap, size_t position) const {
+  const size_t i = this->index(snap, position);
+  for (size_t c = 0; c < this->m_dimension; ++c) {
+    if (!FpCompare::equalTo(this->m_values[c][i], this->m_defaultValue)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the time series at a single node
+ * @param[in] position column of the time series
+ * @param[in] component 0, 1 or 2 for the u, v or w component
+ * @return vector with one value for each snap
+ */
+std::vector<double> OutputTimeseries::values(size_t position,
+                                             size_t component) const {
+  if (component >= this->m_dimension) {
+    adcircmodules_throw_exception("OutputTimeseries: Invalid component");
+  }
+  std::vector<double> v(this->m_numSnaps);
+  for (size_t s = 0; s < this->m_numSnaps; ++s) {
+    v[s] = this->m_values[component][this->index(s, position)];
+  }
+  return v;
+}
+
+/**
+ * @brief Pointer to the row major matrix of values for a component
+ * @param[in] component 0, 1 or 2 for the u, v or w component
+ * @return pointer to numSnaps() * numNodes() values
+ */
+double *OutputTimeseries::data(size_t component) {
+  assert(component < this->m_dimension);
+  return this->m_values[component].data();
+}
+
+const double *OutputTimeseries::data(size_t component) const {
+  assert(component < this->m_dimension);
+  return this->m_values[component].data();
+}
@@ -0,0 +1,93 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OUTPUTTIMESERIES_H
+#define ADCMOD_OUTPUTTIMESERIES_H
+
+#include <array>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+
+namespace Adcirc {
+
+namespace Output {
+
+/**
+ * @class OutputTimeseries
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief The OutputTimeseries class holds the values of an ADCIRC output file
+ * at a set of nodes over a range of snaps
+ *
+ * Values are stored as a dense matrix for each component, with one row for
+ * each snap and one column for each requested node. Columns are in the order
+ * the nodes were requested.
+ *
+ */
+class OutputTimeseries {
+ public:
+  OutputTimeseries();
+  OutputTimeseries(const std::vector<size_t> &nodes, size_t firstSnap,
+                   size_t numSnaps, size_t dimension, double defaultValue);
+
+  size_t numSnaps() const;
+  size_t numNodes() const;
+  size_t firstSnap() const;
+  size_t dimension() const;
+  double defaultValue() const;
+
+  size_t node(size_t position) const;
+  const std::vector<size_t> &nodes() const;
+
+  double time(size_t snap) const;
+  void setTime(size_t snap, double time);
+
+  long long iteration(size_t snap) const;
+  void setIteration(size_t snap, long long iteration);
+
+  double z(size_t snap, size_t position) const;
+  double u(size_t snap, size_t position) const;
+  double v(size_t snap, size_t position) const;
+  double w(size_t snap, size_t position) const;
+  double magnitude(size_t snap, size_t position) const;
+
+  bool isDefault(size_t snap, size_t position) const;
+
+  std::vector<double> values(size_t position, size_t component = 0) const;
+
+  double *data(size_t component = 0);
+  const double *data(size_t component = 0) const;
+
+ private:
+  size_t index(size_t snap, size_t position) const;
+
+  std::vector<size_t> m_nodes;
+  size_t m_firstSnap;
+  size_t m_numSnaps;
+  size_t m_dimension;
+  double m_defaultValue;
+  std::vector<double> m_time;
+  std::vector<long long> m_iteration;
+  std::array<std::vector<double>, 3> m_values;
+};
+}  // namespace Output
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OUTPUTTIMESERIES_H
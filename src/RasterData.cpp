@@ -40,10 +40,27 @@ template Adcirc::PixelValueVector<double>
 Adcirc::Raster::Rasterdata::pixelValues<double>(size_t ibegin, size_t jbegin,
                                                 size_t iend, size_t jend) const;
 
+template bool Adcirc::Raster::Rasterdata::window<int>(
+    size_t ibegin, size_t jbegin, size_t iend, size_t jend,
+    RasterWindow<int> &w) const;
+
+template bool Adcirc::Raster::Rasterdata::window<double>(
+    size_t ibegin, size_t jbegin, size_t iend, size_t jend,
+    RasterWindow<double> &w) const;
+
 template int Adcirc::Raster::Rasterdata::nodata<int>() const;
 
 template double Adcirc::Raster::Rasterdata::nodata<double>() const;
 
+//...Default memory budget for the raster tile cache (bytes)
+static constexpr size_t c_defaultTileCacheSize = 256 * 1024 * 1024;
+
+//...Tiles are grown until they contain at least this many pixels
+static constexpr size_t c_minTilePixels = 256 * 256;
+
+//...Maximum number of columns in a tile, used for striped rasters
+static constexpr size_t c_maxTileWidth = 1024;
+
 // Macro to initialize constructors
 #define RASTERDATACLASSINIT                                                   \
   m_file(nullptr), m_band(nullptr), m_isOpen(false), m_isRead(false),         \
@@ -55,7 +72,8 @@ template double Adcirc::Raster::Rasterdata::nodata<double>() const;
       m_ymax(-std::numeric_limits<double>::max()), m_dx(0.0), m_dy(0.0),      \
       m_nodata(-std::numeric_limits<double>::max()),                          \
       m_nodataint(-std::numeric_limits<int>::max()), m_readType(GDT_Unknown), \
-      m_rasterType(RasterTypes::Unknown)
+      m_rasterType(RasterTypes::Unknown),                                     \
+      m_tileCacheSize(c_defaultTileCacheSize)
 
 /**
  * @brief Default constructor without a filename
@@ -86,7 +104,9 @@ bool Rasterdata::open() {
     return false;
   } else {
     this->m_isOpen = true;
-    return this->getRasterMetadata();
+    if (!this->getRasterMetadata()) return false;
+    this->initializeTileCache();
+    return true;
   }
 }
 
@@ -158,14 +178,139 @@ void Rasterdata::setFilename(const std::string &filename) {
  * @return true if object was successfully closed
  */
 bool Rasterdata::close() {
+  this->m_tileCache.reset(nullptr);
+  {
+    std::lock_guard<std::mutex> lock(this->m_handleMutex);
+    for (auto h : this->m_handles) {
+      GDALClose(static_cast<GDALDatasetH>(h));
+    }
+    this->m_handles.clear();
+  }
   if (this->m_file != nullptr) {
     GDALClose(static_cast<GDALDatasetH>(this->m_file));
+    this->m_file = nullptr;
+    this->m_band = nullptr;
     this->m_isOpen = false;
     return true;
   }
   return false;
 }
 
+/**
+ * @brief Creates the tile cache used when reading pixels from disk
+ *
+ * Tiles are aligned to the natural block size of the raster band. Blocks that
+ * are very small (or striped rasters with one row per block) are grouped so
+ * that each tile contains a reasonable number of pixels.
+ */
+void Rasterdata::initializeTileCache() {
+  int bx = 0, by = 0;
+  this->m_band->GetBlockSize(&bx, &by);
+  size_t tx = bx > 0 ? static_cast<size_t>(bx) : 256;
+  size_t ty = by > 0 ? static_cast<size_t>(by) : 256;
+  if (tx > c_maxTileWidth) tx = c_maxTileWidth;
+  if (tx * ty < c_minTilePixels) {
+    ty *= (c_minTilePixels + tx * ty - 1) / (tx * ty);
+  }
+  this->m_tileCache = std::make_unique<RasterTileCache>(
+      this->m_nx, this->m_ny, tx, ty, this->m_tileCacheSize,
+      [this](size_t i0, size_t j0, size_t nx, size_t ny, double *buffer) {
+        return this->readTile(i0, j0, nx, ny, buffer);
+      });
+}
+
+/**
+ * @brief Reads a tile of the raster from disk
+ * @param i0 starting column
+ * @param j0 starting row
+ * @param nx number of columns
+ * @param ny number of rows
+ * @param buffer destination buffer
+ * @return true if the read was successful
+ *
+ * Each concurrent reader uses its own GDAL dataset handle so that reads are
+ * not serialized
+ */
+bool Rasterdata::readTile(size_t i0, size_t j0, size_t nx, size_t ny,
+                          double *buffer) {
+  GDALDataset *handle = this->acquireHandle();
+  if (handle == nullptr) return false;
+  CPLErr err = handle->GetRasterBand(1)->RasterIO(
+      GF_Read, static_cast<int>(i0), static_cast<int>(j0), static_cast<int>(nx),
+      static_cast<int>(ny), buffer, static_cast<int>(nx), static_cast<int>(ny),
+      GDT_Float64, 0, 0);
+  this->releaseHandle(handle);
+  return err == CE_None;
+}
+
+/**
+ * @brief Takes a dataset handle from the pool, opening a new one if none are
+ * available
+ * @return GDAL dataset handle
+ */
+GDALDataset *Rasterdata::acquireHandle() {
+  {
+    std::lock_guard<std::mutex> lock(this->m_handleMutex);
+    if (!this->m_handles.empty()) {
+      GDALDataset *h = this->m_handles.back();
+      this->m_handles.pop_back();
+      return h;
+    }
+  }
+  return static_cast<GDALDataset *>(
+      GDALOpen(this->m_filename.c_str(), GA_ReadOnly));
+}
+
+/**
+ * @brief Returns a dataset handle to the pool
+ * @param handle GDAL dataset handle
+ */
+void Rasterdata::releaseHandle(GDALDataset *handle) {
+  std::lock_guard<std::mutex> lock(this->m_handleMutex);
+  this->m_handles.push_back(handle);
+}
+
+/**
+ * @brief Memory budget for the tile cache used when reading from disk
+ * @return memory budget in bytes
+ */
+size_t Rasterdata::tileCacheSize() const { return this->m_tileCacheSize; }
+
+/**
+ * @brief Sets the memory budget for the tile cache used when reading from disk
+ * @param bytes memory budget in bytes
+ *
+ * If the raster is already open, the cache is emptied and rebuilt. This should
+ * not be called while other threads are reading from the raster.
+ */
+void Rasterdata::setTileCacheSize(size_t bytes) {
+  this->m_tileCacheSize = bytes;
+  if (this->m_isOpen) this->initializeTileCache();
+}
+
+/**
+ * @brief Number of tile requests that were satisfied from the cache
+ * @return cache hits
+ */
+size_t Rasterdata::tileCacheHits() const {
+  return this->m_tileCache ? this->m_tileCache->hits() : 0;
+}
+
+/**
+ * @brief Number of tile requests that required a read from disk
+ * @return cache misses
+ */
+size_t Rasterdata::tileCacheMisses() const {
+  return this->m_tileCache ? this->m_tileCache->misses() : 0;
+}
+
+/**
+ * @brief Resets the tile cache hit and miss counters
+ */
+void Rasterdata::resetTileCacheStatistics() {
+  if (this->m_tileCache) this->m_tileCache->resetStatistics();
+}
+
 /**
  * @brief Calculates the coordinate of the pixel center
  * @param i i-index
@@ -302,18 +447,11 @@ T Rasterdata::pixelValue(size_t i, size_t j) const {
  */
 template <typename T>
 T Rasterdata::pixelValue(Pixel &p) const {
-  if (p.i() > 0 && p.j() > 0 && p.i() < this->nx() && p.j() < this->ny()) {
-    T buf;
-    auto err = CPLErr();
-
-#pragma omp critical
-    {
-      err = this->m_band->RasterIO(GF_Read, p.i(), p.j(), 1, 1, &buf, 1, 1,
-                                   static_cast<GDALDataType>(this->m_readType),
-                                   0, 0);
-    }
-    if (err != 0) return this->nodata<T>();
-    return buf;
+  if (p.i() > 0 && p.j() > 0 && p.i() < this->nx() && p.j() < this->ny() &&
+      this->m_tileCache) {
+    auto tile = this->m_tileCache->tile(p.i(), p.j());
+    if (!tile) return this->nodata<T>();
+    return static_cast<T>(tile->value(p.i(), p.j()));
   } else {
     return this->nodata<T>();
   }
@@ -420,6 +558,68 @@ Adcirc::PixelValueVector<T> Rasterdata::pixelValues(const size_t ibegin,
   }
 }
 
+/**
+ * @brief Returns a view of the raster values in the given search box
+ * @param ibegin beginning i-index
+ * @param jbegin beginning j-index
+ * @param iend ending i-index
+ * @param jend ending j-index
+ * @param w window that is set to view the requested pixels
+ * @return true if the values were available
+ *
+ * When the raster is in memory as type T the window points directly into
+ * the raster data. Otherwise the values are copied from the tile cache into
+ * a scratch buffer owned by the calling thread, which is reused by the next
+ * call to this function on the same thread. No allocation occurs once the
+ * scratch buffer has grown to the largest window requested.
+ */
+template <typename T>
+bool Rasterdata::window(size_t ibegin, size_t jbegin, size_t iend,
+                        size_t jend, RasterWindow<T> &w) const {
+  if (iend >= this->m_nx || jend >= this->m_ny || ibegin > iend ||
+      jbegin > jend) {
+    w = RasterWindow<T>();
+    return false;
+  }
+
+  if (this->m_isRead) {
+    //...Only the array of the raster's own type is filled by read(), so a
+    //   window of the other type is converted through the tile cache below
+    const T *base = nullptr;
+    if (std::is_same<T, int>::value) {
+      if (this->m_intOnDisk.num_elements() != 0) {
+        base = reinterpret_cast<const T *>(this->m_intOnDisk.data());
+      }
+    } else if (std::is_same<T, double>::value) {
+      if (this->m_doubleOnDisk.num_elements() != 0) {
+        base = reinterpret_cast<const T *>(this->m_doubleOnDisk.data());
+      }
+    } else {
+      adcircmodules_throw_exception("Rasterdata: Invalid pixel type");
+    }
+    if (base != nullptr) {
+      w = RasterWindow<T>(base + jbegin * this->m_nx + ibegin, this->m_nx,
+                          ibegin, jbegin, iend, jend, this->m_xmin,
+                          this->m_ymax, this->m_dx, this->m_dy);
+      return true;
+    }
+  }
+
+  static thread_local std::vector<T> scratch;
+  const size_t width = iend - ibegin + 1;
+  const size_t n = width * (jend - jbegin + 1);
+  if (scratch.size() < n) scratch.resize(n);
+
+  if (!this->m_tileCache ||
+      !this->m_tileCache->read(ibegin, jbegin, iend, jend, scratch.data())) {
+    w = RasterWindow<T>();
+    return false;
+  }
+  w = RasterWindow<T>(scratch.data(), width, ibegin, jbegin, iend, jend,
+                      this->m_xmin, this->m_ymax, this->m_dx, this->m_dy);
+  return true;
+}
+
 /**
  * @brief Reads the pixel values for the given search box from memory
  * @param ibegin beginning i-index
@@ -481,24 +681,17 @@ Adcirc::PixelValueVector<T> Rasterdata::pixelValuesFromDisk(size_t ibegin,
 
   PixelValueVector<T> values;
   values.reserve(n);
-  std::vector<T> z(n);
+  std::vector<double> z(n);
 
-  CPLErr e = CPLErr();
-
-#pragma omp critical
-  {
-    e = this->m_band->RasterIO(GF_Read, ibegin, jbegin, nx, ny, z.data(), nx,
-                               ny, static_cast<GDALDataType>(this->m_readType),
-                               0, 0);
-  }
+  const bool ok = this->m_tileCache &&
+                  this->m_tileCache->read(ibegin, jbegin, iend, jend, z.data());
 
   size_t k = 0;
   for (size_t j = jbegin; j <= jend; ++j) {
     for (size_t i = ibegin; i <= iend; ++i) {
-      Point p = this->pixelToCoordinate(i, j);
-      bool valid = z[k] != this->nodata<T>();
-      values.push_back(
-          PixelValue<T>(this->pixelToCoordinate(i, j), valid, z[k]));
+      const T zk = ok ? static_cast<T>(z[k]) : this->nodata<T>();
+      bool valid = zk != this->nodata<T>();
+      values.push_back(PixelValue<T>(this->pixelToCoordinate(i, j), valid, zk));
       k++;
     }
   }
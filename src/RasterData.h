@@ -19,12 +19,16 @@
 #ifndef ADCMOD_RASTERDATA_H
 #define ADCMOD_RASTERDATA_H
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "Pixel.h"
 #include "PixelValueVector.h"
 #include "Point.h"
+#include "RasterTileCache.h"
+#include "RasterWindow.h"
 #include "boost/multi_array.hpp"
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -109,6 +113,10 @@ class Rasterdata {
   Adcirc::PixelValueVector<T> pixelValues(size_t ibegin, size_t jbegin,
                                           size_t iend, size_t jend) const;
 
+  template <typename T>
+  bool window(size_t ibegin, size_t jbegin, size_t iend, size_t jend,
+              Adcirc::Raster::RasterWindow<T> &w) const;
+
   int rasterType() const;
 
   int epsg() const;
@@ -116,6 +124,13 @@ class Rasterdata {
 
   bool isOpen() const;
 
+  size_t tileCacheSize() const;
+  void setTileCacheSize(size_t bytes);
+
+  size_t tileCacheHits() const;
+  size_t tileCacheMisses() const;
+  void resetTileCacheStatistics();
+
  private:
   bool getRasterMetadata();
   Adcirc::Raster::Rasterdata::RasterTypes selectRasterType(int d);
@@ -131,9 +146,18 @@ class Rasterdata {
   void readIntegerRasterToMemory();
   void readDoubleRasterToMemory();
 
+  void initializeTileCache();
+  bool readTile(size_t i0, size_t j0, size_t nx, size_t ny, double *buffer);
+  GDALDataset *acquireHandle();
+  void releaseHandle(GDALDataset *handle);
+
   GDALDataset *m_file;
   GDALRasterBand *m_band;
 
+  std::unique_ptr<Adcirc::Raster::RasterTileCache> m_tileCache;
+  std::vector<GDALDataset *> m_handles;
+  std::mutex m_handleMutex;
+
   boost::multi_array<double, 2> m_doubleOnDisk;
   boost::multi_array<int, 2> m_intOnDisk;
 
@@ -147,6 +171,7 @@ class Rasterdata {
   int m_nodataint;
   int m_readType;
   RasterTypes m_rasterType;
+  size_t m_tileCacheSize;
   std::string m_projectionReference;
   std::string m_filename;
 };
@@ -0,0 +1,146 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterFileWriter.h"
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "boost/format.hpp"
+#include "cpl_conv.h"
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+
+using namespace Adcirc::Private;
+
+/**
+ * @brief Creates the raster file
+ * @param[in] filename output file
+ * @param[in] nx number of columns
+ * @param[in] ny number of rows
+ * @param[in] xmin left edge of the raster
+ * @param[in] ymax top edge of the raster
+ * @param[in] resolution pixel size
+ * @param[in] epsg coordinate system of the raster
+ * @param[in] nullvalue value of pixels without data
+ * @param[in] description description of the band
+ * @param[in] units units of the band
+ * @param[in] blockSize width and height of the GeoTIFF tiles
+ */
+RasterFileWriter::RasterFileWriter(const std::string &filename, size_t nx,
+                                   size_t ny, double xmin, double ymax,
+                                   double resolution, int epsg,
+                                   double nullvalue,
+                                   const std::string &description,
+                                   const std::string &units, size_t blockSize)
+    : m_raster(nullptr), m_band(nullptr) {
+  auto getfmt = [&](const std::string &ext) -> std::string {
+    if (ext == ".tif") return "GTiff";
+    if (ext == ".img") return "HFA";
+    return std::string();
+  };
+
+  std::string fmt = getfmt(Adcirc::FileIO::Generic::getFileExtension(filename));
+
+  if (fmt.empty()) {
+    adcircmodules_throw_exception("Could not determine the raster format");
+  }
+
+  GDALAllRegister();
+  GDALDriver *driver = GetGDALDriverManager()->GetDriverByName(fmt.c_str());
+  if (driver == nullptr) {
+    adcircmodules_throw_exception("The GDAL " + fmt +
+                                  " driver is not available");
+  }
+
+  char **options = nullptr;
+  if (fmt == "GTiff") {
+    options = CSLSetNameValue(options, "BIGTIFF", "IF_SAFER");
+    options = CSLSetNameValue(options, "TILED", "YES");
+    options = CSLSetNameValue(options, "BLOCKXSIZE",
+                              std::to_string(blockSize).c_str());
+    options = CSLSetNameValue(options, "BLOCKYSIZE",
+                              std::to_string(blockSize).c_str());
+    options = CSLSetNameValue(options, "COMPRESS", "LZW");
+  } else {
+    options = CSLSetNameValue(options, "COMPRESS", "YES");
+  }
+
+  this->m_raster =
+      driver->Create(filename.c_str(), static_cast<int>(nx),
+                     static_cast<int>(ny), 1, GDT_Float32, options);
+  CSLDestroy(options);
+  if (this->m_raster == nullptr) {
+    adcircmodules_throw_exception("Could not create raster " + filename);
+  }
+
+  double transform[6] = {xmin, resolution, 0, ymax, 0, -resolution};
+  this->m_raster->SetGeoTransform(transform);
+
+  char *cwkt = nullptr;
+  OGRSpatialReference sref;
+  std::string srefstr = boost::str(boost::format("EPSG:%i") % epsg);
+  sref.SetWellKnownGeogCS(srefstr.c_str());
+  sref.exportToWkt(&cwkt);
+  this->m_raster->SetProjection(cwkt);
+  CPLFree(cwkt);
+
+  this->m_band = this->m_raster->GetRasterBand(1);
+  this->m_band->SetDescription(description.c_str());
+  this->m_band->SetUnitType(units.c_str());
+  this->m_band->SetNoDataValue(nullvalue);
+}
+
+RasterFileWriter::~RasterFileWriter() {
+  if (this->m_raster != nullptr) {
+    GDALClose(static_cast<GDALDatasetH>(this->m_raster));
+  }
+}
+
+/**
+ * @brief Writes a block of pixels
+ * @param[in] column first column of the block
+ * @param[in] row first row of the block
+ * @param[in] width number of columns in the block
+ * @param[in] height number of rows in the block
+ * @param[in] values pixel values in row major order
+ */
+void RasterFileWriter::write(size_t column, size_t row, size_t width,
+                             size_t height, const float *values) {
+  CPLErr cr = this->m_band->RasterIO(
+      GF_Write, static_cast<int>(column), static_cast<int>(row),
+      static_cast<int>(width), static_cast<int>(height),
+      const_cast<float *>(values), static_cast<int>(width),
+      static_cast<int>(height), GDT_Float32, 0, 0);
+  if (cr != CE_None) {
+    adcircmodules_throw_exception("Error during Raster I/O in GDAL library");
+  }
+}
+
+/**
+ * @brief Computes the band statistics and closes the file
+ */
+void RasterFileWriter::close() {
+  if (this->m_raster == nullptr) return;
+  double bmin, bmax, bmean, bsigma;
+  this->m_band->ComputeStatistics(true, &bmin, &bmax, &bmean, &bsigma,
+                                  nullptr, nullptr);
+  this->m_band->SetStatistics(bmin, bmax, bmean, bsigma);
+  GDALClose(static_cast<GDALDatasetH>(this->m_raster));
+  this->m_raster = nullptr;
+  this->m_band = nullptr;
+}
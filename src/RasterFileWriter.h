@@ -0,0 +1,65 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERFILEWRITER_H
+#define ADCMOD_RASTERFILEWRITER_H
+
+#include <cstddef>
+#include <string>
+
+class GDALDataset;
+class GDALRasterBand;
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class RasterFileWriter
+ * @author Zachary Cobell
+ * @brief Writes a single band floating point raster with GDAL one block at a
+ * time
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The format is selected from the file extension (.tif or .img). GeoTIFF
+ * files are tiled with the block size passed to the constructor, so blocks
+ * of that size are written directly to the file without holding the full
+ * raster in memory.
+ *
+ */
+class RasterFileWriter {
+ public:
+  RasterFileWriter(const std::string &filename, size_t nx, size_t ny,
+                   double xmin, double ymax, double resolution, int epsg,
+                   double nullvalue, const std::string &description,
+                   const std::string &units, size_t blockSize);
+  ~RasterFileWriter();
+
+  void write(size_t column, size_t row, size_t width, size_t height,
+             const float *values);
+  void close();
+
+ private:
+  GDALDataset *m_raster;
+  GDALRasterBand *m_band;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERFILEWRITER_H
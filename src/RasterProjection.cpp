@@ -0,0 +1,632 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterProjection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "Mesh.h"
+#include "MeshRasterizer.h"
+
+#ifdef USE_GDAL
+#include "RasterFileWriter.h"
+#endif
+
+using namespace Adcirc::Geometry;
+using Adcirc::Private::MeshRasterizer;
+
+//...Width and height of the tiles used to compute and write the raster
+static constexpr size_t c_tileSize = 512;
+
+//...Smallest number of pixels applied using multiple threads
+static constexpr size_t c_parallelApplySize = 65536;
+
+static const char c_projectionMagic[8] = {'A', 'D', 'C', 'R',
+                                          'P', 'R', 'O', 'J'};
+static constexpr uint64_t c_projectionVersion = 2;
+static constexpr uint64_t c_projectionByteOrder = 0x0102030405060708;
+static constexpr size_t c_projectionHeaderWords = 12;
+
+/**
+ * @brief Computes the raster grid covering an extent, as Mesh::toRaster does
+ */
+static void rasterGrid(const std::vector<double> &extent, double resolution,
+                       double &xmin, double &ymax, size_t &nx, size_t &ny) {
+  if (extent.size() < 4 || !(resolution > 0.0)) {
+    adcircmodules_throw_exception("Invalid raster extent or resolution");
+  }
+  const double xmax = std::max(extent[0], extent[2]);
+  const double ymin = std::min(extent[3], extent[1]);
+  xmin = std::min(extent[0], extent[2]);
+  ymax = std::max(extent[3], extent[1]);
+  nx = static_cast<size_t>(std::floor(std::abs(xmax - xmin) / resolution)) +
+       1;
+  ny = static_cast<size_t>(std::floor(std::abs(ymax - ymin) / resolution)) +
+       1;
+  if (nx < 3 || ny < 3) {
+    adcircmodules_throw_exception("Invalid resolution specified.");
+  }
+}
+
+/**
+ * @brief Adds a block of memory to a 64-bit FNV-1a hash
+ */
+static uint64_t hashBytes(uint64_t h, const void *data, size_t size) {
+  constexpr uint64_t prime = 0x100000001b3ULL;
+  const auto *p = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < size; ++i) h = (h ^ p[i]) * prime;
+  return h;
+}
+
+template <typename T>
+static uint64_t hashValue(uint64_t h, T value) {
+  return hashBytes(h, &value, sizeof(T));
+}
+
+/**
+ * @brief Hash of the mesh geometry and connectivity and of the raster grid
+ */
+static uint64_t gridHash(Mesh *mesh, double xmin, double ymax,
+                         double resolution, size_t nx, size_t ny) {
+  uint64_t h = 0xcbf29ce484222325ULL;
+  h = hashValue<uint64_t>(h, mesh->numNodes());
+  h = hashValue<uint64_t>(h, mesh->numElements());
+  for (const auto &n : *mesh->nodes()) {
+    h = hashValue(h, n.x());
+    h = hashValue(h, n.y());
+  }
+  const Node *firstNode = mesh->nodes()->data();
+  for (const auto &e : *mesh->elements()) {
+    for (size_t k = 0; k < e.n(); ++k) {
+      h = hashValue<uint64_t>(h, e.node(k) - firstNode);
+    }
+  }
+  h = hashValue(h, xmin);
+  h = hashValue(h, ymax);
+  h = hashValue(h, resolution);
+  h = hashValue<uint64_t>(h, nx);
+  h = hashValue<uint64_t>(h, ny);
+  return h;
+}
+
+static std::string hashString(uint64_t h) {
+  static const char digits[] = "0123456789abcdef";
+  std::string s(16, '0');
+  for (size_t i = 0; i < 16; ++i) {
+    s[15 - i] = digits[(h >> (4 * i)) & 0xf];
+  }
+  return s;
+}
+
+RasterProjection::RasterProjection()
+    : m_nx(0),
+      m_ny(0),
+      m_xmin(0.0),
+      m_ymax(0.0),
+      m_resolution(0.0),
+      m_epsg(0),
+      m_numNodes(0),
+      m_hash(0) {}
+
+/**
+ * @brief Computes the projection of a mesh onto a raster
+ * @param[in] mesh mesh the nodal values are defined on
+ * @param[in] extent raster extent as xmin, ymin, xmax, ymax
+ * @param[in] resolution pixel size
+ */
+RasterProjection::RasterProjection(Mesh *mesh,
+                                   const std::vector<double> &extent,
+                                   double resolution)
+    : RasterProjection() {
+  this->compute(mesh, extent, resolution);
+}
+
+/**
+ * @brief Computes the projection of a mesh onto a raster
+ * @param[in] mesh mesh the nodal values are defined on
+ * @param[in] extent raster extent as xmin, ymin, xmax, ymax
+ * @param[in] resolution pixel size
+ */
+void RasterProjection::compute(Mesh *mesh, const std::vector<double> &extent,
+                               double resolution) {
+  double xmin, ymax;
+  size_t nx, ny;
+  rasterGrid(extent, resolution, xmin, ymax, nx, ny);
+
+  if (nx >= std::numeric_limits<uint32_t>::max() ||
+      ny >= std::numeric_limits<uint32_t>::max()) {
+    adcircmodules_throw_exception("RasterProjection: Raster is too large");
+  }
+  if (mesh->numNodes() >= std::numeric_limits<uint32_t>::max()) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Mesh has too many nodes");
+  }
+
+  MeshRasterizer rasterizer(*mesh->nodes(), *mesh->elements(), xmin, ymax,
+                            resolution, nx, ny, c_tileSize);
+  if (rasterizer.numTriangles() >= MeshRasterizer::noTriangle()) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Mesh has too many elements");
+  }
+
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_xmin = xmin;
+  this->m_ymax = ymax;
+  this->m_resolution = resolution;
+  this->m_epsg = mesh->projection();
+  this->m_numNodes = mesh->numNodes();
+  this->m_hash = gridHash(mesh, xmin, ymax, resolution, nx, ny);
+
+  this->m_triangleNodes.resize(3 * rasterizer.numTriangles());
+  for (size_t i = 0; i < rasterizer.numTriangles(); ++i) {
+    const size_t *n = rasterizer.triangleNodes(i);
+    for (size_t k = 0; k < 3; ++k) {
+      this->m_triangleNodes[3 * i + k] = static_cast<uint32_t>(n[k]);
+    }
+  }
+
+  //...Each tile is projected into a dense buffer and reduced to the spans of
+  //   the pixels it covers
+  struct TileSpans {
+    std::vector<Span> spans;
+    std::vector<float> weights;
+    std::vector<size_t> rowStart;
+  };
+  const size_t numTileColumns = rasterizer.numTileColumns();
+  std::vector<TileSpans> tiles(numTileColumns * rasterizer.numTileRows());
+#pragma omp parallel
+  {
+    std::vector<uint32_t> triangle(c_tileSize * c_tileSize);
+    std::vector<float> weight(2 * c_tileSize * c_tileSize);
+#pragma omp for schedule(dynamic)
+    for (long long tile = 0; tile < static_cast<long long>(tiles.size());
+         ++tile) {
+      const size_t col = static_cast<size_t>(tile) % numTileColumns;
+      const size_t row = static_cast<size_t>(tile) / numTileColumns;
+      const size_t width = rasterizer.tileWidth(col);
+      const size_t height = rasterizer.tileHeight(row);
+      rasterizer.project(col, row, triangle.data(), weight.data(), width);
+
+      TileSpans &t = tiles[tile];
+      t.rowStart.push_back(0);
+      for (size_t j = 0; j < height; ++j) {
+        const uint32_t r = static_cast<uint32_t>(row * c_tileSize + j);
+        for (size_t i = 0; i < width; ++i) {
+          const uint32_t tri = triangle[j * width + i];
+          if (tri == MeshRasterizer::noTriangle()) continue;
+          const uint32_t c = static_cast<uint32_t>(col * c_tileSize + i);
+          if (!t.spans.empty() && t.spans.back().row == r &&
+              t.spans.back().column1 == c &&
+              t.spans.back().triangle == tri) {
+            t.spans.back().column1++;
+          } else {
+            t.spans.push_back({r, c, c + 1, tri});
+          }
+          t.weights.push_back(weight[2 * (j * width + i)]);
+          t.weights.push_back(weight[2 * (j * width + i) + 1]);
+        }
+        t.rowStart.push_back(t.spans.size());
+      }
+    }
+  }
+
+  //...The spans of the tiles are merged into row order, joining spans which
+  //   continue across the edge of a tile
+  size_t numSpans = 0, numWeights = 0;
+  for (const auto &t : tiles) {
+    numSpans += t.spans.size();
+    numWeights += t.weights.size();
+  }
+  this->m_spans.clear();
+  this->m_spans.reserve(numSpans);
+  this->m_weights.clear();
+  this->m_weights.reserve(numWeights);
+  for (size_t row = 0; row < rasterizer.numTileRows(); ++row) {
+    std::vector<size_t> nextWeight(numTileColumns, 0);
+    for (size_t j = 0; j < rasterizer.tileHeight(row); ++j) {
+      for (size_t col = 0; col < numTileColumns; ++col) {
+        const TileSpans &t = tiles[row * numTileColumns + col];
+        for (size_t k = t.rowStart[j]; k < t.rowStart[j + 1]; ++k) {
+          const Span &span = t.spans[k];
+          const size_t n = 2 * (span.column1 - span.column0);
+          this->m_weights.insert(
+              this->m_weights.end(), t.weights.begin() + nextWeight[col],
+              t.weights.begin() + nextWeight[col] + n);
+          nextWeight[col] += n;
+          if (!this->m_spans.empty() &&
+              this->m_spans.back().row == span.row &&
+              this->m_spans.back().column1 == span.column0 &&
+              this->m_spans.back().triangle == span.triangle) {
+            this->m_spans.back().column1 = span.column1;
+          } else {
+            this->m_spans.push_back(span);
+          }
+        }
+      }
+    }
+    for (size_t col = 0; col < numTileColumns; ++col) {
+      tiles[row * numTileColumns + col] = TileSpans();
+    }
+  }
+  this->m_spans.shrink_to_fit();
+  this->indexRows();
+}
+
+/**
+ * @brief Locates the first span and the first weight of each raster row
+ */
+void RasterProjection::indexRows() {
+  this->m_rowSpan.assign(this->m_ny + 1, 0);
+  this->m_rowWeight.assign(this->m_ny + 1, 0);
+  for (const auto &s : this->m_spans) {
+    this->m_rowSpan[s.row + 1]++;
+    this->m_rowWeight[s.row + 1] += 2 * (s.column1 - s.column0);
+  }
+  for (size_t r = 0; r < this->m_ny; ++r) {
+    this->m_rowSpan[r + 1] += this->m_rowSpan[r];
+    this->m_rowWeight[r + 1] += this->m_rowWeight[r];
+  }
+}
+
+void RasterProjection::checkSize(const std::vector<double> &z) const {
+  if (this->m_rowSpan.empty()) {
+    adcircmodules_throw_exception(
+        "RasterProjection: The projection has not been computed");
+  }
+  if (z.size() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Number of values does not match the mesh");
+  }
+}
+
+/**
+ * @brief Flags the nodes whose values mark them as dry
+ */
+std::vector<unsigned char> RasterProjection::dryNodes(
+    const std::vector<double> &z, double nullvalue, bool partialWetting,
+    bool parallel) const {
+  std::vector<unsigned char> dry(z.size());
+#pragma omp parallel for schedule(static) if (parallel)
+  for (long long i = 0; i < static_cast<long long>(z.size()); ++i) {
+    dry[i] = MeshRasterizer::isDry(z[i], nullvalue, partialWetting) ? 1 : 0;
+  }
+  return dry;
+}
+
+/**
+ * @brief Computes the values of a range of raster rows
+ */
+void RasterProjection::applyRows(const std::vector<double> &z,
+                                 const std::vector<unsigned char> &dry,
+                                 double nullvalue, bool partialWetting,
+                                 size_t firstRow, size_t numRows,
+                                 bool parallel, float *values) const {
+  const long long n = static_cast<long long>(numRows);
+#pragma omp parallel for schedule(static) \
+    if (parallel && numRows * this->m_nx >= c_parallelApplySize)
+  for (long long j = 0; j < n; ++j) {
+    const size_t row = firstRow + static_cast<size_t>(j);
+    float *rowValues = values + static_cast<size_t>(j) * this->m_nx;
+    std::fill(rowValues, rowValues + this->m_nx, static_cast<float>(nullvalue));
+    const float *weight = this->m_weights.data() + this->m_rowWeight[row];
+    for (size_t k = this->m_rowSpan[row]; k < this->m_rowSpan[row + 1]; ++k) {
+      const Span &s = this->m_spans[k];
+      const uint32_t *node = &this->m_triangleNodes[3 * s.triangle];
+      const double v[3] = {z[node[0]], z[node[1]], z[node[2]]};
+      const bool isDry = dry[node[0]] || dry[node[1]] || dry[node[2]];
+      for (uint32_t c = s.column0; c < s.column1; ++c, weight += 2) {
+        const double w0 = weight[0];
+        const double w1 = weight[1];
+        const double w[3] = {w0, w1, 1.0 - w0 - w1};
+        if (isDry) {
+          rowValues[c] =
+              MeshRasterizer::interpolate(v, w, nullvalue, partialWetting);
+        } else {
+          rowValues[c] =
+              static_cast<float>(w[0] * v[0] + w[1] * v[1] + w[2] * v[2]);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Interpolates nodal values onto the raster
+ * @param[in] z values at the mesh nodes
+ * @param[in] nullvalue value used for pixels outside of the mesh and for dry
+ * nodes
+ * @param[in] partialWetting interpolate from the wet vertices of partially
+ * wet elements
+ * @return pixel values in row major order, starting at the top left
+ */
+std::vector<float> RasterProjection::apply(const std::vector<double> &z,
+                                           double nullvalue,
+                                           bool partialWetting) const {
+  this->checkSize(z);
+  std::vector<float> values(this->m_nx * this->m_ny);
+  this->applyRows(z, this->dryNodes(z, nullvalue, partialWetting, true),
+                  nullvalue, partialWetting, 0, this->m_ny, true,
+                  values.data());
+  return values;
+}
+
+/**
+ * @brief Interpolates several nodal value vectors onto the raster. The
+ * fields are processed concurrently
+ * @param[in] z values at the mesh nodes for each field
+ * @param[in] nullvalue value used for pixels outside of the mesh and for dry
+ * nodes
+ * @param[in] partialWetting interpolate from the wet vertices of partially
+ * wet elements
+ * @return pixel values of each field
+ */
+std::vector<std::vector<float>> RasterProjection::apply(
+    const std::vector<std::vector<double>> &z, double nullvalue,
+    bool partialWetting) const {
+  for (const auto &f : z) this->checkSize(f);
+  std::vector<std::vector<float>> values(z.size());
+  if (z.size() == 1) {
+    values[0] = this->apply(z[0], nullvalue, partialWetting);
+    return values;
+  }
+#pragma omp parallel for schedule(dynamic)
+  for (long long f = 0; f < static_cast<long long>(z.size()); ++f) {
+    values[f].resize(this->m_nx * this->m_ny);
+    this->applyRows(z[f],
+                    this->dryNodes(z[f], nullvalue, partialWetting, false),
+                    nullvalue, partialWetting, 0, this->m_ny, false,
+                    values[f].data());
+  }
+  return values;
+}
+
+/**
+ * @brief Interpolates nodal values onto the raster and writes them to a file
+ * with GDAL
+ * @param[in] filename name of the raster file (.tif or .img)
+ * @param[in] z values at the mesh nodes
+ * @param[in] nullvalue value used for pixels outside of the mesh and for dry
+ * nodes
+ * @param[in] description description of the raster band
+ * @param[in] units units of the raster band
+ * @param[in] partialWetting interpolate from the wet vertices of partially
+ * wet elements
+ *
+ * The raster is computed and written in strips of rows, so the full raster
+ * is never held in memory.
+ */
+void RasterProjection::toRaster(const std::string &filename,
+                                const std::vector<double> &z, double nullvalue,
+                                const std::string &description,
+                                const std::string &units,
+                                bool partialWetting) const {
+#ifndef USE_GDAL
+  adcircmodules_throw_exception("GDAL is not enabled.");
+#else
+  this->checkSize(z);
+  const std::vector<unsigned char> dry =
+      this->dryNodes(z, nullvalue, partialWetting, true);
+
+  Adcirc::Private::RasterFileWriter raster(
+      filename, this->m_nx, this->m_ny, this->m_xmin, this->m_ymax,
+      this->m_resolution, this->m_epsg, nullvalue, description, units,
+      c_tileSize);
+  std::vector<float> strip(c_tileSize * this->m_nx);
+  for (size_t row = 0; row < this->m_ny; row += c_tileSize) {
+    const size_t numRows = std::min(c_tileSize, this->m_ny - row);
+    this->applyRows(z, dry, nullvalue, partialWetting, row, numRows, true,
+                    strip.data());
+    raster.write(0, row, this->m_nx, numRows, strip.data());
+  }
+  raster.close();
+#endif
+}
+
+/**
+ * @brief Writes the projection to a binary file
+ * @param[in] filename name of the file
+ */
+void RasterProjection::write(const std::string &filename) const {
+  if (this->m_rowSpan.empty()) {
+    adcircmodules_throw_exception(
+        "RasterProjection: The projection has not been computed");
+  }
+
+  uint64_t xmin, ymax, resolution;
+  std::memcpy(&xmin, &this->m_xmin, sizeof(double));
+  std::memcpy(&ymax, &this->m_ymax, sizeof(double));
+  std::memcpy(&resolution, &this->m_resolution, sizeof(double));
+  const uint64_t header[c_projectionHeaderWords] = {
+      c_projectionByteOrder,
+      c_projectionVersion,
+      this->m_hash,
+      this->m_nx,
+      this->m_ny,
+      this->m_numNodes,
+      this->m_triangleNodes.size() / 3,
+      static_cast<uint64_t>(static_cast<int64_t>(this->m_epsg)),
+      xmin,
+      ymax,
+      resolution,
+      this->m_spans.size()};
+
+  //...A saved projection is replaced, never rewritten in place, so a reader
+  //   does not see a partially written file
+  const std::string temporary =
+      Adcirc::FileIO::Generic::temporaryFilename(filename);
+  std::ofstream fid(temporary, std::ios::binary | std::ios::trunc);
+  if (!fid) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Could not open file for writing");
+  }
+  fid.write(c_projectionMagic, sizeof(c_projectionMagic));
+  fid.write(reinterpret_cast<const char *>(header), sizeof(header));
+  fid.write(reinterpret_cast<const char *>(this->m_triangleNodes.data()),
+            this->m_triangleNodes.size() * sizeof(uint32_t));
+  fid.write(reinterpret_cast<const char *>(this->m_spans.data()),
+            this->m_spans.size() * sizeof(Span));
+  fid.write(reinterpret_cast<const char *>(this->m_weights.data()),
+            this->m_weights.size() * sizeof(float));
+  fid.close();
+  if (!fid) {
+    std::remove(temporary.c_str());
+    adcircmodules_throw_exception("RasterProjection: Error writing file");
+  }
+  Adcirc::FileIO::Generic::replaceFile(temporary, filename);
+}
+
+/**
+ * @brief Reads a projection written by write()
+ * @param[in] filename name of the file
+ */
+void RasterProjection::read(const std::string &filename) {
+  std::ifstream fid(filename, std::ios::binary);
+  if (!fid) {
+    adcircmodules_throw_exception("RasterProjection: Could not open file");
+  }
+
+  char magic[sizeof(c_projectionMagic)];
+  uint64_t header[c_projectionHeaderWords];
+  fid.read(magic, sizeof(magic));
+  fid.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (!fid ||
+      std::memcmp(magic, c_projectionMagic, sizeof(c_projectionMagic)) != 0 ||
+      header[0] != c_projectionByteOrder || header[1] != c_projectionVersion) {
+    adcircmodules_throw_exception(
+        "RasterProjection: File is not a compatible raster projection");
+  }
+
+  const size_t nx = header[3];
+  const size_t ny = header[4];
+  const size_t numNodes = header[5];
+  const size_t numTriangles = header[6];
+  const size_t numSpans = header[11];
+  if (nx == 0 || ny == 0 || nx >= std::numeric_limits<uint32_t>::max() ||
+      ny >= std::numeric_limits<uint32_t>::max() ||
+      numTriangles >= MeshRasterizer::noTriangle() || numSpans > nx * ny) {
+    adcircmodules_throw_exception("RasterProjection: Invalid file header");
+  }
+
+  std::vector<uint32_t> triangleNodes(3 * numTriangles);
+  std::vector<Span> spans(numSpans);
+  fid.read(reinterpret_cast<char *>(triangleNodes.data()),
+           triangleNodes.size() * sizeof(uint32_t));
+  fid.read(reinterpret_cast<char *>(spans.data()),
+           spans.size() * sizeof(Span));
+  if (!fid) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Unexpected end of file");
+  }
+
+  for (const auto n : triangleNodes) {
+    if (n >= numNodes) {
+      adcircmodules_throw_exception(
+          "RasterProjection: Invalid triangle in file");
+    }
+  }
+
+  //...Spans must be in row order and must not overlap
+  size_t numWeights = 0;
+  for (size_t k = 0; k < spans.size(); ++k) {
+    const Span &s = spans[k];
+    const bool ordered = k == 0 || s.row > spans[k - 1].row ||
+                         (s.row == spans[k - 1].row &&
+                          s.column0 >= spans[k - 1].column1);
+    if (!ordered || s.row >= ny || s.column0 >= s.column1 ||
+        s.column1 > nx || s.triangle >= numTriangles) {
+      adcircmodules_throw_exception("RasterProjection: Invalid span in file");
+    }
+    numWeights += 2 * (s.column1 - s.column0);
+  }
+
+  std::vector<float> weights(numWeights);
+  fid.read(reinterpret_cast<char *>(weights.data()),
+           weights.size() * sizeof(float));
+  if (!fid) {
+    adcircmodules_throw_exception(
+        "RasterProjection: Unexpected end of file");
+  }
+
+  this->m_hash = header[2];
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_numNodes = numNodes;
+  this->m_epsg = static_cast<int>(static_cast<int64_t>(header[7]));
+  std::memcpy(&this->m_xmin, &header[8], sizeof(double));
+  std::memcpy(&this->m_ymax, &header[9], sizeof(double));
+  std::memcpy(&this->m_resolution, &header[10], sizeof(double));
+  this->m_triangleNodes = std::move(triangleNodes);
+  this->m_spans = std::move(spans);
+  this->m_weights = std::move(weights);
+  this->indexRows();
+}
+
+/**
+ * @brief Returns true if the projection was computed for the same mesh
+ * geometry, extent and resolution
+ */
+bool RasterProjection::matches(Mesh *mesh, const std::vector<double> &extent,
+                               double resolution) const {
+  if (this->m_rowSpan.empty()) return false;
+  return this->hash() == RasterProjection::hash(mesh, extent, resolution);
+}
+
+/**
+ * @brief Hash of the mesh geometry and raster grid of the projection
+ */
+std::string RasterProjection::hash() const {
+  return hashString(this->m_hash);
+}
+
+/**
+ * @brief Hash of a mesh geometry and raster grid, which can be compared with
+ * the hash of a saved projection without computing the projection
+ * @param[in] mesh mesh the nodal values are defined on
+ * @param[in] extent raster extent as xmin, ymin, xmax, ymax
+ * @param[in] resolution pixel size
+ */
+std::string RasterProjection::hash(Mesh *mesh,
+                                   const std::vector<double> &extent,
+                                   double resolution) {
+  double xmin, ymax;
+  size_t nx, ny;
+  rasterGrid(extent, resolution, xmin, ymax, nx, ny);
+  return hashString(gridHash(mesh, xmin, ymax, resolution, nx, ny));
+}
+
+size_t RasterProjection::nx() const { return this->m_nx; }
+
+size_t RasterProjection::ny() const { return this->m_ny; }
+
+double RasterProjection::xmin() const { return this->m_xmin; }
+
+double RasterProjection::ymax() const { return this->m_ymax; }
+
+double RasterProjection::resolution() const { return this->m_resolution; }
+
+int RasterProjection::epsg() const { return this->m_epsg; }
+
+size_t RasterProjection::numNodes() const { return this->m_numNodes; }
@@ -0,0 +1,141 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERPROJECTION_H
+#define ADCMOD_RASTERPROJECTION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+
+namespace Adcirc {
+
+namespace Geometry {
+
+class Mesh;
+
+/**
+ * @class RasterProjection
+ * @author Zachary Cobell
+ * @brief Interpolation from the nodes of a mesh onto a raster, computed once
+ * and applied to any number of nodal value vectors
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The projection stores the pixels covered by the mesh as runs of pixels
+ * within a row that lie in the same triangle, along with the interpolation
+ * weights of each covered pixel, so rasterizing a field only requires a pass
+ * over the covered pixels and pixels outside of the mesh take no storage. The
+ * raster grid is defined in the same way as Mesh::toRaster.
+ *
+ * A projection can be written to disk and read back. The file holds a hash
+ * of the mesh geometry and the raster grid, which is compared against the
+ * hash of a mesh with matches() to decide whether a saved projection can be
+ * reused.
+ *
+ */
+class RasterProjection {
+ public:
+  ADCIRCMODULES_EXPORT RasterProjection();
+
+  ADCIRCMODULES_EXPORT RasterProjection(Adcirc::Geometry::Mesh *mesh,
+                                        const std::vector<double> &extent,
+                                        double resolution);
+
+  void ADCIRCMODULES_EXPORT compute(Adcirc::Geometry::Mesh *mesh,
+                                    const std::vector<double> &extent,
+                                    double resolution);
+
+  std::vector<float> ADCIRCMODULES_EXPORT
+  apply(const std::vector<double> &z, double nullvalue = -99999.0,
+        bool partialWetting = true) const;
+
+  std::vector<std::vector<float>> ADCIRCMODULES_EXPORT
+  apply(const std::vector<std::vector<double>> &z, double nullvalue = -99999.0,
+        bool partialWetting = true) const;
+
+  void ADCIRCMODULES_EXPORT toRaster(const std::string &filename,
+                                     const std::vector<double> &z,
+                                     double nullvalue = -99999.0,
+                                     const std::string &description = "none",
+                                     const std::string &units = "none",
+                                     bool partialWetting = true) const;
+
+  void ADCIRCMODULES_EXPORT write(const std::string &filename) const;
+  void ADCIRCMODULES_EXPORT read(const std::string &filename);
+
+  bool ADCIRCMODULES_EXPORT matches(Adcirc::Geometry::Mesh *mesh,
+                                    const std::vector<double> &extent,
+                                    double resolution) const;
+
+  std::string ADCIRCMODULES_EXPORT hash() const;
+
+  static std::string ADCIRCMODULES_EXPORT
+  hash(Adcirc::Geometry::Mesh *mesh, const std::vector<double> &extent,
+       double resolution);
+
+  size_t ADCIRCMODULES_EXPORT nx() const;
+  size_t ADCIRCMODULES_EXPORT ny() const;
+  double ADCIRCMODULES_EXPORT xmin() const;
+  double ADCIRCMODULES_EXPORT ymax() const;
+  double ADCIRCMODULES_EXPORT resolution() const;
+  int ADCIRCMODULES_EXPORT epsg() const;
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+
+ private:
+  /**
+   * @brief Pixels [column0, column1) of a raster row which lie in a triangle
+   */
+  struct Span {
+    uint32_t row;
+    uint32_t column0;
+    uint32_t column1;
+    uint32_t triangle;
+  };
+
+  void indexRows();
+  void applyRows(const std::vector<double> &z,
+                 const std::vector<unsigned char> &dry, double nullvalue,
+                 bool partialWetting, size_t firstRow, size_t numRows,
+                 bool parallel, float *values) const;
+  std::vector<unsigned char> dryNodes(const std::vector<double> &z,
+                                      double nullvalue, bool partialWetting,
+                                      bool parallel) const;
+  void checkSize(const std::vector<double> &z) const;
+
+  size_t m_nx;
+  size_t m_ny;
+  double m_xmin;
+  double m_ymax;
+  double m_resolution;
+  int m_epsg;
+  size_t m_numNodes;
+  uint64_t m_hash;
+  std::vector<uint32_t> m_triangleNodes;
+  std::vector<Span> m_spans;
+  std::vector<float> m_weights;
+  std::vector<size_t> m_rowSpan;
+  std::vector<size_t> m_rowWeight;
+};
+
+}  // namespace Geometry
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERPROJECTION_H
@@ -0,0 +1,283 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterTileCache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Logging.h"
+
+using namespace Adcirc::Raster;
+
+//...Template Instantiation
+template bool RasterTileCache::read<double>(size_t ibegin, size_t jbegin,
+                                            size_t iend, size_t jend,
+                                            double *buffer);
+
+template bool RasterTileCache::read<int>(size_t ibegin, size_t jbegin,
+                                         size_t iend, size_t jend, int *buffer);
+
+//...Upper limit on the number of independently locked shards
+static constexpr size_t c_maxShards = 64;
+
+//...Minimum number of tiles each shard should be able to hold
+static constexpr size_t c_minTilesPerShard = 4;
+
+/**
+ * @brief Constructor
+ * @param nx number of columns in the raster
+ * @param ny number of rows in the raster
+ * @param tileNx number of columns in each tile
+ * @param tileNy number of rows in each tile
+ * @param memoryBudget approximate maximum number of bytes held by the cache
+ * @param loader function used to read a tile from the underlying raster
+ *
+ * The number of shards is chosen so that each shard can hold a few tiles
+ * within its portion of the memory budget. Each shard always retains at least
+ * one tile, so very small budgets may be exceeded by up to one tile per shard.
+ */
+RasterTileCache::RasterTileCache(size_t nx, size_t ny, size_t tileNx,
+                                 size_t tileNy, size_t memoryBudget,
+                                 TileLoader loader)
+    : m_nx(nx),
+      m_ny(ny),
+      m_tileNx(std::max<size_t>(1, std::min(tileNx, nx))),
+      m_tileNy(std::max<size_t>(1, std::min(tileNy, ny))),
+      m_numTilesX((nx + m_tileNx - 1) / m_tileNx),
+      m_memoryBudget(memoryBudget),
+      m_shardBudget(0),
+      m_loader(std::move(loader)),
+      m_hits(0),
+      m_misses(0),
+      m_evictions(0) {
+  if (!m_loader) {
+    adcircmodules_throw_exception("RasterTileCache: No tile loader specified");
+  }
+  const size_t tileBytes = m_tileNx * m_tileNy * sizeof(double);
+  size_t nShards = m_memoryBudget / (tileBytes * c_minTilesPerShard);
+  nShards = std::max<size_t>(1, std::min(nShards, c_maxShards));
+  m_shardBudget = m_memoryBudget / nShards;
+  m_shards.reserve(nShards);
+  for (size_t i = 0; i < nShards; ++i) {
+    m_shards.push_back(std::make_unique<Shard>());
+  }
+}
+
+/**
+ * @brief Number of columns in the raster
+ * @return number of columns
+ */
+size_t RasterTileCache::nx() const { return m_nx; }
+
+/**
+ * @brief Number of rows in the raster
+ * @return number of rows
+ */
+size_t RasterTileCache::ny() const { return m_ny; }
+
+/**
+ * @brief Number of columns in each tile
+ * @return tile columns
+ */
+size_t RasterTileCache::tileNx() const { return m_tileNx; }
+
+/**
+ * @brief Number of rows in each tile
+ * @return tile rows
+ */
+size_t RasterTileCache::tileNy() const { return m_tileNy; }
+
+/**
+ * @brief Memory budget for the cache in bytes
+ * @return memory budget
+ */
+size_t RasterTileCache::memoryBudget() const { return m_memoryBudget; }
+
+/**
+ * @brief Number of independently locked shards in the cache
+ * @return number of shards
+ */
+size_t RasterTileCache::numShards() const { return m_shards.size(); }
+
+/**
+ * @brief Number of tile requests satisfied from the cache
+ * @return cache hits
+ */
+size_t RasterTileCache::hits() const {
+  return m_hits.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Number of tile requests that required a read from the loader
+ * @return cache misses
+ */
+size_t RasterTileCache::misses() const {
+  return m_misses.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Number of tiles that have been evicted from the cache
+ * @return evictions
+ */
+size_t RasterTileCache::evictions() const {
+  return m_evictions.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Resets the hit, miss and eviction counters
+ */
+void RasterTileCache::resetStatistics() {
+  m_hits.store(0, std::memory_order_relaxed);
+  m_misses.store(0, std::memory_order_relaxed);
+  m_evictions.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Number of bytes of tile data currently held by the cache
+ * @return memory usage
+ */
+size_t RasterTileCache::memoryUsage() const {
+  size_t b = 0;
+  for (const auto &s : m_shards) {
+    std::lock_guard<std::mutex> lock(s->mutex);
+    b += s->bytes;
+  }
+  return b;
+}
+
+/**
+ * @brief Removes all tiles from the cache
+ *
+ * Tiles that are still referenced by a caller remain valid until released
+ */
+void RasterTileCache::clear() {
+  for (auto &s : m_shards) {
+    std::lock_guard<std::mutex> lock(s->mutex);
+    s->tiles.clear();
+    s->lru.clear();
+    s->bytes = 0;
+  }
+}
+
+RasterTileCache::Shard &RasterTileCache::shard(uint64_t key) {
+  //...Multiplicative hash so that neighboring tiles land in different shards
+  return *m_shards[(key * 0x9E3779B97F4A7C15ULL >> 32) % m_shards.size()];
+}
+
+/**
+ * @brief Returns the tile containing the pixel i,j, reading it if required
+ * @param i column index
+ * @param j row index
+ * @return tile, or nullptr if the tile could not be read
+ */
+std::shared_ptr<const RasterTileCache::Tile> RasterTileCache::tile(size_t i,
+                                                                   size_t j) {
+  if (i >= m_nx || j >= m_ny) return nullptr;
+  const size_t ti = i / m_tileNx;
+  const size_t tj = j / m_tileNy;
+  const uint64_t key = static_cast<uint64_t>(tj) * m_numTilesX + ti;
+  Shard &s = this->shard(key);
+
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    auto it = s.tiles.find(key);
+    if (it != s.tiles.end()) {
+      s.lru.splice(s.lru.begin(), s.lru, it->second.second);
+      m_hits.fetch_add(1, std::memory_order_relaxed);
+      return it->second.first;
+    }
+  }
+
+  m_misses.fetch_add(1, std::memory_order_relaxed);
+  auto t = this->loadTile(ti, tj);
+  if (!t) return nullptr;
+
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.tiles.find(key);
+  if (it != s.tiles.end()) {
+    //...Another thread loaded the same tile while this one was reading
+    s.lru.splice(s.lru.begin(), s.lru, it->second.second);
+    return it->second.first;
+  }
+  s.lru.push_front(key);
+  s.tiles.emplace(key, std::make_pair(t, s.lru.begin()));
+  s.bytes += t->data.size() * sizeof(double);
+  this->evict(s);
+  return t;
+}
+
+std::shared_ptr<const RasterTileCache::Tile> RasterTileCache::loadTile(
+    size_t ti, size_t tj) {
+  auto t = std::make_shared<Tile>();
+  t->i0 = ti * m_tileNx;
+  t->j0 = tj * m_tileNy;
+  t->nx = std::min(m_tileNx, m_nx - t->i0);
+  t->ny = std::min(m_tileNy, m_ny - t->j0);
+  t->data.resize(t->nx * t->ny);
+  if (!m_loader(t->i0, t->j0, t->nx, t->ny, t->data.data())) return nullptr;
+  return t;
+}
+
+void RasterTileCache::evict(Shard &s) {
+  while (s.bytes > m_shardBudget && s.lru.size() > 1) {
+    auto it = s.tiles.find(s.lru.back());
+    s.bytes -= it->second.first->data.size() * sizeof(double);
+    s.tiles.erase(it);
+    s.lru.pop_back();
+    m_evictions.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Reads a rectangular window of the raster through the cache
+ * @param ibegin first column
+ * @param jbegin first row
+ * @param iend last column (inclusive)
+ * @param jend last row (inclusive)
+ * @param buffer destination, row-major with (iend-ibegin+1) columns
+ * @return true if all tiles were read successfully
+ *
+ * Values are converted to the type of the destination buffer
+ */
+template <typename T>
+bool RasterTileCache::read(size_t ibegin, size_t jbegin, size_t iend,
+                           size_t jend, T *buffer) {
+  if (iend >= m_nx || jend >= m_ny || ibegin > iend || jbegin > jend) {
+    return false;
+  }
+  const size_t width = iend - ibegin + 1;
+  for (size_t tj = jbegin / m_tileNy; tj <= jend / m_tileNy; ++tj) {
+    for (size_t ti = ibegin / m_tileNx; ti <= iend / m_tileNx; ++ti) {
+      auto t = this->tile(ti * m_tileNx, tj * m_tileNy);
+      if (!t) return false;
+      const size_t i0 = std::max(ibegin, t->i0);
+      const size_t i1 = std::min(iend, t->i0 + t->nx - 1);
+      const size_t j0 = std::max(jbegin, t->j0);
+      const size_t j1 = std::min(jend, t->j0 + t->ny - 1);
+      for (size_t j = j0; j <= j1; ++j) {
+        const double *src = &t->data[(j - t->j0) * t->nx + (i0 - t->i0)];
+        T *dst = buffer + (j - jbegin) * width + (i0 - ibegin);
+        for (size_t i = 0; i <= i1 - i0; ++i) {
+          dst[i] = static_cast<T>(src[i]);
+        }
+      }
+    }
+  }
+  return true;
+}
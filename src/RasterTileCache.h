@@ -0,0 +1,128 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERTILECACHE_H
+#define ADCMOD_RASTERTILECACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Adcirc {
+namespace Raster {
+
+/**
+ * @class RasterTileCache
+ * @author Zachary Cobell
+ * @brief Thread safe cache of rectangular raster tiles
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The raster is divided into fixed size tiles which are read on demand using
+ * the supplied loader function. Tiles are distributed across a number of
+ * independently locked shards, each with its own least recently used
+ * eviction list, so that concurrent readers only contend when they touch the
+ * same shard. Locks are never held while a tile is being loaded, allowing
+ * disk reads from multiple threads to proceed in parallel.
+ *
+ */
+class RasterTileCache {
+ public:
+  /**
+   * @brief Function used to fill a tile. Arguments are the starting column
+   * and row, the number of columns and rows, and the destination buffer
+   * (row-major). Returns false if the read failed.
+   */
+  using TileLoader =
+      std::function<bool(size_t, size_t, size_t, size_t, double *)>;
+
+  struct Tile {
+    size_t i0;
+    size_t j0;
+    size_t nx;
+    size_t ny;
+    std::vector<double> data;
+    double value(size_t i, size_t j) const {
+      return data[(j - j0) * nx + (i - i0)];
+    }
+  };
+
+  RasterTileCache(size_t nx, size_t ny, size_t tileNx, size_t tileNy,
+                  size_t memoryBudget, TileLoader loader);
+
+  size_t nx() const;
+  size_t ny() const;
+  size_t tileNx() const;
+  size_t tileNy() const;
+  size_t memoryBudget() const;
+  size_t numShards() const;
+
+  std::shared_ptr<const Tile> tile(size_t i, size_t j);
+
+  template <typename T>
+  bool read(size_t ibegin, size_t jbegin, size_t iend, size_t jend,
+            T *buffer);
+
+  size_t hits() const;
+  size_t misses() const;
+  size_t evictions() const;
+  size_t memoryUsage() const;
+
+  void resetStatistics();
+  void clear();
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    std::list<uint64_t> lru;
+    std::unordered_map<
+        uint64_t,
+        std::pair<std::shared_ptr<const Tile>, std::list<uint64_t>::iterator>>
+        tiles;
+    size_t bytes = 0;
+  };
+
+  std::shared_ptr<const Tile> loadTile(size_t ti, size_t tj);
+  Shard &shard(uint64_t key);
+  void evict(Shard &s);
+
+  const size_t m_nx;
+  const size_t m_ny;
+  const size_t m_tileNx;
+  const size_t m_tileNy;
+  const size_t m_numTilesX;
+  const size_t m_memoryBudget;
+  size_t m_shardBudget;
+  TileLoader m_loader;
+  std::vector<std::unique_ptr<Shard>> m_shards;
+
+  std::atomic<size_t> m_hits;
+  std::atomic<size_t> m_misses;
+  std::atomic<size_t> m_evictions;
+};
+
+}  // namespace Raster
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERTILECACHE_H
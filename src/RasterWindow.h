@@ -0,0 +1,106 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERWINDOW_H
+#define ADCMOD_RASTERWINDOW_H
+
+#include <cstddef>
+
+namespace Adcirc {
+namespace Raster {
+
+/**
+ * @class RasterWindow
+ * @author Zachary Cobell
+ * @brief Non-owning view of a rectangular block of raster values
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The window refers to pixels ibegin..iend and jbegin..jend (inclusive) using
+ * the global raster indices. Values are stored row-major with the given row
+ * stride, which allows the window to point directly into an in-memory raster
+ * without copying. Pixel center coordinates are computed from the raster
+ * geometry rather than stored.
+ *
+ */
+template <typename T>
+class RasterWindow {
+ public:
+  RasterWindow()
+      : m_data(nullptr),
+        m_stride(0),
+        m_ibegin(0),
+        m_jbegin(0),
+        m_iend(0),
+        m_jend(0),
+        m_xmin(0.0),
+        m_ymax(0.0),
+        m_dx(0.0),
+        m_dy(0.0) {}
+
+  RasterWindow(const T *data, size_t stride, size_t ibegin, size_t jbegin,
+               size_t iend, size_t jend, double xmin, double ymax, double dx,
+               double dy)
+      : m_data(data),
+        m_stride(stride),
+        m_ibegin(ibegin),
+        m_jbegin(jbegin),
+        m_iend(iend),
+        m_jend(jend),
+        m_xmin(xmin),
+        m_ymax(ymax),
+        m_dx(dx),
+        m_dy(dy) {}
+
+  bool empty() const { return m_data == nullptr; }
+
+  size_t ibegin() const { return m_ibegin; }
+  size_t jbegin() const { return m_jbegin; }
+  size_t iend() const { return m_iend; }
+  size_t jend() const { return m_jend; }
+  size_t stride() const { return m_stride; }
+
+  /** @brief Pointer to the first value in row j, which corresponds to column
+   * ibegin */
+  const T *row(size_t j) const { return m_data + (j - m_jbegin) * m_stride; }
+
+  T value(size_t i, size_t j) const { return this->row(j)[i - m_ibegin]; }
+
+  /** @brief x-coordinate of the center of column i */
+  double x(size_t i) const { return i * m_dx + m_xmin + 0.50 * m_dx; }
+
+  /** @brief y-coordinate of the center of row j */
+  double y(size_t j) const { return m_ymax - (j + 1) * m_dy + 0.50 * m_dy; }
+
+ private:
+  const T *m_data;
+  size_t m_stride;
+  size_t m_ibegin;
+  size_t m_jbegin;
+  size_t m_iend;
+  size_t m_jend;
+  double m_xmin;
+  double m_ymax;
+  double m_dx;
+  double m_dy;
+};
+
+}  // namespace Raster
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERWINDOW_H
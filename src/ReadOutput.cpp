@@ -18,22 +18,35 @@
 //------------------------------------------------------------------------*/
 #include "ReadOutput.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <fstream>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <utility>
 
 #include "AdcircOutputfiles.h"
+#include "AsciiOutputReader.h"
 #include "FileIO.h"
 #include "FileTypes.h"
 #include "Logging.h"
+#include "OutputRecordPool.h"
 #include "StringConversion.h"
 #include "netcdf.h"
 
 using namespace Adcirc::Output;
 
+//...Largest number of values read from a netCDF variable in a single request
+//   when extracting a time series
+static constexpr size_t c_maxTimeseriesBuffer = 4194304;
+
+//...Nodes closer together than this are read in a single request from
+//   variables which are not chunked. The gap is one 4 KiB page of values, so
+//   the values between them cost little more to read than the nodes
+//   themselves
+static constexpr size_t c_timeseriesNodeGap = 512;
+
 const std::vector<OutputMetadata>* ReadOutput::adcircFileMetadata() {
   return &c_outputMetadata;
 }
@@ -55,7 +68,8 @@ ReadOutput::ReadOutput(const std::string& filename)
       m_varid_time(0),
       m_metadata(OutputMetadata()),
       m_verbose(0),
-      m_coldstart(1970, 1, 1, 0, 0, 0) {}
+      m_coldstart(1970, 1, 1, 0, 0, 0),
+      m_pool(std::make_unique<Adcirc::Private::OutputRecordPool>()) {}
 
 ReadOutput::~ReadOutput() { this->clear(); }
 
@@ -125,7 +139,9 @@ void ReadOutput::setColdstart(Adcirc::CDate coldstart) {
 Adcirc::CDate ReadOutput::coldstart() { return this->m_coldstart; }
 
 void ReadOutput::addRecord(const OutputRecord& record) {
-  this->m_records.push_back(record);
+  OutputRecord* r = this->m_pool->acquire();
+  *r = record;
+  this->m_records.push_back(r);
   this->rebuildMap();
 }
 
@@ -145,14 +161,25 @@ void ReadOutput::setDefaultValue(double defaultValue) {
   this->m_defaultValue = defaultValue;
 }
 
+/**
+ * @brief Removes all records. Their storage is kept for reuse by later reads.
+ */
 void ReadOutput::clear() {
+  for (auto r : this->m_records) {
+    this->m_pool->release(r);
+  }
   this->m_records.clear();
   this->m_recordMap.clear();
 }
 
+/**
+ * @brief Removes a record. Pointers to the other records remain valid.
+ * @param[in] position position of the record in the list of records
+ */
 void ReadOutput::clearAt(size_t position) {
   assert(position < this->m_records.size());
   if (position < this->m_records.size()) {
+    this->m_pool->release(this->m_records[position]);
     this->m_records.erase(this->m_records.begin() + position);
     this->rebuildMap();
   } else {
@@ -220,17 +247,7 @@ void ReadOutput::close() {
 void ReadOutput::read(size_t snap) {
   if (this->filetype() == Adcirc::Output::OutputAsciiFull ||
       this->filetype() == Adcirc::Output::OutputAsciiSparse) {
-    if (snap != Adcirc::Output::nextOutputSnap()) {
-      if (this->m_verbose > 0)
-        Logging::warning(
-            "ASCII Output must be read record by "
-            "record. Specified snap number ignored.");
-    }
-    if (this->currentSnap() > this->numSnaps()) {
-      adcircmodules_throw_exception(
-          "ReadOutput: Attempt to read past last record in file");
-    }
-    this->readAsciiRecord();
+    this->readAsciiRecord(snap);
   } else if (this->filetype() == Adcirc::Output::OutputNetcdf3 ||
              this->filetype() == Adcirc::Output::OutputNetcdf4) {
     this->readNetcdfRecord(snap);
@@ -241,20 +258,136 @@ void ReadOutput::read(size_t snap) {
   return;
 }
 
+/**
+ * @brief Reads a record into an existing record instead of adding it to the
+ * records held by this object
+ * @param[in] snap zero based record index
+ * @param[in,out] record record to fill. Its storage is reused when it already
+ * holds numNodes() values with the dimension of the file.
+ * @param[in] numThreads number of threads used to decode ASCII records, or
+ * zero to use the OpenMP default
+ *
+ * This is used to read files with a fixed set of buffers, so that reading
+ * each snap does not allocate memory. The current snap is not changed.
+ */
+void ReadOutput::read(size_t snap, OutputRecord& record, int numThreads) {
+  if (!this->isOpen()) {
+    adcircmodules_throw_exception("ReadOutput: File not open");
+  }
+
+  if (snap >= this->numSnaps()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Record requested > number of records in file");
+  }
+
+  this->prepareRecord(snap, record);
+
+  if (this->filetype() == Adcirc::Output::OutputAsciiFull ||
+      this->filetype() == Adcirc::Output::OutputAsciiSparse) {
+    this->m_ascii->setLayout(this->numSnaps(), this->numNodes(),
+                             *this->metadata());
+    this->m_ascii->read(snap, record, numThreads);
+  } else if (this->filetype() == Adcirc::Output::OutputNetcdf3 ||
+             this->filetype() == Adcirc::Output::OutputNetcdf4) {
+    this->readNetcdfValues(snap, record);
+  } else {
+    adcircmodules_throw_exception("ReadOutput: Unknown filetype");
+  }
+}
+
+/**
+ * @brief Sets up a record to hold a snap from this file, reusing its storage
+ * when it already has the layout of the file
+ * @param[in] snap zero based record index
+ * @param[in,out] record record to set up
+ */
+void ReadOutput::prepareRecord(size_t snap, OutputRecord& record) {
+  if (record.numNodes() != this->numNodes() ||
+      record.metadata()->dimension() != this->metadata()->dimension()) {
+    record = OutputRecord(snap, this->numNodes(), *this->metadata(),
+                          this->coldstart());
+  } else {
+    if (!(*record.metadata() == *this->metadata())) {
+      record.setMetadata(*this->metadata());
+    }
+    record.setColdstart(this->coldstart());
+  }
+  record.setRecord(snap);
+}
+
+/**
+ * @brief Reads the values at a set of nodes over a range of snaps
+ * @param[in] nodes zero based indices of the nodes to read. The columns of the
+ * returned time series are in the same order.
+ * @param[in] firstSnap zero based index of the first snap to read
+ * @param[in] numSnaps number of snaps to read
+ * @return dense time series with one row per snap and one column per node
+ *
+ * For netCDF files, only the portions of the file containing the requested
+ * nodes are read, so the cost is proportional to the number of nodes rather
+ * than the size of the file. Records which have already been read with read()
+ * are not affected.
+ */
+OutputTimeseries ReadOutput::readTimeseries(const std::vector<size_t>& nodes,
+                                            size_t firstSnap,
+                                            size_t numSnaps) {
+  if (!this->isOpen()) {
+    adcircmodules_throw_exception("ReadOutput: File not open");
+  }
+
+  if (this->metadata()->isMax()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Time series cannot be read from a max file");
+  }
+
+  if (firstSnap + numSnaps > this->numSnaps()) {
+    adcircmodules_throw_exception(
+        "ReadOutput: Record requested > number of records in file");
+  }
+
+  for (auto n : nodes) {
+    if (n >= this->numNodes()) {
+      adcircmodules_throw_exception("ReadOutput: Node index out of range");
+    }
+  }
+
+  if (this->filetype() == Adcirc::Output::OutputAsciiFull ||
+      this->filetype() == Adcirc::Output::OutputAsciiSparse) {
+    OutputTimeseries timeseries(nodes, firstSnap, numSnaps,
+                                this->metadata()->dimension(),
+                                this->defaultValue());
+    this->readAsciiTimeseries(timeseries);
+    return timeseries;
+  } else if (this->filetype() == Adcirc::Output::OutputNetcdf3 ||
+             this->filetype() == Adcirc::Output::OutputNetcdf4) {
+    OutputTimeseries timeseries(
+        nodes, firstSnap, numSnaps,
+        std::min(this->metadata()->dimension(), this->m_varid_data.size()),
+        this->defaultValue());
+    this->readNetcdfTimeseries(timeseries);
+    return timeseries;
+  } else {
+    adcircmodules_throw_exception("ReadOutput: Unknown filetype");
+    return OutputTimeseries();
+  }
+}
+
 void ReadOutput::openAscii() {
   if (this->isOpen()) {
     adcircmodules_throw_exception("ReadOutput: File already open");
   }
-  this->m_fid.open(this->filename());
-  if (this->m_fid.is_open()) {
-    this->setOpen(true);
-    return;
-  } else {
+  try {
+    this->m_ascii =
+        std::make_unique<Adcirc::Private::AsciiOutputReader>(this->filename());
+  } catch (const std::exception&) {
     adcircmodules_throw_exception("ReadOutput: File could not be opened");
   }
+  this->setOpen(true);
 }
 
 void ReadOutput::openNetcdf() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   if (!this->isOpen()) {
     int ierr = nc_open(this->filename().c_str(), NC_NOWRITE, &this->m_ncid);
     if (ierr != NC_NOERR) {
@@ -270,7 +403,7 @@ void ReadOutput::openNetcdf() {
 
 void ReadOutput::closeAscii() {
   if (this->isOpen()) {
-    this->m_fid.close();
+    this->m_ascii.reset();
     this->setOpen(false);
     return;
   }
@@ -279,6 +412,8 @@ void ReadOutput::closeAscii() {
 }
 
 void ReadOutput::closeNetcdf() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   if (this->isOpen()) {
     nc_close(this->m_ncid);
     this->setOpen(false);
@@ -303,7 +438,7 @@ OutputRecord* ReadOutput::data(size_t snap, bool& ok) {
     return nullptr;
   } else {
     ok = true;
-    return &this->m_records[this->m_recordMap[snap]];
+    return this->m_records[this->m_recordMap[snap]];
   }
 }
 
@@ -322,7 +457,7 @@ OutputRecord* ReadOutput::dataAt(size_t position, bool& ok) {
     return nullptr;
   } else {
     ok = true;
-    return &this->m_records[position];
+    return this->m_records[position];
   }
 }
 
@@ -424,11 +559,9 @@ void ReadOutput::readAsciiHeader() {
     adcircmodules_throw_exception("ReadOutput: No filename specified");
   }
 
-  std::string line;
-  std::getline(this->m_fid, line);  // header
-  this->setHeader(line);
+  this->setHeader(this->m_ascii->headerLine(0));
 
-  std::getline(this->m_fid, line);  // file info header
+  std::string line = this->m_ascii->headerLine(1);  // file info header
 
   std::vector<std::string> list;
   FileIO::Generic::splitString(line, list);
@@ -436,25 +569,25 @@ void ReadOutput::readAsciiHeader() {
   bool ok;
   this->setNumSnaps(StringConversion::stringToSizet(list.at(0), ok));
   if (!ok) {
-    this->m_fid.close();
+    this->closeAscii();
     adcircmodules_throw_exception("ReadOutput: Error reading ascii header");
   }
 
   this->setNumNodes(StringConversion::stringToSizet(list.at(1), ok));
   if (!ok) {
-    this->m_fid.close();
+    this->closeAscii();
     adcircmodules_throw_exception("ReadOutput: Error reading ascii header");
   }
 
   this->setDt(StringConversion::stringToDouble(list.at(2), ok));
   if (!ok) {
-    this->m_fid.close();
+    this->closeAscii();
     adcircmodules_throw_exception("ReadOutput: Error reading ascii header");
   }
 
   this->setDiteration(StringConversion::stringToInt(list.at(3), ok));
   if (!ok) {
-    this->m_fid.close();
+    this->closeAscii();
     adcircmodules_throw_exception("ReadOutput: Error reading ascii header");
   }
 
@@ -468,15 +601,20 @@ void ReadOutput::readAsciiHeader() {
     this->metadata()->setIsVector(true);
     this->metadata()->setDimension(2);
   } else {
-    this->m_fid.close();
+    this->closeAscii();
     adcircmodules_throw_exception(
         "ReadOutput: Invalid number of columns in file");
   }
 
+  this->m_ascii->setLayout(this->numSnaps(), this->numNodes(),
+                           *this->metadata());
+
   return;
 }
 
 void ReadOutput::readNetcdfHeader() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   assert(this->isOpen());
 
   int ierr = nc_inq_dimid(this->m_ncid, "time", &this->m_dimid_time);
@@ -544,76 +682,34 @@ void ReadOutput::readNetcdfHeader() {
   return;
 }
 
-void ReadOutput::readAsciiRecord() {
-  std::string line;
-
-  this->m_records.push_back(
-      OutputRecord(this->currentSnap(), this->numNodes(), *(this->metadata())));
-  OutputRecord* record = &this->m_records.back();
-
-  //...Record header
-  std::getline(this->m_fid, line);
-  std::vector<std::string> list;
-  FileIO::Generic::splitString(line, list);
-  bool ok;
-
-  double t = StringConversion::stringToDouble(list[0], ok);
-  if (ok) {
-    record->setTime(t);
-  } else {
-    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-  }
-
-  int it = StringConversion::stringToInt(list[1], ok);
-  if (ok) {
-    record->setIteration(it);
-  } else {
-    adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-  }
-
-  size_t numNonDefault = this->numNodes();
-  double dflt = Adcirc::Output::defaultOutputValue();
-
-  if (list.size() > 2) {
-    numNonDefault = StringConversion::stringToSizet(list[2], ok);
-    if (!ok) {
-      adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-    }
-
-    dflt = StringConversion::stringToDouble(list[3], ok);
-    if (!ok) {
-      adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-    }
+/**
+ * @brief Reads a record from an ASCII output file
+ * @param[in] snap zero based record index or nextOutputSnap() to read the
+ * record following the previous one
+ *
+ * Records are located using the index kept by the AsciiOutputReader, so they
+ * may be read in any order. When records are read sequentially, the following
+ * records are decoded in the background.
+ */
+void ReadOutput::readAsciiRecord(size_t snap) {
+  if (snap == Output::nextOutputSnap()) {
+    snap = this->currentSnap();
   }
-  record->setDefaultValue(dflt);
-  record->fill(dflt);
 
-  //...Record loop
-  for (size_t i = 0; i < numNonDefault; ++i) {
-    std::getline(this->m_fid, line);
+  this->m_ascii->setLayout(this->numSnaps(), this->numNodes(),
+                           *this->metadata());
+  OutputRecord decoded = this->m_ascii->read(snap);
 
-    if (this->metadata()->isVector()) {
-      size_t id;
-      double v1, v2;
-      if (FileIO::AdcircIO::splitStringAttribute2Format(line, id, v1, v2)) {
-        record->set(id - 1, v1, v2);
-      } else {
-        adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-      }
-    } else {
-      size_t id;
-      double v1;
-      if (FileIO::AdcircIO::splitStringAttribute1Format(line, id, v1)) {
-        record->set(id - 1, v1);
-      } else {
-        adcircmodules_throw_exception("ReadOutput: Error reading ascii record");
-      }
-    }
-  }
+  //...Swap the decoded record into a slot from the pool and give the previous
+  //   contents of the slot back to the reader to decode a later snap into
+  OutputRecord* record = this->m_pool->acquire();
+  std::swap(*record, decoded);
+  this->m_ascii->recycle(std::move(decoded));
+  this->m_records.push_back(record);
 
   //...Setup the map for record indicies
-  this->m_recordMap[record->record()] = this->m_records.size() - 1;
-  this->setCurrentSnap(this->currentSnap() + 1);
+  this->m_recordMap[snap] = this->m_records.size() - 1;
+  this->setCurrentSnap(snap + 1);
 
   return;
 }
@@ -630,21 +726,39 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
     adcircmodules_throw_exception(
         "ReadOutput: Record requested > number of records in file");
   }
-  this->m_records.push_back(
-      OutputRecord(snap, this->numNodes(), this->metadata()->isVector(),
-                   this->metadata()->isMax(), this->metadata()->dimension()));
-  OutputRecord* record = &this->m_records.back();
+  OutputRecord* record = this->m_pool->acquire();
+  try {
+    this->prepareRecord(snap, *record);
+    this->readNetcdfValues(snap, *record);
+  } catch (const std::exception&) {
+    this->m_pool->release(record);
+    throw;
+  }
+  this->m_records.push_back(record);
 
-  record->setTime(this->m_time[snap]);
-  record->setIteration(std::floor(this->m_time[snap] / this->dt()));
+  this->m_recordMap[record->record()] = this->m_records.size() - 1;
+  this->setCurrentSnap(this->currentSnap() + 1);
+}
+
+/**
+ * @brief Reads the time and values of a netCDF record into an existing record
+ * @param[in] snap zero based record index
+ * @param[in,out] record record with storage for numNodes values
+ */
+void ReadOutput::readNetcdfValues(size_t snap, OutputRecord& record) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
+  record.setDefaultValue(this->defaultValue());
+  record.setTime(this->m_time[snap]);
+  record.setIteration(std::floor(this->m_time[snap] / this->dt()));
 
   //..Read the data record. If it is a max record, there is
   //  no time dimension
   if (this->metadata()->isMax()) {
     if (this->metadata()->dimension() == 1) {
-      record->m_u.resize(this->numNodes());
+      record.m_u.resize(this->numNodes());
       int ierr =
-          nc_get_var(this->m_ncid, this->m_varid_data[0], record->m_u.data());
+          nc_get_var(this->m_ncid, this->m_varid_data[0], record.m_u.data());
 
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
@@ -652,10 +766,10 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
         return;
       }
     } else if (this->metadata()->dimension() == 2) {
-      record->m_u.resize(this->numNodes());
-      record->m_v.resize(this->numNodes());
+      record.m_u.resize(this->numNodes());
+      record.m_v.resize(this->numNodes());
       int ierr =
-          nc_get_var(this->m_ncid, this->m_varid_data[0], record->m_u.data());
+          nc_get_var(this->m_ncid, this->m_varid_data[0], record.m_u.data());
 
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
@@ -663,7 +777,7 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
         return;
       }
       ierr =
-          nc_get_var(this->m_ncid, this->m_varid_data[1], record->m_v.data());
+          nc_get_var(this->m_ncid, this->m_varid_data[1], record.m_v.data());
 
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
@@ -680,7 +794,7 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
 
     if (this->metadata()->dimension() == 1) {
       int ierr = nc_get_vara(this->m_ncid, this->m_varid_data[0], start, count,
-                             record->m_u.data());
+                             record.m_u.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
@@ -688,7 +802,7 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
       }
     } else if (this->metadata()->dimension() == 2) {
       int ierr = nc_get_vara(this->m_ncid, this->m_varid_data[0], start, count,
-                             record->m_u.data());
+                             record.m_u.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
@@ -696,29 +810,29 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
       }
 
       ierr = nc_get_vara(this->m_ncid, this->m_varid_data[1], start, count,
-                         record->m_v.data());
+                         record.m_v.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
         return;
       }
     } else if (this->metadata()->dimension() == 3) {
-      int ierr = nc_get_vara(this->m_ncid, this->m_varid_data[1], start, count,
-                             record->m_u.data());
+      int ierr = nc_get_vara(this->m_ncid, this->m_varid_data[0], start, count,
+                             record.m_u.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
         return;
       }
       ierr = nc_get_vara(this->m_ncid, this->m_varid_data[1], start, count,
-                         record->m_v.data());
+                         record.m_v.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
         return;
       }
       ierr = nc_get_vara(this->m_ncid, this->m_varid_data[2], start, count,
-                         record->m_w.data());
+                         record.m_w.data());
       if (ierr != NC_NOERR) {
         adcircmodules_throw_exception(
             "ReadOutput: Error reading netcdf record");
@@ -726,15 +840,153 @@ void ReadOutput::readNetcdfRecord(size_t snap) {
       }
     }
   }
+}
 
-  this->m_recordMap[record->record()] = this->m_records.size() - 1;
-  this->setCurrentSnap(this->currentSnap() + 1);
+/**
+ * @brief Fills a time series from an ASCII file by decoding each snap in the
+ * range
+ * @param[in,out] timeseries time series to fill
+ */
+void ReadOutput::readAsciiTimeseries(OutputTimeseries& timeseries) {
+  this->m_ascii->setLayout(this->numSnaps(), this->numNodes(),
+                           *this->metadata());
+  const size_t n = timeseries.numNodes();
+  for (size_t s = 0; s < timeseries.numSnaps(); ++s) {
+    OutputRecord r = this->m_ascii->read(timeseries.firstSnap() + s);
+    timeseries.setTime(s, r.time());
+    timeseries.setIteration(s, r.iteration());
+    for (size_t p = 0; p < n; ++p) {
+      const size_t node = timeseries.node(p);
+      if (timeseries.dimension() == 1) {
+        timeseries.data(0)[s * n + p] = r.z(node);
+      } else {
+        timeseries.data(0)[s * n + p] = r.u(node);
+        timeseries.data(1)[s * n + p] = r.v(node);
+      }
+    }
+    this->m_ascii->recycle(std::move(r));
+  }
+}
+
+/**
+ * @brief Fills a time series from a netCDF file using hyperslab reads
+ * @param[in,out] timeseries time series to fill
+ *
+ * The requested nodes are sorted and split into groups which are each read
+ * with one request per block of snaps. For chunked (netCDF4) variables a
+ * group contains the nodes within the same chunk, since the whole chunk is
+ * decompressed regardless of how much of it is requested. Otherwise, nodes
+ * that are close together are grouped. Groups of evenly spaced nodes are read
+ * with a strided request.
+ */
+void ReadOutput::readNetcdfTimeseries(OutputTimeseries& timeseries) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
+  struct NodeGroup {
+    size_t first;
+    size_t count;
+    size_t stride;
+    size_t begin;
+    size_t end;
+  };
+
+  const size_t n = timeseries.numNodes();
+  if (n == 0 || timeseries.numSnaps() == 0) return;
+
+  for (size_t s = 0; s < timeseries.numSnaps(); ++s) {
+    const double t = this->m_time[timeseries.firstSnap() + s];
+    timeseries.setTime(s, t);
+    timeseries.setIteration(s, std::floor(t / this->dt()));
+  }
+
+  //...Visit the requested nodes in the order they are stored in the file
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return timeseries.node(a) < timeseries.node(b);
+  });
+
+  int storage = NC_CONTIGUOUS;
+  size_t chunk[2] = {0, 0};
+  int ierr =
+      nc_inq_var_chunking(this->m_ncid, this->m_varid_data[0], &storage, chunk);
+  const bool chunked = ierr == NC_NOERR && storage == NC_CHUNKED &&
+                       chunk[0] > 0 && chunk[1] > 0;
+
+  std::vector<NodeGroup> groups;
+  for (size_t k = 0; k < n; ++k) {
+    const size_t node = timeseries.node(order[k]);
+    bool newGroup = groups.empty();
+    if (!newGroup) {
+      const size_t previous = timeseries.node(order[k - 1]);
+      newGroup = chunked ? node / chunk[1] != groups.back().first / chunk[1]
+                         : node - previous > c_timeseriesNodeGap;
+    }
+    if (newGroup) groups.push_back({node, 0, 1, k, k});
+    groups.back().end = k + 1;
+  }
+
+  std::vector<double> buffer;
+  for (auto& g : groups) {
+    const size_t span = timeseries.node(order[g.end - 1]) - g.first + 1;
+    g.count = span;
+
+    //...Evenly spaced nodes only require the requested values to be read
+    if (g.end - g.begin > 1) {
+      const size_t d = timeseries.node(order[g.begin + 1]) - g.first;
+      bool even = d > 1;
+      for (size_t k = g.begin + 1; k < g.end && even; ++k) {
+        even = timeseries.node(order[k]) - timeseries.node(order[k - 1]) == d;
+      }
+      if (even) {
+        g.stride = d;
+        g.count = (span - 1) / d + 1;
+      }
+    }
+
+    //...Snaps read per request. Blocks are a multiple of the chunk size in
+    //   time when possible so that chunks are not decompressed twice
+    size_t rows = std::max<size_t>(1, c_maxTimeseriesBuffer / g.count);
+    if (chunked && rows > chunk[0]) rows -= rows % chunk[0];
+    rows = std::min(rows, timeseries.numSnaps());
+    buffer.resize(rows * g.count);
+
+    for (size_t t0 = 0; t0 < timeseries.numSnaps(); t0 += rows) {
+      const size_t nt = std::min(rows, timeseries.numSnaps() - t0);
+      const size_t start[2] = {timeseries.firstSnap() + t0, g.first};
+      const size_t count[2] = {nt, g.count};
+      const ptrdiff_t stride[2] = {1, static_cast<ptrdiff_t>(g.stride)};
+
+      for (size_t c = 0; c < timeseries.dimension(); ++c) {
+        if (g.stride == 1) {
+          ierr = nc_get_vara_double(this->m_ncid, this->m_varid_data[c], start,
+                                    count, buffer.data());
+        } else {
+          ierr = nc_get_vars_double(this->m_ncid, this->m_varid_data[c], start,
+                                    count, stride, buffer.data());
+        }
+        if (ierr != NC_NOERR) {
+          adcircmodules_throw_exception(
+              "ReadOutput: Error reading netcdf time series");
+        }
+
+        double* out = timeseries.data(c);
+        for (size_t k = g.begin; k < g.end; ++k) {
+          const size_t local = (timeseries.node(order[k]) - g.first) / g.stride;
+          const size_t column = order[k];
+          for (size_t r = 0; r < nt; ++r) {
+            out[(t0 + r) * n + column] = buffer[r * g.count + local];
+          }
+        }
+      }
+    }
+  }
 }
 
 void ReadOutput::rebuildMap() {
   this->m_recordMap.clear();
   for (size_t i = 0; i < this->m_records.size(); ++i) {
-    this->m_recordMap[this->m_records[i].record()] = i;
+    this->m_recordMap[this->m_records[i]->record()] = i;
   }
   return;
 }
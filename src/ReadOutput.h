@@ -19,7 +19,7 @@
 #ifndef ADCMOD_READOUTPUT_H
 #define ADCMOD_READOUTPUT_H
 
-#include <fstream>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -29,9 +29,15 @@
 #include "Node.h"
 #include "OutputMetadata.h"
 #include "OutputRecord.h"
+#include "OutputTimeseries.h"
 
 namespace Adcirc {
 
+namespace Private {
+class AsciiOutputReader;
+class OutputRecordPool;
+}
+
 namespace Output {
 
 /**
@@ -94,6 +100,11 @@ class ReadOutput {
   void setModelDt(double modelDt);
 
   void read(size_t snap = Adcirc::Output::nextOutputSnap());
+  void read(size_t snap, Adcirc::Output::OutputRecord &record,
+            int numThreads = 0);
+
+  Adcirc::Output::OutputTimeseries readTimeseries(
+      const std::vector<size_t> &nodes, size_t firstSnap, size_t numSnaps);
 
   Adcirc::Output::OutputRecord *data(size_t snap);
   Adcirc::Output::OutputRecord *data(size_t snap, bool &ok);
@@ -116,8 +127,8 @@ class ReadOutput {
   void setOpen(bool open);
 
   // variables
-  std::ifstream m_fid;
-  std::vector<Adcirc::Output::OutputRecord> m_records;
+  std::unique_ptr<Adcirc::Private::AsciiOutputReader> m_ascii;
+  std::vector<Adcirc::Output::OutputRecord *> m_records;
   std::unordered_map<size_t, size_t> m_recordMap;
   bool m_open;
   Adcirc::Output::OutputFormat m_filetype;
@@ -136,6 +147,7 @@ class ReadOutput {
   Adcirc::Output::OutputMetadata m_metadata;
   size_t m_verbose;
   Adcirc::CDate m_coldstart;
+  std::unique_ptr<Adcirc::Private::OutputRecordPool> m_pool;
 
   // netcdf specific variables
   int m_ncid;
@@ -148,6 +160,7 @@ class ReadOutput {
   Adcirc::Output::OutputFormat getFiletype();
   void findNetcdfVarId();
   void rebuildMap();
+  void prepareRecord(size_t snap, Adcirc::Output::OutputRecord &record);
 
   void openAscii();
   void openNetcdf();
@@ -158,8 +171,12 @@ class ReadOutput {
   void readAsciiHeader();
   void readNetcdfHeader();
 
-  void readAsciiRecord();
+  void readAsciiRecord(size_t snap);
   void readNetcdfRecord(size_t snap);
+  void readNetcdfValues(size_t snap, Adcirc::Output::OutputRecord &record);
+
+  void readAsciiTimeseries(Adcirc::Output::OutputTimeseries &timeseries);
+  void readNetcdfTimeseries(Adcirc::Output::OutputTimeseries &timeseries);
   int netcdfVariableSearch(size_t variableIndex, OutputMetadata &filetypeFound);
 };
 }  // namespace Output
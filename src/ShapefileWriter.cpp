@@ -0,0 +1,375 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "ShapefileWriter.h"
+
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+
+#include "AsciiWriter.h"
+#include "DefaultValues.h"
+#include "FPCompare.h"
+#include "FileIO.h"
+#include "Logging.h"
+#include "shapefil.h"
+
+using namespace Adcirc::Private;
+
+//...Size of the .shp and .shx file headers
+static constexpr size_t c_headerSize = 100;
+
+//...Largest .shp file that can be addressed by the .shx offsets
+static constexpr uint64_t c_maxFileSize = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Removes the extension from a file name in the same way as shapelib,
+ * so that any extension is replaced and names without one are kept
+ * @param[in] filename name of the file
+ * @return name without the extension
+ */
+static std::string shapefileBasename(const std::string &filename) {
+  const size_t dot = filename.find_last_of('.');
+  const size_t separator = filename.find_last_of("/\\");
+  if (dot == std::string::npos || dot == 0 ||
+      (separator != std::string::npos && dot < separator)) {
+    return filename;
+  }
+  return filename.substr(0, dot);
+}
+
+static void putBigEndian32(char *p, uint32_t v) {
+  p[0] = static_cast<char>((v >> 24) & 0xff);
+  p[1] = static_cast<char>((v >> 16) & 0xff);
+  p[2] = static_cast<char>((v >> 8) & 0xff);
+  p[3] = static_cast<char>(v & 0xff);
+}
+
+static void putLittleEndian32(char *p, uint32_t v) {
+  p[0] = static_cast<char>(v & 0xff);
+  p[1] = static_cast<char>((v >> 8) & 0xff);
+  p[2] = static_cast<char>((v >> 16) & 0xff);
+  p[3] = static_cast<char>((v >> 24) & 0xff);
+}
+
+static void putLittleEndianDouble(char *p, double v) {
+  uint64_t bits;
+  std::memcpy(&bits, &v, sizeof(double));
+  for (size_t i = 0; i < 8; ++i) {
+    p[i] = static_cast<char>((bits >> (8 * i)) & 0xff);
+  }
+}
+
+static int shapeType(FeatureGeometry geometry) {
+  switch (geometry) {
+    case FeaturePoint:
+      return SHPT_POINT;
+    case FeatureLine:
+      return SHPT_ARC;
+    case FeaturePolygon:
+      return SHPT_POLYGON;
+  }
+  return SHPT_NULL;
+}
+
+/**
+ * @brief Constructor
+ * @param[in] filename name of the .shp file. Any other extension is replaced
+ * with .shp, and the .shx and .dbf files are written next to it.
+ * @param[in] geometry type of the features
+ */
+ShapefileWriter::ShapefileWriter(const std::string &filename,
+                                 FeatureGeometry geometry)
+    : FeatureWriter(geometry),
+      m_basename(shapefileBasename(filename)),
+      m_shapeType(shapeType(geometry)),
+      m_shp(nullptr),
+      m_shx(nullptr),
+      m_dbf(nullptr),
+      m_closed(false),
+      m_recordLength(1),
+      m_numRecords(0),
+      m_shpLength(0),
+      m_hasBounds(false),
+      m_bounds{0.0, 0.0, 0.0, 0.0} {}
+
+ShapefileWriter::~ShapefileWriter() {
+  if (!this->m_closed) {
+    try {
+      this->close();
+    } catch (const std::exception &e) {
+      Adcirc::Logging::logError(e.what());
+    }
+  }
+}
+
+/**
+ * @brief Creates the files and their headers with shapelib, then reopens
+ * them so that records can be appended
+ */
+void ShapefileWriter::createFiles() {
+  const std::string shpFile = this->m_basename + ".shp";
+  const std::string shxFile = this->m_basename + ".shx";
+  const std::string dbfFile = this->m_basename + ".dbf";
+
+  SHPHandle shpid = SHPCreate(shpFile.c_str(), this->m_shapeType);
+  DBFHandle dbfid = DBFCreate(dbfFile.c_str());
+  if (shpid == nullptr || dbfid == nullptr) {
+    if (shpid != nullptr) SHPClose(shpid);
+    if (dbfid != nullptr) DBFClose(dbfid);
+    adcircmodules_throw_exception("Could not create shapefile " + shpFile);
+  }
+
+  for (const auto &f : this->fields()) {
+    DBFAddField(dbfid, f.name.c_str(),
+                f.type == FieldInteger ? FTInteger : FTDouble, f.width,
+                f.precision);
+    this->m_recordLength += std::min(f.width, 255);
+
+    //...The default value is too wide for any field and takes the slow
+    //   formatting path, so its truncated text is formatted only once
+    char text[AsciiWriter::maxLineLength()];
+    const int width = std::min(f.width, 255);
+    char *end = AsciiWriter::fixed(
+        text, adcircmodules_default_value<double>(), width, f.precision);
+    this->m_defaultText.emplace_back(
+        text, std::min<size_t>(end - text, width));
+  }
+
+  DBFClose(dbfid);
+  SHPClose(shpid);
+
+  this->m_shp = std::fopen(shpFile.c_str(), "r+b");
+  this->m_shx = std::fopen(shxFile.c_str(), "r+b");
+  this->m_dbf = std::fopen(dbfFile.c_str(), "r+b");
+  if (this->m_shp == nullptr || this->m_shx == nullptr ||
+      this->m_dbf == nullptr) {
+    for (std::FILE **f : {&this->m_shp, &this->m_shx, &this->m_dbf}) {
+      if (*f != nullptr) std::fclose(*f);
+      *f = nullptr;
+    }
+    adcircmodules_throw_exception("Could not open shapefile " + shpFile);
+  }
+  std::fseek(this->m_shp, 0, SEEK_END);
+  std::fseek(this->m_shx, 0, SEEK_END);
+  std::fseek(this->m_dbf, 0, SEEK_END);
+}
+
+/**
+ * @brief Size of a record in the .shp file, not including the record header
+ * @param[in] numVertices number of vertices in the shape
+ */
+size_t ShapefileWriter::contentLength(size_t numVertices) const {
+  if (this->m_shapeType == SHPT_POINT) return 20;
+  return 48 + 16 * numVertices;
+}
+
+/**
+ * @brief Encodes the .shp record of a feature
+ * @param[in] table batch of features
+ * @param[in] feature position of the feature in the batch
+ * @param[in] record one based record number in the file
+ * @param[out] p location of the record
+ */
+void ShapefileWriter::encodeShape(const FeatureTable &table, size_t feature,
+                                  size_t record, char *p) const {
+  const size_t nv = table.numVertices(feature);
+  const double *x = table.x(feature);
+  const double *y = table.y(feature);
+
+  putBigEndian32(p, static_cast<uint32_t>(record));
+  putBigEndian32(p + 4, static_cast<uint32_t>(this->contentLength(nv) / 2));
+  putLittleEndian32(p + 8, static_cast<uint32_t>(this->m_shapeType));
+
+  if (this->m_shapeType == SHPT_POINT) {
+    putLittleEndianDouble(p + 12, x[0]);
+    putLittleEndianDouble(p + 20, y[0]);
+    return;
+  }
+
+  double xmin = nv > 0 ? x[0] : 0.0;
+  double ymin = nv > 0 ? y[0] : 0.0;
+  double xmax = xmin;
+  double ymax = ymin;
+  for (size_t i = 1; i < nv; ++i) {
+    xmin = std::min(xmin, x[i]);
+    ymin = std::min(ymin, y[i]);
+    xmax = std::max(xmax, x[i]);
+    ymax = std::max(ymax, y[i]);
+  }
+  putLittleEndianDouble(p + 12, xmin);
+  putLittleEndianDouble(p + 20, ymin);
+  putLittleEndianDouble(p + 28, xmax);
+  putLittleEndianDouble(p + 36, ymax);
+  putLittleEndian32(p + 44, 1);
+  putLittleEndian32(p + 48, static_cast<uint32_t>(nv));
+  putLittleEndian32(p + 52, 0);
+  char *v = p + 56;
+  for (size_t i = 0; i < nv; ++i) {
+    putLittleEndianDouble(v, x[i]);
+    putLittleEndianDouble(v + 8, y[i]);
+    v += 16;
+  }
+}
+
+/**
+ * @brief Encodes the .dbf record of a feature, formatted as shapelib
+ * formats numeric fields
+ * @param[in] table batch of features
+ * @param[in] feature position of the feature in the batch
+ * @param[out] p location of the record
+ */
+void ShapefileWriter::encodeAttributes(const FeatureTable &table,
+                                       size_t feature, char *p) const {
+  std::memset(p, ' ', this->m_recordLength);
+  char *field = p + 1;
+  char text[AsciiWriter::maxLineLength()];
+  for (size_t i = 0; i < this->fields().size(); ++i) {
+    const Field &f = this->fields()[i];
+    const double value = table.attribute(feature, i);
+    const int width = std::min(f.width, 255);
+    if (f.precision != 0 &&
+        FpCompare::equalTo(value, adcircmodules_default_value<double>())) {
+      const std::string &d = this->m_defaultText[i];
+      std::memcpy(field, d.data(), d.size());
+      field += width;
+      continue;
+    }
+    char *end = f.precision == 0
+                    ? AsciiWriter::integer(text, static_cast<int>(value), width)
+                    : AsciiWriter::fixed(text, value, width, f.precision);
+    //...Values too wide for the field are truncated
+    std::memcpy(field, text, std::min<size_t>(end - text, width));
+    field += width;
+  }
+}
+
+/**
+ * @brief Appends a batch of features to the files
+ * @param[in] table batch of features
+ */
+void ShapefileWriter::write(const FeatureTable &table) {
+  if (this->m_shp == nullptr) this->createFiles();
+
+  const size_t n = table.size();
+
+  //...Record offsets within the batch and the bounds of the file
+  this->m_offsets.resize(n + 1);
+  this->m_offsets[0] = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const size_t nv = table.numVertices(i);
+    this->m_offsets[i + 1] =
+        this->m_offsets[i] + 8 + this->contentLength(nv);
+    const double *x = table.x(i);
+    const double *y = table.y(i);
+    for (size_t j = 0; j < nv; ++j) {
+      if (!this->m_hasBounds) {
+        this->m_bounds = {x[j], y[j], x[j], y[j]};
+        this->m_hasBounds = true;
+      }
+      this->m_bounds[0] = std::min(this->m_bounds[0], x[j]);
+      this->m_bounds[1] = std::min(this->m_bounds[1], y[j]);
+      this->m_bounds[2] = std::max(this->m_bounds[2], x[j]);
+      this->m_bounds[3] = std::max(this->m_bounds[3], y[j]);
+    }
+  }
+
+  if (c_headerSize + this->m_shpLength + this->m_offsets[n] > c_maxFileSize) {
+    adcircmodules_throw_exception(
+        "Shapefile exceeds the maximum size of the format");
+  }
+
+  this->m_shpBuffer.resize(this->m_offsets[n]);
+  this->m_shxBuffer.resize(8 * n);
+  this->m_dbfBuffer.resize(this->m_recordLength * n);
+
+#pragma omp parallel for schedule(static)
+  for (long long ii = 0; ii < static_cast<long long>(n); ++ii) {
+    const size_t i = static_cast<size_t>(ii);
+    const uint64_t offset = c_headerSize + this->m_shpLength +
+                            this->m_offsets[i];
+    const uint64_t length = this->m_offsets[i + 1] - this->m_offsets[i] - 8;
+    this->encodeShape(table, i, this->m_numRecords + i + 1,
+                      this->m_shpBuffer.data() + this->m_offsets[i]);
+    putBigEndian32(this->m_shxBuffer.data() + 8 * i,
+                   static_cast<uint32_t>(offset / 2));
+    putBigEndian32(this->m_shxBuffer.data() + 8 * i + 4,
+                   static_cast<uint32_t>(length / 2));
+    this->encodeAttributes(table, i,
+                           this->m_dbfBuffer.data() + this->m_recordLength * i);
+  }
+
+  if (std::fwrite(this->m_shpBuffer.data(), 1, this->m_shpBuffer.size(),
+                  this->m_shp) != this->m_shpBuffer.size() ||
+      std::fwrite(this->m_shxBuffer.data(), 1, this->m_shxBuffer.size(),
+                  this->m_shx) != this->m_shxBuffer.size() ||
+      std::fwrite(this->m_dbfBuffer.data(), 1, this->m_dbfBuffer.size(),
+                  this->m_dbf) != this->m_dbfBuffer.size()) {
+    adcircmodules_throw_exception("Error writing shapefile records");
+  }
+
+  this->m_shpLength += this->m_offsets[n];
+  this->m_numRecords += n;
+}
+
+/**
+ * @brief Writes the file lengths, bounds and record count into the headers
+ */
+void ShapefileWriter::updateHeaders() {
+  char buffer[8 * 4];
+
+  putBigEndian32(buffer,
+                 static_cast<uint32_t>((c_headerSize + this->m_shpLength) / 2));
+  std::fseek(this->m_shp, 24, SEEK_SET);
+  std::fwrite(buffer, 1, 4, this->m_shp);
+
+  for (size_t i = 0; i < 4; ++i) {
+    putLittleEndianDouble(buffer + 8 * i, this->m_bounds[i]);
+  }
+  std::fseek(this->m_shp, 36, SEEK_SET);
+  std::fwrite(buffer, 1, 32, this->m_shp);
+  std::fseek(this->m_shx, 36, SEEK_SET);
+  std::fwrite(buffer, 1, 32, this->m_shx);
+
+  putBigEndian32(buffer, static_cast<uint32_t>(
+                             (c_headerSize + 8 * this->m_numRecords) / 2));
+  std::fseek(this->m_shx, 24, SEEK_SET);
+  std::fwrite(buffer, 1, 4, this->m_shx);
+
+  putLittleEndian32(buffer, static_cast<uint32_t>(this->m_numRecords));
+  std::fseek(this->m_dbf, 4, SEEK_SET);
+  std::fwrite(buffer, 1, 4, this->m_dbf);
+}
+
+/**
+ * @brief Completes the headers and closes the files
+ */
+void ShapefileWriter::close() {
+  if (this->m_closed) return;
+  this->m_closed = true;
+  if (this->m_shp == nullptr) this->createFiles();
+  this->updateHeaders();
+  bool error = false;
+  for (std::FILE **f : {&this->m_shp, &this->m_shx, &this->m_dbf}) {
+    error = std::fclose(*f) != 0 || error;
+    *f = nullptr;
+  }
+  if (error) {
+    adcircmodules_throw_exception("Error closing shapefile");
+  }
+}
@@ -0,0 +1,87 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_SHAPEFILEWRITER_H
+#define ADCMOD_SHAPEFILEWRITER_H
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "FeatureWriter.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class ShapefileWriter
+ * @author Zachary Cobell
+ * @brief Writes vector features to ESRI shapefiles
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * The files and their headers are created with shapelib. The records of each
+ * batch are then encoded concurrently into .shp, .shx and .dbf buffers that
+ * are appended to the files in order, and the headers are updated when the
+ * writer is closed. The files are identical to those written one object at
+ * a time through shapelib.
+ *
+ */
+class ShapefileWriter : public FeatureWriter {
+ public:
+  ShapefileWriter(const std::string &filename, FeatureGeometry geometry);
+  ~ShapefileWriter() override;
+
+  void close() override;
+
+ protected:
+  void write(const FeatureTable &table) override;
+
+ private:
+  void createFiles();
+  size_t contentLength(size_t numVertices) const;
+  void encodeShape(const FeatureTable &table, size_t feature, size_t record,
+                   char *p) const;
+  void encodeAttributes(const FeatureTable &table, size_t feature,
+                        char *p) const;
+  void updateHeaders();
+
+  const std::string m_basename;
+  const int m_shapeType;
+  std::FILE *m_shp;
+  std::FILE *m_shx;
+  std::FILE *m_dbf;
+  bool m_closed;
+  size_t m_recordLength;
+  size_t m_numRecords;
+  uint64_t m_shpLength;
+  bool m_hasBounds;
+  std::array<double, 4> m_bounds;
+  std::vector<std::string> m_defaultText;
+  std::vector<uint64_t> m_offsets;
+  std::vector<char> m_shpBuffer;
+  std::vector<char> m_shxBuffer;
+  std::vector<char> m_dbfBuffer;
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_SHAPEFILEWRITER_H
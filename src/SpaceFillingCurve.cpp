@@ -0,0 +1,132 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+using namespace Adcirc::Private;
+
+//...Number of bits used to quantize each coordinate
+static constexpr unsigned c_curveBits = 16;
+
+/**
+ * @brief Spreads the lower 32 bits of a value so that there is a zero bit
+ * between each of the original bits
+ */
+static uint64_t spreadBits(uint64_t v) {
+  v &= 0x00000000FFFFFFFFULL;
+  v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+  v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+  v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  v = (v | (v << 2)) & 0x3333333333333333ULL;
+  v = (v | (v << 1)) & 0x5555555555555555ULL;
+  return v;
+}
+
+/**
+ * @brief Computes the Morton (z-order) index of a point by interleaving the
+ * bits of the x and y coordinates
+ * @param x quantized x-coordinate
+ * @param y quantized y-coordinate
+ * @return position along the curve
+ */
+uint64_t SpaceFillingCurve::morton(uint32_t x, uint32_t y) {
+  return spreadBits(x) | (spreadBits(y) << 1);
+}
+
+/**
+ * @brief Computes the Hilbert curve index of a point on a 2^16 x 2^16 grid
+ * @param x quantized x-coordinate (lower 16 bits are used)
+ * @param y quantized y-coordinate (lower 16 bits are used)
+ * @return position along the curve
+ *
+ * Unlike the Morton curve, consecutive Hilbert indices are always adjacent
+ * cells, so there are no long jumps across the domain
+ */
+uint64_t SpaceFillingCurve::hilbert(uint32_t x, uint32_t y) {
+  const uint32_t n = 1U << c_curveBits;
+  x &= n - 1;
+  y &= n - 1;
+  uint64_t d = 0;
+  for (uint32_t s = n >> 1; s > 0; s >>= 1) {
+    const uint32_t rx = (x & s) > 0 ? 1 : 0;
+    const uint32_t ry = (y & s) > 0 ? 1 : 0;
+    d += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = n - 1 - x;
+        y = n - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+/**
+ * @brief Computes the permutation that sorts a set of points along a curve
+ * @param x x-coordinates
+ * @param y y-coordinates
+ * @param curve type of curve to use
+ * @return indices of the input points in curve order
+ */
+std::vector<size_t> SpaceFillingCurve::order(const std::vector<double> &x,
+                                             const std::vector<double> &y,
+                                             Curve curve) {
+  assert(x.size() == y.size());
+  const size_t n = x.size();
+  std::vector<size_t> idx(n);
+  std::iota(idx.begin(), idx.end(), 0);
+  if (n < 2) return idx;
+
+  double xmin = std::numeric_limits<double>::max();
+  double ymin = std::numeric_limits<double>::max();
+  double xmax = -std::numeric_limits<double>::max();
+  double ymax = -std::numeric_limits<double>::max();
+  for (size_t i = 0; i < n; ++i) {
+    xmin = std::min(xmin, x[i]);
+    xmax = std::max(xmax, x[i]);
+    ymin = std::min(ymin, y[i]);
+    ymax = std::max(ymax, y[i]);
+  }
+
+  //...Use the same scale in both directions so the curve is not distorted
+  const double span = std::max(xmax - xmin, ymax - ymin);
+  const double cells = static_cast<double>((1U << c_curveBits) - 1);
+  const double scale = span > 0.0 ? cells / span : 0.0;
+
+  std::vector<std::pair<uint64_t, size_t>> keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    const auto qx = static_cast<uint32_t>((x[i] - xmin) * scale);
+    const auto qy = static_cast<uint32_t>((y[i] - ymin) * scale);
+    keys[i].first = curve == Hilbert ? SpaceFillingCurve::hilbert(qx, qy)
+                                     : SpaceFillingCurve::morton(qx, qy);
+    keys[i].second = i;
+  }
+  std::sort(keys.begin(), keys.end());
+
+  for (size_t i = 0; i < n; ++i) {
+    idx[i] = keys[i].second;
+  }
+  return idx;
+}
@@ -0,0 +1,56 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_SPACEFILLINGCURVE_H
+#define ADCMOD_SPACEFILLINGCURVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class SpaceFillingCurve
+ * @author Zachary Cobell
+ * @brief Orders two dimensional points along a space filling curve
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Points that are close together along a Morton (z-order) or Hilbert curve
+ * are also close together in space. Processing points in curve order keeps
+ * the working set of spatial lookups (raster tiles, search tree nodes) small.
+ *
+ */
+class SpaceFillingCurve {
+ public:
+  enum Curve { Morton, Hilbert };
+
+  static uint64_t morton(uint32_t x, uint32_t y);
+  static uint64_t hilbert(uint32_t x, uint32_t y);
+
+  static std::vector<size_t> order(const std::vector<double> &x,
+                                   const std::vector<double> &y,
+                                   Curve curve = Hilbert);
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_SPACEFILLINGCURVE_H
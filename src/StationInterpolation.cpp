@@ -18,6 +18,8 @@
 //------------------------------------------------------------------------*/
 #include "StationInterpolation.h"
 
+#include <algorithm>
+
 #include "Constants.h"
 #include "FPCompare.h"
 #include "FileIO.h"
@@ -28,6 +30,10 @@
 
 using namespace Adcirc::Output;
 
+//...Largest number of values held in memory for each component of the
+//   station time series while interpolating
+static constexpr size_t c_maxTimeseriesValues = 16777216;
+
 StationInterpolation::StationInterpolation(
     const StationInterpolationOptions &options)
     : m_options(options) {}
@@ -53,14 +59,34 @@ void StationInterpolation::run() {
 
   size_t nsnap = this->m_options.endsnap() - this->m_options.startsnap() + 1;
 
+  //...Only the nodes used by the stations are read from the file, in blocks
+  //   of snaps that bound the memory used by the time series. Time series
+  //   cannot be read from max files, which are read one record at a time
+  std::vector<size_t> nodes = this->timeseriesNodes();
+
   ProgressBar progress_bar(nsnap);
   progress_bar.begin();
 
-  for (size_t i = this->m_options.startsnap(); i <= this->m_options.endsnap();
-       ++i) {
-    this->interpolateTimeSnapToStations(i, writeVector, coldstart, globalFile);
-    progress_bar.tick();
-    globalFile.clearAt(0);
+  if (globalFile.metadata()->isMax() || nodes.empty()) {
+    for (size_t i = this->m_options.startsnap();
+         i <= this->m_options.endsnap(); ++i) {
+      Adcirc::Output::OutputTimeseries data =
+          StationInterpolation::readSnap(globalFile, nodes, i);
+      this->interpolateTimeSnapToStations(data, 0, writeVector, coldstart);
+      progress_bar.tick();
+    }
+  } else {
+    const size_t blockSize =
+        std::max<size_t>(1, c_maxTimeseriesValues / nodes.size());
+    for (size_t s0 = 0; s0 < nsnap; s0 += blockSize) {
+      const size_t nb = std::min(blockSize, nsnap - s0);
+      Adcirc::Output::OutputTimeseries data = globalFile.readTimeseries(
+          nodes, this->m_options.startsnap() - 1 + s0, nb);
+      for (size_t i = 0; i < nb; ++i) {
+        this->interpolateTimeSnapToStations(data, i, writeVector, coldstart);
+        progress_bar.tick();
+      }
+    }
   }
   progress_bar.end();
 
@@ -92,40 +118,39 @@ Adcirc::Geometry::Mesh StationInterpolation::readMesh(
 
 void StationInterpolation::generateInterpolationWeights(
     Adcirc::Geometry::Mesh &m) {
-  m.buildElementalSearchTree();
   size_t nFound = 0;
   Hmdf *stn = this->m_options.stations();
 
   this->m_weights.resize(stn->nstations());
 
+  std::vector<double> x(stn->nstations()), y(stn->nstations());
   for (size_t i = 0; i < stn->nstations(); ++i) {
-    std::vector<double> wt;
-    double x1 = stn->station(i)->longitude();
-    double y1 = stn->station(i)->latitude();
-    double x2 = 0.0;
-    double y2 = 0.0;
+    x[i] = stn->station(i)->longitude();
+    y[i] = stn->station(i)->latitude();
+  }
 
-    if (this->m_options.epsgStation() != this->m_options.epsgGlobal()) {
-      bool isLatLon;
-      Adcirc::Projection::transform(this->m_options.epsgStation(),
-                                    this->m_options.epsgGlobal(), x1, y1, x2,
-                                    y2, isLatLon);
-    } else {
-      x2 = x1;
-      y2 = y1;
-    }
+  if (this->m_options.epsgStation() != this->m_options.epsgGlobal()) {
+    bool isLatLon;
+    std::vector<double> xin(x), yin(y);
+    Adcirc::Projection::transform(this->m_options.epsgStation(),
+                                  this->m_options.epsgGlobal(), xin, yin, x, y,
+                                  isLatLon);
+  }
 
-    size_t eidx = m.findElement(x2, y2, wt);
+  std::vector<double> wt;
+  std::vector<size_t> eidx = m.findElements(x, y, wt);
 
-    if (eidx == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
+  for (size_t i = 0; i < stn->nstations(); ++i) {
+    if (eidx[i] == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
       this->m_weights[i].found = false;
     } else {
       nFound++;
+      this->m_weights[i].found = true;
       for (size_t j = 0; j < 3; ++j) {
-        this->m_weights[i].found = true;
         this->m_weights[i].node_index[j] =
-            m.nodeIndexById(m.element(eidx)->node(j)->id());
-        this->m_weights[i].weight[j] = wt[j];
+            m.nodeIndexById(m.element(eidx[i])->node(j)->id());
+        this->m_weights[i].weight[j] =
+            wt[i * Adcirc::Geometry::Mesh::MAX_NODES_PER_ELEMENT + j];
       }
     }
   }
@@ -178,38 +203,90 @@ Adcirc::CDate StationInterpolation::getColdstartDate() {
   return Adcirc::CDate(1970, 1, 1, 0, 0, 0);
 }
 
+/**
+ * @brief Returns the nodes used to interpolate to the stations and sets the
+ * weights used with the time series read at those nodes
+ * @return zero based node indices, each listed once
+ */
+std::vector<size_t> StationInterpolation::timeseriesNodes() {
+  std::vector<size_t> nodes;
+  for (const auto &w : this->m_weights) {
+    if (!w.found) continue;
+    nodes.insert(nodes.end(), w.node_index.begin(), w.node_index.end());
+  }
+  std::sort(nodes.begin(), nodes.end());
+  nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+  this->m_timeseriesWeights = this->m_weights;
+  for (auto &w : this->m_timeseriesWeights) {
+    if (!w.found) continue;
+    for (auto &n : w.node_index) {
+      n = std::lower_bound(nodes.begin(), nodes.end(), n) - nodes.begin();
+    }
+  }
+  return nodes;
+}
+
+/**
+ * @brief Reads a single record of a file at a set of nodes
+ * @param[in] file file to read
+ * @param[in] nodes zero based node indices
+ * @param[in] snap one based snap number
+ * @return time series holding the single record
+ */
+Adcirc::Output::OutputTimeseries StationInterpolation::readSnap(
+    Adcirc::Output::ReadOutput &file, const std::vector<size_t> &nodes,
+    const size_t snap) {
+  file.read(snap - 1);
+  const Adcirc::Output::OutputRecord *record = file.dataAt(0);
+  const bool isVector = file.metadata()->isVector();
+  Adcirc::Output::OutputTimeseries data(nodes, snap - 1, 1, isVector ? 2 : 1,
+                                        file.defaultValue());
+  data.setTime(0, record->time());
+  data.setIteration(0, record->iteration());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (isVector) {
+      data.data(0)[i] = record->u(nodes[i]);
+      data.data(1)[i] = record->v(nodes[i]);
+    } else {
+      data.data(0)[i] = record->z(nodes[i]);
+    }
+  }
+  file.clearAt(0);
+  return data;
+}
+
 void StationInterpolation::interpolateTimeSnapToStations(
-    const size_t snap, const bool writeVector, const Adcirc::CDate &coldstart,
-    Adcirc::Output::ReadOutput &globalFile) {
-  globalFile.read(snap - 1);
-  auto adcircTime = globalFile.dataAt(0)->time();
-  auto adcircIt = globalFile.dataAt(0)->iteration();
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const bool writeVector, const Adcirc::CDate &coldstart) {
+  auto adcircTime = data.time(snap);
+  auto adcircIt = data.iteration(snap);
   Adcirc::CDate d = coldstart + adcircTime;
   Hmdf *stationData = this->m_options.stations();
 
   for (size_t j = 0; j < stationData->nstations(); ++j) {
-    if (this->m_weights[j].found) {
+    if (this->m_timeseriesWeights[j].found) {
       if (writeVector) {
         stationData->station(j)->setNext(
             d, Adcirc::Output::StationInterpolation::interpVector(
-                   globalFile, this->m_weights[j]));
+                   data, snap, this->m_timeseriesWeights[j]));
       } else {
         if (this->m_options.hasPositiveDirection()) {
           stationData->station(j)->setNext(
               d, this->interpScalar(
-                     globalFile, this->m_weights[j],
+                     data, snap, this->m_timeseriesWeights[j],
                      this->m_options.station(j)->positiveDirection()));
         } else {
           stationData->station(j)->setNext(
-              d, this->interpScalar(globalFile, this->m_weights[j]));
+              d, this->interpScalar(data, snap, this->m_timeseriesWeights[j]));
         }
       }
     } else {
       if (writeVector) {
-        stationData->station(j)->setNext(d, globalFile.defaultValue(),
-                                         globalFile.defaultValue());
+        stationData->station(j)->setNext(d, data.defaultValue(),
+                                         data.defaultValue());
       } else {
-        stationData->station(j)->setNext(d, globalFile.defaultValue());
+        stationData->station(j)->setNext(d, data.defaultValue());
       }
     }
     auto file_position = stationData->station(j)->numSnaps() - 1;
@@ -218,32 +295,61 @@ void StationInterpolation::interpolateTimeSnapToStations(
   }
 }
 
+/**
+ * @brief Interpolates the most recently read record of a file to a location
+ * @param[in] data file with at least one record read
+ * @param[in] w interpolation weights with indices of the nodes in the mesh
+ * @param[in] positive_direction positive flow direction in degrees, or -9999
+ * if not specified
+ * @return interpolated value
+ */
 double StationInterpolation::interpScalar(Adcirc::Output::ReadOutput &data,
                                           Weight &w,
                                           const double positive_direction) {
+  const bool isVector = data.metadata()->isVector();
+  std::vector<size_t> nodes(w.node_index.begin(), w.node_index.end());
+  Adcirc::Output::OutputTimeseries values(nodes, 0, 1, isVector ? 2 : 1,
+                                          data.defaultValue());
+  Weight local = w;
+  for (size_t i = 0; i < 3; ++i) {
+    local.node_index[i] = i;
+    if (isVector) {
+      values.data(0)[i] = data.dataAt(0)->u(w.node_index[i]);
+      values.data(1)[i] = data.dataAt(0)->v(w.node_index[i]);
+    } else {
+      values.data(0)[i] = data.dataAt(0)->z(w.node_index[i]);
+    }
+  }
+  return this->interpScalar(values, 0, local, positive_direction);
+}
+
+double StationInterpolation::interpScalar(
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w, const double positive_direction) {
   if (this->m_options.angle()) {
-    if (data.metadata()->isVector()) {
+    if (data.dimension() > 1) {
       adcircmodules_throw_exception(
           "Vector data supplied when a scalar angle was expected");
     }
-    return Adcirc::Output::StationInterpolation::interpAngle(data, w);
-  } else if (data.metadata()->isVector()) {
-    return this->interpScalarFromVector(data, w, positive_direction);
+    return Adcirc::Output::StationInterpolation::interpAngle(data, snap, w);
+  } else if (data.dimension() > 1) {
+    return this->interpScalarFromVector(data, snap, w, positive_direction);
   } else {
     return Adcirc::Output::StationInterpolation::interpolateDryValues(
-        data.dataAt(0)->z(w.node_index[0]), w.weight[0],
-        data.dataAt(0)->z(w.node_index[1]), w.weight[1],
-        data.dataAt(0)->z(w.node_index[2]), w.weight[2], data.defaultValue());
+        data.z(snap, w.node_index[0]), w.weight[0],
+        data.z(snap, w.node_index[1]), w.weight[1],
+        data.z(snap, w.node_index[2]), w.weight[2], data.defaultValue());
   }
 }
 
-double StationInterpolation::interpAngle(Adcirc::Output::ReadOutput &data,
-                                         Weight &w) {
+double StationInterpolation::interpAngle(
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w) {
   using namespace Adcirc::FpCompare;
   std::array<double, 3> vx{0, 0, 0};
   std::array<double, 3> vy{0, 0, 0};
   for (size_t i = 0; i < 3; ++i) {
-    auto v = data.dataAt(0)->z(w.node_index[i]);
+    auto v = data.z(snap, w.node_index[i]);
     if (equalTo(v, data.defaultValue())) {
       vx[i] = data.defaultValue();
       vy[i] = data.defaultValue();
@@ -268,12 +374,13 @@ double StationInterpolation::interpAngle(Adcirc::Output::ReadOutput &data,
 }
 
 std::tuple<double, double> StationInterpolation::interpVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w) {
   std::array<double, 3> vx{0, 0, 0};
   std::array<double, 3> vy{0, 0, 0};
   for (auto i = 0; i < 3; ++i) {
-    vx[i] = data.dataAt(0)->u(w.node_index[i]);
-    vy[i] = data.dataAt(0)->v(w.node_index[i]);
+    vx[i] = data.u(snap, w.node_index[i]);
+    vy[i] = data.v(snap, w.node_index[i]);
   }
   double vxx = StationInterpolation::interpolateDryValues(
       vx[0], w.weight[0], vx[1], w.weight[1], vx[2], w.weight[2],
@@ -285,11 +392,11 @@ std::tuple<double, double> StationInterpolation::interpVector(
 }
 
 double StationInterpolation::interpScalarFromVectorWithFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w, const double positive_direction) {
   using namespace Adcirc::FpCompare;
   double vx, vy;
-  std::tie(vx, vy) = StationInterpolation::interpVector(data, w);
+  std::tie(vx, vy) = StationInterpolation::interpVector(data, snap, w);
   if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
     return data.defaultValue();
   }
@@ -307,19 +414,21 @@ double StationInterpolation::interpScalarFromVectorWithFlowDirection(
 }
 
 double StationInterpolation::interpScalarFromVectorWithoutFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w) {
   return StationInterpolation::interpolateDryValues(
-      data.dataAt(0)->magnitude(w.node_index[0]), w.weight[0],
-      data.dataAt(0)->magnitude(w.node_index[1]), w.weight[1],
-      data.dataAt(0)->magnitude(w.node_index[2]), w.weight[2],
+      data.magnitude(snap, w.node_index[0]), w.weight[0],
+      data.magnitude(snap, w.node_index[1]), w.weight[1],
+      data.magnitude(snap, w.node_index[2]), w.weight[2],
       data.defaultValue());
 }
 
 double StationInterpolation::interpDirectionFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w) {
   using namespace Adcirc::FpCompare;
   double vx, vy;
-  std::tie(vx, vy) = StationInterpolation::interpVector(data, w);
+  std::tie(vx, vy) = StationInterpolation::interpVector(data, snap, w);
   if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
     return data.defaultValue();
   } else {
@@ -328,18 +437,18 @@ double StationInterpolation::interpDirectionFromVector(
 }
 
 double StationInterpolation::interpScalarFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
+    const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+    const Weight &w, const double positive_direction) {
   using namespace Adcirc::FpCompare;
   if (this->m_options.magnitude() && equalTo(positive_direction, -9999.0)) {
     return StationInterpolation::interpScalarFromVectorWithoutFlowDirection(
-        data, w);
+        data, snap, w);
   } else if (this->m_options.magnitude() &&
              !equalTo(positive_direction, -9999.0)) {
     return StationInterpolation::interpScalarFromVectorWithFlowDirection(
-        data, w, positive_direction);
+        data, snap, w, positive_direction);
   } else if (this->m_options.direction()) {
-    return StationInterpolation::interpDirectionFromVector(data, w);
+    return StationInterpolation::interpDirectionFromVector(data, snap, w);
   } else {
     adcircmodules_throw_exception(
         "Cannot write vector data. Select --magnitude or --direction");
@@ -23,11 +23,13 @@
 #include <limits>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "AdcircModules_Global.h"
 #include "CDate.h"
 #include "Hmdf.h"
 #include "Mesh.h"
+#include "OutputTimeseries.h"
 #include "ReadOutput.h"
 #include "StationInterpolationOptions.h"
 
@@ -63,27 +65,41 @@ class StationInterpolation {
   Adcirc::Output::Hmdf copyStationList(Adcirc::Output::Hmdf &list,
                                        const bool vector = false);
 
-  void interpolateTimeSnapToStations(const size_t snap, const bool writeVector,
-                                     const CDate &coldstart,
-                                     Adcirc::Output::ReadOutput &globalFile);
-  double interpScalarFromVector(Adcirc::Output::ReadOutput &data, Weight &w,
+  std::vector<size_t> timeseriesNodes();
+  static Adcirc::Output::OutputTimeseries readSnap(
+      Adcirc::Output::ReadOutput &file, const std::vector<size_t> &nodes,
+      const size_t snap);
+  void interpolateTimeSnapToStations(
+      const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+      const bool writeVector, const CDate &coldstart);
+  double interpScalar(const Adcirc::Output::OutputTimeseries &data,
+                      const size_t snap, const Weight &w,
+                      const double positive_direction = -9999.0);
+  double interpScalarFromVector(const Adcirc::Output::OutputTimeseries &data,
+                                const size_t snap, const Weight &w,
                                 const double positive_direction = -9999.0);
   static double interpScalarFromVectorWithoutFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w);
+      const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+      const Weight &w);
   static double interpScalarFromVectorWithFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w,
-      const double positive_direction);
-  static double interpDirectionFromVector(Adcirc::Output::ReadOutput &data, Weight &w);
-  static double interpAngle(Adcirc::Output::ReadOutput &data,Weight &w);
+      const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+      const Weight &w, const double positive_direction);
+  static double interpDirectionFromVector(
+      const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+      const Weight &w);
+  static double interpAngle(const Adcirc::Output::OutputTimeseries &data,
+                            const size_t snap, const Weight &w);
 
   static std::tuple<double, double> interpVector(
-      Adcirc::Output::ReadOutput &data, Weight &w);
+      const Adcirc::Output::OutputTimeseries &data, const size_t snap,
+      const Weight &w);
   void allocateStationArrays();
   void generateInterpolationWeights(Adcirc::Geometry::Mesh &m);
 
   static CDate dateFromString(const std::string &dateString);
 
   std::vector<Weight> m_weights;
+  std::vector<Weight> m_timeseriesWeights;
   Adcirc::Output::StationInterpolationOptions m_options;
 };
 
@@ -26,12 +26,16 @@
 
 #include "WriteOutput.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 
 #include "AdcircOutputfiles.h"
+#include "AsciiWriter.h"
+#include "FileIO.h"
 #include "Formatting.h"
 #include "Logging.h"
+#include "NetcdfBlockWriter.h"
 #include "hdf5.h"
 #include "netcdf.h"
 
@@ -49,7 +53,33 @@ WriteOutput::WriteOutput(const std::string &filename,
 }
 
 WriteOutput::~WriteOutput() {
-  if (this->m_isOpen) this->close();
+  if (this->m_isOpen) {
+    try {
+      this->close();
+    } catch (const std::exception &e) {
+      Adcirc::Logging::logError(e.what());
+    }
+  }
+}
+
+/**
+ * @brief Options used when writing netCDF files
+ */
+NetcdfWriteOptions WriteOutput::netcdfOptions() const {
+  return this->m_netcdfOptions;
+}
+
+/**
+ * @brief Sets the storage and compression options used when writing netCDF
+ * files. Must be called before the file is opened.
+ * @param[in] options netCDF write options
+ */
+void WriteOutput::setNetcdfOptions(const NetcdfWriteOptions &options) {
+  if (this->m_isOpen) {
+    adcircmodules_throw_exception(
+        "WriteOutput: Options cannot be changed after the file is opened");
+  }
+  this->m_netcdfOptions = options;
 }
 
 void WriteOutput::open() {
@@ -70,8 +100,30 @@ void WriteOutput::close() {
     if (this->m_fid.is_open()) this->m_fid.close();
   } else if (this->m_format == Adcirc::Output::OutputNetcdf4 ||
              this->m_format == Adcirc::Output::OutputNetcdf3) {
-    nc_close(this->m_ncid);
+    std::unique_ptr<Adcirc::Private::NetcdfBlockWriter> writer =
+        std::move(this->m_netcdfWriter);
+    this->m_isOpen = false;
+
+    //...The writer thread takes the netCDF mutex, so it is not held until
+    //   the writer has finished
+    auto closeFile = [this]() {
+      std::lock_guard<std::recursive_mutex> lock(
+          Adcirc::FileIO::Netcdf::libraryMutex());
+      nc_close(this->m_ncid);
+    };
+    if (writer != nullptr) {
+      try {
+        writer->finish();
+      } catch (const std::exception &) {
+        writer.reset();
+        closeFile();
+        throw;
+      }
+    }
+    closeFile();
   } else if (this->m_format == Adcirc::Output::OutputHdf5) {
+    std::lock_guard<std::recursive_mutex> lock(
+        Adcirc::FileIO::Netcdf::libraryMutex());
     H5Fclose(this->m_h5fid);
   }
   this->m_isOpen = false;
@@ -158,12 +210,57 @@ int WriteOutput::defineNetcdfVariable(int dimid_node, const int *dims,
   }
 
   if (this->m_format == Adcirc::Output::OutputNetcdf4) {
-    ierr += nc_def_var_deflate(this->m_ncid, varid_v, 1, 1, 2);
+    ierr += this->defineNetcdfStorage(varid_v);
+    if (this->m_netcdfOptions.fillPolicy() == FillNone) {
+      ierr += nc_def_var_fill(this->m_ncid, varid_v, NC_NOFILL, nullptr);
+    }
+    if (!this->m_dataContainer->metadata()->isMax()) {
+      const size_t nn = this->m_mesh != nullptr
+                            ? this->m_mesh->numNodes()
+                            : this->m_dataContainer->numNodes();
+      if (this->m_netcdfOptions.chunkLayout() == ChunkSnapMajor) {
+        const size_t chunks[2] = {1, std::max<size_t>(nn, 1)};
+        ierr += nc_def_var_chunking(this->m_ncid, varid_v, NC_CHUNKED, chunks);
+      } else if (this->m_netcdfOptions.chunkLayout() == ChunkNodeBlocked) {
+        const size_t chunks[2] = {
+            this->m_netcdfOptions.chunkSnaps(),
+            std::max<size_t>(
+                std::min(this->m_netcdfOptions.chunkNodes(), nn), 1)};
+        ierr += nc_def_var_chunking(this->m_ncid, varid_v, NC_CHUNKED, chunks);
+      }
+    }
+    if (this->m_netcdfOptions.significantDigits() > 0) {
+      const int nsd = this->m_netcdfOptions.significantDigits();
+      ierr += nc_put_att_int(this->m_ncid, varid_v,
+                             "number_of_significant_digits", NC_INT, 1, &nsd);
+    }
+  }
+  if (ierr != NC_NOERR) {
+    adcircmodules_throw_exception(
+        "WriteOutput: Error defining netCDF variable");
   }
   return varid_v;
 }
 
+/**
+ * @brief Applies the compression options to a netCDF variable
+ * @param[in] varid variable to compress
+ * @return netCDF error code
+ */
+int WriteOutput::defineNetcdfStorage(int varid) {
+  if (this->m_netcdfOptions.deflateLevel() == 0) {
+    return this->m_netcdfOptions.shuffle()
+               ? nc_def_var_deflate(this->m_ncid, varid, 1, 0, 0)
+               : NC_NOERR;
+  }
+  return nc_def_var_deflate(this->m_ncid, varid,
+                            this->m_netcdfOptions.shuffle() ? 1 : 0, 1,
+                            this->m_netcdfOptions.deflateLevel());
+}
+
 void WriteOutput::openFileNetCDF() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   int ierr = nc_create(this->filename().c_str(), NC_NETCDF4, &this->m_ncid);
   int dimid_time, dimid_node, dimid_ele, dimid_nvertex, dimid_mesh;
 
@@ -195,11 +292,11 @@ void WriteOutput::openFileNetCDF() {
                      &varid_depth);
 
   if (this->m_format == Adcirc::Output::OutputNetcdf4) {
-    ierr += nc_def_var_deflate(this->m_ncid, this->m_varid_time, 1, 1, 2);
-    ierr += nc_def_var_deflate(this->m_ncid, varid_x, 1, 1, 2);
-    ierr += nc_def_var_deflate(this->m_ncid, varid_y, 1, 1, 2);
-    ierr += nc_def_var_deflate(this->m_ncid, varid_depth, 1, 1, 2);
-    ierr += nc_def_var_deflate(this->m_ncid, varid_element, 1, 1, 2);
+    ierr += this->defineNetcdfStorage(this->m_varid_time);
+    ierr += this->defineNetcdfStorage(varid_x);
+    ierr += this->defineNetcdfStorage(varid_y);
+    ierr += this->defineNetcdfStorage(varid_depth);
+    ierr += this->defineNetcdfStorage(varid_element);
   }
 
   if (ierr != NC_NOERR) {
@@ -282,6 +379,11 @@ void WriteOutput::openFileNetCDF() {
     ierr += nc_put_vara_int(m_ncid, varid_element, start, count, n3.data());
   }
 
+  this->m_netcdfWriter = std::make_unique<Adcirc::Private::NetcdfBlockWriter>(
+      this->m_ncid, this->m_varid_time, this->m_varid,
+      this->m_dataContainer->numNodes(),
+      this->m_dataContainer->metadata()->isMax(), fill, this->m_netcdfOptions);
+
   return;
 }
 
@@ -509,6 +611,8 @@ void WriteOutput::h5_defineFiletype() {
 }
 
 void WriteOutput::openFileHdf5() {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   this->m_h5fid = H5Fcreate(this->m_filename.c_str(), H5F_ACC_TRUNC,
                             H5P_DEFAULT, H5P_DEFAULT);
   hid_t gid_dataset = H5Gcreate2(this->m_h5fid, "/Datasets", H5P_DEFAULT,
@@ -532,38 +636,45 @@ void WriteOutput::setFilename(const std::string &filename) {
 
 std::string WriteOutput::filename() const { return this->m_filename; }
 
-void WriteOutput::writeAsciiNodeRecord(size_t i, const OutputRecord *record) {
-  if (this->m_dataContainer->metadata()->dimension() == 1) {
-    this->m_fid << Adcirc::Output::Formatting::adcircScalarLineFormat(
-        i + 1, record->z(i));
-  } else if (this->m_dataContainer->metadata()->dimension() == 2) {
-    if (this->m_dataContainer->metadata()->isMax()) {
-      this->m_fid << Adcirc::Output::Formatting::adcircScalarLineFormat(
-          i + 1, record->z(i));
-    } else {
-      this->m_fid << Adcirc::Output::Formatting::adcircVectorLineFormat(
-          i + 1, record->u(i), record->v(i));
-    }
-  } else if (this->m_dataContainer->metadata()->dimension() == 3) {
-    this->m_fid << Adcirc::Output::Formatting::adcirc3dLineFormat(
-        i + 1, record->u(i), record->v(i), record->w(i));
+void WriteOutput::writeAsciiNodeRecords(const OutputRecord *record,
+                                        bool sparse) {
+  Adcirc::Private::AsciiWriter writer(this->m_fid);
+  const size_t dimension = this->m_dataContainer->metadata()->dimension();
+  const bool isMax = this->m_dataContainer->metadata()->isMax();
+
+  if (dimension == 1 || (dimension == 2 && isMax)) {
+    writer.writeLines(record->numNodes(), [&](char *p, size_t i) {
+      if (sparse && record->isDefault(i)) return p;
+      return Formatting::adcircScalarLine(p, i + 1, record->z(i));
+    });
+  } else if (dimension == 2) {
+    writer.writeLines(record->numNodes(), [&](char *p, size_t i) {
+      if (sparse && record->isDefault(i)) return p;
+      return Formatting::adcircVectorLine(p, i + 1, record->u(i),
+                                          record->v(i));
+    });
+  } else if (dimension == 3) {
+    writer.writeLines(record->numNodes(), [&](char *p, size_t i) {
+      if (sparse && record->isDefault(i)) return p;
+      return Formatting::adcirc3dLine(p, i + 1, record->u(i), record->v(i),
+                                      record->w(i));
+    });
+  }
+
+  //...Max files with a second value (i.e. time of max) write the second value
+  //   as its own block
+  if (isMax && dimension == 2) {
+    writer.writeLines(record->numNodes(), [&](char *p, size_t i) {
+      if (sparse && record->isDefault(i)) return p;
+      return Formatting::adcircScalarLine(p, i + 1, record->v(i));
+    });
   }
-  return;
 }
 
 void WriteOutput::writeRecordAsciiFull(const OutputRecord *record) {
   this->m_fid << Adcirc::Output::Formatting::adcircFullFormatRecordHeader(
       record->time(), record->iteration());
-  for (size_t i = 0; i < record->numNodes(); ++i) {
-    this->writeAsciiNodeRecord(i, record);
-  }
-  if (this->m_dataContainer->metadata()->isMax() &&
-      this->m_dataContainer->metadata()->dimension() == 2) {
-    for (size_t i = 0; i < record->numNodes(); ++i) {
-      this->m_fid << Adcirc::Output::Formatting::adcircScalarLineFormat(
-          i + 1, record->v(i));
-    }
-  }
+  this->writeAsciiNodeRecords(record, false);
   return;
 }
 
@@ -571,49 +682,12 @@ void WriteOutput::writeRecordAsciiSparse(const OutputRecord *record) {
   this->m_fid << Adcirc::Output::Formatting::adcircSparseFormatRecordHeader(
       record->time(), record->iteration(), record->numNonDefault(),
       record->defaultValue());
-  for (size_t i = 0; i < record->numNodes(); ++i) {
-    if (!record->isDefault(i)) {
-      this->writeAsciiNodeRecord(i, record);
-    }
-  }
-  if (this->m_dataContainer->metadata()->isMax() &&
-      this->m_dataContainer->metadata()->dimension() == 2) {
-    for (size_t i = 0; i < record->numNodes(); ++i) {
-      if (!record->isDefault(i)) {
-        this->m_fid << Adcirc::Output::Formatting::adcircScalarLineFormat(
-            i + 1, record->v(i));
-      }
-    }
-  }
+  this->writeAsciiNodeRecords(record, true);
   return;
 }
 
 void WriteOutput::writeRecordNetCDF(const OutputRecord *record) {
-  double t = record->time();
-  nc_put_var1(this->m_ncid, this->m_varid_time, &this->m_recordsWritten, &t);
-
-  const size_t start[2] = {this->m_recordsWritten, 0};
-  const size_t count[2] = {
-      m_dataContainer->metadata()->isMax() ? record->numNodes() : 1,
-      m_dataContainer->metadata()->isMax() ? 1 : record->numNodes()};
-
-  if (this->m_dataContainer->metadata()->dimension() == 1) {
-    nc_put_vara(this->m_ncid, this->m_varid[0], start, count,
-                record->m_u.data());
-  } else if (this->m_dataContainer->metadata()->dimension() == 2) {
-    nc_put_vara(this->m_ncid, this->m_varid[0], start, count,
-                record->m_u.data());
-    nc_put_vara(this->m_ncid, this->m_varid[1], start, count,
-                record->m_v.data());
-  } else if (this->m_dataContainer->metadata()->dimension() == 3) {
-    nc_put_vara(this->m_ncid, this->m_varid[0], start, count,
-                record->m_u.data());
-    nc_put_vara(this->m_ncid, this->m_varid[1], start, count,
-                record->m_v.data());
-    nc_put_vara(this->m_ncid, this->m_varid[2], start, count,
-                record->m_w.data());
-  }
-  return;
+  this->m_netcdfWriter->append(record);
 }
 
 void WriteOutput::h5_appendRecord(const std::string &name,
@@ -788,6 +862,8 @@ void WriteOutput::h5_appendRecord(const std::string &name,
 void WriteOutput::writeRecordHdf5(
     const Adcirc::Output::OutputRecord *recordElevation,
     const Adcirc::Output::OutputRecord *recordVelocity) {
+  std::lock_guard<std::recursive_mutex> lock(
+      Adcirc::FileIO::Netcdf::libraryMutex());
   this->h5_appendRecord("/Datasets/Water Surface Elevation (63)",
                         recordElevation, false);
   if (recordVelocity != nullptr) {
@@ -20,12 +20,19 @@
 #define ADCMOD_WRITEOUTPUT_H
 
 #include <fstream>
+#include <memory>
 
 #include "Mesh.h"
+#include "NetcdfWriteOptions.h"
 #include "OutputRecord.h"
 #include "ReadOutput.h"
 
 namespace Adcirc {
+
+namespace Private {
+class NetcdfBlockWriter;
+}
+
 namespace Output {
 
 /**
@@ -52,19 +59,23 @@ class WriteOutput {
 
   void setFilename(const std::string &filename);
 
+  Adcirc::Output::NetcdfWriteOptions netcdfOptions() const;
+  void setNetcdfOptions(const Adcirc::Output::NetcdfWriteOptions &options);
+
  private:
   void openFileAscii();
   void openFileNetCDF();
   void openFileHdf5();
   int defineNetcdfVariable(int dimid_node, const int *dims, double fill,
                            size_t index);
+  int defineNetcdfStorage(int varid);
 
   void writeRecordAsciiFull(const Adcirc::Output::OutputRecord *record);
   void writeRecordAsciiSparse(const Adcirc::Output::OutputRecord *record);
   void writeRecordNetCDF(const Adcirc::Output::OutputRecord *record);
   void writeRecordHdf5(const Adcirc::Output::OutputRecord *recordElevation,
                        const Adcirc::Output::OutputRecord *recordVelocity);
-  void writeAsciiNodeRecord(size_t i, const OutputRecord *record);
+  void writeAsciiNodeRecords(const OutputRecord *record, bool sparse);
 
   void h5_createDataset(const std::string &name, bool isVector);
   void h5_appendRecord(const std::string &name,
@@ -92,6 +103,8 @@ class WriteOutput {
   int m_varid_time;
   int64_t m_h5fid;
   std::vector<int> m_varid;
+  Adcirc::Output::NetcdfWriteOptions m_netcdfOptions;
+  std::unique_ptr<Adcirc::Private::NetcdfBlockWriter> m_netcdfWriter;
 };
 
 }  // namespace Output
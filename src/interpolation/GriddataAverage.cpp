@@ -26,17 +26,15 @@ GriddataAverage::GriddataAverage(const Adcirc::Raster::Rasterdata *raster,
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataAverage::computeFromRaster() const {
-  const auto values = this->pixelDataInRadius<double>();
-
-  if (values.code() == 0) {
-    double a = 0.0;
-    size_t n = 0;
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        a += v.value();
+  double a = 0.0;
+  size_t n = 0;
+  const bool found = this->forEachPixelInRadius<double>(
+      [&](double, double, double, double z) {
+        a += z;
         n++;
-      }
-    }
+      });
+
+  if (found) {
     return n > 0 ? a / static_cast<double>(n) : this->config()->defaultValue();
   } else {
     return GriddataAverage::methodErrorValue();
@@ -44,19 +42,17 @@ double GriddataAverage::computeFromRaster() const {
 }
 
 double GriddataAverage::computeFromLookup() const {
-  const auto values = this->pixelDataInRadius<int>();
-  if (values.code() == 0) {
-    size_t n = 0;
-    double a = 0.0;
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = this->config()->getKeyValue(v.value());
+  size_t n = 0;
+  double a = 0.0;
+  const bool found =
+      this->forEachPixelInRadius<int>([&](double, double, double, int z) {
+        double zl = this->config()->getKeyValue(z);
         if (zl != this->config()->defaultValue()) {
           a += zl;
           n++;
         }
-      }
-    }
+      });
+  if (found) {
     return (n > 0 ? a / static_cast<double>(n)
                   : GriddataMethod::methodErrorValue());
   } else {
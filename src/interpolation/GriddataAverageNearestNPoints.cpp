@@ -28,19 +28,14 @@ GriddataAverageNearestNPoints::GriddataAverageNearestNPoints(
 double GriddataAverageNearestNPoints::computeFromRaster() const {
   const auto maxPoints = static_cast<size_t>(attribute()->filterSize());
   const double w = this->calculateExpansionLevelForPoints(maxPoints);
-  const auto values = this->pixelDataInSpecifiedRadius<double>(w);
 
-  if (values.code() == 0) {
-    std::vector<std::tuple<double, double>> pts;
-    pts.reserve(values.pixels().size());
-
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        pts.emplace_back(
-            Constants::distance(attribute()->point(), v.location()), v.value());
-      }
-    }
+  static thread_local std::vector<std::tuple<double, double>> pts;
+  pts.clear();
+  const bool found = this->forEachPixelInSpecifiedRadius<double>(
+      w,
+      [&](double, double, double dis, double z) { pts.emplace_back(dis, z); });
 
+  if (found) {
     if (pts.empty()) return GriddataMethod::methodErrorValue();
 
     size_t np = std::min(pts.size(), maxPoints);
@@ -61,21 +56,18 @@ double GriddataAverageNearestNPoints::computeFromRaster() const {
 double GriddataAverageNearestNPoints::computeFromLookup() const {
   const auto maxPoints = static_cast<size_t>(attribute()->filterSize());
   const double w = this->calculateExpansionLevelForPoints(maxPoints);
-  const auto values = this->pixelDataInSpecifiedRadius<int>(w);
-
-  if (values.code() == 0) {
-    std::vector<std::tuple<double, double>> pts;
-    pts.reserve(values.pixels().size());
 
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = config()->getKeyValue(v.value());
+  static thread_local std::vector<std::tuple<double, double>> pts;
+  pts.clear();
+  const bool found = this->forEachPixelInSpecifiedRadius<int>(
+      w, [&](double, double, double dis, int z) {
+        double zl = config()->getKeyValue(z);
         if (zl != config()->defaultValue()) {
-          pts.emplace_back(
-              Constants::distance(attribute()->point(), v.location()), zl);
+          pts.emplace_back(dis, zl);
         }
-      }
-    }
+      });
+
+  if (found) {
     if (pts.empty()) return GriddataMethod::methodErrorValue();
 
     size_t np = std::min(pts.size(), maxPoints);
@@ -27,14 +27,12 @@ GriddataHighest::GriddataHighest(const Adcirc::Raster::Rasterdata *raster,
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataHighest::computeFromRaster() const {
-  const auto values = this->pixelDataInRadius<double>();
-  if (values.code() == 0) {
-    double zm = -std::numeric_limits<double>::max();
-    for (const auto &v : values.pixels()) {
-      if (v.valid() && v.value() > zm) {
-        zm = v.value();
-      }
-    }
+  double zm = -std::numeric_limits<double>::max();
+  const bool found = this->forEachPixelInRadius<double>(
+      [&](double, double, double, double z) {
+        if (z > zm) zm = z;
+      });
+  if (found) {
     return zm == -std::numeric_limits<double>::max()
                ? GriddataMethod::methodErrorValue()
                : zm;
@@ -44,19 +42,17 @@ double GriddataHighest::computeFromRaster() const {
 }
 
 double GriddataHighest::computeFromLookup() const {
-  const auto values = this->pixelDataInRadius<int>();
-  if (values.code() == 0) {
-    double zm = -std::numeric_limits<double>::max();
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = config()->getKeyValue(v.value());
+  double zm = -std::numeric_limits<double>::max();
+  const bool found =
+      this->forEachPixelInRadius<int>([&](double, double, double, int z) {
+        double zl = config()->getKeyValue(z);
         if (zl != config()->defaultValue()) {
           if (zl > zm) {
             zm = zl;
           }
         }
-      }
-    }
+      });
+  if (found) {
     return zm != -std::numeric_limits<double>::max()
                ? zm
                : GriddataMethod::methodErrorValue();
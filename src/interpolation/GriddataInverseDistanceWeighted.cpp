@@ -26,41 +26,34 @@ GriddataInverseDistanceWeighted::GriddataInverseDistanceWeighted(
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataInverseDistanceWeighted::computeFromRaster() const {
-  const auto values = this->pixelDataInRadius<double>();
-  if (values.code() == 0) {
-    double n = 0.0;
-    double d = 0.0;
-    size_t num = 0;
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double dis = Constants::distance(attribute()->point(), v.location());
-        n += v.value() / dis;
+  double n = 0.0;
+  double d = 0.0;
+  size_t num = 0;
+  const bool found = this->forEachPixelInRadius<double>(
+      [&](double, double, double dis, double z) {
+        n += z / dis;
         d += 1 / dis;
         num++;
-      }
-    }
+      });
+  if (found) {
     return num > 0 ? n / d : GriddataMethod::methodErrorValue();
   }
   return GriddataMethod::methodErrorValue();
 }
 
 double GriddataInverseDistanceWeighted::computeFromLookup() const {
-  const auto values = this->pixelDataInRadius<int>();
-  if (values.code() == 0) {
-    double n = 0.0;
-    double d = 0.0;
-    size_t num = 0;
-
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = config()->getKeyValue(v.value());
+  double n = 0.0;
+  double d = 0.0;
+  size_t num = 0;
+  const bool found =
+      this->forEachPixelInRadius<int>([&](double, double, double dis, int z) {
+        double zl = config()->getKeyValue(z);
         if (zl != config()->defaultValue()) {
-          double dis = Constants::distance(attribute()->point(), v.location());
           n += zl / dis;
           d += 1.0 / dis;
         }
-      }
-    }
+      });
+  if (found) {
     return num > 0 ? n / d : GriddataMethod::methodErrorValue();
   }
   return GriddataMethod::methodErrorValue();
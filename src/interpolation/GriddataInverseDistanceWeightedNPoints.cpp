@@ -29,19 +29,15 @@ GriddataInverseDistanceWeightedNPoints::GriddataInverseDistanceWeightedNPoints(
 double GriddataInverseDistanceWeightedNPoints::computeFromRaster() const {
   const auto maxPoints = static_cast<size_t>(attribute()->filterSize());
   const double w = this->calculateExpansionLevelForPoints(maxPoints);
-  const auto values = this->pixelDataInSpecifiedRadius<double>(w);
 
-  if (values.code() == 0) {
-    std::vector<std::tuple<double, double>> pts;
-    pts.reserve(maxPoints);
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        pts.emplace_back(
-            Constants::distance(attribute()->point(), v.location()), v.value());
-      }
-      if (pts.size() == maxPoints) break;
-    }
+  static thread_local std::vector<std::tuple<double, double>> pts;
+  pts.clear();
+  const bool found = this->forEachPixelInSpecifiedRadius<double>(
+      w, [&](double, double, double dis, double z) {
+        if (pts.size() < maxPoints) pts.emplace_back(dis, z);
+      });
 
+  if (found) {
     return pts.empty() ? GriddataMethod::methodErrorValue()
                        : GriddataInverseDistanceWeightedNPoints::
                              computeInverseDistanceValue(pts, maxPoints);
@@ -52,22 +48,19 @@ double GriddataInverseDistanceWeightedNPoints::computeFromRaster() const {
 double GriddataInverseDistanceWeightedNPoints::computeFromLookup() const {
   const auto maxPoints = static_cast<size_t>(attribute()->filterSize());
   const double w = this->calculateExpansionLevelForPoints(maxPoints);
-  const auto values = this->pixelDataInSpecifiedRadius<int>(w);
 
-  if (values.code() == 0) {
-    std::vector<std::tuple<double, double>> pts;
-    pts.reserve(maxPoints);
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = config()->getKeyValue(v.value());
+  static thread_local std::vector<std::tuple<double, double>> pts;
+  pts.clear();
+  const bool found = this->forEachPixelInSpecifiedRadius<int>(
+      w, [&](double, double, double dis, int z) {
+        if (pts.size() == maxPoints) return;
+        double zl = config()->getKeyValue(z);
         if (zl != config()->defaultValue()) {
-          pts.emplace_back(
-              Constants::distance(attribute()->point(), v.location()), zl);
+          pts.emplace_back(dis, zl);
         }
-      }
-      if (pts.size() == maxPoints) break;
-    }
+      });
 
+  if (found) {
     return pts.empty() ? GriddataMethod::methodErrorValue()
                        : GriddataInverseDistanceWeightedNPoints::
                              computeInverseDistanceValue(pts, maxPoints);
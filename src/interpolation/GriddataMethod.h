@@ -22,15 +22,17 @@
 
 #include <cassert>
 #include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "Constants.h"
 #include "GriddataAttribute.h"
 #include "GriddataConfig.h"
 #include "Logging.h"
-#include "PixelValueVector.h"
 #include "Point.h"
 #include "RasterData.h"
+#include "RasterWindow.h"
 
 namespace Adcirc {
 namespace Private {
@@ -68,74 +70,70 @@ class GriddataMethod {
     return std::vector<double>(12, config()->defaultValue());
   }
 
-  template <typename T>
-  Adcirc::PixelValueVector<T> pixelDataInSpecifiedRadius(double radius) const {
+  /**
+   * @brief Visits each valid raster pixel within a radius of the query point
+   * @param radius search radius
+   * @param f function called as f(x, y, distance, value) for each pixel that
+   * is not nodata, lies within the radius and passes the threshold test.
+   * Pixels are visited in row-major order.
+   * @return true if any pixel that is not nodata lies within the radius
+   *
+   * Values are read through a view of the raster so no per-pixel storage is
+   * allocated
+   */
+  template <typename T, typename F>
+  bool forEachPixelInSpecifiedRadius(double radius, F &&f) const {
+    const Adcirc::Point p = attribute()->point();
     Adcirc::Raster::Pixel ul, lr;
-    this->m_raster->searchBoxAroundPoint(
-        attribute()->point().x(), attribute()->point().y(), radius, ul, lr);
-
-    if (ul.isValid() && lr.isValid()) {
-      auto values = m_raster->pixelValues<T>(ul.i(), ul.j(), lr.i(), lr.j());
-      int outCode = 1;
-      for (auto &v : values.pixels()) {
-        if (v.valid()) {
-          if (Adcirc::Constants::distance(attribute()->point(), v.location()) >
-              radius) {
-            v.setValid(false);
-          } else {
-            outCode = 0;
-          }
-        }
-      }
-      values.setCode(outCode);
+    this->m_raster->searchBoxAroundPoint(p.x(), p.y(), radius, ul, lr);
+    if (!ul.isValid() || !lr.isValid()) return false;
+
+    Adcirc::Raster::RasterWindow<T> w;
+    if (!m_raster->window<T>(ul.i(), ul.j(), lr.i(), lr.j(), w)) return false;
 
-      if (this->config()->thresholdMethod() !=
-          Interpolation::Threshold::NoThreshold) {
-        this->thresholdData(values);
+    const bool threshold = this->config()->thresholdMethod() !=
+                           Interpolation::Threshold::NoThreshold;
+    if (threshold && std::is_same<T, int>::value) {
+      adcircmodules_throw_exception(
+          "Cannot use thresholding and integer rasters");
+    }
+
+    const T nodata = m_raster->nodata<T>();
+    bool found = false;
+    for (size_t j = w.jbegin(); j <= w.jend(); ++j) {
+      const double y = w.y(j);
+      const T *row = w.row(j);
+      for (size_t i = w.ibegin(); i <= w.iend(); ++i) {
+        const T z = row[i - w.ibegin()];
+        if (z == nodata) continue;
+        const double x = w.x(i);
+        const double d = Adcirc::Constants::distance(p, x, y);
+        if (d > radius) continue;
+        found = true;
+        if (threshold && this->isThresholded(z)) continue;
+        f(x, y, d, z);
       }
-      return values;
     }
-    return PixelValueVector<T>();
+    return found;
   }
 
-  template <typename T>
-  Adcirc::PixelValueVector<T> pixelDataInRadius() const {
-    return this->pixelDataInSpecifiedRadius<T>(attribute()->queryResolution());
+  template <typename T, typename F>
+  bool forEachPixelInRadius(F &&f) const {
+    return this->forEachPixelInSpecifiedRadius<T>(
+        attribute()->queryResolution(), std::forward<F>(f));
   }
 
-  template <typename T>
-  void thresholdData(Adcirc::PixelValueVector<T> &values) const {
-    if (std::is_same<T, int>::value)
-      adcircmodules_throw_exception(
-          "Cannot use thresholding and integer rasters");
-
-    if (this->config()->thresholdMethod() ==
-        Interpolation::Threshold::NoThreshold)
-      return;
-
+  bool isThresholded(double value) const {
+    const double zz = value * this->config()->rasterMultiplier() +
+                      this->config()->datumShift();
     if (this->config()->thresholdMethod() ==
         Interpolation::Threshold::ThresholdAbove) {
-      for (auto &v : values.pixels()) {
-        if (!v.valid()) continue;
-        auto zz = v.value() * this->config()->rasterMultiplier() +
-                  this->config()->datumShift();
-        if (zz < this->config()->thresholdValue()) {
-          v.setValue(this->config()->defaultValue());
-          v.setValid(false);
-        }
-      }
+      return zz < this->config()->thresholdValue();
     } else if (this->config()->thresholdMethod() ==
                Interpolation::Threshold::ThresholdBelow) {
-      for (auto &v : values.pixels()) {
-        if (!v.valid()) continue;
-        auto zz = v.value() * this->config()->rasterMultiplier() +
-                  this->config()->datumShift();
-        if (zz > this->config()->thresholdValue()) {
-          v.setValue(this->config()->defaultValue());
-          v.setValid(false);
-        }
-      }
+      return zz > this->config()->thresholdValue();
     }
+    return false;
   }
 
   double calculateExpansionLevelForPoints(size_t n) const {
@@ -26,15 +26,11 @@ GriddataStandardDeviation::GriddataStandardDeviation(
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataStandardDeviation::computeFromRaster() const {
-  const auto values = this->pixelDataInRadius<double>();
-  if (values.code() == 0) {
-    std::vector<double> z2;
-    z2.reserve(values.pixels().size());
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        z2.push_back(v.value());
-      }
-    }
+  static thread_local std::vector<double> z2;
+  z2.clear();
+  const bool found = this->forEachPixelInRadius<double>(
+      [&](double, double, double, double z) { z2.push_back(z); });
+  if (found) {
     return GriddataStandardDeviation::doAverageOutsideStandardDeviation(z2,
                                                                         m_n);
   }
@@ -42,19 +38,16 @@ double GriddataStandardDeviation::computeFromRaster() const {
 }
 
 double GriddataStandardDeviation::computeFromLookup() const {
-  const auto values = this->pixelDataInRadius<int>();
-  if (values.code() == 0) {
-    std::vector<double> z2;
-    z2.reserve(values.pixels().size());
-
-    for (const auto &v : values.pixels()) {
-      if (v.valid()) {
-        double zl = config()->getKeyValue(v.value());
+  static thread_local std::vector<double> z2;
+  z2.clear();
+  const bool found =
+      this->forEachPixelInRadius<int>([&](double, double, double, int z) {
+        double zl = config()->getKeyValue(z);
         if (zl != config()->defaultValue()) {
           z2.push_back(zl);
         }
-      }
-    }
+      });
+  if (found) {
     return GriddataStandardDeviation::doAverageOutsideStandardDeviation(z2,
                                                                         m_n);
   }
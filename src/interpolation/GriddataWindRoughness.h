@@ -23,6 +23,7 @@
 #include <array>
 
 #include "GriddataMethod.h"
+#include "WindRoughnessKernel.h"
 
 namespace Adcirc {
 namespace Private {
@@ -41,22 +42,15 @@ class GriddataWindRoughness : public GriddataMethod {
 
   static constexpr double windRadius() { return 10000.0; }
 
-  static constexpr double windSigma() { return 6.0; }
+  static constexpr double windSigma() {
+    return WindRoughnessKernel::windSigma();
+  }
 
  private:
-  static void computeWeightedDirectionalWindValues(
-      const std::array<double, 12> &weight, std::vector<double> &wind,
-      double nearWeight);
-
-  static std::tuple<bool, double, char> computeWindDirectionAndWeight(
-      const Point &p1, const Point &p2);
+  using KernelBins = std::array<double, WindRoughnessKernel::numBins()>;
 
-  static double gaussian(double distance);
-
-  template <typename T>
-  static int sgn(T val) {
-    return (T(0) < val) - (val < T(0));
-  }
+  static std::vector<double> computeWeightedDirectionalWindValues(
+      const KernelBins &weight, const KernelBins &wind);
 };
 
 }  // namespace Private
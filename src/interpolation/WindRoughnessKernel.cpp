@@ -0,0 +1,508 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "WindRoughnessKernel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "Constants.h"
+
+//...The vector kernels are compiled using function level target attributes
+//   so that the rest of the library is not built with instructions that the
+//   processor may not support. They are only used when the processor reports
+//   support at runtime.
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ADCMOD_WIND_KERNEL_X86 1
+#include <immintrin.h>
+#else
+#define ADCMOD_WIND_KERNEL_X86 0
+#endif
+
+using namespace Adcirc::Private;
+
+// This is a very fast approximation to the exp function. But it is only an
+// approximation. exp is ~15% of the computational time required when computing
+// directional wind reduction, so you can get some gains. The results are
+// different but not substantially
+template <typename T>
+T fast_exp(const T x) noexcept {
+  if (std::is_same<T, float>()) {
+    constexpr auto v0 = double((1 << 20) / M_LN2);
+    constexpr auto v1 = double((1 << 20) * 1023 - 0);
+    union union_exp {
+      double d_;
+      int32_t i_[2];
+      explicit union_exp(int32_t v) : i_{0, v} {}
+    };
+    union_exp uu(v0 * x + v1);
+    return uu.d_;
+  } else if (std::is_same<T, double>()) {
+    constexpr auto v0 = double((int64_t(1) << 52) / M_LN2);
+    constexpr auto v1 = double((int64_t(1) << 52) * 1023 - 0);
+    union union_exp {
+      double d_;
+      int64_t i_;
+      explicit union_exp(int64_t v) : i_{v} {}
+    };
+    union_exp uu(v0 * x + v1);
+    return uu.d_;
+  } else {
+    return T(0);
+  }
+}
+#ifdef ADCMOD_USE_FAST_MATH
+#define griddata_exp fast_exp
+#else
+#define griddata_exp std::exp
+#endif
+
+//...A couple constants used within
+constexpr static double c_rootTwoPi() { return 2.50662827463100024161; }
+constexpr static double c_oneOver2MinusRoot3() {
+  return 1.0 / (2.0 - Adcirc::Constants::root3());
+}
+constexpr static double c_oneOver2PlusRoot3() {
+  return 1.0 / (2.0 + Adcirc::Constants::root3());
+}
+constexpr static double c_epsilon() {
+  return std::numeric_limits<double>::epsilon();
+}
+constexpr static double c_epsilonSquared() { return c_epsilon() * c_epsilon(); }
+constexpr static double c_gaussianScale() {
+  return 1.0 / (WindRoughnessKernel::windSigma() * c_rootTwoPi());
+}
+constexpr static double c_twoWindSigmaSquared() {
+  return 2.0 * WindRoughnessKernel::windSigma() *
+         WindRoughnessKernel::windSigma();
+}
+constexpr static double c_verticalTangent() { return 10000000.0; }
+
+//...Bin used for pixels coincident with the query point
+constexpr static size_t c_nearBin = 12;
+
+//...Direction bins indexed by 7*(sgn(dx)+1) + k*sgn(dy)+3. The center row can
+//   only be reached with k=3 since a vertical offset always has the maximum
+//   tangent, so the remaining entries in that row are never used. The final
+//   entry is used by the vector kernels for coincident pixels.
+constexpr static unsigned char c_windDirectionLookup[22] = {
+    3, 2,  1,  0,  11, 10, 9, 3,  12, 12, 12,
+    12, 12, 9, 3,  4,  5,  6, 7, 8,  9,  c_nearBin};
+
+template <typename T>
+static int sgn(T val) {
+  return (T(0) < val) - (val < T(0));
+}
+
+/**
+ * @brief Gaussian weight for a pixel
+ * @param distance squared distance (scaled) between the pixel and query point
+ * @return weight
+ */
+double WindRoughnessKernel::gaussian(const double distance) {
+  return c_gaussianScale() * griddata_exp(-distance / c_twoWindSigmaSquared());
+}
+
+/**
+ * @brief Direction sector that a pixel lies within relative to the query point
+ * @param dx scaled x offset of the pixel
+ * @param dy scaled y offset of the pixel
+ * @return direction bin (0-11), or 12 if the pixel is coincident
+ */
+size_t WindRoughnessKernel::direction(double dx, double dy) {
+  const double d = dx * dx + dy * dy;
+  if (d > c_epsilonSquared()) {
+    const double tanxy =
+        std::abs(dx) > c_epsilon() ? std::abs(dy / dx) : c_verticalTangent();
+    const int k =
+        std::min(1, static_cast<int>(tanxy * c_oneOver2MinusRoot3())) +
+        std::min(1, static_cast<int>(tanxy)) +
+        std::min(1, static_cast<int>(tanxy * c_oneOver2PlusRoot3()));
+    const int a = sgn(dx) + 1;
+    const int b = k * sgn(dy) + 3;
+    return c_windDirectionLookup[7 * a + b];
+  } else {
+    return c_nearBin;
+  }
+}
+
+static void accumulateScalar(const double *dx, const double *dy,
+                             const double *z, size_t n, double *weight,
+                             double *wind) {
+  for (size_t i = 0; i < n; ++i) {
+    const double w =
+        WindRoughnessKernel::gaussian(dx[i] * dx[i] + dy[i] * dy[i]);
+    const size_t b = WindRoughnessKernel::direction(dx[i], dy[i]);
+    weight[b] += w;
+    wind[b] += w * z[i];
+  }
+}
+
+#if ADCMOD_WIND_KERNEL_X86
+
+//...Coefficients used by the vector exp functions
+constexpr static double c_log2e = 1.44269504088896340736;
+constexpr static double c_ln2Hi = 6.93147180559945286227e-01;
+constexpr static double c_ln2Lo = 2.31904681384629955842e-17;
+constexpr static double c_expMin = -708.0;
+constexpr static double c_expMax = 709.0;
+constexpr static double c_expRound = 6755399441055744.0;  // 1.5 * 2^52
+
+/**
+ * Taylor series coefficients for exp(r), |r| <= ln(2)/2. With 14 terms the
+ * truncation error is well below the precision of a double
+ */
+constexpr static double c_expCoefficients[14] = {
+    1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0,
+    1.0 / 3628800.0,    1.0 / 362880.0,    1.0 / 40320.0,
+    1.0 / 5040.0,       1.0 / 720.0,       1.0 / 120.0,
+    1.0 / 24.0,         1.0 / 6.0,         1.0 / 2.0,
+    1.0,                1.0};
+
+__attribute__((target("avx2,fma"))) static inline __m256d exp_avx2(__m256d x) {
+  x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(c_expMin)),
+                    _mm256_set1_pd(c_expMax));
+  const __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(c_log2e)),
+                                    _MM_FROUND_TO_NEAREST_INT |
+                                        _MM_FROUND_NO_EXC);
+  __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(c_ln2Hi), x);
+  r = _mm256_fnmadd_pd(n, _mm256_set1_pd(c_ln2Lo), r);
+
+  __m256d p = _mm256_set1_pd(c_expCoefficients[0]);
+  for (size_t i = 1; i < 14; ++i) {
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(c_expCoefficients[i]));
+  }
+
+  //...Build 2^n directly in the exponent bits
+  const __m256i ni =
+      _mm256_castpd_si256(_mm256_add_pd(n, _mm256_set1_pd(c_expRound)));
+  const __m256i e = _mm256_slli_epi64(
+      _mm256_add_epi64(ni, _mm256_set1_epi64x(1023)), 52);
+  return _mm256_mul_pd(p, _mm256_castsi256_pd(e));
+}
+
+/**
+ * Same approximation as fast_exp<double>. v0*x+v1 is at least 2^52 for
+ * x >= c_expMin, so it holds an integer that is truncated to int64 from its
+ * exponent and mantissa bits, which gives the same bits as the scalar cast
+ */
+__attribute__((target("avx2,fma"))) static inline __m256d fast_exp_avx2(
+    __m256d x) {
+  constexpr auto v0 = double((int64_t(1) << 52) / M_LN2);
+  constexpr auto v1 = double((int64_t(1) << 52) * 1023 - 0);
+  x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(c_expMin)),
+                    _mm256_set1_pd(c_expMax));
+  const __m256i t = _mm256_castpd_si256(_mm256_add_pd(
+      _mm256_mul_pd(x, _mm256_set1_pd(v0)), _mm256_set1_pd(v1)));
+  const __m256i shift =
+      _mm256_sub_epi64(_mm256_srli_epi64(t, 52), _mm256_set1_epi64x(1075));
+  const __m256i mantissa =
+      _mm256_or_si256(_mm256_and_si256(t, _mm256_set1_epi64x(0xFFFFFFFFFFFFF)),
+                      _mm256_set1_epi64x(int64_t(1) << 52));
+  return _mm256_castsi256_pd(_mm256_sllv_epi64(mantissa, shift));
+}
+
+#ifdef ADCMOD_USE_FAST_MATH
+#define griddata_exp_avx2 fast_exp_avx2
+#else
+#define griddata_exp_avx2 exp_avx2
+#endif
+
+__attribute__((target("avx2,fma"))) static void accumulateAvx2(
+    const double *dx, const double *dy, const double *z, size_t n,
+    double *weight, double *wind) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d one = _mm256_set1_pd(1.0);
+  const __m256d signMask = _mm256_set1_pd(-0.0);
+  const __m256d eps = _mm256_set1_pd(c_epsilon());
+  const __m256d eps2 = _mm256_set1_pd(c_epsilonSquared());
+  const __m256d vertical = _mm256_set1_pd(c_verticalTangent());
+  const __m256d c1 = _mm256_set1_pd(c_oneOver2MinusRoot3());
+  const __m256d c2 = _mm256_set1_pd(c_oneOver2PlusRoot3());
+  const __m256d scale = _mm256_set1_pd(c_gaussianScale());
+  const __m256d twoSigma2 = _mm256_set1_pd(c_twoWindSigmaSquared());
+  const __m256d seven = _mm256_set1_pd(7.0);
+  const __m256d three = _mm256_set1_pd(3.0);
+  const __m256d nearIndex = _mm256_set1_pd(21.0);
+
+  alignas(32) double ws[4];
+  alignas(32) double wzs[4];
+  alignas(16) int32_t idx[4];
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256d x = _mm256_loadu_pd(dx + i);
+    const __m256d y = _mm256_loadu_pd(dy + i);
+    const __m256d v = _mm256_loadu_pd(z + i);
+
+    const __m256d d = _mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y));
+    const __m256d w = _mm256_mul_pd(
+        scale, griddata_exp_avx2(
+                   _mm256_div_pd(_mm256_xor_pd(d, signMask), twoSigma2)));
+
+    //...Sector binning without branches
+    const __m256d ax = _mm256_andnot_pd(signMask, x);
+    const __m256d ay = _mm256_andnot_pd(signMask, y);
+    const __m256d tanxy =
+        _mm256_blendv_pd(vertical, _mm256_div_pd(ay, ax),
+                         _mm256_cmp_pd(ax, eps, _CMP_GT_OQ));
+    __m256d k = _mm256_and_pd(
+        _mm256_cmp_pd(_mm256_mul_pd(tanxy, c1), one, _CMP_GE_OQ), one);
+    k = _mm256_add_pd(
+        k, _mm256_and_pd(_mm256_cmp_pd(tanxy, one, _CMP_GE_OQ), one));
+    k = _mm256_add_pd(
+        k, _mm256_and_pd(
+               _mm256_cmp_pd(_mm256_mul_pd(tanxy, c2), one, _CMP_GE_OQ), one));
+    const __m256d sx =
+        _mm256_sub_pd(_mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_GT_OQ), one),
+                      _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_LT_OQ), one));
+    const __m256d sy =
+        _mm256_sub_pd(_mm256_and_pd(_mm256_cmp_pd(y, zero, _CMP_GT_OQ), one),
+                      _mm256_and_pd(_mm256_cmp_pd(y, zero, _CMP_LT_OQ), one));
+    __m256d bin = _mm256_add_pd(
+        _mm256_mul_pd(_mm256_add_pd(sx, one), seven),
+        _mm256_add_pd(_mm256_mul_pd(k, sy), three));
+    bin = _mm256_blendv_pd(nearIndex, bin, _mm256_cmp_pd(d, eps2, _CMP_GT_OQ));
+
+    _mm256_store_pd(ws, w);
+    _mm256_store_pd(wzs, _mm256_mul_pd(w, v));
+    _mm_store_si128(reinterpret_cast<__m128i *>(idx), _mm256_cvttpd_epi32(bin));
+    for (size_t l = 0; l < 4; ++l) {
+      const size_t b = c_windDirectionLookup[idx[l]];
+      weight[b] += ws[l];
+      wind[b] += wzs[l];
+    }
+  }
+  accumulateScalar(dx + i, dy + i, z + i, n - i, weight, wind);
+}
+
+//...Some versions of gcc report false positive uninitialized values from
+//   within the avx512 intrinsic headers
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f"))) static inline __m512d exp_avx512(
+    __m512d x) {
+  x = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(c_expMin)),
+                    _mm512_set1_pd(c_expMax));
+  const __m512d n = _mm512_roundscale_pd(
+      _mm512_mul_pd(x, _mm512_set1_pd(c_log2e)),
+      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m512d r = _mm512_fnmadd_pd(n, _mm512_set1_pd(c_ln2Hi), x);
+  r = _mm512_fnmadd_pd(n, _mm512_set1_pd(c_ln2Lo), r);
+
+  __m512d p = _mm512_set1_pd(c_expCoefficients[0]);
+  for (size_t i = 1; i < 14; ++i) {
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(c_expCoefficients[i]));
+  }
+
+  const __m512i ni =
+      _mm512_castpd_si512(_mm512_add_pd(n, _mm512_set1_pd(c_expRound)));
+  const __m512i e = _mm512_slli_epi64(
+      _mm512_add_epi64(ni, _mm512_set1_epi64(1023)), 52);
+  return _mm512_mul_pd(p, _mm512_castsi512_pd(e));
+}
+
+/**
+ * Same approximation as fast_exp<double>, see fast_exp_avx2
+ */
+__attribute__((target("avx512f"))) static inline __m512d fast_exp_avx512(
+    __m512d x) {
+  constexpr auto v0 = double((int64_t(1) << 52) / M_LN2);
+  constexpr auto v1 = double((int64_t(1) << 52) * 1023 - 0);
+  x = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(c_expMin)),
+                    _mm512_set1_pd(c_expMax));
+  const __m512i t = _mm512_castpd_si512(_mm512_add_pd(
+      _mm512_mul_pd(x, _mm512_set1_pd(v0)), _mm512_set1_pd(v1)));
+  const __m512i shift =
+      _mm512_sub_epi64(_mm512_srli_epi64(t, 52), _mm512_set1_epi64(1075));
+  const __m512i mantissa =
+      _mm512_or_si512(_mm512_and_si512(t, _mm512_set1_epi64(0xFFFFFFFFFFFFF)),
+                      _mm512_set1_epi64(int64_t(1) << 52));
+  return _mm512_castsi512_pd(_mm512_sllv_epi64(mantissa, shift));
+}
+
+#ifdef ADCMOD_USE_FAST_MATH
+#define griddata_exp_avx512 fast_exp_avx512
+#else
+#define griddata_exp_avx512 exp_avx512
+#endif
+
+__attribute__((target("avx512f"))) static void accumulateAvx512(
+    const double *dx, const double *dy, const double *z, size_t n,
+    double *weight, double *wind) {
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d one = _mm512_set1_pd(1.0);
+  const __m512d eps = _mm512_set1_pd(c_epsilon());
+  const __m512d eps2 = _mm512_set1_pd(c_epsilonSquared());
+  const __m512d vertical = _mm512_set1_pd(c_verticalTangent());
+  const __m512d c1 = _mm512_set1_pd(c_oneOver2MinusRoot3());
+  const __m512d c2 = _mm512_set1_pd(c_oneOver2PlusRoot3());
+  const __m512d scale = _mm512_set1_pd(c_gaussianScale());
+  const __m512d negTwoSigma2 = _mm512_set1_pd(-c_twoWindSigmaSquared());
+  const __m512d seven = _mm512_set1_pd(7.0);
+  const __m512d three = _mm512_set1_pd(3.0);
+  const __m512d nearIndex = _mm512_set1_pd(21.0);
+
+  alignas(64) double ws[8];
+  alignas(64) double wzs[8];
+  alignas(32) int32_t idx[8];
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m512d x = _mm512_loadu_pd(dx + i);
+    const __m512d y = _mm512_loadu_pd(dy + i);
+    const __m512d v = _mm512_loadu_pd(z + i);
+
+    const __m512d d = _mm512_add_pd(_mm512_mul_pd(x, x), _mm512_mul_pd(y, y));
+    const __m512d w = _mm512_mul_pd(
+        scale, griddata_exp_avx512(_mm512_div_pd(d, negTwoSigma2)));
+
+    const __m512d ax = _mm512_abs_pd(x);
+    const __m512d ay = _mm512_abs_pd(y);
+    const __m512d tanxy =
+        _mm512_mask_blend_pd(_mm512_cmp_pd_mask(ax, eps, _CMP_GT_OQ), vertical,
+                             _mm512_div_pd(ay, ax));
+    __m512d k = _mm512_maskz_mov_pd(
+        _mm512_cmp_pd_mask(_mm512_mul_pd(tanxy, c1), one, _CMP_GE_OQ), one);
+    k = _mm512_mask_add_pd(k, _mm512_cmp_pd_mask(tanxy, one, _CMP_GE_OQ), k,
+                           one);
+    k = _mm512_mask_add_pd(
+        k, _mm512_cmp_pd_mask(_mm512_mul_pd(tanxy, c2), one, _CMP_GE_OQ), k,
+        one);
+    const __m512d sx = _mm512_sub_pd(
+        _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(x, zero, _CMP_GT_OQ), one),
+        _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ), one));
+    const __m512d sy = _mm512_sub_pd(
+        _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(y, zero, _CMP_GT_OQ), one),
+        _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(y, zero, _CMP_LT_OQ), one));
+    __m512d bin = _mm512_add_pd(
+        _mm512_mul_pd(_mm512_add_pd(sx, one), seven),
+        _mm512_add_pd(_mm512_mul_pd(k, sy), three));
+    bin = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(d, eps2, _CMP_GT_OQ),
+                               nearIndex, bin);
+
+    _mm512_store_pd(ws, w);
+    _mm512_store_pd(wzs, _mm512_mul_pd(w, v));
+    _mm256_store_si256(reinterpret_cast<__m256i *>(idx),
+                       _mm512_cvttpd_epi32(bin));
+    for (size_t l = 0; l < 8; ++l) {
+      const size_t b = c_windDirectionLookup[idx[l]];
+      weight[b] += ws[l];
+      wind[b] += wzs[l];
+    }
+  }
+  accumulateScalar(dx + i, dy + i, z + i, n - i, weight, wind);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+/**
+ * @brief Best kernel implementation supported by the processor
+ * @return implementation
+ */
+WindRoughnessKernel::Implementation WindRoughnessKernel::bestAvailable() {
+#if ADCMOD_WIND_KERNEL_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return Avx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return Avx2;
+  }
+#endif
+  return Scalar;
+}
+
+static std::atomic<int> &selectedImplementation() {
+  static std::atomic<int> impl(WindRoughnessKernel::bestAvailable());
+  return impl;
+}
+
+/**
+ * @brief Kernel implementation used by accumulate
+ * @return implementation
+ */
+WindRoughnessKernel::Implementation WindRoughnessKernel::implementation() {
+  return static_cast<Implementation>(
+      selectedImplementation().load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Selects the kernel implementation used by accumulate
+ * @param impl requested implementation. If the processor does not support it,
+ * the best supported implementation is used instead
+ */
+void WindRoughnessKernel::setImplementation(Implementation impl) {
+  if (impl > bestAvailable()) impl = bestAvailable();
+  selectedImplementation().store(impl, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Accumulates the directional weights for a set of pixels using the
+ * selected implementation
+ * @param dx scaled x offsets of the pixels from the query point
+ * @param dy scaled y offsets of the pixels from the query point
+ * @param z pixel values
+ * @param n number of pixels
+ * @param weight accumulated weights for each bin (numBins() values)
+ * @param wind accumulated weighted values for each bin (numBins() values)
+ */
+void WindRoughnessKernel::accumulate(const double *dx, const double *dy,
+                                     const double *z, size_t n, double *weight,
+                                     double *wind) {
+  WindRoughnessKernel::accumulate(WindRoughnessKernel::implementation(), dx,
+                                  dy, z, n, weight, wind);
+}
+
+/**
+ * @brief Accumulates the directional weights for a set of pixels using a
+ * specific implementation
+ * @param impl implementation to use. Must be supported by the processor
+ * @param dx scaled x offsets of the pixels from the query point
+ * @param dy scaled y offsets of the pixels from the query point
+ * @param z pixel values
+ * @param n number of pixels
+ * @param weight accumulated weights for each bin (numBins() values)
+ * @param wind accumulated weighted values for each bin (numBins() values)
+ *
+ * Pixels are accumulated in the order supplied regardless of implementation
+ */
+void WindRoughnessKernel::accumulate(Implementation impl, const double *dx,
+                                     const double *dy, const double *z,
+                                     size_t n, double *weight, double *wind) {
+#if ADCMOD_WIND_KERNEL_X86
+  if (impl == Avx512) {
+    accumulateAvx512(dx, dy, z, n, weight, wind);
+    return;
+  } else if (impl == Avx2) {
+    accumulateAvx2(dx, dy, z, n, weight, wind);
+    return;
+  }
+#endif
+  accumulateScalar(dx, dy, z, n, weight, wind);
+}
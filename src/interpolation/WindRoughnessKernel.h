@@ -0,0 +1,74 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCIRCMODULES_SRC_WINDROUGHNESSKERNEL_H_
+#define ADCIRCMODULES_SRC_WINDROUGHNESSKERNEL_H_
+
+#include <cstddef>
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class WindRoughnessKernel
+ * @author Zachary Cobell
+ * @brief Accumulates directional wind reduction weights for a batch of pixels
+ * @copyright Copyright 2015-2019 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ *
+ * Each pixel is assigned a gaussian weight based on its distance from the
+ * query point and binned into one of twelve 30 degree direction sectors.
+ * Pixels that coincide with the query point are placed in an additional bin
+ * (index 12) and contribute to every direction. The kernel has a scalar
+ * implementation and AVX2/AVX-512 implementations which are selected at
+ * runtime based on the capabilities of the processor.
+ *
+ * The vector implementations use a polynomial exp that is accurate to a few
+ * units in the last place, so results agree with the scalar implementation
+ * to a relative tolerance of 1e-12.
+ *
+ */
+class WindRoughnessKernel {
+ public:
+  enum Implementation { Scalar = 0, Avx2 = 1, Avx512 = 2 };
+
+  /// Number of accumulation bins (12 directions plus the coincident bin)
+  static constexpr size_t numBins() { return 13; }
+
+  static constexpr double windSigma() { return 6.0; }
+
+  static Implementation bestAvailable();
+  static Implementation implementation();
+  static void setImplementation(Implementation impl);
+
+  static void accumulate(const double *dx, const double *dy, const double *z,
+                         size_t n, double *weight, double *wind);
+
+  static void accumulate(Implementation impl, const double *dx,
+                         const double *dy, const double *z, size_t n,
+                         double *weight, double *wind);
+
+  static double gaussian(double distance);
+
+  static size_t direction(double dx, double dy);
+};
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCIRCMODULES_SRC_WINDROUGHNESSKERNEL_H_
@@ -34,6 +34,7 @@
 #include "AdcHash.h"
 #include "HashType.h"
 #include "Mesh.h"
+#include "RasterProjection.h"
 #include "CDate.h"
 #include "Hmdf.h"
 #include "HmdfStation.h"
@@ -52,8 +53,12 @@
 #include "NodalAttributes.h"
 #include "OutputMetadata.h"
 #include "ReadOutput.h"
+#include "NetcdfWriteOptions.h"
 #include "WriteOutput.h"
+#include "OutputSpan.h"
 #include "OutputRecord.h"
+#include "OutputTimeseries.h"
+#include "OutputSnapRange.h"
 #include "HarmonicsRecord.h"
 #include "HarmonicsOutput.h"
 #include "KDTree.h"
@@ -66,7 +71,9 @@
 #include "PixelValueVector.h"
 #include "Oceanweather.h"
 #include "OceanweatherHeader.h"
+#include "OceanweatherIndex.h"
 #include "OceanweatherRecord.h"
+#include "OceanweatherInterpolator.h"
 #include "OceanweatherTrackInfo.h"
 %}
 
@@ -109,6 +116,7 @@ namespace std {
 %include "AdcHash.h"
 %include "HashType.h"
 %include "Mesh.h"
+%include "RasterProjection.h"
 %include "CDate.h"
 %include "Hmdf.h"
 %include "HmdfStation.h"
@@ -126,9 +134,17 @@ namespace std {
 %include "AttributeMetadata.h"
 %include "NodalAttributes.h"
 %include "OutputMetadata.h"
+%include "OutputTimeseries.h"
 %include "ReadOutput.h"
+%include "NetcdfWriteOptions.h"
 %include "WriteOutput.h"
+%include "OutputSpan.h"
+%extend Adcirc::Output::OutputSpan {
+  size_t __len__() const { return $self->size(); }
+  double __getitem__(size_t index) const { return $self->at(index); }
+}
 %include "OutputRecord.h"
+%include "OutputSnapRange.h"
 %include "HarmonicsRecord.h"
 %include "HarmonicsOutput.h"
 %include "KDTree.h"
@@ -141,7 +157,9 @@ namespace std {
 %include "PixelValueVector.h"
 %include "Oceanweather.h"
 %include "OceanweatherHeader.h"
+%include "OceanweatherIndex.h"
 %include "OceanweatherRecord.h"
+%include "OceanweatherInterpolator.h"
 %include "OceanweatherTrackInfo.h"
 
 #ifdef _USE_GDAL
@@ -0,0 +1,116 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "AsciiWriter.h"
+#include "Formatting.h"
+
+using Adcirc::Private::AsciiWriter;
+
+int checkValue(double v) {
+  char buffer[AsciiWriter::maxLineLength()];
+  char reference[AsciiWriter::maxLineLength()];
+
+  char *end = AsciiWriter::scientific(buffer, v, 20, 10);
+  std::snprintf(reference, sizeof(reference), "%20.10e", v);
+  if (std::string(buffer, end) != reference) {
+    std::cout << "Scientific format differs: [" << std::string(buffer, end)
+              << "] [" << reference << "]" << std::endl;
+    return 1;
+  }
+
+  end = AsciiWriter::fixed(buffer, v, 16, 10);
+  std::snprintf(reference, sizeof(reference), "%16.10f", v);
+  if (std::string(buffer, end) != reference) {
+    std::cout << "Fixed format differs: [" << std::string(buffer, end)
+              << "] [" << reference << "]" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main() {
+  //...Special values, values on rounding boundaries and powers of ten
+  std::vector<double> values = {0.0,
+                                -0.0,
+                                1.0,
+                                -1.0,
+                                0.1,
+                                9.99999999995,
+                                9.999999999949999,
+                                0.5e-10,
+                                1.5e-10,
+                                2.5e-10,
+                                -99999.0,
+                                1e300,
+                                5e-324,
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::quiet_NaN()};
+  for (int i = -30; i <= 30; ++i) {
+    values.push_back(std::pow(10.0, i));
+    values.push_back(-5.0 * std::pow(10.0, i));
+  }
+
+  //...Random values of varying magnitude and random bit patterns
+  std::mt19937_64 gen(1234);
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::uniform_real_distribution<double> exponent(-15.0, 20.0);
+  for (size_t i = 0; i < 100000; ++i) {
+    values.push_back(mantissa(gen) * std::pow(10.0, exponent(gen)));
+    values.push_back(400000.0 + 1e5 * mantissa(gen));
+    const uint64_t bits = gen();
+    double v;
+    std::memcpy(&v, &bits, sizeof(double));
+    values.push_back(v);
+  }
+
+  for (auto v : values) {
+    if (checkValue(v) != 0) return 1;
+  }
+
+  //...Lines written through the buffered writer, skipping some lines
+  std::ostringstream output;
+  std::string reference;
+  AsciiWriter writer(output);
+  writer.writeLines(values.size(), [&](char *p, size_t i) {
+    if (i % 7 == 0) return p;
+    return Adcirc::Output::Formatting::adcircScalarLine(p, i + 1, values[i]);
+  });
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i % 7 == 0) continue;
+    char line[AsciiWriter::maxLineLength()];
+    std::snprintf(line, sizeof(line), "%8zu     %20.10e\n", i + 1, values[i]);
+    reference += line;
+  }
+  if (output.str() != reference) {
+    std::cout << "Buffered output differs from reference" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
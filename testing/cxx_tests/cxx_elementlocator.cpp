@@ -0,0 +1,119 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+using namespace Adcirc::Geometry;
+
+int checkMeshFile() {
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  //...Element centers lie strictly inside their own element
+  std::vector<double> w;
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    double xc, yc;
+    mesh->element(i)->getElementCenter(xc, yc);
+    size_t found = mesh->findElement(xc, yc, w);
+    if (found != i) {
+      std::cout << "Element " << i << " center located in " << found
+                << std::endl;
+      return 1;
+    }
+    if (std::abs(w[0] + w[1] + w[2] - 1.0) > 1e-12) {
+      std::cout << "Invalid weights for element " << i << std::endl;
+      return 1;
+    }
+  }
+
+  //...Mesh nodes lie on the boundary of the elements around them
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    const double x = mesh->node(i)->x();
+    const double y = mesh->node(i)->y();
+    size_t found = mesh->findElement(x, y);
+    if (found == adcircmodules_default_value<size_t>() ||
+        !mesh->element(found)->isInside(x, y)) {
+      std::cout << "Node " << i << " not located" << std::endl;
+      return 1;
+    }
+  }
+
+  if (mesh->findElement(0.0, 0.0) != adcircmodules_default_value<size_t>()) {
+    std::cout << "Point outside of the mesh was located" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int checkMixedMesh() {
+  //...Two triangles and two quadrilaterals, one of which is not convex,
+  //   covering the rectangle [0,4]x[0,2]
+  Mesh mesh;
+  mesh.resizeMesh(7, 0, 0, 0);
+  mesh.addNode(0, Node(1, 0.0, 0.0, 0.0));
+  mesh.addNode(1, Node(2, 2.0, 0.0, 0.0));
+  mesh.addNode(2, Node(3, 4.0, 0.0, 0.0));
+  mesh.addNode(3, Node(4, 0.0, 2.0, 0.0));
+  mesh.addNode(4, Node(5, 2.0, 2.0, 0.0));
+  mesh.addNode(5, Node(6, 4.0, 2.0, 0.0));
+  mesh.addNode(6, Node(7, 0.8, 0.8, 0.0));
+  mesh.addElement(0, Element(1, mesh.node(0), mesh.node(1), mesh.node(6),
+                             mesh.node(3)));
+  mesh.addElement(1, Element(2, mesh.node(1), mesh.node(4), mesh.node(3),
+                             mesh.node(6)));
+  mesh.addElement(2, Element(3, mesh.node(1), mesh.node(2), mesh.node(5)));
+  mesh.addElement(3, Element(4, mesh.node(1), mesh.node(5), mesh.node(4)));
+
+  std::vector<double> w;
+  for (size_t j = 0; j <= 40; ++j) {
+    for (size_t i = 0; i <= 80; ++i) {
+      const double x = i * 0.05;
+      const double y = j * 0.05;
+      size_t found = mesh.findElement(x, y, w);
+      if (found == adcircmodules_default_value<size_t>() ||
+          !mesh.element(found)->isInside(x, y)) {
+        std::cout << "Point " << x << ", " << y << " not located" << std::endl;
+        return 1;
+      }
+      double sum = 0.0;
+      for (auto v : w) sum += v;
+      if (w.size() != mesh.element(found)->n() || std::abs(sum - 1.0) > 1e-12) {
+        std::cout << "Invalid weights at " << x << ", " << y << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  if (mesh.findElement(4.01, 1.0) != adcircmodules_default_value<size_t>() ||
+      mesh.findElement(1.0, -0.01) != adcircmodules_default_value<size_t>()) {
+    std::cout << "Point outside of the mesh was located" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main() {
+  if (checkMeshFile() != 0) return 1;
+  if (checkMixedMesh() != 0) return 1;
+  return 0;
+}
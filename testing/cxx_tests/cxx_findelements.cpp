@@ -0,0 +1,97 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+using namespace Adcirc::Geometry;
+
+int main() {
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  //...Query points on a regular grid that extends past the mesh
+  const std::vector<double> ext = mesh->extent();
+  const double xmin = ext[0] - 0.01;
+  const double ymin = ext[1] - 0.01;
+  const double dx = (ext[2] - ext[0] + 0.02) / 150.0;
+  const double dy = (ext[3] - ext[1] + 0.02) / 150.0;
+  std::vector<double> x, y;
+  for (size_t j = 0; j <= 150; ++j) {
+    for (size_t i = 0; i <= 150; ++i) {
+      x.push_back(xmin + i * dx);
+      y.push_back(ymin + j * dy);
+    }
+  }
+
+  std::vector<double> weights;
+  std::vector<size_t> elements = mesh->findElements(x, y, weights);
+  std::vector<size_t> nodes = mesh->findNearestNodes(x, y);
+
+  if (elements.size() != x.size() || nodes.size() != x.size() ||
+      weights.size() != x.size() * Mesh::MAX_NODES_PER_ELEMENT) {
+    std::cout << "Invalid output size" << std::endl;
+    return 1;
+  }
+
+  size_t nFound = 0;
+  std::vector<double> w;
+  for (size_t i = 0; i < x.size(); ++i) {
+    const size_t e = mesh->findElement(x[i], y[i], w);
+    if (e != elements[i]) {
+      std::cout << "Element mismatch at point " << i << ": " << e << " "
+                << elements[i] << std::endl;
+      return 1;
+    }
+    if (e != Mesh::ELEMENT_NOT_FOUND) nFound++;
+    for (size_t j = 0; j < Mesh::MAX_NODES_PER_ELEMENT; ++j) {
+      const double expected = j < w.size() && e != Mesh::ELEMENT_NOT_FOUND
+                                  ? w[j]
+                                  : 0.0;
+      if (weights[i * Mesh::MAX_NODES_PER_ELEMENT + j] != expected) {
+        std::cout << "Weight mismatch at point " << i << std::endl;
+        return 1;
+      }
+    }
+    if (mesh->findNearestNode(x[i], y[i]) != nodes[i]) {
+      std::cout << "Nearest node mismatch at point " << i << std::endl;
+      return 1;
+    }
+  }
+
+  if (nFound == 0 || nFound == x.size()) {
+    std::cout << "Expected points both inside and outside of the mesh"
+              << std::endl;
+    return 1;
+  }
+
+  //...Mismatched input sizes are rejected
+  x.pop_back();
+  try {
+    mesh->findElements(x, y);
+    std::cout << "Mismatched input sizes were accepted" << std::endl;
+    return 1;
+  } catch (const std::exception &) {
+  }
+
+  return 0;
+}
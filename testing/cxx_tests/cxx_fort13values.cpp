@@ -0,0 +1,73 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::ModelParameters;
+  std::unique_ptr<NodalAttributes> fort13(
+      new NodalAttributes("test_files/ms-riv.13"));
+  fort13->read();
+
+  const size_t p = fort13->locateAttribute(
+      "surface_directional_effective_roughness_length");
+  const size_t n = fort13->metadata(p)->numberOfValues();
+  std::vector<double> v = fort13->values(p);
+  if (n != 12 || v.size() != n * fort13->numNodes()) {
+    std::cout << "Unexpected number of values" << std::endl;
+    return 1;
+  }
+  for (size_t k = 0; k < n; ++k) {
+    if (fort13->attribute(p, 5)->value(k) != v[5 * n + k]) {
+      std::cout << "Attribute does not match the stored values" << std::endl;
+      return 1;
+    }
+  }
+
+  //...Values set in either form are visible in the other
+  v[5 * n + 3] = 0.125;
+  fort13->setValues(p, v);
+  if (fort13->attribute(p, 5)->value(3) != 0.125) {
+    std::cout << "Attribute was not updated" << std::endl;
+    return 1;
+  }
+  fort13->attribute(p, 7)->setValue(0.25);
+  if (fort13->values(p)[7 * n + 11] != 0.25) {
+    std::cout << "Values were not updated" << std::endl;
+    return 1;
+  }
+
+  //...Round trip through a file
+  fort13->write("test_files/cxx_fort13values.13");
+  std::unique_ptr<NodalAttributes> copy(
+      new NodalAttributes("test_files/cxx_fort13values.13"));
+  copy->read();
+  for (size_t i = 0; i < fort13->numParameters(); ++i) {
+    const std::string name = fort13->attributeNames(i);
+    if (copy->values(copy->locateAttribute(name)) != fort13->values(i)) {
+      std::cout << "Values of " << name << " changed when written"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
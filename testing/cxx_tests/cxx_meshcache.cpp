@@ -0,0 +1,110 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+
+std::string fileContents(const std::string &filename) {
+  std::ifstream f(filename);
+  std::stringstream s;
+  s << f.rdbuf();
+  return s.str();
+}
+
+bool sameMesh(Adcirc::Geometry::Mesh *m1, Adcirc::Geometry::Mesh *m2) {
+  m1->write("test_files/meshcache_a.grd");
+  m2->write("test_files/meshcache_b.grd");
+  return m1->hash() == m2->hash() &&
+         m1->nodeOrderingIsLogical() == m2->nodeOrderingIsLogical() &&
+         m1->elementOrderingIsLogical() == m2->elementOrderingIsLogical() &&
+         m1->projection() == m2->projection() &&
+         fileContents("test_files/meshcache_a.grd") ==
+             fileContents("test_files/meshcache_b.grd");
+}
+
+int checkMesh(const std::string &filename) {
+  using namespace Adcirc::Geometry;
+
+  std::unique_ptr<Mesh> m1(new Mesh(filename));
+  m1->read();
+
+  //...Direct write and read of the binary format
+  m1->write("test_files/meshcache.14b");
+  std::unique_ptr<Mesh> m2(new Mesh("test_files/meshcache.14b"));
+  m2->read();
+  if (!sameMesh(m1.get(), m2.get())) {
+    std::cout << filename << ": Binary mesh does not match" << std::endl;
+    return 1;
+  }
+
+  //...First read generates the cache, second read uses it
+  std::remove("test_files/meshcache_cache.14b");
+  for (size_t i = 0; i < 2; ++i) {
+    std::unique_ptr<Mesh> m3(new Mesh(filename));
+    m3->setCacheFile("test_files/meshcache_cache.14b");
+    m3->read();
+    if (!sameMesh(m1.get(), m3.get())) {
+      std::cout << filename << ": Cached mesh does not match on read " << i
+                << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main() {
+  std::vector<std::string> files = {"test_files/ms-riv.grd",
+                                    "test_files/internal_overflow.grd"};
+  for (const auto &f : files) {
+    if (checkMesh(f) != 0) return 1;
+  }
+
+  //...A cache generated from a different file must not be used. The stale
+  //   cache is replaced rather than rewritten, so a reader which already has
+  //   it open still sees the complete old file
+  using namespace Adcirc::Geometry;
+  const std::string stale = fileContents("test_files/meshcache_cache.14b");
+  std::ifstream reader("test_files/meshcache_cache.14b", std::ios::binary);
+  std::unique_ptr<Mesh> m1(new Mesh("test_files/ms-riv.grd"));
+  m1->read();
+  std::unique_ptr<Mesh> m2(new Mesh("test_files/ms-riv.grd"));
+  m2->setCacheFile("test_files/meshcache_cache.14b");
+  m2->read();
+  if (!sameMesh(m1.get(), m2.get())) {
+    std::cout << "Stale cache was used" << std::endl;
+    return 1;
+  }
+#ifndef _WIN32
+  std::stringstream old;
+  old << reader.rdbuf();
+  if (old.str() != stale) {
+    std::cout << "Cache was modified while it was open" << std::endl;
+    return 1;
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "MeshRasterizer.h"
+
+using namespace Adcirc::Geometry;
+using Adcirc::Private::MeshRasterizer;
+
+//...Assembles the tiles of a rasterizer into a full raster
+std::vector<float> rasterize(const MeshRasterizer &r,
+                             const std::vector<double> &z, double nullvalue,
+                             bool partialWetting) {
+  std::vector<float> raster(r.nx() * r.ny());
+  std::vector<float> tile;
+  for (size_t row = 0; row < r.numTileRows(); ++row) {
+    for (size_t col = 0; col < r.numTileColumns(); ++col) {
+      r.rasterize(col, row, z, nullvalue, partialWetting, tile);
+      for (size_t j = 0; j < r.tileHeight(row); ++j) {
+        for (size_t i = 0; i < r.tileWidth(col); ++i) {
+          raster[(row * r.tileSize() + j) * r.nx() + col * r.tileSize() + i] =
+              tile[j * r.tileWidth(col) + i];
+        }
+      }
+    }
+  }
+  return raster;
+}
+
+int checkMeshFile() {
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  const double nullvalue = -99999.0;
+  const std::vector<double> extent = mesh->extent();
+  const double resolution = (extent[2] - extent[0]) / 300.0;
+  const double xmin = extent[0] - 5.5 * resolution;
+  const double ymax = extent[3] + 3.5 * resolution;
+  const size_t nx = 320;
+  const size_t ny =
+      static_cast<size_t>((ymax - extent[1]) / resolution) + 8;
+  const std::vector<double> z = mesh->z();
+
+  MeshRasterizer tiled(*mesh->nodes(), *mesh->elements(), xmin, ymax,
+                       resolution, nx, ny, 37);
+  MeshRasterizer single(*mesh->nodes(), *mesh->elements(), xmin, ymax,
+                        resolution, nx, ny, 4096);
+  if (tiled.numTileColumns() != 9 || single.numTileColumns() != 1) {
+    std::cout << "Unexpected number of tiles" << std::endl;
+    return 1;
+  }
+
+  const std::vector<float> a = rasterize(tiled, z, nullvalue, false);
+  const std::vector<float> b = rasterize(single, z, nullvalue, false);
+  if (a != b) {
+    std::cout << "Raster depends on the tile size" << std::endl;
+    return 1;
+  }
+
+  //...Every pixel matches the element found by the point locator
+  std::vector<double> w;
+  size_t numInside = 0;
+  for (size_t j = 0; j < ny; ++j) {
+    for (size_t i = 0; i < nx; ++i) {
+      const double x = i * resolution + xmin + 0.5 * resolution;
+      const double y = ymax - (j + 1) * resolution + 0.5 * resolution;
+      const size_t e = mesh->findElement(x, y, w);
+      double expected = nullvalue;
+      if (e != adcircmodules_default_value<size_t>()) {
+        expected = 0.0;
+        for (size_t k = 0; k < 3; ++k) {
+          expected += w[k] * mesh->element(e)->node(k)->z();
+        }
+        numInside++;
+      }
+      const float v = a[j * nx + i];
+      if (std::abs(v - static_cast<float>(expected)) >
+          1e-4 * std::max(1.0, std::abs(expected))) {
+        std::cout << "Pixel " << i << ", " << j << " is " << v
+                  << ", expected " << expected << std::endl;
+        return 1;
+      }
+    }
+  }
+  if (numInside == 0 || numInside == nx * ny) {
+    std::cout << "Raster does not cover the edge of the mesh" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int checkPartialWetting() {
+  const double nullvalue = -99999.0;
+  const double w[3] = {0.5, 0.25, 0.25};
+
+  const double wet[3] = {1.0, 2.0, 3.0};
+  if (MeshRasterizer::interpolate(wet, w, nullvalue, true) != 1.75f ||
+      MeshRasterizer::interpolate(wet, w, nullvalue, false) != 1.75f) {
+    std::cout << "Invalid value in a wet element" << std::endl;
+    return 1;
+  }
+
+  const double oneDry[3] = {1.0, nullvalue, 3.0};
+  if (MeshRasterizer::interpolate(oneDry, w, nullvalue, true) !=
+          static_cast<float>((0.5 * 1.0 + 0.25 * 3.0) / 0.75) ||
+      MeshRasterizer::interpolate(oneDry, w, nullvalue, false) !=
+          static_cast<float>(nullvalue)) {
+    std::cout << "Invalid value in an element with one dry node" << std::endl;
+    return 1;
+  }
+
+  const double twoDry[3] = {adcircmodules_default_value<double>(), nullvalue,
+                            3.0};
+  if (MeshRasterizer::interpolate(twoDry, w, nullvalue, true) != 3.0f) {
+    std::cout << "Invalid value in an element with two dry nodes"
+              << std::endl;
+    return 1;
+  }
+
+  const double dry[3] = {nullvalue, nullvalue, nullvalue};
+  if (MeshRasterizer::interpolate(dry, w, nullvalue, true) !=
+      static_cast<float>(nullvalue)) {
+    std::cout << "Invalid value in a dry element" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main() {
+  if (checkMeshFile() != 0) return 1;
+  if (checkPartialWetting() != 0) return 1;
+  return 0;
+}
@@ -0,0 +1,179 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "OceanweatherTestFile.h"
+
+//...Writes a file with numSnaps records 6 hours apart. Lines of the second
+//   domain end with CRLF
+void writeFile(const std::string &filename, bool wind, size_t domain,
+               size_t numSnaps) {
+  OceanweatherTestFile::Spec spec;
+  spec.wind = wind;
+  spec.numRecords = numSnaps;
+  spec.eol = domain == 1 ? "\r\n" : "\n";
+  spec.grid = [=](size_t) {
+    return OceanweatherTestFile::Grid{11 + 4 * domain, 7 + 2 * domain, 0.25,
+                                      20.0 + domain, -95.0 + domain};
+  };
+  spec.value = [](size_t r, size_t field, size_t i) {
+    return 1000.0 + r + 0.01 * i + (field == 2 ? 1.0 : 0.0);
+  };
+  OceanweatherTestFile::write(filename, spec);
+}
+
+std::string baseName(size_t domain) {
+  return "test_files/cxx_oceanweatherindex_" + std::to_string(domain);
+}
+
+int main() {
+  Adcirc::Oceanweather owi;
+  for (size_t d = 0; d < 2; ++d) {
+    writeFile(baseName(d) + ".pre", false, d, 5);
+    writeFile(baseName(d) + ".win", true, d, 5);
+    std::remove(
+        Adcirc::OceanweatherIndex::cacheFilename(baseName(d) + ".pre").c_str());
+    std::remove(
+        Adcirc::OceanweatherIndex::cacheFilename(baseName(d) + ".win").c_str());
+    owi.addDomain(baseName(d) + ".pre", baseName(d) + ".win");
+  }
+
+  //...Sequential read for reference
+  std::vector<Adcirc::OceanweatherRecord> records;
+  while (owi.read() == 0) {
+    records.push_back(owi.record());
+  }
+
+  if (records.size() != 5 || owi.nSnaps() != 5) {
+    std::cout << "Unexpected number of snaps: " << records.size() << " "
+              << owi.nSnaps() << std::endl;
+    return 1;
+  }
+
+  std::vector<Adcirc::CDate> times = owi.snapTimes();
+  for (size_t s = 0; s < 5; ++s) {
+    if (times[s] != records[s].current_time()) {
+      std::cout << "Time of snap " << s << " is " << times[s] << std::endl;
+      return 1;
+    }
+  }
+
+  //...Seeks to a snap and to a time between snaps, which reads the next snap
+  const size_t expected[2] = {3, 2};
+  const Adcirc::CDate seekTimes[2] = {
+      times[3], times[1] + Adcirc::CDate::hours(1)};
+  for (size_t k = 0; k < 2; ++k) {
+    if (owi.seek(seekTimes[k]) != 0 || owi.read() != 0) {
+      std::cout << "Could not read after seeking to " << seekTimes[k]
+                << std::endl;
+      return 1;
+    }
+    const size_t s = expected[k];
+    if (owi.currentSnap() != s + 1) {
+      std::cout << "Current snap is " << owi.currentSnap() << std::endl;
+      return 1;
+    }
+    Adcirc::OceanweatherRecord r = owi.record();
+    for (size_t d = 0; d < 2; ++d) {
+      if (r.domain(d)->data_pressure != records[s].domain(d)->data_pressure ||
+          r.domain(d)->data_u != records[s].domain(d)->data_u ||
+          r.domain(d)->data_v != records[s].domain(d)->data_v) {
+        std::cout << "Data after seeking to snap " << s << " does not match"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  auto range = owi.snapRange(times[1], times[3]);
+  if (range.first != 1 || range.second != 4) {
+    std::cout << "Unexpected snap range " << range.first << " "
+              << range.second << std::endl;
+    return 1;
+  }
+
+  if (owi.seek(times[4] + Adcirc::CDate::hours(1)) == 0) {
+    std::cout << "Seek past the last snap succeeded" << std::endl;
+    return 1;
+  }
+
+  //...The cache is reused until the file changes
+  owi.close();
+  const std::string file = baseName(0) + ".win";
+  Adcirc::OceanweatherIndex cached;
+  if (!cached.readCache(file) || cached.nSnaps() != 5) {
+    std::cout << "Cached index was not read" << std::endl;
+    return 1;
+  }
+  writeFile(file, true, 0, 6);
+  if (cached.readCache(file)) {
+    std::cout << "Cached index of a modified file was used" << std::endl;
+    return 1;
+  }
+  Adcirc::OceanweatherIndex rebuilt(file, true);
+  if (rebuilt.nSnaps() != 6 || !cached.readCache(file) ||
+      cached.snap(5).offset != rebuilt.snap(5).offset) {
+    std::cout << "Index of the modified file is incorrect" << std::endl;
+    return 1;
+  }
+
+  //...The layout is found from the lines of the first snap, including files
+  //   with a single snap
+  const std::string single = baseName(1) + "_single.win";
+  writeFile(single, true, 1, 1);
+  if (Adcirc::OceanweatherIndex::isWindFile(baseName(0) + ".pre") ||
+      !Adcirc::OceanweatherIndex::isWindFile(file) ||
+      !Adcirc::OceanweatherIndex::isWindFile(single)) {
+    std::cout << "Layout of the files was not detected" << std::endl;
+    return 1;
+  }
+
+  //...Data blocks are skipped, so a wind file indexed as a pressure file and
+  //   a truncated file do not have a grid line where one is expected
+  std::vector<std::string> invalid = {file};
+  {
+    const std::string truncated = baseName(0) + "_truncated.pre";
+    std::ifstream in(baseName(0) + ".pre", std::ios::binary);
+    std::string text((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+    std::ofstream out(truncated, std::ios::binary);
+    out << text.substr(0, text.size() - 100);
+    invalid.push_back(truncated);
+  }
+  for (const auto &f : invalid) {
+    bool thrown = false;
+    try {
+      Adcirc::OceanweatherIndex index(f, false, false);
+    } catch (const std::exception &e) {
+      thrown = true;
+    }
+    if (!thrown) {
+      std::cout << "Invalid file " << f << " was indexed" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "OceanweatherTestFile.h"
+
+//...Grid spacing of each domain in each record. The nested grid is refined
+//   in the third record
+const size_t c_numRecords = 4;
+const double c_dx[c_numRecords][2] = {
+    {0.25, 0.1}, {0.25, 0.1}, {0.25, 0.05}, {0.25, 0.05}};
+
+void writeFile(const std::string &filename, bool wind, size_t domain) {
+  OceanweatherTestFile::Spec spec;
+  spec.wind = wind;
+  spec.numRecords = c_numRecords;
+  spec.grid = [=](size_t r) {
+    const double dx = c_dx[r][domain];
+    const size_t n = static_cast<size_t>(std::round(1.0 / dx)) + 1;
+    if (domain == 0) return OceanweatherTestFile::Grid{13, 9, dx, 20.0, -95.0};
+    return OceanweatherTestFile::Grid{n, n, dx, 21.0, -94.0};
+  };
+  spec.value = [=](size_t r, size_t field, size_t i) {
+    return (field == 0 ? 1000.0 : 0.0) +
+           10.0 * std::sin(0.3 * i + field + r + domain);
+  };
+  OceanweatherTestFile::write(filename, spec);
+}
+
+//...Compares the interpolated values to a direct lookup in the record
+int check(Adcirc::OceanweatherInterpolator &interp,
+          const Adcirc::OceanweatherRecord &record,
+          const std::vector<double> &x, const std::vector<double> &y,
+          size_t r) {
+  std::vector<double> p, u, v;
+  interp.interpolate(record, p, u, v);
+
+  size_t nInside = 0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    double ep, eu, ev;
+    size_t domain;
+    std::tie(ep, eu, ev, domain) = record.get(x[i], y[i]);
+    if (domain != Adcirc::OceanweatherInterpolator::noDomain()) nInside++;
+    if (interp.domain(i) != domain || std::abs(p[i] - ep) > 1e-9 ||
+        std::abs(u[i] - eu) > 1e-9 || std::abs(v[i] - ev) > 1e-9) {
+      std::cout << "Point " << i << " in record " << r
+                << " does not match: " << p[i] << " " << u[i] << " " << v[i]
+                << ", expected " << ep << " " << eu << " " << ev
+                << std::endl;
+      return 1;
+    }
+  }
+
+  if (nInside == 0 || nInside == x.size()) {
+    std::cout << "Points do not cover the domain boundaries" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main() {
+  Adcirc::Oceanweather owi;
+  for (size_t d = 0; d < 2; ++d) {
+    const std::string base =
+        "test_files/cxx_oceanweatherinterpolator_" + std::to_string(d);
+    writeFile(base + ".pre", false, d);
+    writeFile(base + ".win", true, d);
+    owi.addDomain(base + ".pre", base + ".win");
+  }
+
+  //...Points covering both domains and the area outside of them
+  std::vector<double> x, y;
+  for (double px = -95.5; px < -91.5; px += 0.0731) {
+    for (double py = 19.5; py < 22.5; py += 0.0677) {
+      x.push_back(px);
+      y.push_back(py);
+    }
+  }
+
+  Adcirc::OceanweatherInterpolator interp(x, y);
+  const bool expectRebuild[c_numRecords] = {true, false, true, false};
+
+  for (size_t r = 0; r < c_numRecords; ++r) {
+    if (owi.read() != 0) {
+      std::cout << "Error reading record " << r << std::endl;
+      return 1;
+    }
+    Adcirc::OceanweatherRecord record = owi.record();
+
+    if (interp.update(record) != expectRebuild[r]) {
+      std::cout << "Unexpected rebuild state for record " << r << std::endl;
+      return 1;
+    }
+    if (check(interp, record, x, y, r) != 0) return 1;
+  }
+
+  //...Records read without interpolating in between. The grid is refined on
+  //   a skipped read, so the last read does not report a grid change but the
+  //   operator built for the first record no longer applies
+  owi.seek(size_t(0));
+  Adcirc::OceanweatherInterpolator skipping(x, y);
+  for (size_t r = 0; r < c_numRecords; ++r) {
+    if (owi.read() != 0) {
+      std::cout << "Error reading record " << r << std::endl;
+      return 1;
+    }
+    if (r == 1 || r == 2) continue;
+
+    const Adcirc::OceanweatherRecord &record = owi.record();
+    if (r == 3 && record.gridChanged()) {
+      std::cout << "Grid change reported on the last record" << std::endl;
+      return 1;
+    }
+    if (!skipping.update(record)) {
+      std::cout << "Operator was not rebuilt for record " << r << std::endl;
+      return 1;
+    }
+    if (check(skipping, record, x, y, r) != 0) return 1;
+  }
+
+  return 0;
+}
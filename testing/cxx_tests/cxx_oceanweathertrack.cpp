@@ -0,0 +1,137 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "OceanweatherTestFile.h"
+
+//...Writes a storm moving east. Values are rounded to whole numbers so that
+//   the extrema occur in several cells
+void writeFile(const std::string &filename, bool wind, size_t domain) {
+  const OceanweatherTestFile::Grid grid =
+      domain == 0 ? OceanweatherTestFile::Grid{61, 41, 0.25, 20.0, -95.0}
+                  : OceanweatherTestFile::Grid{97, 53, 0.05, 23.0, -90.0};
+  OceanweatherTestFile::Spec spec;
+  spec.wind = wind;
+  spec.numRecords = 4;
+  spec.grid = [=](size_t) { return grid; };
+  spec.value = [=](size_t r, size_t field, size_t i) {
+    const double x = grid.swlon + (i % grid.nx) * grid.dx - (-92.0 + 1.5 * r);
+    const double y = grid.swlat + (i / grid.nx) * grid.dx - 24.0;
+    const double dist = std::sqrt(x * x + y * y);
+    if (field == 0) return std::round(950.0 + 60.0 * (1.0 - std::exp(-dist)));
+    const double speed = std::round(60.0 * dist * std::exp(1.0 - dist));
+    return field == 1 ? -speed * y / (dist + 1e-9) : speed * x / (dist + 1e-9);
+  };
+  OceanweatherTestFile::write(filename, spec);
+}
+
+//...Cell by cell search for the extrema
+Adcirc::OceanweatherTrackInfo reference(const Adcirc::OceanweatherRecord &r) {
+  Adcirc::OceanweatherTrackInfo info;
+  for (size_t k = 0; k < r.ndomain(); ++k) {
+    const auto *d = r.domain(k);
+    for (size_t i = 0; i < d->grid.nx * d->grid.ny; ++i) {
+      size_t ii, jj;
+      std::tie(ii, jj) = d->grid.index1DtoIndex2D(i);
+      const double vel =
+          Adcirc::Constants::magnitude(d->data_u[i], d->data_v[i]);
+      if (d->data_pressure[i] < info.min_central_pressure()) {
+        info.set_min_central_pressure(d->data_pressure[i]);
+        info.set_storm_center(Adcirc::Point(d->grid.x(ii), d->grid.y(jj)));
+      }
+      if (vel > info.maximum_wind_velocity()) {
+        info.set_maximum_wind_velocity(vel);
+        info.set_max_velocity_location(
+            Adcirc::Point(d->grid.x(ii), d->grid.y(jj)));
+      }
+    }
+  }
+  return info;
+}
+
+bool same(const Adcirc::OceanweatherTrackInfo &a,
+          const Adcirc::OceanweatherTrackInfo &b) {
+  return a.min_central_pressure() == b.min_central_pressure() &&
+         a.maximum_wind_velocity() == b.maximum_wind_velocity() &&
+         a.storm_center().x() == b.storm_center().x() &&
+         a.storm_center().y() == b.storm_center().y() &&
+         a.max_velocity_location().x() == b.max_velocity_location().x() &&
+         a.max_velocity_location().y() == b.max_velocity_location().y();
+}
+
+int main() {
+  Adcirc::Oceanweather owi;
+  owi.setUseIndexCache(false);
+  for (size_t d = 0; d < 2; ++d) {
+    const std::string base =
+        "test_files/cxx_oceanweathertrack_" + std::to_string(d);
+    writeFile(base + ".pre", false, d);
+    writeFile(base + ".win", true, d);
+    owi.addDomain(base + ".pre", base + ".win");
+  }
+
+  std::vector<Adcirc::OceanweatherTrackInfo> expected;
+  std::vector<Adcirc::CDate> times;
+  while (owi.read() == 0) {
+    const Adcirc::OceanweatherRecord &record = owi.record();
+    const Adcirc::OceanweatherTrackInfo info = record.get_current_storm_info();
+    expected.push_back(reference(record));
+    times.push_back(record.current_time());
+    if (!same(info, expected.back()) || info.time() != times.back()) {
+      std::cout << "Storm info of snap " << expected.size() - 1
+                << " does not match: " << info.min_central_pressure() << " "
+                << info.maximum_wind_velocity() << ", expected "
+                << expected.back().min_central_pressure() << " "
+                << expected.back().maximum_wind_velocity() << std::endl;
+      return 1;
+    }
+  }
+
+  if (expected.size() != 4) {
+    std::cout << "Unexpected number of snaps" << std::endl;
+    return 1;
+  }
+
+  std::vector<Adcirc::OceanweatherTrackInfo> track =
+      owi.track(times[1], times[2]);
+  if (track.size() != 2 || !same(track[0], expected[1]) ||
+      !same(track[1], expected[2]) || track[0].time() != times[1]) {
+    std::cout << "Track between times does not match" << std::endl;
+    return 1;
+  }
+
+  owi.seek(size_t(0));
+  track = owi.track();
+  if (track.size() != expected.size()) {
+    std::cout << "Track has " << track.size() << " snaps" << std::endl;
+    return 1;
+  }
+  for (size_t s = 0; s < track.size(); ++s) {
+    if (!same(track[s], expected[s])) {
+      std::cout << "Track snap " << s << " does not match" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "MeshRasterizer.h"
+
+using namespace Adcirc::Geometry;
+using Adcirc::Private::MeshRasterizer;
+
+int main() {
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  const double nullvalue = -99999.0;
+  const std::vector<double> extent = mesh->extent();
+  const double resolution = (extent[2] - extent[0]) / 300.0;
+
+  RasterProjection projection(mesh.get(), extent, resolution);
+
+  //...Compare against the rasterizer used by Mesh::toRaster
+  const std::vector<double> z = mesh->z();
+  std::vector<double> wet(z);
+  for (size_t i = 0; i < wet.size(); i += 7) wet[i] = nullvalue;
+
+  MeshRasterizer rasterizer(*mesh->nodes(), *mesh->elements(),
+                            projection.xmin(), projection.ymax(), resolution,
+                            projection.nx(), projection.ny(), 64);
+  for (const auto &field : {z, wet}) {
+    const std::vector<float> a = projection.apply(field, nullvalue, true);
+    std::vector<float> tile;
+    for (size_t row = 0; row < rasterizer.numTileRows(); ++row) {
+      for (size_t col = 0; col < rasterizer.numTileColumns(); ++col) {
+        rasterizer.rasterize(col, row, field, nullvalue, true, tile);
+        for (size_t j = 0; j < rasterizer.tileHeight(row); ++j) {
+          for (size_t i = 0; i < rasterizer.tileWidth(col); ++i) {
+            const float expected = tile[j * rasterizer.tileWidth(col) + i];
+            const float v = a[(row * 64 + j) * projection.nx() + col * 64 + i];
+            if (std::abs(v - expected) >
+                1e-4 * std::max(1.0f, std::abs(expected))) {
+              std::cout << "Projected value " << v << " does not match "
+                        << expected << std::endl;
+              return 1;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //...Several fields at once give the same result as one at a time
+  const std::vector<std::vector<float>> both =
+      projection.apply({z, wet}, nullvalue, true);
+  if (both.size() != 2 || both[0] != projection.apply(z, nullvalue, true) ||
+      both[1] != projection.apply(wet, nullvalue, true)) {
+    std::cout << "Multiple field projection does not match" << std::endl;
+    return 1;
+  }
+
+  //...Round trip through a file
+  projection.write("test_files/ms-riv.rproj");
+  RasterProjection saved;
+  saved.read("test_files/ms-riv.rproj");
+  if (saved.hash() != projection.hash() || saved.nx() != projection.nx() ||
+      saved.ny() != projection.ny() ||
+      saved.apply(wet, nullvalue, true) != both[1]) {
+    std::cout << "Projection read from file does not match" << std::endl;
+    return 1;
+  }
+
+  //...Only the pixels covered by the mesh are stored, so a raster which is
+  //   mostly outside of the mesh takes far less than a value per pixel
+  const std::vector<double> padded = {
+      extent[0] - 2.0 * (extent[2] - extent[0]),
+      extent[1] - 2.0 * (extent[3] - extent[1]),
+      extent[2] + 2.0 * (extent[2] - extent[0]),
+      extent[3] + 2.0 * (extent[3] - extent[1])};
+  RasterProjection sparse(mesh.get(), padded, resolution);
+  sparse.write("test_files/ms-riv_padded.rproj");
+  std::ifstream sparseFile("test_files/ms-riv_padded.rproj",
+                           std::ios::binary | std::ios::ate);
+  const size_t fileSize = static_cast<size_t>(sparseFile.tellg());
+  if (fileSize > sparse.nx() * sparse.ny()) {
+    std::cout << "Projection file takes " << fileSize << " bytes for "
+              << sparse.nx() * sparse.ny() << " pixels" << std::endl;
+    return 1;
+  }
+
+  if (!saved.matches(mesh.get(), extent, resolution)) {
+    std::cout << "Saved projection does not match its mesh" << std::endl;
+    return 1;
+  }
+  if (saved.matches(mesh.get(), extent, resolution * 2.0)) {
+    std::cout << "Saved projection matches a different grid" << std::endl;
+    return 1;
+  }
+  mesh->node(10)->setX(mesh->node(10)->x() + 1e-6);
+  if (saved.matches(mesh.get(), extent, resolution)) {
+    std::cout << "Saved projection matches a modified mesh" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "RasterData.h"
+#include "RasterTileCache.h"
+
+//...Windows of a raster written from a mesh, of both pixel types, read from
+//   disk through the cache and again after the raster is read into memory
+int checkRasterWindows() {
+  using Adcirc::Raster::Rasterdata;
+  using Adcirc::Raster::RasterWindow;
+
+  std::unique_ptr<Adcirc::Geometry::Mesh> mesh(
+      new Adcirc::Geometry::Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  const std::vector<double> extent = mesh->extent();
+  Adcirc::Geometry::RasterProjection projection(
+      mesh.get(), extent, (extent[2] - extent[0]) / 300.0);
+  const std::vector<float> z = projection.apply(mesh->z());
+  projection.toRaster("test_files/cxx_rastertilecache.tif", mesh->z());
+
+  Rasterdata raster("test_files/cxx_rastertilecache.tif");
+  if (!raster.open() || raster.nx() != projection.nx() ||
+      raster.ny() != projection.ny()) {
+    std::cout << "Could not open the projected raster" << std::endl;
+    return 1;
+  }
+  raster.setTileCacheSize(64 * 64 * sizeof(double) * 4);
+
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) raster.read();
+    for (size_t k = 0; k < 200; ++k) {
+      const size_t i0 = (k * 37) % (raster.nx() - 20);
+      const size_t j0 = (k * 53) % (raster.ny() - 20);
+      RasterWindow<double> wd;
+      RasterWindow<int> wi;
+      if (!raster.window<double>(i0, j0, i0 + 19, j0 + 19, wd) ||
+          !raster.window<int>(i0, j0, i0 + 19, j0 + 19, wi)) {
+        std::cout << "Window could not be read" << std::endl;
+        return 1;
+      }
+      for (size_t j = j0; j < j0 + 20; ++j) {
+        for (size_t i = i0; i < i0 + 20; ++i) {
+          const float expected = z[j * raster.nx() + i];
+          if (wd.value(i, j) != expected ||
+              wi.value(i, j) != static_cast<int>(expected)) {
+            std::cout << "Window value does not match the projection"
+                      << std::endl;
+            return 1;
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+int main() {
+  using Adcirc::Raster::RasterTileCache;
+
+  const size_t nx = 1000;
+  const size_t ny = 700;
+  std::atomic<size_t> reads(0);
+
+  //...Synthetic raster where each pixel value encodes its own position
+  auto loader = [&](size_t i0, size_t j0, size_t tnx, size_t tny,
+                    double *buffer) {
+    reads++;
+    for (size_t j = 0; j < tny; ++j) {
+      for (size_t i = 0; i < tnx; ++i) {
+        buffer[j * tnx + i] = static_cast<double>((j0 + j) * nx + i0 + i);
+      }
+    }
+    return true;
+  };
+
+  //...Small budget so that eviction is exercised
+  const size_t budget = 64 * 64 * sizeof(double) * 16;
+  RasterTileCache cache(nx, ny, 64, 64, budget, loader);
+
+  std::atomic<size_t> errors(0);
+
+#pragma omp parallel for schedule(dynamic)
+  for (int k = 0; k < 20000; ++k) {
+    //...Overlapping windows sweeping across the raster
+    const size_t ic = (static_cast<size_t>(k) * 5) % (nx - 40);
+    const size_t jc = (static_cast<size_t>(k) * 5 / (nx - 40) * 20) % (ny - 40);
+    std::vector<double> z(40 * 40);
+    if (!cache.read(ic, jc, ic + 39, jc + 39, z.data())) {
+      errors++;
+      continue;
+    }
+    for (size_t j = 0; j < 40; ++j) {
+      for (size_t i = 0; i < 40; ++i) {
+        if (z[j * 40 + i] != static_cast<double>((jc + j) * nx + ic + i)) {
+          errors++;
+        }
+      }
+    }
+  }
+
+  auto t = cache.tile(nx - 1, ny - 1);
+  if (!t || t->value(nx - 1, ny - 1) != static_cast<double>(nx * ny - 1)) {
+    std::cout << "Edge tile returned incorrect value" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Hits: " << cache.hits() << ", Misses: " << cache.misses()
+            << ", Evictions: " << cache.evictions()
+            << ", Memory: " << cache.memoryUsage() << std::endl;
+
+  if (errors != 0) {
+    std::cout << "Cache returned incorrect values" << std::endl;
+    return 1;
+  }
+  if (cache.misses() != reads || cache.hits() == 0 ||
+      cache.evictions() == 0) {
+    std::cout << "Unexpected cache statistics" << std::endl;
+    return 1;
+  }
+  if (cache.memoryUsage() > budget + cache.numShards() * 64 * 64 * 8) {
+    std::cout << "Cache exceeded memory budget" << std::endl;
+    return 1;
+  }
+  if (cache.read<double>(0, 0, nx, 0, nullptr)) return 1;
+
+  return checkRasterWindows();
+}
@@ -0,0 +1,127 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "AdcircModules.h"
+
+//...Reads every record in order and then in reverse order and checks that
+//   the records are identical
+int checkFile(const std::string &filename) {
+  using namespace Adcirc::Output;
+
+  std::unique_ptr<ReadOutput> sequential(new ReadOutput(filename));
+  std::unique_ptr<ReadOutput> reverse(new ReadOutput(filename));
+  sequential->open();
+  reverse->open();
+
+  for (size_t i = 0; i < sequential->numSnaps(); ++i) {
+    sequential->read();
+  }
+
+  for (size_t i = reverse->numSnaps(); i > 0; --i) {
+    reverse->read(i - 1);
+  }
+
+  for (size_t i = 0; i < sequential->numSnaps(); ++i) {
+    OutputRecord *a = sequential->data(i);
+    OutputRecord *b = reverse->data(i);
+    if (a->time() != b->time() || a->iteration() != b->iteration()) {
+      std::cout << "Time mismatch in " << filename << " record " << i
+                << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < a->numNodes(); ++j) {
+      bool same = a->metadata()->isVector()
+                      ? a->u(j) == b->u(j) && a->v(j) == b->v(j)
+                      : a->z(j) == b->z(j);
+      if (!same) {
+        std::cout << "Value mismatch in " << filename << " record " << i
+                  << " node " << j << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...Reading beyond the last record must fail
+  bool thrown = false;
+  try {
+    reverse->read(reverse->numSnaps());
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  if (!thrown) {
+    std::cout << "No exception reading past the end of " << filename
+              << std::endl;
+    return 1;
+  }
+
+  sequential->close();
+  reverse->close();
+  return 0;
+}
+
+int main() {
+  if (checkFile("test_files/fort.63") != 0) return 1;
+  if (checkFile("test_files/sparse_fort.63") != 0) return 1;
+  if (checkFile("test_files/sparse_fort.64") != 0) return 1;
+
+  //...A bad line in a record decoded ahead of the caller is reported when
+  //   that record is requested, and the records before it are unaffected
+  {
+    std::ifstream in("test_files/fort.63");
+    std::ofstream out("test_files/cxx_readasciirandom_bad.63");
+    std::string line;
+    for (size_t n = 0; std::getline(in, line); ++n) {
+      //...A value line in the middle of the fourth record
+      out << (n == 2 + 3 * 2717 + 1500 ? std::string("  1500  bad") : line)
+          << "\n";
+    }
+  }
+  {
+    using namespace Adcirc::Output;
+    ReadOutput bad("test_files/cxx_readasciirandom_bad.63");
+    bad.open();
+    size_t failed = bad.numSnaps();
+    for (size_t i = 0; i < bad.numSnaps() && failed == bad.numSnaps(); ++i) {
+      try {
+        bad.read();
+      } catch (const std::exception &e) {
+        failed = i;
+      }
+    }
+    bad.close();
+    if (failed != 3) {
+      std::cout << "Bad record reported at snap " << failed << std::endl;
+      return 1;
+    }
+  }
+
+  //...Random access read of a single record
+  using namespace Adcirc::Output;
+  std::unique_ptr<ReadOutput> output(new ReadOutput("test_files/fort.63"));
+  output->open();
+  output->read(2);
+  output->close();
+
+  if (output->data(2)->z(42) == 0.21464678645) return 0;
+  return 1;
+}
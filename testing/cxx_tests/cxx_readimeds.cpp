@@ -0,0 +1,158 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+
+struct Sample {
+  Adcirc::CDate date;
+  double value;
+};
+
+//...Samples of station s, including dates before the epoch and a leap day
+std::vector<Sample> samples(size_t s) {
+  std::vector<Sample> v;
+  Adcirc::CDate d = s == 0 ? Adcirc::CDate(1969, 12, 31, 22, 0, 0)
+                           : Adcirc::CDate(2000, 2, 28, 12, 0, 0);
+  for (size_t i = 0; i < 200 + 50 * s; ++i) {
+    v.push_back({d, std::round(1e6 * std::sin(0.01 * i + s)) / 1e6});
+    d += Adcirc::CDate::minutes(6 + 30 * s);
+  }
+  return v;
+}
+
+//...Station 1 is written with CRLF line endings
+void writeImeds(const std::string &filename) {
+  FILE *f = std::fopen(filename.c_str(), "wb");
+  std::fprintf(f, "%% IMEDS generic format\n");
+  std::fprintf(f, "%% year month day hour min sec value\n");
+  std::fprintf(f, "%% test UTC MSL m\n");
+  for (size_t s = 0; s < 3; ++s) {
+    const char *eol = s == 1 ? "\r\n" : "\n";
+    std::fprintf(f, "station_%zu   %16.10f   %16.10f%s", s, 29.0 + s,
+                 -90.0 - s, eol);
+    for (const auto &x : samples(s)) {
+      std::fprintf(f, "%04d %02d %02d %02d %02d %02d %12.6f%s",
+                   x.date.year(), x.date.month(), x.date.day(), x.date.hour(),
+                   x.date.minute(), x.date.second(), x.value, eol);
+    }
+    if (s == 0) std::fprintf(f, "\n");
+  }
+  std::fclose(f);
+}
+
+int check(const Adcirc::Output::Hmdf &h, double tolerance) {
+  if (h.nstations() != 3) {
+    std::cout << "Read " << h.nstations() << " stations" << std::endl;
+    return 1;
+  }
+  for (size_t s = 0; s < 3; ++s) {
+    const auto *st = h.station(s);
+    const auto expected = samples(s);
+    if (st->numSnaps() != expected.size()) {
+      std::cout << "Station " << s << " has " << st->numSnaps() << " samples"
+                << std::endl;
+      return 1;
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+      if (st->date(i) != expected[i].date ||
+          std::abs(st->data(i) - expected[i].value) > tolerance ||
+          st->dateColumn()[i] !=
+              Adcirc::Output::HmdfStation::toEpochMilliseconds(
+                  expected[i].date)) {
+        std::cout << "Sample " << i << " of station " << s << " is "
+                  << st->date(i) << " " << st->data(i) << ", expected "
+                  << expected[i].date << " " << expected[i].value
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int main() {
+  const std::string imeds = "test_files/cxx_readimeds.imeds";
+  writeImeds(imeds);
+
+  Adcirc::Output::Hmdf h;
+  if (h.readImeds(imeds) != 0 || check(h, 1e-12) != 0) return 1;
+  if (h.station(2)->name() != "station_2" ||
+      std::abs(h.station(2)->latitude() - 31.0) > 1e-9 ||
+      std::abs(h.station(2)->longitude() + 92.0) > 1e-9) {
+    std::cout << "Station header was not read" << std::endl;
+    return 1;
+  }
+
+  //...Round trip through the writers
+  h.setDatum("MSL");
+  h.setUnits("m");
+  h.writeImeds("test_files/cxx_readimeds_2.imeds");
+  h.writeCsv("test_files/cxx_readimeds.csv");
+
+  Adcirc::Output::Hmdf h2;
+  if (h2.read("test_files/cxx_readimeds_2.imeds") != 0 || check(h2, 1e-6)) {
+    return 1;
+  }
+
+  Adcirc::Output::Hmdf h3;
+  if (h3.read("test_files/cxx_readimeds.csv") != 0 || check(h3, 1e-4)) {
+    return 1;
+  }
+  if (h3.datum() != "MSL" || h3.units() != "m") {
+    std::cout << "Csv metadata was not read" << std::endl;
+    return 1;
+  }
+
+  //...Vector data in csv format
+  Adcirc::Output::Hmdf v(2);
+  Adcirc::Output::HmdfStation vs(2);
+  for (const auto &x : samples(1)) {
+    vs.setNext(x.date, x.value, -x.value);
+  }
+  v.addStation(vs);
+  v.writeCsv("test_files/cxx_readimeds_vector.csv");
+  Adcirc::Output::Hmdf v2(2);
+  if (v2.readCsv("test_files/cxx_readimeds_vector.csv") != 0 ||
+      v2.nstations() != 1 || v2.station(0)->numSnaps() != vs.numSnaps() ||
+      std::abs(v2.station(0)->data(10, 1) + vs.data(10, 0)) > 1e-4 ||
+      v2.station(0)->date(10) != vs.date(10)) {
+    std::cout << "Vector csv file was not read" << std::endl;
+    return 1;
+  }
+
+  //...Sanitize sorts the samples by date and removes invalid values
+  Adcirc::Output::HmdfStation st;
+  st.setNext(Adcirc::CDate(2020, 1, 2), 2.0);
+  st.setNext(Adcirc::CDate(2020, 1, 1), 1.0);
+  st.setNext(Adcirc::CDate(2020, 1, 3), 100.0);
+  st.sanitize(-10.0, 10.0);
+  if (st.date(0) != Adcirc::CDate(2020, 1, 1) || st.data(0) != 1.0 ||
+      st.data(1) != 2.0 ||
+      st.data(2) != Adcirc::Output::HmdfStation::nullDataValue()) {
+    std::cout << "Sanitize failed" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int compareMesh(const std::string &filename) {
+  using namespace Adcirc::Geometry;
+
+  std::unique_ptr<Mesh> m1(new Mesh(filename));
+  m1->read();
+
+  std::unique_ptr<Mesh> m2(new Mesh(filename));
+  m2->setReaderMode(MeshReaderMapped);
+  m2->read();
+
+  if (m1->numNodes() != m2->numNodes() ||
+      m1->numElements() != m2->numElements() ||
+      m1->numOpenBoundaries() != m2->numOpenBoundaries() ||
+      m1->numLandBoundaries() != m2->numLandBoundaries() ||
+      m1->meshHeaderString() != m2->meshHeaderString()) {
+    std::cout << filename << ": Mesh dimensions do not match" << std::endl;
+    return 1;
+  }
+
+  if (m1->nodeOrderingIsLogical() != m2->nodeOrderingIsLogical() ||
+      m1->elementOrderingIsLogical() != m2->elementOrderingIsLogical()) {
+    std::cout << filename << ": Mesh ordering does not match" << std::endl;
+    return 1;
+  }
+
+  for (size_t i = 0; i < m1->numNodes(); ++i) {
+    if (m1->node(i)->id() != m2->node(i)->id() ||
+        m1->node(i)->x() != m2->node(i)->x() ||
+        m1->node(i)->y() != m2->node(i)->y() ||
+        m1->node(i)->z() != m2->node(i)->z()) {
+      std::cout << filename << ": Node " << i << " does not match"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  for (size_t i = 0; i < m1->numElements(); ++i) {
+    if (m1->element(i)->id() != m2->element(i)->id() ||
+        m1->element(i)->n() != m2->element(i)->n()) {
+      std::cout << filename << ": Element " << i << " does not match"
+                << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < m1->element(i)->n(); ++j) {
+      if (m1->element(i)->node(j)->id() != m2->element(i)->node(j)->id()) {
+        std::cout << filename << ": Element " << i << " does not match"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < m1->numOpenBoundaries(); ++i) {
+    if (m1->openBoundary(i)->toStringList() !=
+        m2->openBoundary(i)->toStringList()) {
+      std::cout << filename << ": Open boundary " << i << " does not match"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  for (size_t i = 0; i < m1->numLandBoundaries(); ++i) {
+    if (m1->landBoundary(i)->toStringList() !=
+        m2->landBoundary(i)->toStringList()) {
+      std::cout << filename << ": Land boundary " << i << " does not match"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main() {
+  std::vector<std::string> files = {"test_files/ms-riv.grd",
+                                    "test_files/ms-riv2.grd",
+                                    "test_files/internal_overflow.grd"};
+  for (const auto &f : files) {
+    if (compareMesh(f) != 0) return 1;
+  }
+  return 0;
+}
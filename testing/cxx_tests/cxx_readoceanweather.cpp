@@ -0,0 +1,101 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "OceanweatherTestFile.h"
+
+//...Value written at index i of a field in record r
+double fieldValue(size_t field, size_t record, size_t i) {
+  const double base[3] = {1013.0, 0.0, 0.0};
+  const double v = base[field] - 25.0 * std::sin(0.1 * i + record) +
+                   (field == 0 ? 0.0 : 12.5 * std::cos(0.07 * i * field));
+  return std::round(v * 1e4) / 1e4;
+}
+
+//...Lines of the second record are written in free format with exponents
+//   on every fifth line
+void writeFile(const std::string &filename, bool wind, size_t nx, size_t ny,
+               double swlat, double swlon) {
+  OceanweatherTestFile::Spec spec;
+  spec.wind = wind;
+  spec.numRecords = 2;
+  spec.grid = [=](size_t) {
+    return OceanweatherTestFile::Grid{nx, ny, 0.25, swlat, swlon};
+  };
+  spec.value = [](size_t r, size_t field, size_t i) {
+    return fieldValue(field, r, i);
+  };
+  spec.freeFormat = [](size_t r, size_t line) {
+    return r == 1 && line % 5 == 0;
+  };
+  OceanweatherTestFile::write(filename, spec);
+}
+
+int main() {
+  const size_t nx[2] = {13, 40};
+  const size_t ny[2] = {7, 24};
+  Adcirc::Oceanweather owi;
+  for (size_t d = 0; d < 2; ++d) {
+    const std::string base = "test_files/cxx_readoceanweather_" +
+                             std::to_string(d);
+    writeFile(base + ".pre", false, nx[d], ny[d], 20.0 + d, -95.0 + d);
+    writeFile(base + ".win", true, nx[d], ny[d], 20.0 + d, -95.0 + d);
+    owi.addDomain(base + ".pre", base + ".win");
+  }
+
+  for (size_t r = 0; r < 2; ++r) {
+    if (owi.read() != 0) {
+      std::cout << "Error reading record " << r << std::endl;
+      return 1;
+    }
+    Adcirc::OceanweatherRecord record = owi.record();
+    for (size_t d = 0; d < 2; ++d) {
+      const auto *domain = record.domain(d);
+      const std::vector<double> *data[3] = {
+          &domain->data_pressure, &domain->data_u, &domain->data_v};
+      for (size_t field = 0; field < 3; ++field) {
+        if (data[field]->size() != nx[d] * ny[d]) {
+          std::cout << "Unexpected number of values" << std::endl;
+          return 1;
+        }
+        for (size_t i = 0; i < nx[d] * ny[d]; ++i) {
+          const double expected = fieldValue(field, r, i);
+          if (std::abs((*data[field])[i] - expected) > 1e-9) {
+            std::cout << "Value " << i << " of field " << field
+                      << " in domain " << d << " is " << (*data[field])[i]
+                      << ", expected " << expected << std::endl;
+            return 1;
+          }
+        }
+      }
+    }
+  }
+
+  //...No records remain
+  if (owi.read() == 0) {
+    std::cout << "Read past the end of the files" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
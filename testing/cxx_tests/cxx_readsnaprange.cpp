@@ -0,0 +1,126 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <iostream>
+#include <memory>
+#include <set>
+
+#include "AdcircModules.h"
+
+//...Compares the records from a snap range with records read one at a time
+int checkFile(const std::string &filename, size_t queueDepth,
+              size_t memoryLimit) {
+  using namespace Adcirc::Output;
+
+  std::unique_ptr<ReadOutput> output(new ReadOutput(filename));
+  std::unique_ptr<ReadOutput> reference(new ReadOutput(filename));
+  output->open();
+  reference->open();
+
+  const size_t firstSnap = 2;
+  const size_t numSnaps = output->numSnaps() - firstSnap;
+
+  OutputSnapRange range(output.get(), firstSnap, numSnaps);
+  range.setQueueDepth(queueDepth);
+  range.setMemoryLimit(memoryLimit);
+
+  std::set<OutputRecord *> buffers;
+  size_t snap = firstSnap;
+  for (auto &r : range) {
+    buffers.insert(&r);
+    reference->read(snap);
+    OutputRecord *ref = reference->dataAt(0);
+    if (r.record() != snap || r.time() != ref->time() ||
+        r.iteration() != ref->iteration()) {
+      std::cout << "Record mismatch in " << filename << " snap " << snap
+                << std::endl;
+      return 1;
+    }
+    for (size_t i = 0; i < output->numNodes(); ++i) {
+      bool same = r.metadata()->isVector()
+                      ? r.u(i) == ref->u(i) && r.v(i) == ref->v(i)
+                      : r.z(i) == ref->z(i);
+      if (!same) {
+        std::cout << "Value mismatch in " << filename << " snap " << snap
+                  << " node " << i << std::endl;
+        return 1;
+      }
+    }
+    reference->clear();
+    snap++;
+  }
+
+  if (snap != firstSnap + numSnaps) {
+    std::cout << "Incorrect number of records from " << filename << std::endl;
+    return 1;
+  }
+
+  //...netCDF files are read ahead as well, while the reference file is read
+  //   on this thread
+  if (queueDepth > 0 && memoryLimit == OutputSnapRange::defaultMemoryLimit() &&
+      range.effectiveQueueDepth() == 0) {
+    std::cout << "File not read ahead in " << filename << std::endl;
+    return 1;
+  }
+
+  //...Records are recycled rather than allocated for each snap
+  if (buffers.size() > range.effectiveQueueDepth() + 1) {
+    std::cout << "Records not reused in " << filename << std::endl;
+    return 1;
+  }
+
+  //...A range may be abandoned before it is complete
+  {
+    OutputSnapRange partial(output.get(), 0, output->numSnaps());
+    partial.setQueueDepth(queueDepth);
+    if (partial.next() == nullptr) return 1;
+  }
+
+  output->close();
+  reference->close();
+  return 0;
+}
+
+int main() {
+  using Adcirc::Output::OutputSnapRange;
+
+  const std::vector<std::string> files = {
+      "test_files/fort.63", "test_files/sparse_fort.64",
+      "test_files/fort.63.nc", "test_files/fort.64.nc"};
+
+  for (const auto &f : files) {
+    if (checkFile(f, 0, OutputSnapRange::defaultMemoryLimit()) != 0) return 1;
+    if (checkFile(f, 1, OutputSnapRange::defaultMemoryLimit()) != 0) return 1;
+    if (checkFile(f, 4, OutputSnapRange::defaultMemoryLimit()) != 0) return 1;
+    //...The memory limit only allows one record, so reads are not queued
+    if (checkFile(f, 4, 1) != 0) return 1;
+  }
+
+  Adcirc::Output::ReadOutput output("test_files/fort.63");
+  output.open();
+  bool thrown = false;
+  try {
+    OutputSnapRange range(&output, output.numSnaps() - 1, 2);
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+  output.close();
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+
+//...Compares a time series read at a set of nodes with the full records
+int checkFile(const std::string &filename, const std::vector<size_t> &nodes) {
+  using namespace Adcirc::Output;
+
+  std::unique_ptr<ReadOutput> output(new ReadOutput(filename));
+  output->open();
+
+  const size_t firstSnap = 3;
+  const size_t numSnaps = 10;
+  OutputTimeseries ts = output->readTimeseries(nodes, firstSnap, numSnaps);
+
+  if (ts.numSnaps() != numSnaps || ts.numNodes() != nodes.size()) {
+    std::cout << "Incorrect size of time series from " << filename
+              << std::endl;
+    return 1;
+  }
+
+  for (size_t s = 0; s < numSnaps; ++s) {
+    output->read(firstSnap + s);
+    OutputRecord *r = output->data(firstSnap + s);
+    if (ts.time(s) != r->time() || ts.iteration(s) != r->iteration()) {
+      std::cout << "Time mismatch in " << filename << std::endl;
+      return 1;
+    }
+    for (size_t p = 0; p < nodes.size(); ++p) {
+      bool same = r->metadata()->isVector()
+                      ? ts.u(s, p) == r->u(nodes[p]) &&
+                            ts.v(s, p) == r->v(nodes[p])
+                      : ts.z(s, p) == r->z(nodes[p]);
+      if (!same) {
+        std::cout << "Value mismatch in " << filename << " snap " << s
+                  << " node " << nodes[p] << std::endl;
+        return 1;
+      }
+    }
+    output->clear();
+  }
+
+  //...Out of range requests must fail
+  bool thrown = false;
+  try {
+    output->readTimeseries(nodes, output->numSnaps() - 1, 2);
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+
+  thrown = false;
+  try {
+    output->readTimeseries({output->numNodes()}, 0, 1);
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+
+  output->close();
+  return 0;
+}
+
+int main() {
+  //...Unordered nodes with a duplicate, and evenly spaced nodes
+  const std::vector<std::vector<size_t>> nodeSets = {
+      {1220, 42, 0, 2715, 42, 1000, 1001}, {100, 110, 120, 130, 140}};
+
+  for (const auto &nodes : nodeSets) {
+    if (checkFile("test_files/fort.63", nodes) != 0) return 1;
+    if (checkFile("test_files/sparse_fort.64", nodes) != 0) return 1;
+    if (checkFile("test_files/fort.63.nc", nodes) != 0) return 1;
+    if (checkFile("test_files/fort.64.nc", nodes) != 0) return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+//...Checks that record addresses are stable and that spans match values()
+int checkFile(const std::string &filename) {
+  using namespace Adcirc::Output;
+
+  std::unique_ptr<ReadOutput> output(new ReadOutput(filename));
+  output->open();
+
+  //...Pointers to earlier records must survive later reads
+  output->read(0);
+  OutputRecord *first = output->data(0);
+  const std::vector<double> firstValues = first->values(0);
+  for (size_t i = 1; i < 20; ++i) {
+    output->read(i);
+  }
+  if (output->data(0) != first || first->values(0) != firstValues) {
+    std::cout << "Record moved in " << filename << std::endl;
+    return 1;
+  }
+
+  //...Removing a record does not move the others
+  OutputRecord *fifth = output->data(5);
+  output->clearAt(0);
+  if (output->data(5) != fifth || output->dataAt(4) != fifth) {
+    std::cout << "Record moved after clearAt in " << filename << std::endl;
+    return 1;
+  }
+
+  //...Spans view the same values without copying
+  for (size_t c = 0; c < fifth->metadata()->dimension(); ++c) {
+    OutputSpan span = fifth->span(c);
+    std::vector<double> v = fifth->values(c);
+    if (span.size() != v.size() ||
+        !std::equal(span.begin(), span.end(), v.begin())) {
+      std::cout << "Span mismatch in " << filename << std::endl;
+      return 1;
+    }
+  }
+
+  bool thrown = false;
+  try {
+    fifth->span(fifth->metadata()->dimension());
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  if (!thrown) return 1;
+
+  //...Records read after clearing reuse storage and hold the right snap
+  output->clear();
+  for (size_t i = 0; i < 5; ++i) {
+    output->read(i);
+    OutputRecord *r = output->dataAt(0);
+    if (r->record() != i) return 1;
+    if (i == 0 && r->values(0) != firstValues) {
+      std::cout << "Reused record mismatch in " << filename << std::endl;
+      return 1;
+    }
+    output->clearAt(0);
+  }
+
+  output->close();
+  return 0;
+}
+
+int main() {
+  if (checkFile("test_files/fort.63") != 0) return 1;
+  if (checkFile("test_files/sparse_fort.64") != 0) return 1;
+  if (checkFile("test_files/fort.63.nc") != 0) return 1;
+  if (checkFile("test_files/fort.64.nc") != 0) return 1;
+  return 0;
+}
@@ -0,0 +1,128 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+#include "shapefil.h"
+
+//...Reads an element shapefile back with shapelib and compares it with the
+//   mesh
+int checkElements(Adcirc::Geometry::Mesh *mesh, const std::string &filename) {
+  SHPHandle shp = SHPOpen(filename.c_str(), "rb");
+  DBFHandle dbf = DBFOpen(filename.c_str(), "rb");
+  if (shp == nullptr || dbf == nullptr) return 1;
+
+  int numEntities, shapeType;
+  SHPGetInfo(shp, &numEntities, &shapeType, nullptr, nullptr);
+  if (static_cast<size_t>(numEntities) != mesh->numElements() ||
+      DBFGetRecordCount(dbf) != numEntities || shapeType != SHPT_POLYGON) {
+    std::cout << "Incorrect number of elements" << std::endl;
+    return 1;
+  }
+
+  for (int i = 0; i < numEntities; ++i) {
+    Adcirc::Geometry::Element *e = mesh->element(i);
+    SHPObject *obj = SHPReadObject(shp, i);
+    bool ok = obj != nullptr && static_cast<size_t>(obj->nVertices) == e->n();
+    for (size_t j = 0; ok && j < e->n(); ++j) {
+      ok = obj->padfX[j] == e->node(j)->x() && obj->padfY[j] == e->node(j)->y();
+      ok = ok && DBFReadIntegerAttribute(dbf, i, 1 + j) ==
+                     static_cast<int>(e->node(j)->id());
+      ok = ok && std::abs(DBFReadDoubleAttribute(dbf, i, 5 + j) -
+                          e->node(j)->z()) < 0.0001;
+    }
+    ok = ok && DBFReadIntegerAttribute(dbf, i, 0) == static_cast<int>(e->id());
+    if (ok && e->n() == 3) ok = DBFReadIntegerAttribute(dbf, i, 4) == -1;
+    SHPDestroyObject(obj);
+    if (!ok) {
+      std::cout << "Element " << i << " does not match the mesh" << std::endl;
+      return 1;
+    }
+  }
+
+  DBFClose(dbf);
+  SHPClose(shp);
+  return 0;
+}
+
+int checkNodes(Adcirc::Geometry::Mesh *mesh, const std::string &filename) {
+  SHPHandle shp = SHPOpen(filename.c_str(), "rb");
+  DBFHandle dbf = DBFOpen(filename.c_str(), "rb");
+  if (shp == nullptr || dbf == nullptr) return 1;
+
+  int numEntities, shapeType;
+  double minBound[4], maxBound[4];
+  SHPGetInfo(shp, &numEntities, &shapeType, minBound, maxBound);
+  if (static_cast<size_t>(numEntities) != mesh->numNodes() ||
+      shapeType != SHPT_POINT) {
+    std::cout << "Incorrect number of nodes" << std::endl;
+    return 1;
+  }
+
+  std::vector<double> extent = mesh->extent();
+  if (minBound[0] != extent[0] || minBound[1] != extent[1] ||
+      maxBound[0] != extent[2] || maxBound[1] != extent[3]) {
+    std::cout << "Incorrect node shapefile bounds" << std::endl;
+    return 1;
+  }
+
+  for (int i = 0; i < numEntities; ++i) {
+    Adcirc::Geometry::Node *n = mesh->node(i);
+    SHPObject *obj = SHPReadObject(shp, i);
+    bool ok = obj != nullptr && obj->padfX[0] == n->x() &&
+              obj->padfY[0] == n->y() &&
+              DBFReadIntegerAttribute(dbf, i, 0) == static_cast<int>(n->id());
+    SHPDestroyObject(obj);
+    if (!ok) {
+      std::cout << "Node " << i << " does not match the mesh" << std::endl;
+      return 1;
+    }
+  }
+
+  DBFClose(dbf);
+  SHPClose(shp);
+  return 0;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  mesh->toElementShapefile("test_files/ms-riv-export-elements.shp");
+  if (checkElements(mesh.get(), "test_files/ms-riv-export-elements.shp") != 0)
+    return 1;
+
+  mesh->toNodeShapefile("test_files/ms-riv-export-nodes.shp");
+  if (checkNodes(mesh.get(), "test_files/ms-riv-export-nodes.shp") != 0)
+    return 1;
+
+  //...Other names are written as shapefiles, as shapelib does
+  mesh->toNodeShapefile("test_files/ms-riv-export-nodes-noext");
+  if (checkNodes(mesh.get(), "test_files/ms-riv-export-nodes-noext.shp") != 0)
+    return 1;
+
+  mesh->toNodeShapefile("test_files/ms-riv-export-nodes-xyz.xyz");
+  if (checkNodes(mesh.get(), "test_files/ms-riv-export-nodes-xyz.shp") != 0)
+    return 1;
+
+  return 0;
+}
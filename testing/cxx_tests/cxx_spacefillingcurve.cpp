@@ -0,0 +1,91 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "SpaceFillingCurve.h"
+
+using Adcirc::Private::SpaceFillingCurve;
+
+double pathLength(const std::vector<double> &x, const std::vector<double> &y,
+                  const std::vector<size_t> &order) {
+  double d = 0.0;
+  for (size_t i = 1; i < order.size(); ++i) {
+    d += std::hypot(x[order[i]] - x[order[i - 1]],
+                    y[order[i]] - y[order[i - 1]]);
+  }
+  return d;
+}
+
+int main() {
+  //...Consecutive Hilbert indices must be neighboring cells
+  for (uint32_t j = 0; j < 16; ++j) {
+    for (uint32_t i = 0; i < 16; ++i) {
+      for (uint32_t jj = 0; jj < 16; ++jj) {
+        for (uint32_t ii = 0; ii < 16; ++ii) {
+          if (SpaceFillingCurve::hilbert(ii, jj) ==
+                  SpaceFillingCurve::hilbert(i, j) + 1 &&
+              std::abs(static_cast<int>(ii) - static_cast<int>(i)) +
+                      std::abs(static_cast<int>(jj) - static_cast<int>(j)) !=
+                  1) {
+            std::cout << "Hilbert curve is not continuous" << std::endl;
+            return 1;
+          }
+        }
+      }
+    }
+  }
+
+  if (SpaceFillingCurve::morton(3, 5) != 39) {
+    std::cout << "Morton index is incorrect" << std::endl;
+    return 1;
+  }
+
+  std::unique_ptr<Adcirc::Geometry::Mesh> mesh(
+      new Adcirc::Geometry::Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  std::vector<double> x = mesh->x();
+  std::vector<double> y = mesh->y();
+
+  std::vector<size_t> original(x.size());
+  for (size_t i = 0; i < x.size(); ++i) original[i] = i;
+
+  for (auto c : {SpaceFillingCurve::Morton, SpaceFillingCurve::Hilbert}) {
+    std::vector<size_t> order = SpaceFillingCurve::order(x, y, c);
+    std::vector<size_t> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted != original) {
+      std::cout << "Ordering is not a permutation" << std::endl;
+      return 1;
+    }
+    double d0 = pathLength(x, y, original);
+    double d1 = pathLength(x, y, order);
+    std::cout << "Path length: " << d0 << " -> " << d1 << std::endl;
+    if (d1 >= d0) {
+      std::cout << "Ordering did not improve locality" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "interpolation/WindRoughnessKernel.h"
+
+using Adcirc::Private::WindRoughnessKernel;
+
+//...Relative tolerance between the vector and scalar implementations
+constexpr double c_tolerance = 1e-12;
+
+int main() {
+  //...Pixels on a regular grid around the query point, which includes the
+  //   coincident pixel, pixels on the axes and pixels on the diagonals, plus
+  //   a set of randomly placed pixels
+  std::vector<double> dx, dy, z;
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> value(0.0, 0.05);
+  for (int j = -100; j <= 100; ++j) {
+    for (int i = -100; i <= 100; ++i) {
+      dx.push_back(i * 0.03);
+      dy.push_back(j * 0.03);
+      z.push_back(value(gen));
+    }
+  }
+  std::uniform_real_distribution<double> offset(-10.0, 10.0);
+  for (size_t i = 0; i < 1001; ++i) {
+    dx.push_back(offset(gen));
+    dy.push_back(offset(gen));
+    z.push_back(value(gen));
+  }
+
+  if (WindRoughnessKernel::direction(1.0, 0.0) != 6 ||
+      WindRoughnessKernel::direction(0.0, 1.0) != 9 ||
+      WindRoughnessKernel::direction(-1.0, 0.0) != 0 ||
+      WindRoughnessKernel::direction(0.0, -1.0) != 3 ||
+      WindRoughnessKernel::direction(0.0, 0.0) != 12) {
+    std::cout << "Direction binning incorrect" << std::endl;
+    return 1;
+  }
+
+  const size_t nb = WindRoughnessKernel::numBins();
+  std::vector<double> refWeight(nb, 0.0), refWind(nb, 0.0);
+  WindRoughnessKernel::accumulate(WindRoughnessKernel::Scalar, dx.data(),
+                                  dy.data(), z.data(), z.size(),
+                                  refWeight.data(), refWind.data());
+
+  const auto best = WindRoughnessKernel::bestAvailable();
+  std::cout << "Best available kernel: " << best << std::endl;
+  for (int impl = WindRoughnessKernel::Avx2; impl <= best; ++impl) {
+    std::vector<double> weight(nb, 0.0), wind(nb, 0.0);
+    WindRoughnessKernel::accumulate(
+        static_cast<WindRoughnessKernel::Implementation>(impl), dx.data(),
+        dy.data(), z.data(), z.size(), weight.data(), wind.data());
+    for (size_t i = 0; i < nb; ++i) {
+      const double ew = std::abs(weight[i] - refWeight[i]) / refWeight[i];
+      const double ez = std::abs(wind[i] - refWind[i]) / refWind[i];
+      if (!(ew < c_tolerance) || !(ez < c_tolerance)) {
+        std::cout << "Kernel " << impl << " bin " << i
+                  << " differs from scalar: " << weight[i] << " "
+                  << refWeight[i] << " " << wind[i] << " " << refWind[i]
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
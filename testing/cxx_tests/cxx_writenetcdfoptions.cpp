@@ -0,0 +1,149 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+#include "NetcdfBlockWriter.h"
+
+//...Writes the first snaps of fort.63 with a set of options and compares the
+//   values read back, both as records and as time series
+int checkOptions(Adcirc::Geometry::Mesh *mesh,
+                 Adcirc::Output::ReadOutput *input,
+                 const Adcirc::Output::NetcdfWriteOptions &options,
+                 double tolerance) {
+  using namespace Adcirc::Output;
+  const std::string filename = "test_files/fort.write.options.63.nc";
+  const size_t numSnaps = input->numSnaps();
+
+  std::unique_ptr<WriteOutput> writer(new WriteOutput(filename, input, mesh));
+  writer->setNetcdfOptions(options);
+  writer->open();
+  for (size_t i = 0; i < numSnaps; ++i) {
+    writer->write(input->data(i));
+  }
+  writer->close();
+  writer.reset(nullptr);
+
+  std::unique_ptr<ReadOutput> output(new ReadOutput(filename));
+  output->open();
+  if (output->numSnaps() != numSnaps) {
+    std::cout << "Incorrect number of snaps" << std::endl;
+    return 1;
+  }
+
+  for (size_t i = 0; i < numSnaps; ++i) {
+    output->read(i);
+    const OutputRecord *a = input->data(i);
+    const OutputRecord *b = output->data(i);
+    if (a->time() != b->time()) {
+      std::cout << "Time mismatch in snap " << i << std::endl;
+      return 1;
+    }
+    for (size_t j = 0; j < a->numNodes(); ++j) {
+      double v0 = a->z(j);
+      double v1 = b->z(j);
+      if (std::abs(v0 - v1) > tolerance * std::abs(v0)) {
+        std::cout << "Value mismatch in snap " << i << " node " << j << ": "
+                  << v0 << " " << v1 << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  const std::vector<size_t> nodes = {0, 10, 100,
+                                     input->data(0)->numNodes() - 1};
+  OutputTimeseries ts = output->readTimeseries(nodes, 0, numSnaps);
+  for (size_t s = 0; s < numSnaps; ++s) {
+    for (size_t p = 0; p < nodes.size(); ++p) {
+      if (ts.z(s, p) != output->data(s)->z(nodes[p])) {
+        std::cout << "Time series mismatch in snap " << s << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  output->close();
+  return 0;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Output;
+  using Adcirc::Private::NetcdfBlockWriter;
+
+  //...Quantized values keep the requested precision and default values
+  double q[4] = {1.2345678901, -98765.4321, 0.0, -99999.0};
+  NetcdfBlockWriter::quantize(q, 4, 4, -99999.0);
+  if (std::abs(q[0] - 1.2345678901) > 1e-4 * 1.2345678901 ||
+      std::abs(q[1] + 98765.4321) > 1e-4 * 98765.4321 || q[2] != 0.0 ||
+      q[3] != -99999.0) {
+    std::cout << "Quantization error" << std::endl;
+    return 1;
+  }
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  std::unique_ptr<ReadOutput> input(new ReadOutput("test_files/fort.63"));
+  input->open();
+  for (size_t i = 0; i < input->numSnaps(); ++i) {
+    input->read(i);
+  }
+
+  NetcdfWriteOptions options;
+  if (checkOptions(mesh.get(), input.get(), options, 0.0) != 0) return 1;
+
+  options.setChunkLayout(ChunkSnapMajor);
+  options.setFillPolicy(FillNone);
+  if (checkOptions(mesh.get(), input.get(), options, 0.0) != 0) return 1;
+
+  //...Chunks which do not divide the number of snaps or nodes
+  options.setChunkLayout(ChunkNodeBlocked);
+  options.setChunkSnaps(7);
+  options.setChunkNodes(1000);
+  options.setDeflateLevel(5);
+  if (checkOptions(mesh.get(), input.get(), options, 0.0) != 0) return 1;
+
+  options.setAsyncWrite(true);
+  options.setAsyncQueueDepth(1);
+  if (checkOptions(mesh.get(), input.get(), options, 0.0) != 0) return 1;
+
+  options.setSignificantDigits(4);
+  options.setDeflateLevel(0);
+  options.setShuffle(false);
+  if (checkOptions(mesh.get(), input.get(), options, 1e-4) != 0) return 1;
+
+  //...Options cannot change once the file is open
+  WriteOutput writer("test_files/fort.write.options.63.nc", input.get(),
+                     mesh.get());
+  writer.open();
+  bool thrown = false;
+  try {
+    writer.setNetcdfOptions(options);
+  } catch (const std::exception &e) {
+    thrown = true;
+  }
+  writer.close();
+  if (!thrown) return 1;
+
+  input->close();
+  return 0;
+}
@@ -0,0 +1,111 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2019 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMODULES_OCEANWEATHERTESTFILE_H
+#define ADCMODULES_OCEANWEATHERTESTFILE_H
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "CDate.h"
+
+namespace OceanweatherTestFile {
+
+/**
+ * @brief Grid of one record
+ */
+struct Grid {
+  size_t nx;
+  size_t ny;
+  double dx;
+  double swlat;
+  double swlon;
+};
+
+/**
+ * @brief Describes the contents of a synthetic Oceanweather (OWI) file
+ *
+ * Fields are numbered 0 for pressure and 1 and 2 for the u and v wind
+ * components. Values are written 8 per line in the 8F10.4 layout. Lines for
+ * which freeFormat returns true are written with exponents and end in CRLF.
+ */
+struct Spec {
+  bool wind = false;
+  size_t numRecords = 1;
+  Adcirc::CDate start = Adcirc::CDate(2005, 8, 28);
+  int intervalHours = 6;
+  const char *eol = "\n";
+  std::function<Grid(size_t record)> grid;
+  std::function<double(size_t record, size_t field, size_t i)> value;
+  std::function<bool(size_t record, size_t line)> freeFormat;
+};
+
+inline std::string dateString(const Adcirc::CDate &d) {
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), "%04d%02d%02d%02d%02d", d.year(),
+                d.month(), d.day(), d.hour(), d.minute());
+  return buffer;
+}
+
+inline Adcirc::CDate recordTime(const Spec &spec, size_t record) {
+  return spec.start +
+         Adcirc::CDate::hours(spec.intervalHours * static_cast<int>(record));
+}
+
+/**
+ * @brief Writes the file described by spec
+ * @return false if the file could not be opened
+ */
+inline bool write(const std::string &filename, const Spec &spec) {
+  FILE *f = std::fopen(filename.c_str(), "wb");
+  if (!f) return false;
+
+  const std::string first = dateString(spec.start).substr(0, 10);
+  const std::string last =
+      dateString(recordTime(spec, spec.numRecords - 1)).substr(0, 10);
+  std::fprintf(f, "%-55s%s     %s%s", "Oceanweather WIN/PRE Format",
+               first.c_str(), last.c_str(), spec.eol);
+
+  for (size_t r = 0; r < spec.numRecords; ++r) {
+    const Grid g = spec.grid(r);
+    std::fprintf(f,
+                 "iLat=%4zuiLong=%4zuDX=%6.4fDY=%6.4fSWLat=%8.5fSWLon=%8.4f"
+                 "DT=%s%s",
+                 g.ny, g.nx, g.dx, g.dx, g.swlat, g.swlon,
+                 dateString(recordTime(spec, r)).c_str(), spec.eol);
+    const size_t n = g.nx * g.ny;
+    for (size_t field = spec.wind ? 1 : 0; field < (spec.wind ? 3 : 1);
+         ++field) {
+      for (size_t i = 0; i < n; i += 8) {
+        const bool free = spec.freeFormat && spec.freeFormat(r, i / 8);
+        for (size_t j = i; j < std::min(n, i + 8); ++j) {
+          std::fprintf(f, free ? " %.8E" : "%10.4f", spec.value(r, field, j));
+        }
+        std::fprintf(f, "%s", free ? "\r\n" : spec.eol);
+      }
+    }
+  }
+  std::fclose(f);
+  return true;
+}
+
+}  // namespace OceanweatherTestFile
+
+#endif  // ADCMODULES_OCEANWEATHERTESTFILE_H
@@ -29,7 +29,6 @@ std::string toTidefacString(Adcirc::CDate &d);
 std::string toSwanString(Adcirc::CDate &d);
 std::tuple<Adcirc::CDate, Adcirc::CDate, int> readOceanweatherDates(
     const std::string &filename);
-Adcirc::CDate dateFromOWIString(const std::string &str);
 
 int main(int argc, char *argv[]) {
   cxxopts::Options options("generateAdcircSimulationDates",
@@ -135,46 +134,15 @@ int main(int argc, char *argv[]) {
 
 std::tuple<Adcirc::CDate, Adcirc::CDate, int> readOceanweatherDates(
     const std::string &owifile) {
-  std::ifstream owi(owifile);
-  std::string line;
-  std::getline(owi, line);
-  std::vector<std::string> split;
-  Adcirc::FileIO::Generic::splitString(line, split);
-  std::string dateStartString = split[split.size() - 2];
-  std::string dateEndString = split.back();
-
-  Adcirc::CDate dateStart = dateFromOWIString(dateStartString);
-  Adcirc::CDate dateEnd = dateFromOWIString(dateEndString);
-
-  std::getline(owi, line);
-  Adcirc::FileIO::Generic::sanitizeString(line);
-  Adcirc::FileIO::Generic::splitString(line, split);
-  int ilat = stoi(line.substr(5, 4));
-  int ilon = stoi(line.substr(15, 4));
-  std::string d1 = line.substr(68, 12);
-  size_t nline = (ilat * ilon) / 8;
-  if ((ilat * ilon) % 8 != 0) nline++;
-  for (size_t i = 0; i < nline; ++i) {
-    std::getline(owi, line);
+  //...Only the dates are needed, so no index cache is left next to the file
+  const bool wind = Adcirc::OceanweatherIndex::isWindFile(owifile);
+  Adcirc::OceanweatherIndex index(owifile, wind, false);
+  long long dt = 0;
+  if (index.nSnaps() > 1) {
+    dt = index.time(1).toSeconds() - index.time(0).toSeconds();
   }
-  std::getline(owi, line);
-  std::string d2 = line.substr(68, 12);
-  Adcirc::CDate snap1 = dateFromOWIString(d1);
-  Adcirc::CDate snap2 = dateFromOWIString(d2);
-  long long dt = snap2.toSeconds() - snap1.toSeconds();
-  return std::make_tuple(dateStart, dateEnd, dt);
-}
-
-Adcirc::CDate dateFromOWIString(const std::string &str) {
-  int year, month, day, hour, minute, second;
-  minute = 0;
-  second = 0;
-  year = stoi(str.substr(0, 4));
-  month = stoi(str.substr(4, 2));
-  day = stoi(str.substr(6, 2));
-  hour = stoi(str.substr(8, 2));
-  if (str.size() == 12) minute = stoi(str.substr(10, 2));
-  return Adcirc::CDate(year, month, day, hour, minute, second);
+  return std::make_tuple(index.header().startDate(), index.header().endDate(),
+                         dt);
 }
 
 std::string toTidefacString(Adcirc::CDate &d) {
@@ -162,17 +162,25 @@ Locations generateHighWaterMarks(const HighWaterMarkOptions &options) {
   Locations loc(options.station(), options.field());
   loc.read();
 
-  size_t numNotFound = 0;
+  std::vector<double> x(loc.size()), y(loc.size());
   for (size_t i = 0; i < loc.size(); ++i) {
-    std::vector<double> weight;
-    size_t idx =
-        mesh.findElement(loc.location(i)->x(), loc.location(i)->y(), weight);
+    x[i] = loc.location(i)->x();
+    y[i] = loc.location(i)->y();
+  }
+
+  std::vector<double> weight;
+  std::vector<size_t> elements = mesh.findElements(x, y, weight);
 
+  size_t numNotFound = 0;
+  for (size_t i = 0; i < loc.size(); ++i) {
+    size_t idx = elements[i];
     if (idx == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
       numNotFound++;
       loc.location(i)->weighting()->found = false;
     } else {
-      loc.location(i)->weighting()->weight = {weight[0], weight[1], weight[2]};
+      const double *w =
+          &weight[i * Adcirc::Geometry::Mesh::MAX_NODES_PER_ELEMENT];
+      loc.location(i)->weighting()->weight = {w[0], w[1], w[2]};
       loc.location(i)->weighting()->node_index = {
           mesh.element(idx)->node(0)->id() - 1,
           mesh.element(idx)->node(1)->id() - 1,
@@ -157,13 +157,16 @@ int generateSubdomain(const std::string &meshFile,
   std::fill(nodeInside.begin(), nodeInside.end(), 0);
   std::fill(elementInside.begin(), elementInside.end(), 0);
 
-  subdomainTemplateMesh.buildElementalSearchTree();
+  std::vector<double> xc(globalMesh.numElements());
+  std::vector<double> yc(globalMesh.numElements());
+  for (size_t i = 0; i < globalMesh.numElements(); ++i) {
+    globalMesh.element(i)->getElementCenter(xc[i], yc[i]);
+  }
+  std::vector<size_t> found = subdomainTemplateMesh.findElements(xc, yc);
+
   for (size_t i = 0; i < globalMesh.numElements(); ++i) {
     Adcirc::Geometry::Element *e = globalMesh.element(i);
-    double x, y;
-    e->getElementCenter(x, y);
-    if (subdomainTemplateMesh.findElement(x, y) !=
-        Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
+    if (found[i] != Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
       elementInside[i] = 1;
       size_t n1 = globalMesh.nodeIndexById(e->node(0)->id());
       size_t n2 = globalMesh.nodeIndexById(e->node(1)->id());
@@ -257,12 +260,13 @@ int generateSubdomainOutput(Adcirc::Geometry::Mesh &subdomainMesh,
   ProgressBar progress(global.numSnaps());
   progress.begin();
 
-  for (size_t i = 0; i < global.numSnaps(); ++i) {
-    progress.tick();
-    global.read(i);
-    auto r = subsetRecord(translation_table, global.dataAt(0));
-    out.write(r.get());
-    global.clearAt(0);
+  {
+    Adcirc::Output::OutputSnapRange snaps(&global, 0, global.numSnaps());
+    for (auto &record : snaps) {
+      progress.tick();
+      auto r = subsetRecord(translation_table, &record);
+      out.write(r.get());
+    }
   }
   progress.end();
 